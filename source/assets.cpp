@@ -0,0 +1,37 @@
+//
+// Assets - data/ files linked into the executable
+//
+// The arrays, and the table of them, are in assets_data.h, which
+// tools/embed_assets.py makes from data/, as a build step.
+//
+#include "assets.h"
+
+#include <string.h>
+
+#include "assets_data.h"
+
+//------------------------------------------------------------------------------
+
+const Asset* FindAsset(const char* pName)
+{
+	for (size_t idx = 0; idx < SDL_arraysize(s_assets); ++idx)
+	{
+		if (0 == strcmp(s_assets[ idx ].m_pName, pName))
+			return &s_assets[ idx ];
+	}
+
+	return nullptr;
+}
+
+SDL_RWops* OpenAsset(const char* pName)
+{
+	const Asset* pAsset = FindAsset(pName);
+
+	if (nullptr == pAsset)
+	{
+		SDL_SetError("OpenAsset: no asset named %s", pName);
+		return nullptr;
+	}
+
+	return SDL_RWFromConstMem(pAsset->m_pData, (int)pAsset->m_size);
+}
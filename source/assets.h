@@ -0,0 +1,26 @@
+//
+// Assets - data/ files linked into the executable
+//
+// The UI font, and the toolbar buttons used to be loaded out of .\data\,
+// relative to wherever the app was started from.  Now they can't go
+// missing, and there's no file to open before the first frame.
+//
+#ifndef ASSETS_H_
+#define ASSETS_H_
+
+#include <SDL.h>
+
+struct Asset
+{
+	const char* m_pName;          // file name, as it is in data/
+	const unsigned char* m_pData;
+	size_t m_size;
+};
+
+// nullptr if there's no asset by that name
+const Asset* FindAsset(const char* pName);
+
+// Read only SDL_RWops, over the asset's bytes, for IMG_Load_RW and friends
+SDL_RWops* OpenAsset(const char* pName);
+
+#endif // ASSETS_H_
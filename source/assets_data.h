@@ -0,0 +1,4784 @@
+//
+// Assets Data - generated by tools/embed_assets.py from the files in
+// data/, don't edit it, run the script
+//
+
+// data/ShastonHi640.ttf, 73276 bytes
+static const unsigned char ShastonHi640_ttf[] = {
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x03, 0x00, 0x20, 0x4f, 0x53, 0x2f, 0x32,
+  0x54, 0xde, 0x5a, 0xe6, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+  0x9a, 0x68, 0x7e, 0x9a, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x01, 0x4c, 0x67, 0x6c, 0x79, 0x66,
+  0xff, 0x7f, 0x8e, 0x6a, 0x00, 0x00, 0x0f, 0xd8, 0x00, 0x01, 0x00, 0xd0, 0x68, 0x65, 0x61, 0x64,
+  0xfe, 0x82, 0xdf, 0xd8, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+  0x17, 0x72, 0x0d, 0x59, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+  0xe7, 0xf3, 0x42, 0x44, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x06, 0x80, 0x6c, 0x6f, 0x63, 0x61,
+  0x00, 0xc9, 0x71, 0xc8, 0x00, 0x00, 0x09, 0x54, 0x00, 0x00, 0x06, 0x84, 0x6d, 0x61, 0x78, 0x70,
+  0x01, 0xb5, 0x00, 0x92, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x7e, 0x54, 0x14, 0x88, 0x00, 0x01, 0x10, 0xa8, 0x00, 0x00, 0x04, 0xa0, 0x70, 0x6f, 0x73, 0x74,
+  0x85, 0xfb, 0x8c, 0xcf, 0x00, 0x01, 0x15, 0x48, 0x00, 0x00, 0x08, 0xf4, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xbe, 0x9b, 0xed, 0x11, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x03, 0x0c, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xc9, 0x76, 0xc6, 0x79, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x76, 0xc6, 0x79,
+  0xff, 0x9c, 0xfe, 0x70, 0x0c, 0xe4, 0x0a, 0xf0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0a, 0xf0, 0xfe, 0x70, 0x00, 0x00, 0x0d, 0x48,
+  0xff, 0x9c, 0x00, 0x00, 0x0c, 0xe4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa0, 0x00, 0x01, 0x00, 0x00, 0x01, 0xa0, 0x00, 0x90,
+  0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x20, 0x01, 0xf4, 0x00, 0x05,
+  0x00, 0x00, 0x06, 0x40, 0x0c, 0x80, 0x00, 0x00, 0x06, 0x40, 0x06, 0x40, 0x0c, 0x80, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0xaf, 0x50, 0x00, 0xa0, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4b, 0x42, 0x6e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x07, 0x0a, 0xf0, 0xfe, 0x70,
+  0x00, 0x00, 0x0a, 0xf0, 0x01, 0x90, 0x20, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0,
+  0x0a, 0xf0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x04, 0xb0, 0x01, 0x90, 0x06, 0x40, 0x01, 0x2c,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x64, 0x07, 0x08, 0x00, 0xc8,
+  0x04, 0xb0, 0x01, 0x90, 0x05, 0x78, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x05, 0x78, 0x00, 0x64,
+  0x06, 0x40, 0x00, 0xc8, 0x03, 0xe8, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8, 0x03, 0x20, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x03, 0x20, 0x00, 0xc8,
+  0x03, 0xe8, 0x01, 0x2c, 0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x01, 0x2c,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8,
+  0x07, 0x08, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x07, 0x08, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x07, 0x08, 0x00, 0x64,
+  0x07, 0x08, 0x00, 0x64, 0x06, 0x40, 0x00, 0x64, 0x06, 0x40, 0x00, 0x64, 0x06, 0x40, 0x00, 0xc8,
+  0x04, 0xb0, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x64, 0x04, 0xb0, 0x00, 0xc8, 0x06, 0x40, 0x01, 0x2c,
+  0x06, 0x40, 0x00, 0x00, 0x03, 0xe8, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x01, 0xf4, 0x07, 0x08, 0x00, 0x64, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x01, 0x2c,
+  0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x07, 0x08, 0x00, 0xc8,
+  0x07, 0x08, 0x00, 0x64, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x01, 0x2c,
+  0x06, 0x40, 0x00, 0xc8, 0x04, 0xb0, 0x01, 0x90, 0x06, 0x40, 0x00, 0xc8, 0x07, 0x08, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x04, 0xb0, 0x01, 0x90, 0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x64, 0x06, 0x40, 0x00, 0xc8, 0x04, 0xb0, 0x01, 0x90, 0x06, 0x40, 0x00, 0xc8,
+  0x04, 0xb0, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x64,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0xc8,
+  0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x03, 0xe8, 0x00, 0x64, 0x03, 0xe8, 0x00, 0xc8,
+  0x05, 0x78, 0x01, 0x90, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x03, 0x20, 0x00, 0xc8,
+  0x03, 0x20, 0x01, 0x2c, 0x03, 0xe8, 0x00, 0x64, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x64,
+  0x06, 0x40, 0x00, 0x64, 0x06, 0x40, 0x00, 0x64, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x07, 0xd0, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x05, 0x78, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8,
+  0x04, 0xb0, 0x01, 0x2c, 0x04, 0xb0, 0x01, 0x2c, 0x04, 0xb0, 0x01, 0x2c, 0x04, 0xb0, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0x00, 0x07, 0x08, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x07, 0x08, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x07, 0x08, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x09, 0x60, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x04, 0xb0, 0x00, 0xc8, 0x04, 0xb0, 0x01, 0x2c, 0x04, 0xb0, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8,
+  0x07, 0x08, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x08, 0xfc, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x64, 0x04, 0xb0, 0x00, 0x64, 0x04, 0xb0, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0xc8,
+  0x04, 0xb0, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0xc8, 0x06, 0x40, 0x01, 0x2c, 0x04, 0xb0, 0x00, 0xc8,
+  0x04, 0xb0, 0x01, 0x2c, 0x04, 0xb0, 0x00, 0xc8, 0x08, 0x98, 0x00, 0xc8, 0x07, 0x08, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x07, 0x08, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x01, 0xf4, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x01, 0xf4, 0x06, 0x40, 0x00, 0xc8, 0x07, 0xd0, 0x01, 0xf4, 0x06, 0x40, 0x00, 0xc8,
+  0x07, 0xd0, 0x01, 0xf4, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x01, 0xf4, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x07, 0xd0, 0x00, 0xc8, 0x09, 0x60, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x01, 0x2c,
+  0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c,
+  0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x01, 0x2c,
+  0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x08, 0x98, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x07, 0x08, 0x00, 0x64, 0x07, 0x08, 0x00, 0x64, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c,
+  0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c, 0x05, 0x78, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0xc8,
+  0x05, 0x78, 0x01, 0x90, 0x05, 0x78, 0x01, 0xf4, 0x04, 0xb0, 0x00, 0xc8, 0x04, 0xb0, 0x01, 0xf4,
+  0x05, 0x78, 0x01, 0x2c, 0x03, 0x20, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8, 0x07, 0x08, 0x01, 0x90,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x64, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x03, 0xe8, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x07, 0x08, 0x01, 0x90, 0x06, 0x40, 0x00, 0x00, 0x03, 0xe8, 0x01, 0x2c, 0x03, 0xe8, 0x00, 0xc8,
+  0x03, 0xe8, 0x00, 0xc8, 0x03, 0xe8, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x01, 0x2c, 0x06, 0x40, 0x01, 0x2c,
+  0x05, 0x78, 0x01, 0x90, 0x05, 0x78, 0x01, 0x90, 0x03, 0x20, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0x03, 0x20, 0x00, 0xc8, 0x09, 0xc4, 0x00, 0x64, 0x0d, 0x48, 0x00, 0x64,
+  0x03, 0x84, 0x00, 0x64, 0x03, 0x84, 0x00, 0x64, 0x07, 0x08, 0x01, 0x90, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0xc8, 0x08, 0x98, 0x01, 0x2c,
+  0x08, 0x98, 0x01, 0x2c, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x05, 0x78, 0x00, 0x64, 0x05, 0x78, 0x00, 0x64, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8, 0x06, 0x40, 0x00, 0xc8,
+  0x06, 0x40, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x05, 0x78, 0x00, 0xc8, 0x05, 0x78, 0xff, 0x9c,
+  0x07, 0x08, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x64, 0x06, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0x07, 0x08, 0x00, 0xc8, 0x06, 0x40, 0x00, 0x64, 0x09, 0x60, 0x00, 0xc8,
+  0x09, 0x60, 0x01, 0xf4, 0x07, 0x08, 0x00, 0xc8, 0x07, 0xd0, 0x00, 0xc8, 0x05, 0x78, 0xff, 0x9c,
+  0x07, 0x08, 0x00, 0xc8, 0x07, 0x08, 0x00, 0xc8, 0x08, 0x98, 0x00, 0xc8, 0x07, 0xd0, 0x00, 0xc8,
+  0x08, 0x98, 0x00, 0xc8, 0x0a, 0xf0, 0x01, 0x2c, 0x0b, 0xb8, 0x01, 0x2c, 0x09, 0x60, 0x01, 0x2c,
+  0x0a, 0xf0, 0x01, 0x2c, 0x0a, 0xf0, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x01, 0x38,
+  0x00, 0x00, 0x00, 0x4a, 0x00, 0x40, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x7e, 0x01, 0x7f,
+  0x01, 0x92, 0x02, 0x37, 0x02, 0xc7, 0x02, 0xcb, 0x02, 0xdd, 0x03, 0xa9, 0x03, 0xc0, 0x20, 0x27,
+  0x20, 0x31, 0x20, 0x3a, 0x20, 0x3d, 0x20, 0x44, 0x20, 0xac, 0x21, 0x17, 0x21, 0x20, 0x21, 0x22,
+  0x21, 0x27, 0x22, 0x02, 0x22, 0x07, 0x22, 0x11, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x49, 0x22, 0x65,
+  0x23, 0x18, 0x23, 0x25, 0x25, 0xc7, 0x25, 0xca, 0x27, 0x13, 0xf7, 0x05, 0xf8, 0x13, 0xf8, 0xff,
+  0xfb, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa0, 0x01, 0x92, 0x02, 0x37,
+  0x02, 0xc6, 0x02, 0xca, 0x02, 0xd8, 0x03, 0xa9, 0x03, 0xc0, 0x20, 0x10, 0x20, 0x30, 0x20, 0x39,
+  0x20, 0x3c, 0x20, 0x44, 0x20, 0xac, 0x21, 0x17, 0x21, 0x20, 0x21, 0x22, 0x21, 0x26, 0x22, 0x02,
+  0x22, 0x06, 0x22, 0x0f, 0x22, 0x1a, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x23, 0x18, 0x23, 0x25,
+  0x25, 0xc6, 0x25, 0xca, 0x27, 0x13, 0xf7, 0x00, 0xf8, 0x12, 0xf8, 0xff, 0xfb, 0x00, 0xff, 0xff,
+  0x00, 0x01, 0xff, 0xe3, 0xff, 0xc2, 0xff, 0xb0, 0xff, 0x0c, 0xfe, 0x7e, 0xfe, 0x7c, 0xfe, 0x70,
+  0xfd, 0xa5, 0xfd, 0x8f, 0xe1, 0x40, 0xe1, 0x38, 0xe1, 0x31, 0xe1, 0x30, 0xe1, 0x2a, 0xe0, 0xc3,
+  0xe0, 0x59, 0xe0, 0x51, 0xe0, 0x50, 0xe0, 0x4d, 0xdf, 0x73, 0xdf, 0x70, 0xdf, 0x69, 0xdf, 0x61,
+  0xdf, 0x55, 0xdf, 0x39, 0xdf, 0x23, 0xde, 0x71, 0xde, 0x65, 0xdb, 0xc5, 0xdb, 0xc3, 0xda, 0x7b,
+  0x0a, 0x8f, 0x09, 0x83, 0x08, 0x98, 0x06, 0x98, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
+  0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xdc,
+  0x00, 0x00, 0x01, 0x70, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x04, 0x24, 0x00, 0x00, 0x05, 0x70,
+  0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x06, 0x20, 0x00, 0x00, 0x06, 0xb0, 0x00, 0x00, 0x07, 0xb0,
+  0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x08, 0x60,
+  0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x09, 0xb4, 0x00, 0x00, 0x09, 0xfc, 0x00, 0x00, 0x0a, 0xe4,
+  0x00, 0x00, 0x0b, 0xc4, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x9c, 0x00, 0x00, 0x0d, 0x58,
+  0x00, 0x00, 0x0d, 0xe0, 0x00, 0x00, 0x0e, 0xe4, 0x00, 0x00, 0x0f, 0xa0, 0x00, 0x00, 0x0f, 0xd4,
+  0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x10, 0xe8, 0x00, 0x00, 0x11, 0x1c, 0x00, 0x00, 0x11, 0xec,
+  0x00, 0x00, 0x12, 0x98, 0x00, 0x00, 0x13, 0xb4, 0x00, 0x00, 0x14, 0x28, 0x00, 0x00, 0x14, 0xcc,
+  0x00, 0x00, 0x15, 0x6c, 0x00, 0x00, 0x15, 0xd0, 0x00, 0x00, 0x16, 0x10, 0x00, 0x00, 0x16, 0x48,
+  0x00, 0x00, 0x16, 0xf0, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x17, 0x70, 0x00, 0x00, 0x17, 0xd0,
+  0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x18, 0xe8, 0x00, 0x00, 0x19, 0xa8, 0x00, 0x00, 0x1a, 0x48,
+  0x00, 0x00, 0x1a, 0xdc, 0x00, 0x00, 0x1b, 0x48, 0x00, 0x00, 0x1b, 0xfc, 0x00, 0x00, 0x1c, 0xb0,
+  0x00, 0x00, 0x1d, 0x90, 0x00, 0x00, 0x1d, 0xc0, 0x00, 0x00, 0x1e, 0x20, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x1f, 0xa0, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0xb0, 0x00, 0x00, 0x22, 0x60,
+  0x00, 0x00, 0x22, 0x90, 0x00, 0x00, 0x23, 0x70, 0x00, 0x00, 0x23, 0xa0, 0x00, 0x00, 0x24, 0x10,
+  0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x24, 0x78, 0x00, 0x00, 0x24, 0xf4, 0x00, 0x00, 0x25, 0x88,
+  0x00, 0x00, 0x26, 0x28, 0x00, 0x00, 0x26, 0xbc, 0x00, 0x00, 0x27, 0x60, 0x00, 0x00, 0x27, 0xb8,
+  0x00, 0x00, 0x28, 0x84, 0x00, 0x00, 0x28, 0xe4, 0x00, 0x00, 0x29, 0x30, 0x00, 0x00, 0x29, 0xac,
+  0x00, 0x00, 0x2a, 0x5c, 0x00, 0x00, 0x2a, 0x94, 0x00, 0x00, 0x2b, 0x14, 0x00, 0x00, 0x2b, 0x74,
+  0x00, 0x00, 0x2c, 0x08, 0x00, 0x00, 0x2c, 0x9c, 0x00, 0x00, 0x2d, 0x30, 0x00, 0x00, 0x2d, 0x88,
+  0x00, 0x00, 0x2e, 0x28, 0x00, 0x00, 0x2e, 0x88, 0x00, 0x00, 0x2e, 0xe8, 0x00, 0x00, 0x2f, 0x98,
+  0x00, 0x00, 0x30, 0x28, 0x00, 0x00, 0x31, 0x08, 0x00, 0x00, 0x31, 0xa0, 0x00, 0x00, 0x32, 0x30,
+  0x00, 0x00, 0x32, 0xe0, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0xb0, 0x00, 0x00, 0x34, 0x48,
+  0x00, 0x00, 0x34, 0x48, 0x00, 0x00, 0x34, 0x7c, 0x00, 0x00, 0x35, 0x2c, 0x00, 0x00, 0x35, 0xd4,
+  0x00, 0x00, 0x36, 0xe8, 0x00, 0x00, 0x37, 0xe8, 0x00, 0x00, 0x38, 0x1c, 0x00, 0x00, 0x39, 0x48,
+  0x00, 0x00, 0x39, 0x7c, 0x00, 0x00, 0x3a, 0x0c, 0x00, 0x00, 0x3a, 0x98, 0x00, 0x00, 0x3b, 0xcc,
+  0x00, 0x00, 0x3b, 0xf4, 0x00, 0x00, 0x3c, 0x14, 0x00, 0x00, 0x3c, 0x90, 0x00, 0x00, 0x3c, 0xb0,
+  0x00, 0x00, 0x3d, 0x24, 0x00, 0x00, 0x3d, 0x78, 0x00, 0x00, 0x3d, 0xf0, 0x00, 0x00, 0x3e, 0x70,
+  0x00, 0x00, 0x3e, 0xbc, 0x00, 0x00, 0x3f, 0x2c, 0x00, 0x00, 0x3f, 0xb8, 0x00, 0x00, 0x3f, 0xd8,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x48, 0x00, 0x00, 0x40, 0xec, 0x00, 0x00, 0x42, 0x20,
+  0x00, 0x00, 0x43, 0x5c, 0x00, 0x00, 0x44, 0xd4, 0x00, 0x00, 0x46, 0x5c, 0x00, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x47, 0xa0, 0x00, 0x00, 0x48, 0x40, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x49, 0xf0,
+  0x00, 0x00, 0x4a, 0x88, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x4b, 0xd4, 0x00, 0x00, 0x4c, 0x8c,
+  0x00, 0x00, 0x4c, 0xf8, 0x00, 0x00, 0x4d, 0x64, 0x00, 0x00, 0x4d, 0xf8, 0x00, 0x00, 0x4e, 0x5c,
+  0x00, 0x00, 0x4e, 0xd8, 0x00, 0x00, 0x4f, 0x54, 0x00, 0x00, 0x4f, 0xe8, 0x00, 0x00, 0x50, 0x4c,
+  0x00, 0x00, 0x50, 0xd0, 0x00, 0x00, 0x51, 0xcc, 0x00, 0x00, 0x52, 0x8c, 0x00, 0x00, 0x53, 0x4c,
+  0x00, 0x00, 0x54, 0x30, 0x00, 0x00, 0x55, 0x3c, 0x00, 0x00, 0x55, 0xf4, 0x00, 0x00, 0x56, 0xd4,
+  0x00, 0x00, 0x57, 0xd0, 0x00, 0x00, 0x58, 0x5c, 0x00, 0x00, 0x58, 0xe8, 0x00, 0x00, 0x59, 0x9c,
+  0x00, 0x00, 0x5a, 0x20, 0x00, 0x00, 0x5a, 0xdc, 0x00, 0x00, 0x5b, 0x50, 0x00, 0x00, 0x5c, 0x54,
+  0x00, 0x00, 0x5d, 0x0c, 0x00, 0x00, 0x5d, 0xc4, 0x00, 0x00, 0x5e, 0x90, 0x00, 0x00, 0x5f, 0x84,
+  0x00, 0x00, 0x60, 0x24, 0x00, 0x00, 0x61, 0x08, 0x00, 0x00, 0x62, 0x14, 0x00, 0x00, 0x62, 0xcc,
+  0x00, 0x00, 0x63, 0x9c, 0x00, 0x00, 0x64, 0x6c, 0x00, 0x00, 0x65, 0x60, 0x00, 0x00, 0x66, 0x28,
+  0x00, 0x00, 0x66, 0x9c, 0x00, 0x00, 0x67, 0x10, 0x00, 0x00, 0x67, 0x9c, 0x00, 0x00, 0x67, 0xf8,
+  0x00, 0x00, 0x68, 0xc4, 0x00, 0x00, 0x69, 0xa0, 0x00, 0x00, 0x6a, 0x60, 0x00, 0x00, 0x6b, 0x20,
+  0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x6d, 0xc8, 0x00, 0x00, 0x6e, 0x0c,
+  0x00, 0x00, 0x6e, 0xf8, 0x00, 0x00, 0x6f, 0x84, 0x00, 0x00, 0x70, 0x10, 0x00, 0x00, 0x70, 0xc4,
+  0x00, 0x00, 0x71, 0x48, 0x00, 0x00, 0x72, 0x0c, 0x00, 0x00, 0x72, 0xa0, 0x00, 0x00, 0x73, 0x5c,
+  0x00, 0x00, 0x73, 0xe0, 0x00, 0x00, 0x74, 0x6c, 0x00, 0x00, 0x75, 0x10, 0x00, 0x00, 0x75, 0xbc,
+  0x00, 0x00, 0x76, 0x40, 0x00, 0x00, 0x76, 0xd4, 0x00, 0x00, 0x77, 0xa0, 0x00, 0x00, 0x78, 0x6c,
+  0x00, 0x00, 0x79, 0x60, 0x00, 0x00, 0x7a, 0x54, 0x00, 0x00, 0x7b, 0x08, 0x00, 0x00, 0x7b, 0xbc,
+  0x00, 0x00, 0x7c, 0xb0, 0x00, 0x00, 0x7d, 0xa4, 0x00, 0x00, 0x7e, 0x58, 0x00, 0x00, 0x7f, 0x1c,
+  0x00, 0x00, 0x7f, 0xa0, 0x00, 0x00, 0x80, 0x54, 0x00, 0x00, 0x80, 0xa8, 0x00, 0x00, 0x81, 0x5c,
+  0x00, 0x00, 0x81, 0xd0, 0x00, 0x00, 0x82, 0xa4, 0x00, 0x00, 0x82, 0xf8, 0x00, 0x00, 0x83, 0xac,
+  0x00, 0x00, 0x84, 0x04, 0x00, 0x00, 0x84, 0xc0, 0x00, 0x00, 0x85, 0x54, 0x00, 0x00, 0x86, 0x48,
+  0x00, 0x00, 0x87, 0x34, 0x00, 0x00, 0x88, 0x50, 0x00, 0x00, 0x89, 0x1c, 0x00, 0x00, 0x8a, 0x18,
+  0x00, 0x00, 0x8a, 0xc4, 0x00, 0x00, 0x8b, 0xa0, 0x00, 0x00, 0x8c, 0x60, 0x00, 0x00, 0x8d, 0x4c,
+  0x00, 0x00, 0x8d, 0xe0, 0x00, 0x00, 0x8e, 0x94, 0x00, 0x00, 0x8f, 0x08, 0x00, 0x00, 0x8f, 0x88,
+  0x00, 0x00, 0x90, 0x44, 0x00, 0x00, 0x90, 0xf8, 0x00, 0x00, 0x91, 0x4c, 0x00, 0x00, 0x91, 0x98,
+  0x00, 0x00, 0x92, 0x0c, 0x00, 0x00, 0x92, 0x78, 0x00, 0x00, 0x92, 0xd0, 0x00, 0x00, 0x93, 0x34,
+  0x00, 0x00, 0x93, 0x88, 0x00, 0x00, 0x93, 0xc0, 0x00, 0x00, 0x94, 0x54, 0x00, 0x00, 0x94, 0xf8,
+  0x00, 0x00, 0x95, 0xac, 0x00, 0x00, 0x96, 0x68, 0x00, 0x00, 0x97, 0x7c, 0x00, 0x00, 0x98, 0x50,
+  0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 0x54, 0x00, 0x00, 0x99, 0xb8, 0x00, 0x00, 0x99, 0xf8,
+  0x00, 0x00, 0x9a, 0x48, 0x00, 0x00, 0x9a, 0xc4, 0x00, 0x00, 0x9b, 0x30, 0x00, 0x00, 0x9b, 0x6c,
+  0x00, 0x00, 0x9b, 0xb8, 0x00, 0x00, 0x9c, 0x10, 0x00, 0x00, 0x9c, 0x78, 0x00, 0x00, 0x9d, 0x24,
+  0x00, 0x00, 0x9d, 0xb0, 0x00, 0x00, 0x9e, 0x74, 0x00, 0x00, 0x9e, 0xf8, 0x00, 0x00, 0x9f, 0xcc,
+  0x00, 0x00, 0xa0, 0x80, 0x00, 0x00, 0xa1, 0x04, 0x00, 0x00, 0xa1, 0xbc, 0x00, 0x00, 0xa2, 0x3c,
+  0x00, 0x00, 0xa2, 0xe0, 0x00, 0x00, 0xa3, 0x84, 0x00, 0x00, 0xa4, 0x48, 0x00, 0x00, 0xa5, 0x0c,
+  0x00, 0x00, 0xa5, 0xf8, 0x00, 0x00, 0xa6, 0xe4, 0x00, 0x00, 0xa7, 0x98, 0x00, 0x00, 0xa8, 0x8c,
+  0x00, 0x00, 0xa9, 0x54, 0x00, 0x00, 0xa9, 0xd8, 0x00, 0x00, 0xaa, 0xac, 0x00, 0x00, 0xab, 0x28,
+  0x00, 0x00, 0xac, 0x14, 0x00, 0x00, 0xac, 0xc0, 0x00, 0x00, 0xad, 0x8c, 0x00, 0x00, 0xae, 0x58,
+  0x00, 0x00, 0xaf, 0x4c, 0x00, 0x00, 0xb0, 0x40, 0x00, 0x00, 0xb1, 0x38, 0x00, 0x00, 0xb1, 0xf0,
+  0x00, 0x00, 0xb2, 0xe4, 0x00, 0x00, 0xb3, 0xd8, 0x00, 0x00, 0xb4, 0x20, 0x00, 0x00, 0xb4, 0x98,
+  0x00, 0x00, 0xb5, 0x1c, 0x00, 0x00, 0xb5, 0xb0, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb6, 0x80,
+  0x00, 0x00, 0xb7, 0x5c, 0x00, 0x00, 0xb8, 0x38, 0x00, 0x00, 0xb8, 0xac, 0x00, 0x00, 0xb9, 0x20,
+  0x00, 0x00, 0xb9, 0xb4, 0x00, 0x00, 0xba, 0x48, 0x00, 0x00, 0xba, 0xf0, 0x00, 0x00, 0xbb, 0xb8,
+  0x00, 0x00, 0xbc, 0x70, 0x00, 0x00, 0xbd, 0x28, 0x00, 0x00, 0xbd, 0xa0, 0x00, 0x00, 0xbe, 0x18,
+  0x00, 0x00, 0xbf, 0x0c, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0xc0, 0xd4, 0x00, 0x00, 0xc1, 0xc0,
+  0x00, 0x00, 0xc2, 0x74, 0x00, 0x00, 0xc3, 0x30, 0x00, 0x00, 0xc3, 0xec, 0x00, 0x00, 0xc4, 0x90,
+  0x00, 0x00, 0xc5, 0x34, 0x00, 0x00, 0xc6, 0x18, 0x00, 0x00, 0xc6, 0xfc, 0x00, 0x00, 0xc7, 0x44,
+  0x00, 0x00, 0xc7, 0xd4, 0x00, 0x00, 0xc8, 0x3c, 0x00, 0x00, 0xc8, 0x9c, 0x00, 0x00, 0xc8, 0xfc,
+  0x00, 0x00, 0xc9, 0x48, 0x00, 0x00, 0xc9, 0x94, 0x00, 0x00, 0xc9, 0xd4, 0x00, 0x00, 0xc9, 0xf4,
+  0x00, 0x00, 0xca, 0x6c, 0x00, 0x00, 0xca, 0x94, 0x00, 0x00, 0xcb, 0x1c, 0x00, 0x00, 0xcb, 0xa4,
+  0x00, 0x00, 0xcc, 0x74, 0x00, 0x00, 0xcd, 0x24, 0x00, 0x00, 0xcd, 0x44, 0x00, 0x00, 0xcd, 0x64,
+  0x00, 0x00, 0xcd, 0x84, 0x00, 0x00, 0xcd, 0xa4, 0x00, 0x00, 0xcd, 0xc4, 0x00, 0x00, 0xcd, 0xe4,
+  0x00, 0x00, 0xce, 0x18, 0x00, 0x00, 0xce, 0x4c, 0x00, 0x00, 0xce, 0x8c, 0x00, 0x00, 0xce, 0xcc,
+  0x00, 0x00, 0xcf, 0x0c, 0x00, 0x00, 0xcf, 0x4c, 0x00, 0x00, 0xcf, 0xc0, 0x00, 0x00, 0xd0, 0x34,
+  0x00, 0x00, 0xd0, 0xa8, 0x00, 0x00, 0xd1, 0x1c, 0x00, 0x00, 0xd1, 0x7c, 0x00, 0x00, 0xd1, 0xfc,
+  0x00, 0x00, 0xd2, 0x1c, 0x00, 0x00, 0xd2, 0x5c, 0x00, 0x00, 0xd2, 0x7c, 0x00, 0x00, 0xd2, 0xb0,
+  0x00, 0x00, 0xd2, 0xf4, 0x00, 0x00, 0xd3, 0x14, 0x00, 0x00, 0xd5, 0x28, 0x00, 0x00, 0xd7, 0xa0,
+  0x00, 0x00, 0xd8, 0x40, 0x00, 0x00, 0xd8, 0xe0, 0x00, 0x00, 0xd9, 0x38, 0x00, 0x00, 0xd9, 0xd4,
+  0x00, 0x00, 0xda, 0xb4, 0x00, 0x00, 0xdb, 0x94, 0x00, 0x00, 0xdb, 0xf0, 0x00, 0x00, 0xdc, 0xc4,
+  0x00, 0x00, 0xdd, 0x68, 0x00, 0x00, 0xde, 0x38, 0x00, 0x00, 0xdf, 0x08, 0x00, 0x00, 0xdf, 0xdc,
+  0x00, 0x00, 0xe0, 0x90, 0x00, 0x00, 0xe1, 0x44, 0x00, 0x00, 0xe1, 0x84, 0x00, 0x00, 0xe1, 0xc4,
+  0x00, 0x00, 0xe2, 0xe0, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00, 0xe4, 0x64, 0x00, 0x00, 0xe5, 0x28,
+  0x00, 0x00, 0xe6, 0x0c, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe7, 0x84, 0x00, 0x00, 0xe8, 0x18,
+  0x00, 0x00, 0xe9, 0x08, 0x00, 0x00, 0xe9, 0x98, 0x00, 0x00, 0xe9, 0xdc, 0x00, 0x00, 0xea, 0x9c,
+  0x00, 0x00, 0xea, 0xf4, 0x00, 0x00, 0xeb, 0xa8, 0x00, 0x00, 0xec, 0x5c, 0x00, 0x00, 0xed, 0xcc,
+  0x00, 0x00, 0xee, 0xa8, 0x00, 0x00, 0xef, 0x88, 0x00, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0xf2, 0x70,
+  0x00, 0x00, 0xf3, 0x40, 0x00, 0x00, 0xf4, 0x6c, 0x00, 0x00, 0xf5, 0x58, 0x00, 0x00, 0xf5, 0x90,
+  0x00, 0x00, 0xf5, 0xe0, 0x00, 0x00, 0xf6, 0xdc, 0x00, 0x00, 0xf7, 0xd8, 0x00, 0x00, 0xf9, 0x48,
+  0x00, 0x00, 0xfa, 0x24, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfb, 0x90, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0x00, 0xfc, 0x74, 0x00, 0x00, 0xfd, 0x1c, 0x00, 0x00, 0xfd, 0xc8, 0x00, 0x00, 0xfe, 0x58,
+  0x00, 0x00, 0xff, 0x90, 0x00, 0x01, 0x00, 0xd0, 0x00, 0x03, 0x00, 0x00, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x0c, 0x80,
+  0x00, 0x00, 0xf3, 0x80, 0x07, 0xd0, 0x01, 0x90, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0xfb, 0x50, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x02, 0x01, 0x90,
+  0x00, 0x00, 0x02, 0xbc, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x09, 0x07, 0x02, 0xbc,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x01, 0x90,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x01, 0x90, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x01, 0x2c, 0x06, 0x40, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+  0x09, 0x07, 0x05, 0x14, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0xfc, 0x18, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfb, 0x50, 0x04, 0xb0, 0x00, 0x00,
+  0xfb, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x01, 0x90, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x1b,
+  0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x02, 0xbc, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x01, 0x2c,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x00, 0x09, 0x3b, 0x02, 0xbc, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x01, 0x90, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0xfd, 0xa8, 0x06, 0x40, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x64,
+  0x00, 0x00, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x33,
+  0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4b, 0x00, 0x4f, 0x00, 0x53,
+  0x00, 0x57, 0x00, 0x5b, 0x00, 0x5f, 0x00, 0x00, 0x09, 0x5f, 0x03, 0xe8, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x01, 0x2c, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x01, 0x90, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfe, 0x0c, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0xc8, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0xfd, 0xa8, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x08, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0xf9, 0xc0, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x05, 0x78, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfc, 0x18, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x06, 0x40, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x39, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x00, 0x09, 0x4d,
+  0x03, 0xe8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x07, 0x08, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0xfc, 0xe0, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x01, 0x01, 0x90, 0x06, 0x40, 0x02, 0xbc,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x01, 0x90, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x06, 0x40, 0x04, 0xb0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x07, 0xd0, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x00, 0xc8, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0x01, 0x90, 0x04, 0xb0,
+  0x09, 0x60, 0x00, 0x3b, 0x00, 0x00, 0x09, 0x3b, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x04, 0xb0, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x01, 0x00, 0xc8, 0x01, 0x90, 0x05, 0xdc,
+  0x09, 0x60, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x02, 0xbc, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xfe, 0xd4,
+  0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0xfe, 0x70, 0x02, 0xbc,
+  0x01, 0x90, 0x00, 0x07, 0x00, 0x00, 0x09, 0x07, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0xc8, 0x04, 0xb0, 0x05, 0x78,
+  0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x05, 0x78, 0xfb, 0x50, 0x00, 0x00, 0x04, 0xb0,
+  0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4,
+  0x01, 0x90, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0xdc,
+  0x0a, 0xf0, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x04, 0x4c, 0xfc, 0x7c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0xff, 0x9c, 0x00, 0x64, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x08, 0x98,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf7, 0x68,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0x08,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x01, 0x2c, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfb, 0xb4, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0xd0, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x35,
+  0x00, 0x00, 0x09, 0x35, 0x02, 0xbc, 0x02, 0xbc, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x00, 0xc8, 0x01, 0x2c,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfd, 0x44, 0x0a, 0xf0, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1f,
+  0x00, 0x00, 0x09, 0x1f, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1d,
+  0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d,
+  0x00, 0xc8, 0x04, 0xb0, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c, 0x0a, 0xf0, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x00, 0x09, 0x3b, 0x04, 0x4c, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0xfe, 0x0c, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c,
+  0xfd, 0x44, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x07, 0xd0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4,
+  0x07, 0xd0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x09, 0x07, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x07, 0xd0, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c,
+  0xfe, 0x70, 0x02, 0xbc, 0x07, 0xd0, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x02, 0xbc,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x04, 0xb0, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x4c, 0x0a, 0x28, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f,
+  0x04, 0x4c, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x03, 0x20, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+  0x09, 0x07, 0x05, 0x78, 0xfb, 0x50, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x04, 0xb0, 0x0a, 0x28, 0x00, 0x2f,
+  0x00, 0x00, 0x09, 0x2f, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x21,
+  0x00, 0x25, 0x00, 0x00, 0x09, 0x25, 0x04, 0x4c, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfa, 0x88, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x0a, 0x28, 0x00, 0x13, 0x00, 0x23, 0x00, 0x2f,
+  0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x00, 0x09, 0x3f, 0x01, 0x2c, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x9c, 0x03, 0x20, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x9c, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfe, 0x0c, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x07, 0xd0, 0x00, 0x00, 0xfa, 0x88,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0xfb, 0x50, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0xfc, 0xe0, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x0a, 0x28, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x04, 0x4c,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf6, 0xa0, 0x04, 0xb0,
+  0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23,
+  0x00, 0x00, 0x09, 0x23, 0x00, 0xc8, 0x03, 0x84, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x7c, 0x03, 0x84, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfa, 0x88, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x23,
+  0x00, 0x00, 0x09, 0x23, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x07,
+  0x00, 0x13, 0x00, 0x00, 0x09, 0x13, 0x03, 0xe8, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4, 0xfc, 0xe0, 0x03, 0x84, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0x18, 0x02, 0x58,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x09, 0x60,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x00, 0xc8, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0xfc, 0x18,
+  0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09, 0x00, 0xc8, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xfe, 0xd4, 0x0a, 0xf0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x25, 0x00, 0x00, 0x09, 0x25,
+  0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x04, 0x4c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x04, 0xb0, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x00, 0x09, 0x13, 0x05, 0x78, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x0a, 0xf0, 0xf6, 0xa0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x98, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x0a, 0xf0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x05, 0x00, 0x00, 0x09, 0x05, 0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x03, 0x84,
+  0x00, 0x00, 0xfb, 0x50, 0x0a, 0xf0, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b,
+  0x00, 0xc8, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23,
+  0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00,
+  0x09, 0x1f, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0d,
+  0x00, 0x15, 0x00, 0x00, 0x09, 0x15, 0x00, 0xc8, 0x03, 0x84, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfe, 0xd4, 0x03, 0x84, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x00, 0x64, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x08, 0x98,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x00,
+  0x09, 0x27, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0xfe, 0x70, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x0a, 0x28, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x1f,
+  0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x00, 0xc8, 0x03, 0x84, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x03, 0x84, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0x18,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0xdc,
+  0x0a, 0xf0, 0x00, 0x07, 0x00, 0x00, 0x09, 0x07, 0x00, 0xc8, 0x05, 0x14, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x0c, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xf6, 0xa0, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x00, 0x09, 0x13, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00,
+  0xf7, 0x68, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00,
+  0xf6, 0xa0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x06, 0xa4,
+  0x0a, 0xf0, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0xf7, 0x68, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0xf7, 0x68, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x53, 0x00, 0x00, 0x09, 0x53, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x07, 0xd0, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x05, 0xdc,
+  0x0a, 0xf0, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x01, 0x2c, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0xe0, 0x0a, 0xf0, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x03, 0xe8,
+  0x0a, 0xf0, 0x00, 0x07, 0x00, 0x00, 0x09, 0x07, 0x00, 0xc8, 0x03, 0x20, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfc, 0xe0, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x07, 0xd0, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x03, 0xe8,
+  0x0a, 0xf0, 0x00, 0x07, 0x00, 0x00, 0x09, 0x07, 0x00, 0xc8, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x0a, 0xf0, 0x00, 0x00, 0xf3, 0x80, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x07, 0xd0, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x07, 0xd0, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x01, 0x00, 0x00, 0xfe, 0x70, 0x06, 0x40,
+  0xff, 0x38, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x01, 0x00, 0xc8, 0x07, 0x08, 0x03, 0x20,
+  0x0a, 0xf0, 0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0xd4, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x00,
+  0x09, 0x19, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x00, 0xc8,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x03, 0x20, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x0a, 0xf0,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23,
+  0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00,
+  0x09, 0x1f, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x03, 0xe8, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x1b,
+  0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x01, 0x2c, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfd, 0x44, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0xc8,
+  0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x07, 0x08,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x11, 0x00, 0x00, 0x09, 0x11, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x09, 0x60, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x03, 0x00, 0x21, 0x00, 0x2d,
+  0x00, 0x00, 0x09, 0x2d, 0x03, 0xe8, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x64, 0xfd, 0x44,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0xff, 0x9c, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x00, 0x09, 0x13, 0x04, 0x4c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0x4c, 0x0a, 0xf0, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x04, 0x4c,
+  0xfc, 0x7c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x01, 0x2c, 0xfe, 0xd4, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x07, 0xd0,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x09, 0x19, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf8, 0x30, 0x09, 0x60, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x27,
+  0x00, 0x00, 0x09, 0x27, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0xf4, 0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x09,
+  0x00, 0x00, 0x09, 0x09, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x01, 0x90, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x64,
+  0x00, 0x00, 0x06, 0x40, 0x07, 0xd0, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x07, 0xd0, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x01, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x13, 0x00, 0x00, 0x09, 0x13, 0x04, 0x4c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x04, 0x4c,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00,
+  0x09, 0x1f, 0x04, 0x4c, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x09, 0x60,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0x02, 0x58, 0x00, 0xc8,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x14,
+  0x07, 0xd0, 0x00, 0x11, 0x00, 0x00, 0x09, 0x11, 0x01, 0x2c, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x07, 0xd0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x14, 0x07, 0xd0, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23,
+  0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x09, 0x60, 0x00, 0x13, 0x00, 0x00, 0x09, 0x13,
+  0x03, 0x20, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x09, 0x60, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x13, 0x00, 0x00, 0x09, 0x13,
+  0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf8, 0x30,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x07, 0xd0, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27,
+  0x04, 0x4c, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x06, 0x40, 0x07, 0xd0, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f,
+  0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33,
+  0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x21, 0x00, 0x00, 0x09, 0x21,
+  0x03, 0xe8, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x78,
+  0x07, 0xd0, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x01, 0x2c, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfb, 0xb4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0xa8, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x03, 0xe8, 0x01, 0x90, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x01, 0x90, 0xfe, 0x70, 0x02, 0xbc,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x02, 0xbc, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c,
+  0xfe, 0x70, 0x00, 0x00, 0x0c, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x00, 0xc8, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xd0, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x05, 0x14, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x08, 0x98, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x01, 0x90, 0x00, 0x00, 0x02, 0xbc, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+  0x09, 0x07, 0x02, 0xbc, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x27,
+  0x00, 0x00, 0x09, 0x27, 0x02, 0xbc, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x25,
+  0x00, 0x00, 0x09, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0x64,
+  0x00, 0xc8, 0x05, 0xdc, 0x08, 0x98, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x00, 0x09, 0x3f, 0x01, 0x2c,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x02, 0xbc, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x07, 0xd0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x3b, 0x00, 0x00, 0x09, 0x3b,
+  0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x02, 0x01, 0x90, 0xfe, 0x70, 0x02, 0xbc, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+  0x09, 0x07, 0x02, 0xbc, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x2c, 0x05, 0x78, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf3, 0x80, 0x00, 0x00, 0x05, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x39,
+  0x00, 0x45, 0x00, 0x00, 0x09, 0x45, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x03, 0xe8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x09, 0x60, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+  0x09, 0x07, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x03, 0xe8, 0x04, 0xb0, 0x0a, 0x28, 0x00, 0x1f,
+  0x00, 0x00, 0x09, 0x1f, 0x04, 0x4c, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x08, 0x98, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x03,
+  0x00, 0x13, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0xfe, 0x70, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0xfe, 0x0c, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x05, 0xdc, 0x07, 0x08, 0x00, 0x23, 0x00, 0x47, 0x00, 0x00,
+  0x09, 0x47, 0x02, 0xbc, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x01, 0x90, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x01, 0x90, 0x05, 0x78, 0x06, 0x40, 0x00, 0x05,
+  0x00, 0x00, 0x09, 0x05, 0x04, 0x4c, 0xfc, 0x7c, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfe, 0xd4,
+  0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x04, 0xb0, 0x05, 0x78, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x05, 0x78, 0xfb, 0x50,
+  0x00, 0x00, 0x04, 0xb0, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x04, 0xb0, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x09, 0x19, 0x00, 0xc8,
+  0x03, 0x84, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x01, 0x2c, 0x01, 0xf4, 0x00, 0x00,
+  0xfe, 0x0c, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x09, 0x60, 0x03, 0xe8,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x00, 0xc8, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0,
+  0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x04, 0xb0, 0x04, 0xb0,
+  0x0a, 0x28, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x04, 0x4c, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0xfd, 0xa8, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x08, 0x98, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x14, 0x08, 0x98, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x05, 0x14,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x04, 0x4c, 0x00, 0x00, 0x06, 0x40,
+  0xfe, 0x70, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0xf9, 0xc0, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x64, 0x06, 0x40, 0x03, 0x84, 0x0a, 0xf0, 0x00, 0x19, 0x00, 0x00, 0x09, 0x19,
+  0x00, 0xc8, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x40, 0x03, 0x84,
+  0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x01, 0x2c, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c,
+  0x07, 0x08, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x01, 0x90, 0x07, 0xd0, 0x03, 0x84,
+  0x0a, 0xf0, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x17,
+  0x00, 0x00, 0x09, 0x17, 0x03, 0xe8, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x02, 0x58, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x11,
+  0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d, 0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0xfb, 0x50, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xf3, 0x80, 0x00, 0x00, 0x04, 0xb0, 0x05, 0x78, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0xfb, 0x50, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x01, 0x00, 0xc8, 0x04, 0xb0, 0x01, 0xf4, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03,
+  0x01, 0xf4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x06, 0x40, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x01, 0x01, 0x2c, 0xfe, 0x70, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x09, 0x05,
+  0x01, 0xf4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x01, 0x00, 0x64, 0x06, 0x40, 0x03, 0x84,
+  0x0a, 0xf0, 0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x08, 0x98, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x23,
+  0x00, 0x00, 0x09, 0x23, 0x04, 0x4c, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0xfc, 0x18, 0x00, 0x00, 0x03, 0xe8, 0x08, 0x98, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xf5, 0x10, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x05, 0xdc, 0x07, 0x08, 0x00, 0x23,
+  0x00, 0x47, 0x00, 0x00, 0x09, 0x47, 0x04, 0x4c, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0xfe, 0xd4,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x64, 0x00, 0x00, 0x05, 0xdc,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39,
+  0x00, 0x3d, 0x00, 0x41, 0x00, 0x45, 0x00, 0x00, 0x09, 0x45, 0x04, 0x4c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0xfd, 0xa8, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfd, 0x44, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x03, 0x84,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x08, 0x98,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xf5, 0xd8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x08, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x64, 0x00, 0x00, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x03,
+  0x00, 0x1d, 0x00, 0x21, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x47,
+  0x00, 0x4b, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x00, 0x09, 0x53, 0x04, 0x4c, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xfd, 0xa8,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x08, 0x98, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x08,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf5, 0xd8, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x06, 0x40, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x3b,
+  0x00, 0x3f, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4b, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x57, 0x00, 0x00,
+  0x09, 0x57, 0x04, 0x4c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfd, 0xa8, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x01, 0x90, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x08, 0x98, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0xf6, 0xa0, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x05, 0x78, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0xfb, 0x50, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1f,
+  0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x98,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x00, 0x09, 0x21, 0x04, 0x4c,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xf9, 0xc0, 0x03, 0xe8, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x05, 0x78, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x00, 0x09, 0x21, 0x04, 0x4c,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xf9, 0xc0, 0x0a, 0xf0, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xf8, 0xf8,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x04, 0xb0,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b, 0x04, 0x4c, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xf9, 0xc0, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xf9, 0xc0, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x07, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b,
+  0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x03, 0x84, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0,
+  0x03, 0xe8, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x05, 0x78, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x04, 0x4c,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x09, 0x60,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf8, 0xf8, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x05, 0x78, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+  0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x04, 0x4c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0,
+  0x08, 0x98, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x02, 0x58, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0xfb, 0x50, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x02, 0x58, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x08,
+  0x0a, 0xf0, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x07, 0x08, 0xfe, 0x0c, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0xbc, 0xfa, 0xec, 0x01, 0xf4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x09, 0x60, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x03,
+  0x00, 0x0f, 0x00, 0x15, 0x00, 0x00, 0x09, 0x15, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xf8, 0x30, 0xfe, 0x70,
+  0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x15,
+  0x00, 0x00, 0x09, 0x15, 0x04, 0xb0, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0xfd, 0x44, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x04, 0x4c,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0xfc, 0x7c, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0x08, 0x98,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf6, 0xa0, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13,
+  0x00, 0x00, 0x09, 0x13, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfc, 0x18, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x09, 0x60, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0xf8, 0x30, 0xfe, 0x70, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x07, 0xd0, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0x01, 0x2c, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x0f, 0x00, 0x19, 0x00, 0x00, 0x09, 0x19, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfe, 0xd4, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x01, 0x90, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfc, 0x18, 0x06, 0x40, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x03, 0x01, 0x2c, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x19,
+  0x00, 0x00, 0x09, 0x19, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0x18,
+  0x07, 0x08, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x02, 0x01, 0x2c,
+  0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x01, 0x2c,
+  0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x07, 0xd0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13,
+  0x00, 0x00, 0x09, 0x13, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x09, 0x60, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f,
+  0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x00, 0xc8, 0x03, 0x84, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x84, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x0a, 0xf0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+  0x09, 0x37, 0x03, 0x20, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x01, 0x90, 0x00, 0xc8, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfa, 0x88, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x07, 0x08,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x23, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x07, 0xd0,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x09, 0x60,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x27, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0xf8, 0x30, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x07, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3b,
+  0x00, 0x00, 0x09, 0x3b, 0x04, 0xb0, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x0c, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x04, 0x4c, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfb, 0xb4, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x04, 0xb0, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x03, 0xe8, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0xfd, 0xa8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x01, 0x90, 0x05, 0x78, 0x09, 0x60, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x01, 0x2c, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x11, 0x00, 0x25, 0x00, 0x39, 0x00, 0x00, 0x09, 0x39,
+  0x04, 0xb0, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0xfe, 0x70, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d, 0x04, 0x4c, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x08, 0x98, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0x28, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00,
+  0x09, 0x27, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00,
+  0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x05, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x0a, 0xf0, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xf8, 0xf8, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x04, 0xb0, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f,
+  0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x03, 0x20, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x03, 0x20, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x19, 0x00, 0x3b, 0x00, 0x00, 0x09, 0x3b, 0x02, 0xbc, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x01, 0xf4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x07, 0x08, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x00,
+  0x09, 0x27, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x06, 0x40, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x01, 0x90,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f,
+  0x00, 0x19, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0xc8, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf8, 0x30,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x06, 0x40, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x2d,
+  0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8,
+  0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x07, 0x08, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x07, 0x00, 0xc8, 0x00, 0x00, 0x05, 0xdc,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x35,
+  0x00, 0x00, 0x09, 0x35, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x0c, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0xfb, 0xb4, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8,
+  0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xf8, 0xf8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x04, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x00,
+  0x09, 0x21, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x09, 0x60, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x21, 0x00, 0x25, 0x00, 0x2d,
+  0x00, 0x31, 0x00, 0x00, 0x09, 0x31, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x06, 0x40,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x03, 0x20,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x98, 0x07, 0xd0, 0x00, 0x07, 0x00, 0x33, 0x00, 0x3d,
+  0x00, 0x00, 0x09, 0x3d, 0x07, 0xd0, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x02, 0x58, 0xfc, 0x18, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0xbc,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x02, 0x58, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x01, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1b,
+  0x00, 0x23, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x2d, 0x01, 0x2c, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0xc8, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1b,
+  0x00, 0x23, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x2d, 0x01, 0x2c, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0xc8, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x07, 0x08, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0xf8, 0x30, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b, 0x01, 0x2c,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfc, 0x7c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x03, 0x84, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0x44,
+  0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x64,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x08, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x09, 0x00, 0x13, 0x00, 0x17,
+  0x00, 0x00, 0x09, 0x17, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x03, 0x20, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0x30, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfa, 0x88, 0x06, 0x40, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x03, 0x01, 0x2c, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x09,
+  0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x01, 0x2c, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x07, 0x08, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x03, 0xe8, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8,
+  0x0a, 0xf0, 0x00, 0x09, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d, 0x01, 0x2c, 0x01, 0xf4, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x02, 0x58, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x11, 0x00, 0x00, 0x09, 0x11, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x09, 0x60, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xf9, 0xc0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1d, 0x00, 0x29, 0x00, 0x2d,
+  0x00, 0x00, 0x09, 0x2d, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x38, 0x06, 0x40, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x06, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b,
+  0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x09, 0x60,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x07, 0xd0, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x09, 0x60, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0xf8, 0x30, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x07, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33,
+  0x00, 0x37, 0x00, 0x3b, 0x00, 0x00, 0x09, 0x3b, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xfc, 0x7c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x04, 0x4c, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0xf8, 0xf8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x08, 0x98, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x04, 0x4c,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x07, 0xd0,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x01, 0x90, 0x04, 0xb0, 0x09, 0x60, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+  0x00, 0x00, 0x09, 0x0b, 0x04, 0xb0, 0xfc, 0x18, 0x00, 0x00, 0x03, 0xe8, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0xf9, 0xc0, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x03, 0x01, 0x2c, 0x00, 0x00, 0x05, 0xdc, 0x07, 0xd0, 0x00, 0x0d,
+  0x00, 0x19, 0x00, 0x35, 0x00, 0x00, 0x09, 0x35, 0x02, 0xbc, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x03, 0xe8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1d,
+  0x00, 0x00, 0x09, 0x1d, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x98, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d,
+  0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf8, 0x30,
+  0x00, 0x00, 0x00, 0xc8, 0x0a, 0x28, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0xfd, 0xa8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00,
+  0x00, 0xc8, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b,
+  0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0xfd, 0xa8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8,
+  0x08, 0x98, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2b,
+  0x00, 0x00, 0x09, 0x2b, 0x03, 0xe8, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0xe8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x0a, 0xf0, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x09, 0x60, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x04, 0x4c, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x21, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x03, 0xe8, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f,
+  0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x04, 0x4c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0,
+  0x09, 0x60, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf8, 0xf8, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d, 0x03, 0xe8, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x02, 0xbc, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x09, 0x60, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f,
+  0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x04, 0x4c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0,
+  0x09, 0x60, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x00, 0x09, 0x25, 0x03, 0xe8, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xf8, 0x30, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x04, 0x4c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x02, 0x58, 0xfe, 0x70,
+  0x04, 0xb0, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x0a, 0x28, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x07, 0xd0, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x84,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x23, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x2d,
+  0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x0a, 0x28, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0xfd, 0xa8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x23, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x2d, 0x04, 0x4c, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x0a, 0x28, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x23,
+  0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x23, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x04, 0x4c,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+  0x09, 0x27, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x23,
+  0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x23, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27,
+  0x03, 0xe8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50,
+  0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xf5, 0x10, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x34, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x2b,
+  0x00, 0x00, 0x09, 0x2b, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xf5, 0x10, 0x01, 0x90, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x04, 0xb0, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0f,
+  0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x00, 0xc8, 0x03, 0x84, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x84, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x0a, 0xf0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x04, 0xb0,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x01, 0x90,
+  0xfe, 0x70, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x09, 0x60, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x27,
+  0x00, 0x00, 0x09, 0x27, 0x01, 0x2c, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x03, 0x84, 0xfc, 0xe0,
+  0x00, 0x00, 0x03, 0x20, 0xfd, 0x44, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x07, 0x08, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x04, 0xb0, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x09, 0x60,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f, 0x01, 0x2c, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x03, 0x84, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0x44, 0x02, 0x58,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x07, 0x08, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x03, 0x20,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x90, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x09, 0x60,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf6, 0xa0, 0xfe, 0x70, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x27,
+  0x00, 0x00, 0x09, 0x27, 0x01, 0x2c, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0xc8, 0x02, 0x58,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x01, 0x90, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x07, 0x08, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x11,
+  0x00, 0x00, 0x09, 0x11, 0x00, 0xc8, 0x03, 0xe8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x21, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x01, 0x2c,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfc, 0x7c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0xc8, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x07, 0x08, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x02, 0xbc,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x0a, 0xf0, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37,
+  0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x0a, 0x28, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xf8, 0x30, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x21, 0x00, 0x35, 0x00, 0x00,
+  0x09, 0x35, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x21, 0x00, 0x35, 0x00, 0x41, 0x00, 0x00, 0x09, 0x41,
+  0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0xf0, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x2d, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x64,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x21,
+  0x00, 0x2d, 0x00, 0x39, 0x00, 0x00, 0x09, 0x39, 0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x64, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x0a, 0x28, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf7, 0x68, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x21, 0x00, 0x25, 0x00, 0x00,
+  0x09, 0x25, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x00, 0x09, 0x31,
+  0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0xfe, 0x0c, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x01, 0x2c, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b, 0x04, 0x4c, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x00, 0x09, 0x35, 0x04, 0x4c, 0xfd, 0x44,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0xfe, 0x0c, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0x05, 0x78, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x04, 0x4c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0x07, 0xd0, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xf8, 0x30, 0x0a, 0x28,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfb, 0x50, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x04, 0x4c,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x7c, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xf8, 0x30, 0x06, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b,
+  0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x64, 0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+  0x00, 0x17, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x01, 0x2c, 0x02, 0xbc, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0xff, 0x9c, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x03, 0x84, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x01, 0x90, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x64,
+  0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19,
+  0x00, 0x25, 0x00, 0x00, 0x09, 0x25, 0x01, 0x2c, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x03, 0x84, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfc, 0xe0, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x01, 0x90, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x07, 0xd0, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00,
+  0x09, 0x0f, 0x00, 0xc8, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x64, 0x02, 0xbc, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x03,
+  0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x00, 0xc8, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x64,
+  0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00,
+  0x09, 0x17, 0x03, 0x20, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x02, 0xbc, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x15, 0x00, 0x00, 0x09, 0x15, 0x03, 0x20, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44,
+  0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0xfe, 0x70, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x2c, 0xfe, 0x70, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x11, 0x00, 0x00, 0x09, 0x11,
+  0x04, 0xb0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x04, 0x4c,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x09, 0x13, 0x03, 0x20, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x2c, 0x01, 0x2c, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x01, 0x2c, 0x09, 0x60, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c,
+  0x00, 0x00, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x03, 0x20,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0xfe, 0x0c, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x09, 0x60,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x4c, 0x07, 0xd0, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09,
+  0x04, 0x4c, 0xfc, 0x7c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44,
+  0x00, 0x00, 0xfc, 0x7c, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x08, 0x98, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x0a, 0x28, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0xfe, 0x70, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23,
+  0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4,
+  0xfc, 0x7c, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38,
+  0x0a, 0x28, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00,
+  0x09, 0x27, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x08, 0x98, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0xf8, 0xf8, 0x00, 0xc8, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x15,
+  0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xf8, 0x30, 0x08, 0x98, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x00,
+  0x09, 0x3f, 0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0xd4, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0x00, 0xc8, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x27,
+  0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x07, 0xd0, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x03, 0xe8, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x90, 0xfb, 0x50, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x03, 0x84, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00,
+  0xf9, 0xc0, 0x00, 0x00, 0x07, 0xd0, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x03, 0x01, 0xf4,
+  0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x09, 0x13,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x09, 0x60, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0xf8, 0x30, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b,
+  0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0xa8, 0x0a, 0xf0, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0xf4, 0xfe, 0x70, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f,
+  0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x90, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00,
+  0x09, 0x19, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0xfe, 0x70, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x01, 0xf4,
+  0x00, 0x00, 0x06, 0xa4, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x09, 0x15, 0x05, 0x78,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xf9, 0xc0, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09, 0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00,
+  0x03, 0x84, 0x00, 0x00, 0xfb, 0x50, 0x03, 0x84, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x0a, 0xf0,
+  0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xf4, 0x00, 0x00, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x09,
+  0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x03, 0xe8, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x2c, 0x01, 0x90, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x03, 0xe8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x11, 0x00, 0x00, 0x09, 0x11,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x05, 0x78, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x01, 0x01, 0xf4, 0x00, 0x00, 0x04, 0xb0,
+  0x0a, 0xf0, 0x00, 0x15, 0x00, 0x00, 0x09, 0x15, 0x04, 0xb0, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0x28, 0x00, 0x1b, 0x00, 0x21, 0x00, 0x25,
+  0x00, 0x00, 0x09, 0x25, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0x70, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0xc8, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d,
+  0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x07, 0xd0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xf9, 0xc0, 0x0a, 0xf0, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0xfd, 0xa8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x02, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x02, 0x58, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x04, 0x4c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0xff, 0x38,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0x00,
+  0x09, 0x2f, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x03, 0xe8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0xc8, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x0a, 0x28,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfa, 0x88, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x08, 0x98, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x03, 0xe8, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00,
+  0x0a, 0x28, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x1b,
+  0x00, 0x00, 0x09, 0x1b, 0x03, 0xe8, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x02, 0x58, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00,
+  0x07, 0x08, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x04, 0x4c, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0xfc, 0xe0,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x38, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b,
+  0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x02, 0x58, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x2b,
+  0x00, 0x00, 0x09, 0x2b, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x07, 0xd0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x19, 0x00, 0x25, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0xf8, 0x30, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x07, 0x08, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x19, 0x00, 0x25,
+  0x00, 0x29, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0xf8, 0x30, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x07, 0x08,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x07, 0x08, 0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x03, 0xe8,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0xbc,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x90, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x98, 0x07, 0xd0, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x37,
+  0x00, 0x00, 0x09, 0x37, 0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfc, 0x7c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0x64, 0xff, 0x9c,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0xfc, 0xe0, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0x18, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x19,
+  0x00, 0x1f, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0xf0, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0xfb, 0x50, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x02, 0x58, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x01, 0x2c,
+  0x00, 0x00, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b,
+  0x01, 0x2c, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0xd4, 0x03, 0x20, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x0a, 0xf0, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x27, 0x00, 0x2f,
+  0x00, 0x00, 0x09, 0x2f, 0x00, 0xc8, 0x03, 0x84, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xfe, 0xd4, 0x03, 0x84, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0x64, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfc, 0x18, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x02, 0x01, 0x2c, 0xfe, 0x70, 0x05, 0x14, 0x07, 0xd0, 0x00, 0x07,
+  0x00, 0x19, 0x00, 0x00, 0x09, 0x19, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0xc8, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x07, 0x08, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x35,
+  0x00, 0x00, 0x09, 0x35, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0x07, 0xd0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x0a, 0x28, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x02, 0x01, 0x2c,
+  0x00, 0x00, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x11, 0x00, 0x25, 0x00, 0x00, 0x09, 0x25, 0x01, 0x2c,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x0a, 0xf0,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x14,
+  0x0a, 0xf0, 0x00, 0x23, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x2d, 0x04, 0x4c, 0xfd, 0x44,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x0a, 0x28, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x03, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x23,
+  0x00, 0x29, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x2d, 0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0x28, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfd, 0xa8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x02, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x23, 0x00, 0x37, 0x00, 0x00,
+  0x09, 0x37, 0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x23,
+  0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x39, 0x00, 0x00, 0x09, 0x39, 0x04, 0x4c, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x2c, 0xfe, 0x70, 0x05, 0x14, 0x07, 0xd0, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29,
+  0x04, 0x4c, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x14,
+  0x0a, 0xf0, 0x00, 0x23, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c,
+  0x00, 0x00, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x23, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0x4c,
+  0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d,
+  0x00, 0xc8, 0x05, 0x14, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x0a, 0xf0, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x04, 0xb0,
+  0x09, 0x60, 0x00, 0x19, 0x00, 0x00, 0x09, 0x19, 0x02, 0xbc, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00,
+  0x09, 0x1b, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfe, 0xd4, 0x00, 0x00,
+  0xfe, 0x0c, 0x00, 0x00, 0x05, 0x14, 0x00, 0x00, 0xfe, 0x0c, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0xf5, 0xd8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x6c, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x02, 0xbc, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0x0c, 0x04, 0x4c,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x07, 0x08,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0xdc,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x00, 0xc8, 0x05, 0x14, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x0c, 0x0a, 0xf0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x09, 0x60, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x02, 0xbc, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00,
+  0x09, 0x2f, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f, 0x03, 0xe8,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x84,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00,
+  0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x98, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+  0x09, 0x17, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x64, 0xfc, 0xe0, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x38,
+  0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf8, 0x30, 0x09, 0x60,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x03, 0xe8,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00,
+  0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x98, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+  0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfd, 0xa8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00,
+  0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x07, 0xd0, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70,
+  0x02, 0x58, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfc, 0xe0, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b,
+  0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0xa8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x00, 0xc8,
+  0x07, 0xd0, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x03, 0xe8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x05, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1d,
+  0x00, 0x21, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0xfe, 0x0c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x0a, 0x28, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x05, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27,
+  0x03, 0xe8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x0a, 0x28, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x19, 0x00, 0x00, 0x09, 0x19,
+  0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x0a, 0xf0, 0x00, 0x00, 0xf7, 0x68, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x78,
+  0x07, 0xd0, 0x00, 0x19, 0x00, 0x00, 0x09, 0x19, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x23, 0x00, 0x37, 0x00, 0x00,
+  0x09, 0x37, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xfa, 0x88,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xfa, 0x88,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x1f,
+  0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0x28,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfc, 0xe0, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x21, 0x00, 0x35, 0x00, 0x00, 0x09, 0x35, 0x04, 0x4c,
+  0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0xf0,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x04, 0xb0, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x09, 0x60, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xf8, 0xf8, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x05, 0x78, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0x01, 0x2c,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29,
+  0x01, 0x2c, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0xfb, 0xb4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0xa8,
+  0x03, 0x84, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x03, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x09, 0x29, 0x01, 0x2c, 0x04, 0x4c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfb, 0xb4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0xa8, 0x03, 0x84, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x02, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1f,
+  0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x02, 0xbc, 0x02, 0xbc, 0x00, 0x00, 0xfb, 0xb4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x04, 0x4c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x01, 0x2c, 0x04, 0x4c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xfb, 0xb4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0xa8, 0x02, 0xbc, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x01, 0x2c,
+  0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0xfb, 0xb4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0xa8, 0x03, 0x20,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x01, 0x2c, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x00,
+  0x09, 0x33, 0x01, 0x2c, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0xfb, 0xb4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfd, 0xa8, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x0d,
+  0x00, 0x00, 0x09, 0x0d, 0x03, 0x20, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x09, 0x60, 0xf6, 0xa0, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x01, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x02, 0xbc, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0xfe, 0x70, 0x04, 0xb0, 0x07, 0xd0, 0x00, 0x15, 0x00, 0x00, 0x09, 0x15, 0x04, 0x4c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xf8, 0x30, 0x00, 0x01, 0x00, 0xc8, 0x08, 0x98, 0x03, 0x84, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x00, 0x09, 0x13, 0x03, 0x20, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x09, 0x60, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x08, 0x98, 0x03, 0x84, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x00, 0x09, 0x13, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x0a, 0xf0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x01, 0x90, 0x07, 0xd0, 0x03, 0x84, 0x0a, 0xf0, 0x00, 0x09,
+  0x00, 0x0d, 0x00, 0x00, 0x09, 0x0d, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x09, 0x60, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x01, 0xf4, 0x07, 0xd0, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00,
+  0x09, 0x0d, 0x03, 0x20, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x09, 0x60,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x08, 0x98, 0x03, 0xe8, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x00, 0xc8, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x01, 0xf4,
+  0x09, 0x60, 0x03, 0x20, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x03, 0x20, 0xfe, 0xd4,
+  0x00, 0x00, 0x01, 0x2c, 0x09, 0x60, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x04, 0x01, 0x2c,
+  0x07, 0x08, 0x04, 0x4c, 0x0a, 0xf0, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+  0x09, 0x17, 0x04, 0x4c, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0xff, 0x38, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0xfd, 0xa8, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x08, 0x98, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0xfe, 0x70, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x09, 0x05, 0x01, 0xf4, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x05, 0x00, 0xc8,
+  0x08, 0x98, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+  0x00, 0x00, 0x09, 0x1b, 0x05, 0x78, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfb, 0xb4, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x0a, 0xf0, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x04, 0x01, 0x90, 0x07, 0xd0, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x03,
+  0x00, 0x0d, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x03, 0x84, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0xfd, 0x44, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x07, 0xd0, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f, 0x04, 0x4c, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x08, 0x98, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x64,
+  0x00, 0x00, 0x05, 0xdc, 0x08, 0x98, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x25,
+  0x00, 0x00, 0x09, 0x25, 0x03, 0xe8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x04, 0xb0, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0x18, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0xf7, 0x68, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x04, 0xb0, 0x05, 0x78, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x05, 0x78, 0xfb, 0x50,
+  0x00, 0x00, 0x04, 0xb0, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x04, 0xb0, 0x05, 0x78, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x05, 0x78, 0xfb, 0x50,
+  0x00, 0x00, 0x04, 0xb0, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x04, 0xb0, 0x05, 0x78, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x05, 0x78, 0xfb, 0x50,
+  0x00, 0x00, 0x04, 0xb0, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+  0x04, 0xb0, 0x03, 0x20, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x03, 0x20, 0xfd, 0xa8,
+  0x00, 0x00, 0x02, 0x58, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x04, 0xb0, 0x05, 0x78, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x78, 0x00, 0x00, 0x04, 0xb0, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x01, 0x00, 0x00,
+  0x04, 0xb0, 0x06, 0x40, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0x04, 0xb0, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x02, 0x01, 0x90,
+  0xfe, 0x70, 0x04, 0xb0, 0x0a, 0xf0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x09, 0x07, 0x02, 0xbc,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x01, 0xf4, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0xfe, 0x70,
+  0x00, 0x00, 0x0c, 0x80, 0x00, 0x00, 0xf3, 0x80, 0x00, 0x00, 0x0c, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0xfe, 0x70, 0x06, 0x40, 0x00, 0xc8, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+  0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfe, 0x70, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x06, 0x40, 0x03, 0x20, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x00, 0x09, 0x0b, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x0a, 0xf0, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x40, 0x02, 0xbc, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x00, 0x09, 0x0b, 0x01, 0x2c, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x07, 0xd0, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x70, 0x02, 0xbc, 0x03, 0x20, 0x00, 0x0b,
+  0x00, 0x00, 0x09, 0x0b, 0x02, 0xbc, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x40, 0x02, 0xbc, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x00, 0x09, 0x0b, 0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x0a, 0xf0, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x06, 0x40, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x03, 0x20, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0xfe, 0xd4,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x09, 0x60, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x06, 0x40, 0x05, 0x78,
+  0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x05, 0x78, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x0a, 0xf0, 0xfc, 0xe0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x03, 0x20, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x04, 0x4c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0x70, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x06, 0x40, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00,
+  0x09, 0x17, 0x00, 0xc8, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x02, 0xbc, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x13,
+  0x00, 0x00, 0x09, 0x13, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0xd0, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x01, 0x2c, 0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x1b,
+  0x00, 0x00, 0x09, 0x1b, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0xd0, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x01, 0x90, 0x01, 0x90, 0x03, 0xe8, 0x06, 0x40, 0x00, 0x03,
+  0x00, 0x00, 0x09, 0x03, 0x03, 0xe8, 0xfd, 0xa8, 0x00, 0x00, 0x02, 0x58, 0x01, 0x90, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x01, 0x90, 0x01, 0x90, 0x03, 0xe8, 0x06, 0x40, 0x00, 0x0b,
+  0x00, 0x00, 0x09, 0x0b, 0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x01, 0x90, 0x00, 0x03,
+  0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x84, 0x01, 0x90, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x00, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x01, 0x90,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0xdc,
+  0x01, 0x90, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x03, 0x84, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0xfe, 0xd4, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0xc8,
+  0x04, 0xb0, 0x01, 0xf4, 0x06, 0x40, 0x00, 0x03, 0x00, 0x00, 0x09, 0x03, 0x01, 0xf4, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x06, 0x40, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x12, 0x00, 0x64,
+  0x00, 0x00, 0x09, 0x60, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43,
+  0x00, 0x47, 0x00, 0x4b, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x5f, 0x00, 0x63,
+  0x00, 0x67, 0x00, 0x6b, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x77, 0x00, 0x00, 0x09, 0x77, 0x08, 0x98,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0xfa, 0x24, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x01, 0x2c, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xfc, 0xe0,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x01, 0x90,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x04, 0xb0, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfc, 0x18,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x01, 0x2c, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfc, 0x18,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x01, 0x90, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xff, 0x38,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x02, 0x58, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x06, 0x40,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf8, 0xf8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfc, 0xe0,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x00, 0x64, 0x00, 0x00, 0x0c, 0xe4, 0x0a, 0xf0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3b,
+  0x00, 0x3f, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x5f, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6b,
+  0x00, 0x6f, 0x00, 0x73, 0x00, 0x77, 0x00, 0x7b, 0x00, 0x7f, 0x00, 0x83, 0x00, 0x87, 0x00, 0x8b,
+  0x00, 0x8f, 0x00, 0x00, 0x09, 0x8f, 0x0c, 0x80, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xfc, 0x18,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0xfa, 0x24, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xfe, 0xd4, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x07, 0x6c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf5, 0xd8, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x01, 0xf4,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfe, 0x70, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x03, 0x84,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x03, 0xe8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfd, 0x44,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfc, 0x18, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x01, 0x90,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x02, 0x58,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x07, 0xd0,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88,
+  0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x08,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xfc, 0xe0, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x03, 0x20,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xf6, 0xa0,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x03, 0x20,
+  0x07, 0x08, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x02, 0xbc, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x03, 0x20,
+  0x07, 0x08, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x03, 0x20, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x01, 0x90, 0x00, 0x00, 0x05, 0x14,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x02, 0xbc,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x02, 0x58, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0xfe, 0xd4,
+  0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x90,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xf8, 0x30, 0x07, 0xd0, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x21,
+  0x00, 0x00, 0x09, 0x21, 0x04, 0x4c, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x08, 0x98, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x05, 0x78, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0xf6, 0xa0, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xdc, 0x0a, 0xf0, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x04, 0x4c, 0xfd, 0xa8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x04, 0xb0, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x09, 0x11, 0x00, 0xc8,
+  0x03, 0x84, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0xd4, 0x03, 0x20, 0xfe, 0x0c, 0x00, 0x00,
+  0x01, 0xf4, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c, 0x06, 0x40, 0x07, 0xd0,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f, 0x01, 0x2c, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x0c, 0x05, 0x78, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x02, 0x58, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c,
+  0x06, 0x40, 0x07, 0xd0, 0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x09, 0x23, 0x06, 0xa4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0xec, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x08, 0x98, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x02, 0x58, 0xfd, 0xa8,
+  0x03, 0x20, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f,
+  0x04, 0x4c, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x08, 0x98, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f,
+  0x00, 0xc8, 0x01, 0xf4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x0a, 0xf0, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x00,
+  0x09, 0x2f, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x0f,
+  0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x07, 0xd0, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x05, 0x14,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x01, 0x2c, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfc, 0xe0, 0x02, 0xbc, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x07, 0xd0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xfc, 0xe0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x04, 0x4c, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x05, 0x78,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00,
+  0x09, 0x60, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0xf6, 0xa0,
+  0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x03, 0x00, 0xc8,
+  0xfe, 0x70, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x39, 0x00, 0x3d, 0x00, 0x41, 0x00, 0x00, 0x09, 0x41,
+  0x00, 0xc8, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x04, 0x4c, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x64, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x0a, 0xf0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf7, 0x68, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x08, 0x98, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfe, 0x70, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x1d, 0x00, 0x00, 0x09, 0x1d, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x08, 0x98, 0xfc, 0xe0, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfd, 0xa8,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x02, 0x58,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x02, 0x00, 0x00, 0xfe, 0x70, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x00,
+  0x09, 0x39, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x08, 0x98, 0xfc, 0xe0, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0xfe, 0x70, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x0d, 0x00, 0x2b, 0x00, 0x00, 0x09, 0x2b, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x04, 0x4c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x02, 0xbc,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x0a, 0xf0, 0xfd, 0xa8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x03, 0x20, 0xfd, 0xa8, 0xfc, 0xe0, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x01, 0x90, 0x05, 0x14, 0x07, 0xd0, 0x00, 0x29, 0x00, 0x33, 0x00, 0x00,
+  0x09, 0x33, 0x04, 0xb0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x02, 0x58, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x90, 0x05, 0x78, 0x07, 0xd0, 0x00, 0x23,
+  0x00, 0x2d, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37, 0x04, 0xb0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0x64, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38,
+  0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x03, 0x00, 0xc8, 0xfe, 0x70, 0x05, 0x14,
+  0x0a, 0xf0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x1b, 0x02, 0xbc, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x84, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x9c, 0xff, 0x38, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xff, 0x38, 0x00, 0xc8, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x09, 0x60, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x02, 0x58, 0x05, 0x78, 0x08, 0x98, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x01, 0x2c,
+  0x00, 0x64, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x04, 0x4c,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x08,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x01, 0x90, 0x05, 0x78, 0x09, 0x60, 0x00, 0x37, 0x00, 0x00, 0x09, 0x37,
+  0x04, 0x4c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x08, 0x98, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x01, 0x00, 0xc8, 0x01, 0x90, 0x05, 0x78, 0x09, 0x60, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f,
+  0x02, 0xbc, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00,
+  0x02, 0xbc, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x03, 0x20, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x03, 0x00, 0xc8, 0x01, 0x90, 0x05, 0x78, 0x09, 0x60, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+  0x00, 0x00, 0x09, 0x0b, 0x00, 0xc8, 0x04, 0xb0, 0x00, 0x00, 0xfb, 0x50, 0x04, 0xb0, 0x00, 0x00,
+  0xfb, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfb, 0x50, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x01, 0x90, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x2b,
+  0x00, 0x00, 0x09, 0x2b, 0x03, 0x20, 0x02, 0x58, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x03, 0x20, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x05, 0x78, 0x00, 0x00, 0xfb, 0x50,
+  0x00, 0x00, 0x04, 0xb0, 0xfb, 0x50, 0x00, 0x00, 0x04, 0xb0, 0xfb, 0x50, 0x04, 0xb0, 0x00, 0x00,
+  0xfb, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x0a, 0xf0, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0xf5, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x03, 0x20, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x09, 0x60, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x09, 0x27, 0x02, 0x58,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x07, 0xd0,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xf8, 0x30, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x09, 0x60, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+  0x09, 0x27, 0x03, 0x20, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0xfd, 0xa8, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0x05, 0xff, 0x9c, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0b,
+  0x00, 0x17, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x00, 0x09, 0x55, 0x04, 0x4c, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0xc8, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0xfd, 0x44, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x01, 0x90, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x02, 0x58, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x27,
+  0x00, 0x31, 0x00, 0x00, 0x09, 0x31, 0x03, 0xe8, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x05, 0x78, 0x0a, 0x28, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x04, 0xb0, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x33, 0x00, 0x57, 0x00, 0x00,
+  0x09, 0x57, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x03, 0x20, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x33,
+  0x00, 0x57, 0x00, 0x00, 0x09, 0x57, 0x00, 0x64, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x03, 0x20,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78,
+  0x07, 0xd0, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x2f, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x01, 0x90, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x05, 0xdc,
+  0x0a, 0xf0, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x00,
+  0x09, 0x43, 0x03, 0xe8, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0xfe, 0x70, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x04, 0xb0, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0xfc, 0x7c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfb, 0xb4, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x07, 0xd0,
+  0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x64, 0x00, 0x00, 0x05, 0x14, 0x0a, 0xf0, 0x00, 0x17,
+  0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x09, 0x33, 0x02, 0xbc,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x01, 0x90,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xfc, 0x7c, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c, 0x03, 0xe8,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfc, 0x18, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x04, 0x4c,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x07, 0xd0,
+  0x00, 0x00, 0xfb, 0x50, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x98, 0x0a, 0xf0, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09,
+  0x08, 0x98, 0xf8, 0x30, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00,
+  0x09, 0x60, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x01, 0xf4, 0x00, 0x00, 0x07, 0x6c,
+  0x0a, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x02, 0xbc, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x01, 0x90, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf6, 0xa0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40,
+  0x0a, 0xf0, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+  0x09, 0x37, 0x03, 0x20, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x01, 0x90, 0x00, 0xc8, 0x00, 0x00,
+  0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x00, 0xc8, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0xc8, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0xfa, 0x88, 0x00, 0x64, 0x00, 0x00,
+  0xff, 0x9c, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x07, 0x08,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x06, 0xa4, 0x0a, 0xf0, 0x00, 0x1d,
+  0x00, 0x39, 0x00, 0x00, 0x09, 0x39, 0x04, 0x4c, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x64, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfa, 0x88, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xff, 0x9c, 0x00, 0x00, 0x05, 0x78, 0x0a, 0xf0, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x43,
+  0x00, 0x4d, 0x00, 0x55, 0x00, 0x00, 0x09, 0x55, 0x04, 0x4c, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x64, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0xfd, 0x44, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x01, 0x90, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xf8, 0x30, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00,
+  0x09, 0x31, 0x03, 0xe8, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8,
+  0x00, 0x00, 0x06, 0x40, 0x0a, 0xf0, 0x00, 0x27, 0x00, 0x31, 0x00, 0x00, 0x09, 0x31, 0x03, 0xe8,
+  0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x64,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x0a, 0x28, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x6c,
+  0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f, 0x01, 0xf4, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x06, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x07, 0x08,
+  0x0a, 0xf0, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x03, 0x20, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0xfc, 0x7c, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x09, 0x60, 0xfe, 0x70, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x06, 0xa4,
+  0x0a, 0xf0, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x09, 0x17, 0x03, 0x20, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfd, 0x44, 0x00, 0x00, 0x09, 0x60, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0xf8, 0x30, 0x04, 0xb0, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c,
+  0x00, 0x00, 0x0a, 0x28, 0x0a, 0xf0, 0x00, 0x25, 0x00, 0x00, 0x09, 0x25, 0x01, 0x2c, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfc, 0x7c,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00,
+  0x06, 0x40, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2c, 0x00, 0x00, 0x09, 0xc4, 0x0a, 0xf0, 0x00, 0x21,
+  0x00, 0x25, 0x00, 0x00, 0x09, 0x25, 0x01, 0x2c, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfd, 0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4, 0x05, 0x14, 0x01, 0x90, 0x00, 0x00,
+  0xfe, 0x70, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xf9, 0xc0, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xf9, 0xc0,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x07, 0xd0, 0x0a, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x1f,
+  0x01, 0x2c, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xfe, 0xd4,
+  0x07, 0xd0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xf6, 0xa0, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x08, 0xfc, 0x0a, 0xf0, 0x00, 0x49, 0x00, 0x00, 0x09, 0x49,
+  0x04, 0x4c, 0xfd, 0x44, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0xf4,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70,
+  0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x09, 0x60,
+  0x0a, 0xf0, 0x00, 0x4b, 0x00, 0x00, 0x09, 0x4b, 0x04, 0x4c, 0xfd, 0xa8, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xfe, 0x0c,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xfe, 0xd4, 0x00, 0x00, 0xff, 0x9c,
+  0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xff, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0x00, 0xc8, 0x00, 0x00, 0xfd, 0xa8, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00,
+  0xfc, 0xe0, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00,
+  0xfe, 0x70, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x26, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3c,
+  0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x16, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x18, 0x00, 0x96, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x56,
+  0x00, 0xae, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x60, 0x01, 0x04, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x01, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x06, 0x01, 0x72, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1e,
+  0x01, 0x78, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x01, 0x96, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x01, 0xa4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x0c, 0x01, 0xaf, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x2b,
+  0x01, 0xbb, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x30, 0x01, 0xe6, 0x00, 0x03,
+  0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x1c, 0x02, 0x16, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x02, 0x00, 0x0c, 0x02, 0x32, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x3c,
+  0x02, 0x3e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x1c, 0x02, 0x7a, 0x00, 0x03,
+  0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x16, 0x02, 0x96, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x06, 0x00, 0x18, 0x02, 0xac, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x56,
+  0x02, 0xc4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x60, 0x03, 0x1a, 0x00, 0x53,
+  0x00, 0x68, 0x00, 0x61, 0x00, 0x73, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x48,
+  0x00, 0x69, 0x00, 0x20, 0x00, 0x36, 0x00, 0x34, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64,
+  0x00, 0x69, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x42, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00, 0x4e,
+  0x00, 0x50, 0x00, 0x69, 0x00, 0x63, 0x00, 0x61, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x53,
+  0x00, 0x68, 0x00, 0x61, 0x00, 0x73, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x48, 0x00, 0x69,
+  0x00, 0x36, 0x00, 0x34, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31,
+  0x00, 0x31, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61, 0x00, 0x73, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x6e,
+  0x00, 0x20, 0x00, 0x48, 0x00, 0x69, 0x00, 0x20, 0x00, 0x36, 0x00, 0x34, 0x00, 0x30, 0x00, 0x56,
+  0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31,
+  0x00, 0x2e, 0x00, 0x30, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61, 0x00, 0x73, 0x00, 0x74, 0x00, 0x6f,
+  0x00, 0x6e, 0x00, 0x48, 0x00, 0x69, 0x00, 0x36, 0x00, 0x34, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x61,
+  0x00, 0x64, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20,
+  0x00, 0x42, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00, 0x27, 0x00, 0x6e, 0x00, 0x27, 0x00, 0x50,
+  0x00, 0x69, 0x00, 0x63, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20,
+  0x00, 0x4b, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65,
+  0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72,
+  0x00, 0x65, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f,
+  0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x6b, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61,
+  0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x70,
+  0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x66,
+  0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x2f, 0x00, 0x62, 0x00, 0x69,
+  0x00, 0x74, 0x00, 0x73, 0x00, 0x6e, 0x00, 0x70, 0x00, 0x69, 0x00, 0x63, 0x00, 0x61, 0x00, 0x73,
+  0x00, 0x2f, 0x53, 0x68, 0x61, 0x73, 0x74, 0x6f, 0x6e, 0x20, 0x48, 0x69, 0x20, 0x36, 0x34, 0x30,
+  0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x42, 0x69, 0x74, 0x73, 0x4e, 0x50, 0x69, 0x63, 0x61, 0x73,
+  0x3a, 0x20, 0x53, 0x68, 0x61, 0x73, 0x74, 0x6f, 0x6e, 0x48, 0x69, 0x36, 0x34, 0x30, 0x3a, 0x20,
+  0x32, 0x30, 0x31, 0x31, 0x53, 0x68, 0x61, 0x73, 0x74, 0x6f, 0x6e, 0x20, 0x48, 0x69, 0x20, 0x36,
+  0x34, 0x30, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x53, 0x68, 0x61,
+  0x73, 0x74, 0x6f, 0x6e, 0x48, 0x69, 0x36, 0x34, 0x30, 0x4d, 0x61, 0x64, 0x65, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x42, 0x69, 0x74, 0x73, 0x27, 0x6e, 0x27, 0x50, 0x69, 0x63, 0x61, 0x73, 0x20,
+  0x62, 0x79, 0x20, 0x4b, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74,
+  0x77, 0x61, 0x72, 0x65, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x6b,
+  0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x6b, 0x6f, 0x72, 0x70, 0x2e, 0x63, 0x6f, 0x6d, 0x2f,
+  0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2f, 0x62, 0x69, 0x74, 0x73, 0x6e, 0x70, 0x69,
+  0x63, 0x61, 0x73, 0x2f, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61, 0x00, 0x73, 0x00, 0x74, 0x00, 0x6f,
+  0x00, 0x6e, 0x00, 0x20, 0x00, 0x48, 0x00, 0x69, 0x00, 0x20, 0x00, 0x36, 0x00, 0x34, 0x00, 0x30,
+  0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x42, 0x00, 0x69,
+  0x00, 0x74, 0x00, 0x73, 0x00, 0x4e, 0x00, 0x50, 0x00, 0x69, 0x00, 0x63, 0x00, 0x61, 0x00, 0x73,
+  0x00, 0x3a, 0x00, 0x20, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61, 0x00, 0x73, 0x00, 0x74, 0x00, 0x6f,
+  0x00, 0x6e, 0x00, 0x48, 0x00, 0x69, 0x00, 0x36, 0x00, 0x34, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x20,
+  0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61, 0x00, 0x73,
+  0x00, 0x74, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x48, 0x00, 0x69, 0x00, 0x20, 0x00, 0x36,
+  0x00, 0x34, 0x00, 0x30, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f,
+  0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61,
+  0x00, 0x73, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x48, 0x00, 0x69, 0x00, 0x36, 0x00, 0x34,
+  0x00, 0x30, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69,
+  0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x42, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00, 0x27,
+  0x00, 0x6e, 0x00, 0x27, 0x00, 0x50, 0x00, 0x69, 0x00, 0x63, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20,
+  0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x4b, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74,
+  0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74,
+  0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70,
+  0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x6b,
+  0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6b,
+  0x00, 0x6f, 0x00, 0x72, 0x00, 0x70, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f,
+  0x00, 0x73, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65,
+  0x00, 0x2f, 0x00, 0x62, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00, 0x6e, 0x00, 0x70, 0x00, 0x69,
+  0x00, 0x63, 0x00, 0x61, 0x00, 0x73, 0x00, 0x2f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x38, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+  0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
+  0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
+  0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
+  0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
+  0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a,
+  0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32,
+  0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a,
+  0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
+  0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a,
+  0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
+  0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a,
+  0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0xac,
+  0x00, 0xa3, 0x00, 0x84, 0x00, 0x85, 0x00, 0xbd, 0x00, 0x96, 0x00, 0xe8, 0x00, 0x86, 0x00, 0x8e,
+  0x00, 0x8b, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xa4, 0x01, 0x02, 0x00, 0x8a, 0x00, 0xda, 0x00, 0x83,
+  0x00, 0x93, 0x00, 0xf2, 0x00, 0xf3, 0x00, 0x8d, 0x00, 0x97, 0x00, 0x88, 0x01, 0x03, 0x00, 0xde,
+  0x00, 0xf1, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf6, 0x00, 0xa2, 0x00, 0xad,
+  0x00, 0xc9, 0x00, 0xc7, 0x00, 0xae, 0x00, 0x62, 0x00, 0x63, 0x00, 0x90, 0x00, 0x64, 0x00, 0xcb,
+  0x00, 0x65, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xcf, 0x00, 0xcc, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xe9,
+  0x00, 0x66, 0x00, 0xd3, 0x00, 0xd0, 0x00, 0xd1, 0x00, 0xaf, 0x00, 0x67, 0x00, 0xf0, 0x00, 0x91,
+  0x00, 0xd6, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0x68, 0x00, 0xeb, 0x00, 0xed, 0x00, 0x89, 0x00, 0x6a,
+  0x00, 0x69, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x6c, 0x00, 0x6e, 0x00, 0xa0, 0x00, 0x6f, 0x00, 0x71,
+  0x00, 0x70, 0x00, 0x72, 0x00, 0x73, 0x00, 0x75, 0x00, 0x74, 0x00, 0x76, 0x00, 0x77, 0x00, 0xea,
+  0x00, 0x78, 0x00, 0x7a, 0x00, 0x79, 0x00, 0x7b, 0x00, 0x7d, 0x00, 0x7c, 0x00, 0xb8, 0x00, 0xa1,
+  0x00, 0x7f, 0x00, 0x7e, 0x00, 0x80, 0x00, 0x81, 0x00, 0xec, 0x00, 0xee, 0x00, 0xba, 0x01, 0x04,
+  0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x00, 0xfd, 0x00, 0xfe, 0x01, 0x0a,
+  0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x00, 0xff, 0x01, 0x00, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x10,
+  0x01, 0x01, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17,
+  0x01, 0x18, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c, 0x00, 0xf8, 0x00, 0xf9, 0x01, 0x1d,
+  0x01, 0x1e, 0x01, 0x1f, 0x01, 0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25,
+  0x01, 0x26, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c, 0x00, 0xfa,
+  0x00, 0xd7, 0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33,
+  0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3a, 0x01, 0x3b,
+  0x00, 0xe2, 0x00, 0xe3, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e, 0x01, 0x3f, 0x01, 0x40, 0x01, 0x41,
+  0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49,
+  0x01, 0x4a, 0x00, 0xb0, 0x00, 0xb1, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f,
+  0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xe4,
+  0x00, 0xe5, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b,
+  0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x5f, 0x01, 0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63,
+  0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x00, 0xbb,
+  0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x00, 0xe6, 0x00, 0xe7, 0x01, 0x6f, 0x00, 0xa6,
+  0x01, 0x70, 0x00, 0xd8, 0x00, 0xe1, 0x01, 0x71, 0x01, 0x72, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd,
+  0x00, 0xe0, 0x01, 0x73, 0x00, 0xdf, 0x01, 0x74, 0x00, 0x9b, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77,
+  0x00, 0xb2, 0x00, 0xb3, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xc4,
+  0x01, 0x7b, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xc5, 0x01, 0x7c, 0x00, 0x82, 0x00, 0xc2, 0x00, 0x87,
+  0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x00, 0xab, 0x01, 0x80, 0x00, 0xc6, 0x01, 0x81, 0x00, 0xbe,
+  0x00, 0xbf, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x00, 0x8c,
+  0x00, 0x9f, 0x01, 0x88, 0x00, 0x98, 0x00, 0xa8, 0x01, 0x89, 0x00, 0x9a, 0x01, 0x8a, 0x00, 0x99,
+  0x00, 0xa5, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa7, 0x01, 0x8e,
+  0x00, 0x8f, 0x01, 0x8f, 0x01, 0x90, 0x01, 0x91, 0x00, 0x94, 0x00, 0x95, 0x01, 0x92, 0x01, 0x93,
+  0x01, 0x94, 0x01, 0x95, 0x00, 0xb9, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9a,
+  0x01, 0x9b, 0x01, 0x9c, 0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f, 0x01, 0xa0, 0x00, 0xc0, 0x00, 0xc1,
+  0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x06, 0x68, 0x79, 0x70, 0x68, 0x65,
+  0x6e, 0x0e, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x65, 0x64,
+  0x07, 0x41, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x61, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x61, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x41,
+  0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x61, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x43,
+  0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x63, 0x63, 0x69, 0x72, 0x63,
+  0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0a, 0x43, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
+  0x74, 0x0a, 0x63, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x44, 0x63, 0x61,
+  0x72, 0x6f, 0x6e, 0x06, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x44, 0x63, 0x72, 0x6f, 0x61,
+  0x74, 0x07, 0x45, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x65, 0x6d, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x65, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0a,
+  0x45, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x65, 0x64, 0x6f, 0x74, 0x61,
+  0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x65, 0x6f,
+  0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x65, 0x63, 0x61,
+  0x72, 0x6f, 0x6e, 0x0b, 0x47, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b,
+  0x67, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0a, 0x47, 0x64, 0x6f, 0x74,
+  0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x67, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
+  0x74, 0x0c, 0x47, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x67,
+  0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0b, 0x48, 0x63, 0x69, 0x72,
+  0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x68, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
+  0x6c, 0x65, 0x78, 0x04, 0x48, 0x62, 0x61, 0x72, 0x04, 0x68, 0x62, 0x61, 0x72, 0x06, 0x49, 0x74,
+  0x69, 0x6c, 0x64, 0x65, 0x06, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x49, 0x6d, 0x61, 0x63,
+  0x72, 0x6f, 0x6e, 0x07, 0x69, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x49, 0x62, 0x72, 0x65,
+  0x76, 0x65, 0x06, 0x69, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x49, 0x6f, 0x67, 0x6f, 0x6e, 0x65,
+  0x6b, 0x07, 0x69, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x02, 0x49, 0x4a, 0x02, 0x69, 0x6a, 0x0b,
+  0x4a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x6a, 0x63, 0x69, 0x72,
+  0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x4b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63,
+  0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e,
+  0x74, 0x0c, 0x6b, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x69, 0x63, 0x06, 0x4c,
+  0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0c, 0x4c, 0x63, 0x6f,
+  0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6c, 0x63, 0x6f, 0x6d, 0x6d, 0x61,
+  0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x6c, 0x63,
+  0x61, 0x72, 0x6f, 0x6e, 0x04, 0x4c, 0x64, 0x6f, 0x74, 0x04, 0x6c, 0x64, 0x6f, 0x74, 0x06, 0x4e,
+  0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0c, 0x4e, 0x63, 0x6f,
+  0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6e, 0x63, 0x6f, 0x6d, 0x6d, 0x61,
+  0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x6e, 0x63,
+  0x61, 0x72, 0x6f, 0x6e, 0x0b, 0x6e, 0x61, 0x70, 0x6f, 0x73, 0x74, 0x72, 0x6f, 0x70, 0x68, 0x65,
+  0x03, 0x45, 0x6e, 0x67, 0x03, 0x65, 0x6e, 0x67, 0x07, 0x4f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x07, 0x6f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x4f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06,
+  0x6f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d, 0x4f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d,
+  0x6c, 0x61, 0x75, 0x74, 0x0d, 0x6f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61,
+  0x75, 0x74, 0x06, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65,
+  0x0c, 0x52, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x72, 0x63,
+  0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x52, 0x63, 0x61, 0x72, 0x6f,
+  0x6e, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+  0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x53, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c,
+  0x65, 0x78, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x54,
+  0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x74, 0x63, 0x6f, 0x6d,
+  0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06,
+  0x74, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x04, 0x54, 0x62, 0x61, 0x72, 0x04, 0x74, 0x62, 0x61, 0x72,
+  0x06, 0x55, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x75, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x55,
+  0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x55,
+  0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x75, 0x62, 0x72, 0x65, 0x76, 0x65, 0x05, 0x55, 0x72, 0x69,
+  0x6e, 0x67, 0x05, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x0d, 0x55, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72,
+  0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x75, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d,
+  0x6c, 0x61, 0x75, 0x74, 0x07, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x75, 0x6f, 0x67,
+  0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
+  0x0b, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x59, 0x63, 0x69,
+  0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x79, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
+  0x66, 0x6c, 0x65, 0x78, 0x06, 0x5a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x7a, 0x61, 0x63, 0x75,
+  0x74, 0x65, 0x0a, 0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x7a, 0x64,
+  0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x05, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x07, 0x75,
+  0x6e, 0x69, 0x30, 0x32, 0x33, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x41, 0x07, 0x75,
+  0x6e, 0x69, 0x30, 0x32, 0x43, 0x42, 0x05, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x05, 0x4f, 0x6d, 0x65,
+  0x67, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
+  0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x32, 0x09, 0x61, 0x66, 0x69, 0x69, 0x30,
+  0x30, 0x32, 0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x36, 0x0d, 0x75, 0x6e, 0x64,
+  0x65, 0x72, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x64, 0x62, 0x6c, 0x0d, 0x71, 0x75, 0x6f, 0x74, 0x65,
+  0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x64, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x46,
+  0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x32, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x32, 0x34,
+  0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x32, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x32, 0x37,
+  0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x33, 0x31, 0x09, 0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x64,
+  0x62, 0x6c, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x33, 0x44, 0x08, 0x66, 0x72, 0x61, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x04, 0x45, 0x75, 0x72, 0x6f, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x37,
+  0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x32, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x32, 0x37,
+  0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x31, 0x30,
+  0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x31, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x31, 0x43,
+  0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x31, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x34, 0x39,
+  0x0b, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6c, 0x65, 0x6e, 0x63, 0x65, 0x07, 0x75, 0x6e, 0x69,
+  0x32, 0x32, 0x36, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x36, 0x33, 0x07, 0x75, 0x6e, 0x69,
+  0x32, 0x33, 0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x32, 0x35, 0x07, 0x75, 0x6e, 0x69,
+  0x32, 0x35, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x43, 0x37, 0x07, 0x75, 0x6e, 0x69,
+  0x32, 0x37, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x37, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69,
+  0x46, 0x37, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x37, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69,
+  0x46, 0x37, 0x30, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x37, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69,
+  0x46, 0x37, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x38, 0x31, 0x32, 0x07, 0x75, 0x6e, 0x69,
+  0x46, 0x38, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x38, 0x46, 0x46, 0x07, 0x75, 0x6e, 0x69,
+  0x46, 0x42, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x42, 0x30, 0x33, 0x07, 0x75, 0x6e, 0x69,
+  0x46, 0x42, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x42, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69,
+  0x46, 0x42, 0x30, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x42, 0x30, 0x37,
+};
+
+// data/buttons.png, 2933 bytes
+static const unsigned char buttons_png[] = {
+  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0xae, 0x5c, 0xb5,
+  0x55, 0x00, 0x00, 0x00, 0x30, 0x50, 0x4c, 0x54, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x77,
+  0x00, 0x00, 0x44, 0x44, 0x44, 0xff, 0x00, 0x00, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x88, 0x88,
+  0x88, 0x00, 0xee, 0x00, 0x77, 0x88, 0xff, 0x99, 0x99, 0x99, 0xbb, 0xbb, 0xbb, 0xff, 0xaa, 0x99,
+  0xcc, 0xcc, 0xcc, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x21, 0x6a, 0xef, 0x28, 0x00, 0x00, 0x0b,
+  0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x9b, 0xcf, 0x6b, 0x1c, 0xe7, 0x19, 0xc7, 0xdf,
+  0xb2, 0xde, 0xae, 0x87, 0xb1, 0xa3, 0x2e, 0x39, 0x04, 0x91, 0x43, 0x4d, 0x09, 0xb4, 0xa5, 0x17,
+  0x87, 0x69, 0x62, 0xc4, 0xe2, 0xda, 0xd8, 0x6f, 0x52, 0x2f, 0x7b, 0x88, 0xa0, 0xa8, 0x20, 0x74,
+  0x88, 0xc0, 0x90, 0x60, 0x9c, 0x83, 0x52, 0x63, 0x0b, 0xa3, 0x80, 0x6d, 0x74, 0xd9, 0x90, 0xcb,
+  0x58, 0x5a, 0x59, 0x7e, 0xa1, 0x75, 0x0e, 0xfd, 0x03, 0x3a, 0xb6, 0x56, 0x96, 0x61, 0x5a, 0x75,
+  0x21, 0x87, 0x5c, 0xf6, 0x10, 0xf0, 0xb1, 0x07, 0x87, 0xdc, 0x8c, 0x61, 0x11, 0x54, 0xc5, 0x14,
+  0x53, 0xb6, 0xcf, 0xf3, 0xbc, 0x3f, 0xe6, 0xc7, 0xae, 0xa4, 0xd1, 0xcc, 0xca, 0x72, 0x92, 0x77,
+  0x50, 0xc4, 0xea, 0xf5, 0xe6, 0x7d, 0x3f, 0xf3, 0x7d, 0x9f, 0x1f, 0xef, 0x4f, 0x76, 0xbc, 0xaf,
+  0x9e, 0xff, 0x95, 0x3d, 0xf5, 0x9c, 0x2e, 0x52, 0x46, 0x7f, 0x6f, 0x3d, 0x81, 0x5f, 0xdf, 0xfc,
+  0x01, 0xfe, 0xfe, 0x5b, 0x7f, 0x8f, 0x87, 0x8d, 0x85, 0x61, 0x18, 0xf4, 0x7a, 0x3d, 0x77, 0xad,
+  0x24, 0xd4, 0xb3, 0x8c, 0x65, 0xf4, 0xe4, 0x28, 0x93, 0x00, 0x2f, 0xa0, 0xf0, 0x64, 0x0d, 0x7e,
+  0x9d, 0xc9, 0x04, 0xf0, 0x5a, 0xaf, 0xf7, 0xad, 0xac, 0xc4, 0x07, 0x14, 0x07, 0x2b, 0x66, 0x8c,
+  0x85, 0xe1, 0x17, 0xe9, 0xc6, 0xa0, 0xd4, 0xcd, 0x08, 0xd0, 0xde, 0x07, 0x00, 0x09, 0x20, 0x2b,
+  0x41, 0x14, 0xac, 0x38, 0x38, 0xcd, 0xa0, 0x0a, 0x2a, 0x83, 0x46, 0x85, 0xf8, 0x9c, 0x1a, 0x0b,
+  0x7e, 0xfa, 0xee, 0xbb, 0x0a, 0x00, 0x4a, 0x11, 0x34, 0x60, 0xf8, 0x0c, 0x03, 0xe0, 0x08, 0xd0,
+  0xce, 0x06, 0x40, 0x02, 0x50, 0x25, 0x24, 0x00, 0xbd, 0x59, 0xc0, 0xdc, 0xf0, 0x3e, 0x96, 0xf9,
+  0xa7, 0x99, 0x68, 0xc9, 0xb7, 0xad, 0x94, 0x2b, 0xa7, 0x4e, 0x49, 0x00, 0x1f, 0x50, 0x48, 0xa9,
+  0xb1, 0x7e, 0xf5, 0x02, 0xc1, 0xfb, 0x84, 0x62, 0x00, 0xda, 0x04, 0xc0, 0x33, 0x01, 0xfc, 0xe3,
+  0x2b, 0x14, 0x80, 0x00, 0x48, 0x00, 0x6a, 0xec, 0xf8, 0xe3, 0x6f, 0x36, 0x15, 0x14, 0x73, 0xc4,
+  0x6d, 0x52, 0x25, 0x98, 0xd1, 0x00, 0x84, 0x02, 0x00, 0x41, 0x6d, 0x0c, 0xeb, 0xa0, 0x32, 0x44,
+  0x71, 0x0c, 0x00, 0x47, 0x80, 0x76, 0x36, 0x80, 0xbf, 0x77, 0x8f, 0x7d, 0x2b, 0xfb, 0xf1, 0x2f,
+  0x5f, 0xa1, 0x00, 0x04, 0x70, 0xe4, 0xdc, 0x59, 0x10, 0x10, 0x2b, 0x06, 0x94, 0x7b, 0x54, 0xb6,
+  0x5e, 0x0e, 0x15, 0x80, 0xef, 0x4f, 0x4b, 0x80, 0x90, 0x21, 0x00, 0x2a, 0xe0, 0x4f, 0x10, 0x8a,
+  0x93, 0x50, 0x80, 0x67, 0x05, 0xe8, 0xba, 0x12, 0xe0, 0xcf, 0x80, 0xa2, 0x8c, 0xeb, 0xe8, 0xaf,
+  0x6e, 0x2a, 0xe3, 0x02, 0x14, 0xe8, 0x03, 0x54, 0x60, 0x26, 0x54, 0x36, 0xb0, 0x52, 0x16, 0x0a,
+  0x20, 0x3c, 0x09, 0xba, 0xd7, 0xf0, 0x7b, 0x84, 0xe2, 0x24, 0x6d, 0x20, 0xa3, 0x02, 0x41, 0xb7,
+  0x1b, 0x6a, 0x80, 0xae, 0xa3, 0x00, 0x7e, 0x52, 0xfd, 0x99, 0x02, 0x00, 0x14, 0x59, 0x56, 0x0e,
+  0xc3, 0x39, 0xc6, 0x16, 0x50, 0x81, 0x69, 0xa1, 0x6d, 0x20, 0xf2, 0x02, 0x44, 0x99, 0x48, 0x79,
+  0x41, 0x46, 0x00, 0x57, 0x57, 0xe2, 0x77, 0xbb, 0xda, 0xbd, 0xd6, 0xbc, 0x9a, 0xaa, 0x18, 0x50,
+  0xd2, 0x2e, 0x57, 0x16, 0x02, 0x50, 0xae, 0xef, 0x1d, 0x07, 0x32, 0x7a, 0x81, 0xa9, 0xc4, 0x77,
+  0x86, 0xf8, 0xf7, 0xb2, 0x37, 0x71, 0xa0, 0x81, 0xe8, 0xb8, 0x0e, 0xa2, 0xef, 0x8c, 0xe6, 0x93,
+  0x04, 0x78, 0x0c, 0x1f, 0x27, 0xff, 0x0a, 0xbf, 0x3e, 0xdc, 0x1b, 0xe0, 0x60, 0x73, 0xc1, 0x93,
+  0x7d, 0x75, 0x41, 0x4c, 0xda, 0x00, 0x9e, 0x97, 0x96, 0x0b, 0x4a, 0x83, 0x15, 0x07, 0x51, 0xc5,
+  0x3e, 0x3c, 0xaa, 0x31, 0xf0, 0xeb, 0xac, 0x00, 0xed, 0xfd, 0x00, 0x04, 0x35, 0x5d, 0x49, 0x29,
+  0x51, 0x71, 0x40, 0x86, 0x19, 0x35, 0xd6, 0x6e, 0x84, 0x0d, 0xd5, 0x18, 0xe7, 0xfa, 0x7b, 0x90,
+  0x9e, 0x86, 0x02, 0x34, 0x30, 0x0e, 0x64, 0xcd, 0x86, 0x25, 0xf3, 0xb6, 0x13, 0xaa, 0x31, 0x37,
+  0xf9, 0x66, 0x3e, 0x35, 0xd6, 0xe0, 0x3a, 0x41, 0xb5, 0xea, 0xa2, 0xae, 0xba, 0xea, 0xb2, 0x3b,
+  0xab, 0xbe, 0x07, 0xe9, 0x49, 0x24, 0x73, 0x01, 0x50, 0x64, 0x03, 0x08, 0xb4, 0xcf, 0x4b, 0x09,
+  0xb0, 0x62, 0x57, 0x2b, 0xe0, 0x44, 0x0a, 0x34, 0xda, 0x0d, 0x05, 0x50, 0xe7, 0x3a, 0x41, 0x61,
+  0x06, 0x92, 0x99, 0xd4, 0xbf, 0xe4, 0xcc, 0xc6, 0x01, 0x1a, 0x99, 0x23, 0xa1, 0x92, 0x40, 0x66,
+  0x39, 0xe3, 0xf3, 0xae, 0x1b, 0xca, 0x8a, 0x9d, 0x48, 0x81, 0x90, 0x6b, 0x80, 0x56, 0x5d, 0x02,
+  0x00, 0xba, 0x1b, 0x9e, 0xd4, 0x69, 0x9b, 0x39, 0x29, 0x05, 0x78, 0x23, 0x23, 0x00, 0x4a, 0x20,
+  0xe5, 0x2e, 0x45, 0x36, 0xc0, 0x54, 0x99, 0xe3, 0x08, 0x99, 0xa2, 0xdb, 0x68, 0x05, 0x12, 0x40,
+  0x70, 0x05, 0x60, 0xc6, 0x03, 0x80, 0xee, 0x88, 0x93, 0x29, 0x1b, 0xc8, 0xac, 0x00, 0x4a, 0x20,
+  0x01, 0x50, 0x02, 0x09, 0x10, 0x28, 0x05, 0xb0, 0x77, 0xd3, 0x5e, 0xd0, 0x42, 0x2b, 0x48, 0x7a,
+  0x41, 0x7a, 0x3c, 0x10, 0xee, 0xc7, 0x06, 0xe2, 0x06, 0x57, 0x1a, 0x50, 0x00, 0x3a, 0xc0, 0x49,
+  0xbb, 0x5c, 0xe4, 0x05, 0xbb, 0xc5, 0x81, 0xcc, 0x5e, 0xb0, 0x57, 0x80, 0x61, 0xdf, 0xd3, 0x5c,
+  0xf0, 0xf8, 0xf0, 0x72, 0xc1, 0x3e, 0x1e, 0x56, 0x64, 0x0e, 0xb0, 0x63, 0x17, 0xec, 0x13, 0x20,
+  0x0a, 0x26, 0x89, 0x8a, 0x83, 0x5a, 0xb2, 0x8c, 0xcc, 0x7c, 0x70, 0x5e, 0xe0, 0x16, 0x07, 0x70,
+  0xa9, 0x9a, 0x58, 0x30, 0x49, 0xb9, 0x26, 0xfa, 0x26, 0x86, 0xe7, 0x80, 0x7e, 0x70, 0xfc, 0x47,
+  0x8f, 0x1c, 0x92, 0x05, 0xcc, 0x00, 0x38, 0xc5, 0x01, 0x1c, 0xaa, 0x66, 0x39, 0x15, 0x9c, 0x94,
+  0x6b, 0x46, 0x0a, 0x38, 0x3e, 0xfd, 0x50, 0x2e, 0x40, 0x28, 0x15, 0x45, 0xd9, 0x48, 0x01, 0xda,
+  0x26, 0x3c, 0xeb, 0xe0, 0x34, 0x54, 0x81, 0x58, 0x2e, 0x40, 0xa8, 0x11, 0x02, 0x70, 0xd3, 0xb7,
+  0xad, 0x92, 0xc8, 0xa2, 0x40, 0x3c, 0x17, 0x8c, 0x02, 0xe0, 0xfd, 0x7f, 0x99, 0xa8, 0xa7, 0x86,
+  0xea, 0x7b, 0xd8, 0x40, 0x01, 0x05, 0x22, 0x19, 0x0d, 0xc0, 0xb9, 0x67, 0xdf, 0x19, 0xf7, 0x7a,
+  0x5f, 0xec, 0xa2, 0x40, 0xcc, 0x0b, 0xf2, 0xdb, 0x40, 0xe4, 0xcb, 0x09, 0x2f, 0x90, 0x65, 0xe7,
+  0x9e, 0x7e, 0x37, 0xe0, 0xf3, 0x71, 0x05, 0x62, 0x71, 0xc0, 0x29, 0x0e, 0x70, 0x18, 0x81, 0xe8,
+  0x40, 0x72, 0xc1, 0xbe, 0x00, 0x6c, 0x2e, 0x08, 0x71, 0xd2, 0xbb, 0x90, 0x9e, 0x17, 0x0c, 0x2c,
+  0xbd, 0x8c, 0x85, 0xf0, 0x6d, 0x98, 0xe7, 0xbc, 0x48, 0x02, 0xfc, 0x1c, 0x4a, 0xdf, 0x2c, 0x0a,
+  0xb0, 0xe1, 0x86, 0x15, 0x05, 0x30, 0xc7, 0xae, 0xeb, 0xa9, 0x78, 0x18, 0xae, 0xbb, 0xb1, 0xa1,
+  0x16, 0x00, 0x6c, 0xf7, 0x9f, 0x6c, 0x13, 0x00, 0xfc, 0x7f, 0x5f, 0xf6, 0xfb, 0xff, 0x4d, 0x02,
+  0xe0, 0xa7, 0xf1, 0x7c, 0x00, 0x01, 0xfd, 0x60, 0x25, 0xab, 0x8e, 0xa8, 0xc4, 0xe6, 0x05, 0xae,
+  0x9c, 0x8a, 0x0b, 0xb1, 0x82, 0x2e, 0xd7, 0xe7, 0x00, 0xf0, 0x01, 0x01, 0x6c, 0xf7, 0xbf, 0xdc,
+  0x3e, 0x10, 0x00, 0x9f, 0x7e, 0x12, 0x00, 0x72, 0x5e, 0x80, 0x00, 0xdb, 0x1c, 0x1f, 0x02, 0xe0,
+  0x00, 0xf0, 0xc1, 0x4b, 0x07, 0x88, 0x14, 0x90, 0x28, 0x04, 0x50, 0x85, 0xa7, 0x30, 0x40, 0x64,
+  0x03, 0x06, 0x20, 0xb2, 0x81, 0x18, 0x40, 0x64, 0x03, 0x84, 0x22, 0x01, 0xae, 0x7e, 0xfc, 0xa9,
+  0x04, 0x40, 0x94, 0xf1, 0xa2, 0x5e, 0x60, 0x6c, 0x20, 0xf2, 0x82, 0x98, 0x0d, 0x18, 0x2f, 0x88,
+  0xd9, 0x40, 0xf5, 0xd3, 0x79, 0x0d, 0x00, 0x28, 0xe3, 0x85, 0x43, 0xb1, 0xf6, 0x82, 0xc1, 0x09,
+  0x47, 0xbc, 0x2c, 0xe6, 0x05, 0xf7, 0xaf, 0x18, 0x00, 0x40, 0x19, 0x3f, 0xcc, 0x5c, 0x70, 0xfb,
+  0x4a, 0x3e, 0x00, 0x9b, 0x0b, 0x0e, 0x3f, 0x17, 0xc0, 0x24, 0x3e, 0x5b, 0x63, 0xc1, 0xb0, 0x79,
+  0x01, 0xed, 0x2b, 0x34, 0x8a, 0x01, 0x6c, 0x30, 0xf4, 0x42, 0x68, 0xac, 0xc5, 0xeb, 0xa6, 0x62,
+  0x28, 0xac, 0xa4, 0x01, 0x60, 0xce, 0x27, 0x01, 0x7c, 0x33, 0x22, 0x0a, 0x6a, 0xc9, 0x7d, 0x85,
+  0x7a, 0x1e, 0x80, 0xb9, 0xb0, 0x51, 0x91, 0x00, 0xab, 0x0c, 0xbd, 0x50, 0xbe, 0x59, 0x88, 0x4b,
+  0xb8, 0x14, 0x1b, 0x00, 0x45, 0x02, 0x6c, 0xb1, 0xb1, 0xfe, 0x16, 0x01, 0x10, 0x8a, 0xa3, 0xf7,
+  0x15, 0xda, 0x72, 0x81, 0x42, 0xee, 0x2b, 0xe4, 0xb0, 0x01, 0x37, 0x6c, 0x04, 0x20, 0x25, 0x00,
+  0xcc, 0x89, 0x7a, 0x25, 0xb6, 0x4c, 0x17, 0xc8, 0x37, 0x13, 0xb8, 0x84, 0x4b, 0x00, 0xd0, 0xac,
+  0x04, 0x20, 0x14, 0x02, 0x70, 0xd7, 0x82, 0x76, 0xb4, 0xaf, 0xd0, 0xca, 0x05, 0x70, 0x84, 0x37,
+  0xb0, 0x7b, 0x29, 0xec, 0xd6, 0x7d, 0x90, 0x52, 0xe7, 0x82, 0x68, 0x99, 0xce, 0x4f, 0x03, 0xe0,
+  0x27, 0x27, 0xb9, 0xaf, 0x00, 0x28, 0xb9, 0x15, 0x08, 0xa5, 0x02, 0xe2, 0x08, 0xaf, 0x63, 0xf7,
+  0x1a, 0x23, 0x34, 0xb9, 0xc0, 0x4f, 0x75, 0x41, 0x0c, 0xe0, 0xad, 0xb3, 0xc9, 0x7d, 0x85, 0x1c,
+  0x00, 0x73, 0x61, 0x28, 0x6d, 0x00, 0x1b, 0x53, 0x0a, 0x44, 0x00, 0xc2, 0x24, 0xa3, 0x98, 0x11,
+  0x46, 0x5d, 0xf0, 0xa7, 0x5f, 0xfc, 0x52, 0x03, 0xbc, 0x75, 0x36, 0xe7, 0x88, 0xc8, 0x78, 0x81,
+  0x98, 0x13, 0xa2, 0x32, 0xdc, 0x0d, 0x9d, 0x84, 0x1b, 0xc6, 0x8c, 0x30, 0xfa, 0x1e, 0xa0, 0x14,
+  0x9e, 0x17, 0xc4, 0xbc, 0x60, 0xd7, 0xa0, 0xe3, 0x0f, 0x9f, 0x98, 0xd8, 0x79, 0xc1, 0x0f, 0x6b,
+  0x8d, 0x28, 0xa0, 0x20, 0x9f, 0x6a, 0x0c, 0xde, 0xf0, 0x20, 0x00, 0x82, 0x29, 0x78, 0x26, 0x53,
+  0xb3, 0xe3, 0x0a, 0x0d, 0x15, 0x65, 0x84, 0x63, 0x6a, 0xa1, 0xd2, 0xf3, 0x7a, 0x40, 0x40, 0x8d,
+  0x01, 0x0a, 0x96, 0xb9, 0xae, 0x1b, 0x40, 0xc4, 0x76, 0x47, 0x05, 0xe0, 0xd3, 0x27, 0x0a, 0x3a,
+  0xe8, 0x98, 0x73, 0xd4, 0x58, 0x85, 0x86, 0x8a, 0x50, 0xb6, 0xf6, 0xdb, 0xf3, 0xbf, 0xf3, 0xbc,
+  0x1a, 0x96, 0x11, 0x0a, 0x01, 0x30, 0xdc, 0xdb, 0x09, 0xd6, 0x4a, 0xb8, 0xad, 0xe2, 0x30, 0xe1,
+  0xe7, 0x02, 0x38, 0xda, 0x6c, 0x36, 0x59, 0x12, 0x00, 0x23, 0x13, 0x48, 0x80, 0x65, 0xe8, 0x98,
+  0x73, 0x12, 0xc0, 0x7b, 0x5d, 0x2a, 0xb0, 0x4c, 0x28, 0x13, 0x29, 0x00, 0x07, 0x9f, 0x52, 0x2e,
+  0x1b, 0x38, 0xda, 0x94, 0x36, 0xe0, 0x13, 0x4a, 0x52, 0x01, 0x8c, 0x4c, 0x20, 0x01, 0x02, 0x78,
+  0x6f, 0xbf, 0xbe, 0x18, 0x4a, 0x00, 0x44, 0x91, 0x5d, 0xc0, 0x46, 0x00, 0x10, 0xb2, 0x9b, 0x6a,
+  0xdf, 0x07, 0x51, 0x52, 0x36, 0x10, 0x29, 0x10, 0x7a, 0x6f, 0x7b, 0x8b, 0xb4, 0x78, 0xb9, 0x8c,
+  0x28, 0x22, 0x0d, 0xe0, 0xe7, 0x07, 0x88, 0xd6, 0x79, 0xd8, 0x4d, 0x27, 0xed, 0x05, 0xc6, 0x06,
+  0x62, 0x5e, 0x80, 0x28, 0xb8, 0x78, 0x89, 0xcb, 0x56, 0xd2, 0x08, 0x47, 0x05, 0x20, 0x9c, 0x01,
+  0xf7, 0x8a, 0xbc, 0x20, 0xe6, 0x72, 0xca, 0x0b, 0x62, 0x65, 0x4e, 0x7e, 0x23, 0x1c, 0x5c, 0x68,
+  0xb2, 0x6b, 0x44, 0x2f, 0x39, 0x17, 0x4c, 0x92, 0xbd, 0x1d, 0x5e, 0x2e, 0x58, 0x3f, 0xd6, 0xed,
+  0x76, 0x59, 0x19, 0x2b, 0x99, 0x24, 0x7b, 0x33, 0x9b, 0x56, 0xa9, 0xfc, 0xd0, 0xe6, 0x43, 0x01,
+  0x4a, 0x21, 0x2f, 0x36, 0x2f, 0x08, 0xba, 0x0c, 0x08, 0x3a, 0xe5, 0xb5, 0xd2, 0x8a, 0x44, 0x91,
+  0x93, 0x10, 0x18, 0x27, 0x06, 0x66, 0xd3, 0x8a, 0xdc, 0x90, 0xb7, 0x1b, 0xe1, 0xc6, 0x14, 0x96,
+  0xb5, 0x78, 0x04, 0x10, 0xe0, 0xee, 0xa0, 0xde, 0x73, 0xe4, 0x79, 0xe6, 0x05, 0x41, 0xa7, 0x8b,
+  0x4f, 0x07, 0x7c, 0x59, 0xa1, 0xe0, 0xa8, 0xf8, 0x21, 0xbc, 0xbf, 0x1c, 0x15, 0x83, 0x6f, 0xc9,
+  0x41, 0x69, 0x9b, 0x4f, 0x41, 0xfb, 0x58, 0xc6, 0x5b, 0x75, 0xb1, 0x3a, 0x25, 0x01, 0x4a, 0x61,
+  0xb3, 0xa9, 0x77, 0x5d, 0x01, 0x2c, 0x1f, 0x00, 0x3b, 0x26, 0x01, 0x14, 0x4a, 0x62, 0x58, 0xee,
+  0xdc, 0x81, 0xf7, 0x97, 0x5b, 0xb7, 0xe1, 0xfa, 0x55, 0xd9, 0x05, 0x2d, 0x3e, 0x05, 0xed, 0x53,
+  0xd9, 0x89, 0xda, 0xa3, 0xe6, 0x17, 0x7a, 0xdf, 0xb9, 0xd9, 0xcc, 0x07, 0xd0, 0x99, 0x99, 0xd4,
+  0x00, 0x84, 0xa2, 0x27, 0x26, 0x6e, 0x98, 0x18, 0x96, 0x47, 0x0a, 0x08, 0xb1, 0x72, 0x55, 0x76,
+  0xc1, 0x83, 0x13, 0xa1, 0x5e, 0x23, 0x3a, 0x31, 0x71, 0xb7, 0xf9, 0x79, 0x2e, 0x00, 0xd6, 0x01,
+  0x3b, 0xc4, 0x79, 0x81, 0xdf, 0xe9, 0x4c, 0x4f, 0x4a, 0x00, 0x9c, 0x9a, 0xc9, 0x50, 0xec, 0x0b,
+  0xbd, 0x84, 0x1f, 0xb7, 0x01, 0xad, 0xc0, 0x83, 0xf3, 0xf7, 0xab, 0x55, 0xfa, 0xde, 0xd2, 0x09,
+  0x91, 0x77, 0x8d, 0x28, 0x28, 0x07, 0xdd, 0xce, 0x0c, 0x9e, 0x86, 0x62, 0x9d, 0x15, 0x44, 0x41,
+  0x80, 0x87, 0xc6, 0x35, 0x99, 0xde, 0x39, 0x8d, 0xbc, 0x20, 0xb2, 0x81, 0xf6, 0x6f, 0x7a, 0xbd,
+  0x9e, 0x04, 0x38, 0x7f, 0xbb, 0x5a, 0xcd, 0x3b, 0x2c, 0x0f, 0xc0, 0x0b, 0xe9, 0x6d, 0xcb, 0x7e,
+  0xb7, 0x33, 0x9d, 0xf2, 0xef, 0x3b, 0x71, 0xd7, 0xd4, 0x36, 0x60, 0xbc, 0x60, 0xb3, 0xd7, 0x7b,
+  0x26, 0xcb, 0x7e, 0x0d, 0x28, 0xc5, 0xf7, 0x0b, 0x7c, 0xf0, 0xc2, 0x9c, 0x81, 0xe8, 0x5e, 0xaf,
+  0xf7, 0xd4, 0xe6, 0x82, 0x97, 0x3e, 0x2f, 0x60, 0xea, 0x29, 0x95, 0xcc, 0xa7, 0x3c, 0x00, 0xbc,
+  0xdd, 0x06, 0x0f, 0x4b, 0x2e, 0xc7, 0x94, 0xde, 0xf9, 0xe3, 0xc7, 0x0b, 0x03, 0x00, 0x30, 0x66,
+  0x9d, 0x49, 0x01, 0xd0, 0x3c, 0x15, 0x01, 0xe0, 0x8f, 0xad, 0x9c, 0x00, 0xb8, 0x48, 0x25, 0x01,
+  0x78, 0xab, 0x05, 0x1e, 0x96, 0x00, 0xf0, 0xf1, 0x93, 0x02, 0x78, 0xef, 0xc3, 0x17, 0x33, 0x0a,
+  0x00, 0x50, 0xa6, 0x11, 0x80, 0x8e, 0x31, 0x12, 0x40, 0x9f, 0x7e, 0x4a, 0xc5, 0xba, 0x00, 0x17,
+  0xa9, 0x76, 0x06, 0xe0, 0xef, 0xfd, 0xf3, 0x3f, 0xeb, 0x12, 0x00, 0x51, 0x24, 0x80, 0xf7, 0xef,
+  0x33, 0xaa, 0x0b, 0xb6, 0xc6, 0x58, 0x61, 0x05, 0x86, 0x74, 0x41, 0x04, 0xb0, 0xf9, 0xcc, 0x28,
+  0x40, 0x28, 0x4a, 0x81, 0x33, 0x4a, 0x01, 0x36, 0xb6, 0xc5, 0x0e, 0x56, 0x81, 0x4d, 0x63, 0x03,
+  0xf7, 0x9e, 0x1a, 0x05, 0x22, 0x1b, 0x28, 0x00, 0x90, 0x59, 0x01, 0x0d, 0x7a, 0x2f, 0xb2, 0x01,
+  0x56, 0xf2, 0x58, 0xe1, 0x2e, 0x88, 0xbc, 0x60, 0x57, 0x05, 0x28, 0xea, 0x4b, 0x80, 0xa7, 0x91,
+  0x17, 0x8c, 0xf5, 0xd9, 0x08, 0x8d, 0xd0, 0x78, 0x41, 0x6c, 0x39, 0x26, 0xe6, 0x05, 0xba, 0x8c,
+  0xa2, 0x7e, 0x3a, 0x0e, 0x14, 0x70, 0xc3, 0xc3, 0x0d, 0x44, 0xaf, 0x4e, 0x2e, 0x78, 0xf1, 0x63,
+  0xde, 0x3b, 0x4e, 0x9f, 0x05, 0x52, 0x15, 0xf3, 0x5b, 0xc9, 0xb2, 0x36, 0xe7, 0x8d, 0x81, 0xef,
+  0xa5, 0xcb, 0x72, 0x8e, 0x88, 0x86, 0x4d, 0x4e, 0xdb, 0x17, 0xaa, 0xba, 0x62, 0x7e, 0x8b, 0x42,
+  0xb1, 0x89, 0x17, 0x2d, 0xce, 0xf5, 0x91, 0xce, 0xa3, 0x4d, 0x66, 0x4e, 0xd8, 0xd5, 0xf3, 0x02,
+  0x44, 0x07, 0x53, 0xfd, 0x68, 0xf8, 0xb5, 0xc0, 0x6f, 0xbd, 0xa9, 0x00, 0x5a, 0x17, 0xaa, 0xf2,
+  0x44, 0x65, 0xa8, 0x26, 0x21, 0x5c, 0xc7, 0x8b, 0xd8, 0xbe, 0x82, 0x0f, 0x28, 0xb9, 0x97, 0xe9,
+  0x02, 0x3d, 0x0d, 0x93, 0x07, 0x53, 0xc7, 0x36, 0xe6, 0xe7, 0xe7, 0x9f, 0x5f, 0xa8, 0x2a, 0x55,
+  0xae, 0xf3, 0x5b, 0xe3, 0x38, 0x2a, 0x06, 0xb1, 0xb9, 0x9c, 0x86, 0xd5, 0x51, 0x04, 0x09, 0xe0,
+  0x79, 0x27, 0xdd, 0xf8, 0xbe, 0x42, 0x31, 0x05, 0x18, 0xf3, 0x69, 0x1a, 0xf6, 0xf0, 0xa3, 0x8f,
+  0x6e, 0xf4, 0x69, 0x43, 0x72, 0x55, 0xa2, 0x98, 0x51, 0x31, 0x75, 0x01, 0x8a, 0x0d, 0xff, 0x25,
+  0x0f, 0x32, 0x21, 0x8a, 0x53, 0xd8, 0x06, 0x94, 0x02, 0x6b, 0xde, 0xa9, 0x7e, 0xff, 0x39, 0x96,
+  0xdd, 0x21, 0x94, 0x71, 0xa1, 0xbb, 0xa0, 0x61, 0x46, 0xc5, 0x75, 0xbd, 0x69, 0xb5, 0xe5, 0x16,
+  0x3d, 0xc8, 0x34, 0x70, 0x16, 0x08, 0xca, 0x6e, 0xc0, 0xbf, 0x61, 0x2e, 0x58, 0x26, 0x14, 0x63,
+  0xf1, 0xdc, 0x64, 0xcd, 0x56, 0x3d, 0x75, 0xac, 0x17, 0x51, 0x1c, 0x71, 0x00, 0x4b, 0x34, 0x88,
+  0x72, 0x7d, 0xf0, 0x4c, 0x29, 0x17, 0x83, 0x00, 0xcc, 0x39, 0xcc, 0xbd, 0xe3, 0xbc, 0x00, 0xaf,
+  0x4e, 0x2e, 0x78, 0xfe, 0xfd, 0xcc, 0x05, 0x2e, 0x3e, 0x45, 0x43, 0xf1, 0xda, 0x0e, 0xfb, 0x00,
+  0xf3, 0x17, 0x93, 0x65, 0xb3, 0xd0, 0xcb, 0x97, 0x77, 0x84, 0xa2, 0xa5, 0xe2, 0x7c, 0x00, 0x8f,
+  0x9a, 0xcd, 0x45, 0x7d, 0xa1, 0x25, 0xb6, 0x02, 0xba, 0x71, 0xcd, 0xd3, 0x8d, 0xcd, 0x5f, 0xc4,
+  0xb5, 0x80, 0x21, 0x87, 0x9b, 0x62, 0x67, 0x11, 0x0b, 0x28, 0xf0, 0x68, 0x51, 0xbf, 0xc5, 0x5d,
+  0x40, 0x31, 0xb9, 0x60, 0xfe, 0x62, 0x4d, 0x55, 0xbc, 0x7a, 0xcd, 0x43, 0x00, 0x77, 0x96, 0x5d,
+  0x96, 0x00, 0xa8, 0xc5, 0x25, 0x91, 0x3c, 0xd0, 0xa8, 0xce, 0x22, 0xe6, 0x03, 0xf0, 0xd4, 0x01,
+  0xd6, 0xbb, 0x8b, 0xf2, 0xcd, 0x20, 0xf1, 0xfe, 0xfe, 0xf9, 0x35, 0x4f, 0xe7, 0x82, 0xf9, 0x8b,
+  0x13, 0xa4, 0x40, 0x69, 0x4d, 0x2a, 0xb0, 0x14, 0x9d, 0x2b, 0x71, 0x21, 0x1d, 0xb9, 0x45, 0x0f,
+  0x34, 0x42, 0x17, 0x18, 0x00, 0x8f, 0x0e, 0xb0, 0x42, 0xc9, 0x8d, 0xfe, 0x95, 0x1a, 0x6d, 0xe9,
+  0x13, 0x0a, 0x2d, 0xc7, 0x40, 0xc4, 0x91, 0x41, 0x67, 0xc9, 0x99, 0x65, 0x97, 0xd4, 0xc1, 0x16,
+  0xbc, 0x0b, 0xa3, 0x14, 0x60, 0xf9, 0x15, 0x88, 0x75, 0x01, 0x01, 0xdc, 0xaf, 0xbe, 0xa1, 0x72,
+  0xc1, 0x5d, 0x42, 0xa1, 0x73, 0xc5, 0x0f, 0x8c, 0xc1, 0x2d, 0xb1, 0xd2, 0xb2, 0x52, 0x00, 0xd3,
+  0x98, 0x56, 0xc0, 0x1f, 0x81, 0x0d, 0x2c, 0x8a, 0x54, 0x2e, 0xb8, 0x4d, 0x28, 0x22, 0x0d, 0xe0,
+  0xa8, 0xc5, 0x4b, 0xbc, 0x88, 0xa1, 0x23, 0xa1, 0x23, 0x46, 0xa0, 0xc0, 0xa2, 0xc8, 0x92, 0x0b,
+  0x96, 0x62, 0x47, 0x38, 0x4c, 0x1c, 0x70, 0x1c, 0x51, 0xfc, 0x4c, 0xe9, 0x30, 0x80, 0x21, 0x3e,
+  0xbf, 0x34, 0x34, 0x17, 0xe4, 0x8c, 0x03, 0x87, 0x9e, 0x0b, 0xdc, 0x57, 0x61, 0x5e, 0x10, 0x98,
+  0x6b, 0xbf, 0x7b, 0xe4, 0x02, 0xf7, 0x80, 0xe6, 0x05, 0xaf, 0x99, 0x6b, 0xbf, 0xbe, 0xba, 0xf6,
+  0xbb, 0xc3, 0x1d, 0x63, 0x77, 0xef, 0xbd, 0xa5, 0x5c, 0x07, 0x1a, 0x17, 0xf4, 0xb5, 0x5f, 0xbc,
+  0x76, 0xab, 0xb6, 0xe8, 0x06, 0xef, 0x18, 0xef, 0x34, 0x7f, 0x28, 0x0e, 0x50, 0xd9, 0xd8, 0x54,
+  0xa3, 0x62, 0x7f, 0x41, 0x5f, 0xfb, 0x1d, 0x76, 0xc7, 0x38, 0xc4, 0xcb, 0x57, 0x03, 0xf3, 0x87,
+  0xe2, 0x00, 0x1b, 0x9d, 0x85, 0x39, 0x55, 0x09, 0xa0, 0xc8, 0x8d, 0xcb, 0x21, 0x77, 0x8c, 0xf1,
+  0xcc, 0x92, 0xab, 0xb3, 0x21, 0x5e, 0xbe, 0x1a, 0x19, 0xc0, 0x67, 0xdd, 0x8a, 0xea, 0xdb, 0x55,
+  0x40, 0x11, 0x3b, 0xde, 0x31, 0x8e, 0x14, 0x80, 0xc9, 0x83, 0x93, 0x3e, 0xe4, 0x58, 0x00, 0xa0,
+  0xdb, 0xed, 0xa8, 0x4a, 0x00, 0x45, 0xf5, 0xed, 0xd0, 0x3b, 0xc6, 0x31, 0x1b, 0x18, 0xa9, 0x02,
+  0x9f, 0x74, 0x67, 0x54, 0x25, 0x80, 0x22, 0x76, 0xbd, 0x63, 0x3c, 0x38, 0x7f, 0x18, 0x05, 0xc0,
+  0xc3, 0xaf, 0x75, 0x25, 0x9f, 0x74, 0xa7, 0xc5, 0xae, 0x77, 0x8c, 0x0f, 0xc8, 0x0d, 0x4d, 0x25,
+  0x77, 0xbe, 0xce, 0x3c, 0x28, 0x75, 0xec, 0xde, 0xf1, 0x0f, 0x6c, 0x8d, 0xc8, 0x02, 0x58, 0x00,
+  0x0b, 0x60, 0x01, 0xec, 0x5d, 0x33, 0x9b, 0x0b, 0x2c, 0x80, 0x05, 0xb0, 0x00, 0x16, 0xc0, 0xe6,
+  0x02, 0x9b, 0x0b, 0x2c, 0x80, 0x05, 0xb0, 0x00, 0x16, 0xc0, 0xe6, 0x02, 0x9b, 0x0b, 0x2c, 0x80,
+  0x05, 0xb0, 0x00, 0x16, 0xc0, 0xe6, 0x02, 0x9b, 0x0b, 0x2c, 0x80, 0x05, 0xb0, 0x00, 0x16, 0xc0,
+  0xe6, 0x02, 0x9b, 0x0b, 0x2c, 0x80, 0x05, 0xb0, 0x00, 0x16, 0xc0, 0xe6, 0x02, 0x9b, 0x0b, 0x2c,
+  0x80, 0x05, 0xb0, 0x00, 0x16, 0xc0, 0xe6, 0x02, 0x9b, 0x0b, 0x2c, 0x80, 0x05, 0xb0, 0x00, 0x16,
+  0xe0, 0x47, 0x9d, 0x0b, 0xfa, 0x87, 0xfc, 0x58, 0x00, 0x0b, 0x60, 0x01, 0x2c, 0x80, 0x05, 0xb0,
+  0x00, 0x16, 0xc0, 0x02, 0x58, 0x00, 0x0b, 0x60, 0x01, 0x2c, 0x80, 0x05, 0x38, 0x74, 0x80, 0xff,
+  0x03, 0x2e, 0x24, 0x98, 0xbe, 0xb2, 0xfc, 0x05, 0x31, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
+  0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+//------------------------------------------------------------------------------
+
+static const Asset s_assets[] =
+{
+	{ "ShastonHi640.ttf", ShastonHi640_ttf, sizeof(ShastonHi640_ttf) },
+	{ "buttons.png", buttons_png, sizeof(buttons_png) },
+};
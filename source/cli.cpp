@@ -0,0 +1,1828 @@
+//
+// Command Line Interface
+//
+#include "cli.h"
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "pipeline.h"
+#include "files.h"
+#include "watcher.h"
+#include "cache.h"
+#include "manifest.h"
+#include "palettes.h"
+#include "dither.h"
+#include "jobs.h"
+#include "concurrent_queue.h"
+#include "bounded_queue.h"
+#include "progress.h"
+
+#include <map>
+#include <set>
+#include <signal.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+//------------------------------------------------------------------------------
+
+typedef int (*CommandFunc)(int argc, char* argv[]);
+
+static int ConvertCommand(int argc, char* argv[]);
+static int WatchCommand(int argc, char* argv[]);
+static int RunCommand(int argc, char* argv[]);
+static int BenchCommand(int argc, char* argv[]);
+
+static const struct
+{
+	const char* pName;
+	CommandFunc pFunc;
+	const char* pHelp;
+} s_commands[] =
+{
+	{ "convert", ConvertCommand, "Convert images to $C1, packed $C0, or 16 color PNG" },
+	{ "watch",   WatchCommand,   "Keep converting images, as they change in a directory" },
+	{ "run",     RunCommand,     "Run the stages in a manifest, over many images" },
+	{ "bench",   BenchCommand,   "Time the thread queues, check dithering on any number of workers" },
+};
+
+static const int NUM_COMMANDS = (int)(sizeof(s_commands)/sizeof(s_commands[0]));
+
+// Exit codes
+enum
+{
+	eExitSuccess = 0,
+	eExitFailed  = 1,
+	eExitUsage   = 2
+};
+
+//------------------------------------------------------------------------------
+
+bool CLI_IsCommand(const char* pArg)
+{
+	for (int idx = 0; idx < NUM_COMMANDS; ++idx)
+	{
+		if (0 == strcmp(pArg, s_commands[ idx ].pName))
+			return true;
+	}
+
+	if ((0 == strcmp(pArg, "--help")) || (0 == strcmp(pArg, "-h")))
+		return true;
+
+	return false;
+}
+
+//------------------------------------------------------------------------------
+
+int CLI_Main(int argc, char* argv[])
+{
+#ifdef _WIN32
+	// The Release build is a Windows app, so borrow the console we were
+	// started from, if there is one, but leave anything that was
+	// redirected alone, or d16 convert - > out.c1 would go to the console
+	if (AttachConsole(ATTACH_PARENT_PROCESS))
+	{
+		if (FILE_TYPE_UNKNOWN == GetFileType(GetStdHandle(STD_OUTPUT_HANDLE)))
+			freopen("CONOUT$", "w", stdout);
+		if (FILE_TYPE_UNKNOWN == GetFileType(GetStdHandle(STD_ERROR_HANDLE)))
+			freopen("CONOUT$", "w", stderr);
+	}
+#endif
+
+	for (int idx = 0; idx < NUM_COMMANDS; ++idx)
+	{
+		if (0 == strcmp(argv[1], s_commands[ idx ].pName))
+		{
+			// No video, SDL_image, and threads is all we need
+			// SDL_image loads the library for each format, the first time
+			// it sees one, so there is no IMG_Init here, a run that only
+			// sees PNG, doesn't pay for jpeg, tiff, and webp
+			SDL_Init(0);
+
+			int result = s_commands[ idx ].pFunc(argc - 1, argv + 1);
+
+			IMG_Quit();
+			SDL_Quit();
+
+			return result;
+		}
+	}
+
+	printf("Usage: d16 <command> [options]\n\n");
+	printf("With no command, d16 starts the editor\n\n");
+
+	for (int idx = 0; idx < NUM_COMMANDS; ++idx)
+	{
+		printf("  %-10s %s\n", s_commands[ idx ].pName, s_commands[ idx ].pHelp);
+	}
+
+	printf("\nd16 <command> --help, for the options of each command\n");
+
+	// Only asking for it, isn't a mistake
+	if ((0 == strcmp(argv[1], "--help")) || (0 == strcmp(argv[1], "-h")))
+		return eExitSuccess;
+
+	return eExitUsage;
+}
+
+//------------------------------------------------------------------------------
+//
+// Options shared by d16 convert, and d16 watch
+//
+//------------------------------------------------------------------------------
+
+struct ConvertArgs
+{
+	ConvertArgs()
+		: m_bRecursive(false)
+		, m_numThreads(SDL_GetCPUCount())
+		, m_debounceMS(250)
+		, m_bCache(true)
+		, m_cacheBytes(ConversionCache::DEFAULT_MAX_BYTES)
+		, m_bProgress(false)
+	{
+	}
+
+	ConvertOptions m_options;
+	std::string m_outputDirectory;
+	bool m_bRecursive;
+	int  m_numThreads;
+	int  m_debounceMS;   // watch only
+
+	bool m_bCache;
+	std::string m_cacheDirectory;  // empty for the default
+	long long m_cacheBytes;
+
+	bool m_bProgress;    // convert only
+	std::string m_progressFile;  // --progress=<file>, empty for stderr
+
+	std::vector<std::string> m_inputs;
+};
+
+static void ConvertOptionsUsage()
+{
+	printf("  -o, --output <dir>        Where results go (default: next to each input)\n");
+	printf("  -f, --format <c1|pnt|apf|png>\n");
+	printf("                            Output format, pnt is PackBytes $C0, apf keeps the\n");
+	printf("                            size (default: c1)\n");
+	printf("      --level <0-9>         PNG compression, 1 is fastest, 9 smallest (default: %d)\n",
+		   (int)eDeflateDefault);
+	printf("  -p, --posterize <444|555|888>\n");
+	printf("                            Target color resolution (default: 444)\n");
+	printf("  -d, --dither <0-100>      Dither percentage (default: 50)\n");
+	printf("      --dither-method <name>\n");
+	printf("                            diffusion (libimagequant's), floyd, atkinson,\n");
+	printf("                            sierralite, jjn, bayer2, bayer4, bayer8,\n");
+	printf("                            cluster4, cluster8, or bluenoise\n");
+	printf("                            (default: diffusion)\n");
+	printf("  -l, --palette <file>      Lock the colors in this palette file\n");
+	printf("                            (.pal, .gpl, .act, or a .png strip)\n");
+	printf("  -s, --size <W>x<H>        Resize the source first\n");
+	printf("      --filter <point|linear|lanczos|avir>\n");
+	printf("                            Resize filter (default: avir)\n");
+	printf("      --crop                Reposition (centered), instead of scaling\n");
+	printf("  -R, --recursive           Go into sub directories\n");
+	printf("  -j, --jobs <n>            Worker threads (default: number of CPUs)\n");
+	printf("      --cache <dir>         Where to keep conversion results, for next time\n");
+	printf("      --cache-size <MB>     Least recently used results go, over this (default: %d)\n",
+		   (int)(ConversionCache::DEFAULT_MAX_BYTES / (1024 * 1024)));
+	printf("      --no-cache            Convert everything, don't read or write the cache\n");
+	printf("  -h, --help                This help\n");
+}
+
+static void ConvertUsage()
+{
+	printf("Usage: d16 convert [options] <file|directory>...\n");
+	printf("       d16 convert [options] - < input > output\n\n");
+	printf("With -, the image comes in on stdin, and the result goes to stdout\n\n");
+	ConvertOptionsUsage();
+	printf("      --progress[=<file>]   Progress, and item lines, as JSON, for scripts, to\n");
+	printf("                            stderr, or the file (default: off)\n");
+	printf("                            (with -, the time to the first byte, on stderr)\n");
+	printf("\nCtrl+C cancels, what has started stops at the next step\n");
+}
+
+static void WatchUsage()
+{
+	printf("Usage: d16 watch [options] <directory>...\n\n");
+	printf("Converts anything that is out of date, then keeps converting images\n");
+	printf("as they are saved, until Ctrl+C\n\n");
+	ConvertOptionsUsage();
+	printf("      --debounce <ms>       Wait for a file to be quiet this long (default: 250)\n");
+}
+
+static bool ParseSize(const char* pArg, int& width, int& height)
+{
+	return (2 == sscanf(pArg, "%dx%d", &width, &height)) && (width > 0) && (height > 0);
+}
+
+//------------------------------------------------------------------------------
+// Returns -1 to keep going, otherwise the exit code
+static int ParseConvertArgs(const char* pCommand, int argc, char* argv[],
+							ConvertArgs& args, void (*pUsage)())
+{
+	ConvertOptions& options = args.m_options;
+	std::string paletteFile;
+
+	bool bWatch = (0 == strcmp(pCommand, "watch"));
+
+	for (int idx = 1; idx < argc; ++idx)
+	{
+		std::string arg = argv[ idx ];
+
+		// Options that take a value
+		const char* pValue = ((idx + 1) < argc) ? argv[ idx + 1 ] : nullptr;
+		bool bNeedsValue = true;
+
+		if ((arg == "-h") || (arg == "--help"))
+		{
+			pUsage();
+			return eExitSuccess;
+		}
+		else if ((arg == "-R") || (arg == "--recursive"))
+		{
+			args.m_bRecursive = true;
+			bNeedsValue = false;
+		}
+		else if (arg == "--crop")
+		{
+			options.m_bCrop = true;
+			bNeedsValue = false;
+		}
+		else if (arg == "--no-cache")
+		{
+			args.m_bCache = false;
+			bNeedsValue = false;
+		}
+		else if (!bWatch && (arg == "--progress"))
+		{
+			args.m_bProgress = true;
+			bNeedsValue = false;
+		}
+		else if (!bWatch && (0 == arg.compare(0, 11, "--progress=")))
+		{
+			args.m_bProgress = true;
+			args.m_progressFile = arg.substr(11);
+			bNeedsValue = false;
+		}
+		else if (('-' != arg[0]) || (arg == "-"))
+		{
+			args.m_inputs.push_back(arg);
+			bNeedsValue = false;
+		}
+		else if (nullptr == pValue)
+		{
+			fprintf(stderr, "d16 %s: %s needs a value\n", pCommand, arg.c_str());
+			return eExitUsage;
+		}
+		else if ((arg == "-o") || (arg == "--output"))
+		{
+			args.m_outputDirectory = pValue;
+		}
+		else if ((arg == "-f") || (arg == "--format"))
+		{
+			if (0 == SDL_strcasecmp(pValue, "c1"))
+				options.m_iFormat = eOutputC1;
+			else if (0 == SDL_strcasecmp(pValue, "png"))
+				options.m_iFormat = eOutputPNG;
+			else if (0 == SDL_strcasecmp(pValue, "pnt"))
+				options.m_iFormat = eOutputPNT;
+			else if (0 == SDL_strcasecmp(pValue, "apf"))
+				options.m_iFormat = eOutputAPF;
+			else
+			{
+				fprintf(stderr, "d16 %s: unknown format %s\n", pCommand, pValue);
+				return eExitUsage;
+			}
+		}
+		else if (arg == "--level")
+		{
+			options.m_pngLevel = atoi(pValue);
+
+			if ((options.m_pngLevel < eDeflateStore) || (options.m_pngLevel > eDeflateSmallest))
+			{
+				fprintf(stderr, "d16 %s: level must be 0-9\n", pCommand);
+				return eExitUsage;
+			}
+		}
+		else if ((arg == "-p") || (arg == "--posterize"))
+		{
+			options.m_quantize.m_iPosterize = PosterizeFromName(pValue);
+
+			if (options.m_quantize.m_iPosterize < 0)
+			{
+				fprintf(stderr, "d16 %s: posterize must be 444, 555, or 888\n", pCommand);
+				return eExitUsage;
+			}
+		}
+		else if ((arg == "-d") || (arg == "--dither"))
+		{
+			options.m_quantize.m_iDither = atoi(pValue);
+
+			if ((options.m_quantize.m_iDither < 0) || (options.m_quantize.m_iDither > 100))
+			{
+				fprintf(stderr, "d16 %s: dither must be 0-100\n", pCommand);
+				return eExitUsage;
+			}
+		}
+		else if (arg == "--dither-method")
+		{
+			options.m_quantize.m_iDitherMethod = DitherFromName(pValue);
+
+			if (options.m_quantize.m_iDitherMethod < 0)
+			{
+				fprintf(stderr, "d16 %s: unknown dither method %s\n", pCommand, pValue);
+				return eExitUsage;
+			}
+		}
+		else if ((arg == "-l") || (arg == "--palette"))
+		{
+			paletteFile = pValue;
+		}
+		else if ((arg == "-s") || (arg == "--size"))
+		{
+			if (!ParseSize(pValue, options.m_width, options.m_height))
+			{
+				fprintf(stderr, "d16 %s: size should look like 320x200\n", pCommand);
+				return eExitUsage;
+			}
+		}
+		else if (arg == "--filter")
+		{
+			options.m_iFilter = ScaleFilterFromName(pValue);
+
+			if (options.m_iFilter < 0)
+			{
+				fprintf(stderr, "d16 %s: unknown filter %s\n", pCommand, pValue);
+				return eExitUsage;
+			}
+		}
+		else if ((arg == "-j") || (arg == "--jobs"))
+		{
+			args.m_numThreads = atoi(pValue);
+
+			if (args.m_numThreads < 1)
+			{
+				fprintf(stderr, "d16 %s: jobs must be at least 1\n", pCommand);
+				return eExitUsage;
+			}
+		}
+		else if (arg == "--cache")
+		{
+			args.m_cacheDirectory = pValue;
+		}
+		else if (arg == "--cache-size")
+		{
+			int megabytes = atoi(pValue);
+
+			if (megabytes < 1)
+			{
+				fprintf(stderr, "d16 %s: cache size must be at least 1MB\n", pCommand);
+				return eExitUsage;
+			}
+
+			args.m_cacheBytes = megabytes * 1024LL * 1024LL;
+		}
+		else if (bWatch && (arg == "--debounce"))
+		{
+			args.m_debounceMS = atoi(pValue);
+
+			if (args.m_debounceMS < 0)
+			{
+				fprintf(stderr, "d16 %s: debounce can't be negative\n", pCommand);
+				return eExitUsage;
+			}
+		}
+		else
+		{
+			fprintf(stderr, "d16 %s: unknown option %s\n", pCommand, arg.c_str());
+			pUsage();
+			return eExitUsage;
+		}
+
+		if (bNeedsValue)
+			++idx;
+	}
+
+	if (args.m_inputs.empty())
+	{
+		pUsage();
+		return eExitUsage;
+	}
+
+	if (!paletteFile.empty())
+	{
+		if (!LoadPaletteFile(paletteFile, options.m_quantize.m_lockedColors,
+							 options.m_quantize.m_numColors))
+		{
+			fprintf(stderr, "d16 %s: %s\n", pCommand, D16_GetError());
+			return eExitFailed;
+		}
+	}
+
+	if (args.m_bCache && args.m_cacheDirectory.empty())
+	{
+		args.m_cacheDirectory = ConversionCache::DefaultDirectory();
+
+		// Nowhere to put it, just go without
+		args.m_bCache = !args.m_cacheDirectory.empty();
+	}
+
+	return -1;
+}
+
+// nullptr, when the cache is off
+static ConversionCache* CreateCache(const ConvertArgs& args)
+{
+	if (!args.m_bCache)
+		return nullptr;
+
+	return new ConversionCache(args.m_cacheDirectory, args.m_cacheBytes);
+}
+
+//------------------------------------------------------------------------------
+
+static double ElapsedMilliseconds(Uint64 startTime)
+{
+	Uint64 elapsed = SDL_GetPerformanceCounter() - startTime;
+
+	return (elapsed * 1000.0) / SDL_GetPerformanceFrequency();
+}
+
+//------------------------------------------------------------------------------
+
+struct ConvertJob
+{
+	ConvertJob()
+		: m_bSuccess(false)
+		, m_milliseconds(0.0)
+		, m_numPixels(0)
+		, m_progressId(0)
+	{
+	}
+
+	std::string m_input;
+	std::string m_output;
+
+	bool m_bSuccess;
+	double m_milliseconds;
+	long long m_numPixels;
+	std::string m_error;
+
+	int m_progressId;    // in the batch's BatchProgress, 0 if there isn't one
+};
+
+//------------------------------------------------------------------------------
+// Runs on a worker, with that worker's warm Converter
+static void RunConvertJob(Converter& converter, ConvertJob& job)
+{
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	job.m_bSuccess = MakeDirectories(GetDirectory(job.m_output)) &&
+					 converter.ConvertFile(job.m_input, job.m_output, &job.m_numPixels);
+
+	job.m_milliseconds = ElapsedMilliseconds(startTime);
+
+	if (!job.m_bSuccess)
+	{
+		job.m_error = D16_GetError();
+	}
+}
+
+//------------------------------------------------------------------------------
+// With --progress on stderr, the human errors move over to stdout, with the
+// rest of the human text, so stderr is nothing but JSON
+
+static FILE* ErrorFile(FILE* pProgressFile)
+{
+	return (stderr == pProgressFile) ? stdout : stderr;
+}
+
+// pProgressFile is nullptr without --progress
+static void PrintConvertJob(const ConvertJob& job, FILE* pProgressFile)
+{
+	if (job.m_bSuccess)
+	{
+		printf("%9.1fms  %s -> %s\n", job.m_milliseconds,
+			   job.m_input.c_str(), job.m_output.c_str());
+		fflush(stdout);
+	}
+	else
+	{
+		fprintf(ErrorFile(pProgressFile), "%9.1fms  FAILED %s: %s\n", job.m_milliseconds,
+				job.m_input.c_str(), job.m_error.c_str());
+	}
+}
+
+//------------------------------------------------------------------------------
+//
+// d16 convert
+//
+//------------------------------------------------------------------------------
+
+struct ConvertBatch
+{
+	const ConvertOptions* m_pOptions;
+	ConversionCache* m_pCache;
+	std::vector<ConvertJob> m_jobs;
+
+	// One per worker, and one for the calling thread, made on first use, so
+	// each stays warm across the files that land on it
+	std::vector<Converter*> m_converters;
+
+	SDL_atomic_t m_numFailed;
+
+	BatchProgress m_progress;
+	FILE* m_pProgressFile;     // --progress, nullptr without it
+
+	SDL_mutex* m_pPrintMutex;  // keep lines from different workers apart
+};
+
+//------------------------------------------------------------------------------
+
+static void ConvertFile(ConvertBatch* pBatch, int jobIndex)
+{
+	int slot = JobSystem::GetDefault().GetCurrentWorker() + 1;
+
+	Converter*& pConverter = pBatch->m_converters[ slot ];
+
+	if (nullptr == pConverter)
+		pConverter = new Converter(*pBatch->m_pOptions, pBatch->m_pCache);
+
+	ConvertJob& job = pBatch->m_jobs[ jobIndex ];
+	BatchProgress& progress = pBatch->m_progress;
+
+	if (progress.Start(job.m_progressId))
+	{
+		BatchProgress::Binding binding = { &progress, job.m_progressId };
+
+		pConverter->SetProgress(BatchProgress::ReportItem, &binding);
+		RunConvertJob(*pConverter, job);
+		pConverter->SetProgress(nullptr, nullptr);
+	}
+	else
+	{
+		job.m_bSuccess = false;
+		job.m_error = "Canceled";
+	}
+
+	progress.Finish(job.m_progressId, job.m_bSuccess, job.m_numPixels, job.m_error);
+
+	if (!job.m_bSuccess)
+	{
+		SDL_AtomicAdd(&pBatch->m_numFailed, 1);
+	}
+
+	SDL_LockMutex(pBatch->m_pPrintMutex);
+
+	PrintConvertJob(job, pBatch->m_pProgressFile);
+
+	if (pBatch->m_pProgressFile)
+	{
+		std::vector<ProgressItem> items;
+		progress.GetItems(items);
+
+		for (int idx = 0; idx < (int)items.size(); ++idx)
+		{
+			if (items[ idx ].m_id == job.m_progressId)
+			{
+				fprintf(pBatch->m_pProgressFile, "%s\n", FormatProgressItem(items[ idx ]).c_str());
+				break;
+			}
+		}
+
+		fflush(pBatch->m_pProgressFile);
+	}
+
+	SDL_UnlockMutex(pBatch->m_pPrintMutex);
+}
+
+//------------------------------------------------------------------------------
+// Ctrl+C during a convert, or a run, cancels the batch, rather than killing
+// the process, so the files that are half written get cleaned up, and the
+// summary still gets printed.  A second Ctrl+C is the usual kind
+
+static volatile sig_atomic_t s_bCancelBatch = 0;
+
+static void CancelBatch(int)
+{
+	s_bCancelBatch = 1;
+	signal(SIGINT, SIG_DFL);
+}
+
+struct BatchTicker
+{
+	BatchProgress* m_pProgress;
+	FILE* m_pProgressFile;
+	bool m_bCanceled;
+	Uint32 m_lastPrint;
+	SDL_mutex* m_pPrintMutex;
+};
+
+// Called on the main thread, while it waits, about every 100ms
+static void TickBatch(void* pUserData)
+{
+	BatchTicker& ticker = *(BatchTicker*)pUserData;
+
+	if (s_bCancelBatch && !ticker.m_bCanceled)
+	{
+		ticker.m_bCanceled = true;
+		ticker.m_pProgress->CancelAll();
+		fprintf(ErrorFile(ticker.m_pProgressFile), "Canceling, Ctrl+C again to quit now\n");
+	}
+
+	if (ticker.m_pProgressFile && (SDL_GetTicks() - ticker.m_lastPrint >= 1000))
+	{
+		ticker.m_lastPrint = SDL_GetTicks();
+
+		ProgressSummary summary;
+		ticker.m_pProgress->GetSummary(summary);
+
+		if (ticker.m_pPrintMutex)
+			SDL_LockMutex(ticker.m_pPrintMutex);
+
+		fprintf(ticker.m_pProgressFile, "%s\n", FormatProgressLine(summary).c_str());
+		fflush(ticker.m_pProgressFile);
+
+		if (ticker.m_pPrintMutex)
+			SDL_UnlockMutex(ticker.m_pPrintMutex);
+	}
+}
+
+static void PrintFinalProgress(BatchProgress& progress, FILE* pFile)
+{
+	ProgressSummary summary;
+	progress.GetSummary(summary);
+
+	fprintf(pFile, "%s\n", FormatProgressLine(summary).c_str());
+	fflush(pFile);
+}
+
+//------------------------------------------------------------------------------
+// The JSON lines go to stderr, or a file of their own, never stdout, so a
+// script reading them doesn't have to pick them out of the human text
+
+static FILE* OpenProgressFile(const char* pCommand, const std::string& filename)
+{
+	if (filename.empty())
+		return stderr;
+
+	FILE* pFile = fopen(filename.c_str(), "w");
+
+	if (nullptr == pFile)
+		fprintf(stderr, "d16 %s: couldn't open %s, for --progress\n", pCommand, filename.c_str());
+
+	return pFile;
+}
+
+static void CloseProgressFile(FILE* pFile)
+{
+	if (pFile && (stderr != pFile))
+		fclose(pFile);
+}
+
+//------------------------------------------------------------------------------
+// d16 convert -
+//
+// For make, and ninja rules, one image, stdin to stdout.  No directory
+// scanning, and nothing but the result on stdout
+//
+static int StreamConvert(const ConvertArgs& args)
+{
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	// One image, the engine's row bands don't need a thread per CPU
+	JobSystem::CreateDefault(1);
+
+#ifdef _WIN32
+	_setmode(_fileno(stdin), _O_BINARY);
+	_setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+	std::vector<Uint8> input;
+	char buffer[ 64 * 1024 ];
+	size_t numRead;
+
+	while ((numRead = fread(buffer, 1, sizeof(buffer), stdin)) > 0)
+	{
+		input.insert(input.end(), buffer, buffer + numRead);
+	}
+
+	if (input.empty())
+	{
+		fprintf(stderr, "d16 convert: nothing on stdin\n");
+		return eExitFailed;
+	}
+
+	RGBAImage* pSource = LoadRGBAImage(&input[0], input.size());
+
+	if (nullptr == pSource)
+	{
+		fprintf(stderr, "d16 convert: %s\n", D16_GetError());
+		return eExitFailed;
+	}
+
+	ConversionCache* pCache = CreateCache(args);
+
+	if (pCache)
+		pCache->SetShortLived(true);
+
+	IndexedImage* pResult = nullptr;
+	{
+		Converter converter(args.m_options, pCache);
+		pResult = converter.Convert(*pSource);
+	}
+
+	delete pSource;
+	delete pCache;
+
+	std::vector<Uint8> output;
+
+	bool bSuccess = (nullptr != pResult) &&
+					EncodeConverted(*pResult, args.m_options.m_iFormat, output,
+									args.m_options.m_pngLevel);
+
+	delete pResult;
+
+	if (!bSuccess)
+	{
+		fprintf(stderr, "d16 convert: %s\n", D16_GetError());
+		return eExitFailed;
+	}
+
+	if (args.m_bProgress)
+	{
+		FILE* pProgressFile = OpenProgressFile("convert", args.m_progressFile);
+
+		if (pProgressFile)
+		{
+			fprintf(pProgressFile, "stream {\"first_byte_ms\":%.1f}\n", ElapsedMilliseconds(startTime));
+			CloseProgressFile(pProgressFile);
+		}
+	}
+
+	if ((output.size() != fwrite(&output[0], 1, output.size(), stdout)) ||
+		(0 != fflush(stdout)))
+	{
+		fprintf(stderr, "d16 convert: couldn't write to stdout\n");
+		return eExitFailed;
+	}
+
+	return eExitSuccess;
+}
+
+//------------------------------------------------------------------------------
+
+static int ConvertCommand(int argc, char* argv[])
+{
+	ConvertArgs args;
+
+	int result = ParseConvertArgs("convert", argc, argv, args, ConvertUsage);
+
+	if (result >= 0)
+		return result;
+
+	for (int idx = 0; idx < (int)args.m_inputs.size(); ++idx)
+	{
+		if (args.m_inputs[ idx ] == "-")
+		{
+			if ((args.m_inputs.size() > 1) || !args.m_outputDirectory.empty())
+			{
+				fprintf(stderr, "d16 convert: - can't be used with other inputs, or -o\n");
+				return eExitUsage;
+			}
+
+			return StreamConvert(args);
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// Figure out the whole list, before any work starts
+
+	ConvertBatch batch;
+	batch.m_pOptions = &args.m_options;
+	batch.m_pCache = CreateCache(args);
+
+	for (int idx = 0; idx < (int)args.m_inputs.size(); ++idx)
+	{
+		const std::string& input = args.m_inputs[ idx ];
+
+		std::vector<std::string> files;
+		std::string root;
+
+		if (IsDirectory(input))
+		{
+			CollectImageFiles(input, args.m_bRecursive, files);
+			root = input;
+		}
+		else
+		{
+			files.push_back(input);
+		}
+
+		for (int fileIndex = 0; fileIndex < (int)files.size(); ++fileIndex)
+		{
+			ConvertJob job;
+			job.m_input  = files[ fileIndex ];
+			job.m_output = MakeOutputPath(job.m_input, root, args.m_outputDirectory,
+										  args.m_options.m_iFormat);
+			job.m_progressId = batch.m_progress.Add(job.m_input);
+
+			batch.m_jobs.push_back(job);
+		}
+	}
+
+	if (batch.m_jobs.empty())
+	{
+		fprintf(stderr, "d16 convert: no images found\n");
+		delete batch.m_pCache;
+		return eExitFailed;
+	}
+
+	batch.m_pProgressFile = nullptr;
+
+	if (args.m_bProgress)
+	{
+		batch.m_pProgressFile = OpenProgressFile("convert", args.m_progressFile);
+
+		if (nullptr == batch.m_pProgressFile)
+		{
+			delete batch.m_pCache;
+			return eExitFailed;
+		}
+	}
+
+	//--------------------------------------------------------------------------
+
+	// Small batches don't need a thread per CPU
+	int numThreads = args.m_numThreads;
+
+	if (numThreads > (int)batch.m_jobs.size())
+		numThreads = (int)batch.m_jobs.size();
+
+	JobSystem::CreateDefault(numThreads);
+	JobSystem& jobs = JobSystem::GetDefault();
+
+	batch.m_converters.resize(jobs.GetNumWorkers() + 1, nullptr);
+	SDL_AtomicSet(&batch.m_numFailed, 0);
+	batch.m_pPrintMutex = SDL_CreateMutex();
+
+	BatchTicker ticker = { &batch.m_progress, batch.m_pProgressFile, false, 0, batch.m_pPrintMutex };
+
+	s_bCancelBatch = 0;
+	signal(SIGINT, CancelBatch);
+
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	std::vector<JobHandle> handles;
+
+	for (int idx = 0; idx < (int)batch.m_jobs.size(); ++idx)
+	{
+		ConvertBatch* pBatch = &batch;
+
+		handles.push_back(jobs.Submit([pBatch, idx]() { ConvertFile(pBatch, idx); }));
+	}
+
+	TickBatch(&ticker);
+
+	for (int idx = 0; idx < (int)handles.size(); ++idx)
+	{
+		while (!jobs.Wait(handles[ idx ], 100))
+		{
+			TickBatch(&ticker);
+		}
+	}
+
+	signal(SIGINT, SIG_DFL);
+
+	double totalMilliseconds = ElapsedMilliseconds(startTime);
+
+	SDL_DestroyMutex(batch.m_pPrintMutex);
+
+	if (batch.m_pProgressFile)
+	{
+		PrintFinalProgress(batch.m_progress, batch.m_pProgressFile);
+		CloseProgressFile(batch.m_pProgressFile);
+	}
+
+	for (int idx = 0; idx < (int)batch.m_converters.size(); ++idx)
+	{
+		delete batch.m_converters[ idx ];
+	}
+
+	ProgressSummary summary;
+	batch.m_progress.GetSummary(summary);
+
+	int numFailed = SDL_AtomicGet(&batch.m_numFailed);
+
+	printf("%d converted, %d failed, %d canceled, %.1fms on %d threads\n",
+		   summary.m_numDone, summary.m_numFailed, summary.m_numCanceled, totalMilliseconds,
+		   jobs.GetNumWorkers() ? jobs.GetNumWorkers() : 1);
+
+	if (batch.m_pCache)
+	{
+		printf("%d cached, %s\n", batch.m_pCache->GetHits(),
+			   batch.m_pCache->GetDirectory().c_str());
+
+		delete batch.m_pCache;
+	}
+
+	return numFailed ? eExitFailed : eExitSuccess;
+}
+
+//------------------------------------------------------------------------------
+//
+// d16 watch
+//
+//------------------------------------------------------------------------------
+
+static volatile sig_atomic_t s_bStopWatching = 0;
+
+static void StopWatching(int)
+{
+	s_bStopWatching = 1;
+}
+
+struct WatchPool
+{
+	const ConvertOptions* m_pOptions;
+	ConversionCache* m_pCache;
+
+	// One per worker, and one for the calling thread.  The workers live as
+	// long as the watch does, so each Converter stays warm
+	std::vector<Converter*> m_converters;
+
+	SDL_atomic_t m_bStopping;  // skip whatever hasn't started yet
+
+	concurrent_queue<ConvertJob*> m_done;
+};
+
+//------------------------------------------------------------------------------
+
+static void WatchConvert(WatchPool* pPool, ConvertJob* pJob)
+{
+	if (SDL_AtomicGet(&pPool->m_bStopping))
+	{
+		delete pJob;
+		return;
+	}
+
+	int slot = JobSystem::GetDefault().GetCurrentWorker() + 1;
+
+	Converter*& pConverter = pPool->m_converters[ slot ];
+
+	if (nullptr == pConverter)
+		pConverter = new Converter(*pPool->m_pOptions, pPool->m_pCache);
+
+	RunConvertJob(*pConverter, *pJob);
+
+	pPool->m_done.push(pJob);
+}
+
+//------------------------------------------------------------------------------
+
+static int WatchCommand(int argc, char* argv[])
+{
+	ConvertArgs args;
+
+	int result = ParseConvertArgs("watch", argc, argv, args, WatchUsage);
+
+	if (result >= 0)
+		return result;
+
+	FolderWatcher watcher;
+
+	for (int idx = 0; idx < (int)args.m_inputs.size(); ++idx)
+	{
+		if (!watcher.AddDirectory(args.m_inputs[ idx ], args.m_bRecursive))
+		{
+			fprintf(stderr, "d16 watch: %s\n", D16_GetError());
+			return eExitFailed;
+		}
+	}
+
+	WatchPool pool;
+	pool.m_pOptions = &args.m_options;
+	pool.m_pCache = CreateCache(args);
+
+	JobSystem::CreateDefault(args.m_numThreads);
+	JobSystem& jobs = JobSystem::GetDefault();
+
+	pool.m_converters.resize(jobs.GetNumWorkers() + 1, nullptr);
+	SDL_AtomicSet(&pool.m_bStopping, 0);
+
+	std::vector<JobHandle> handles;  // so we can wait for them on the way out
+
+	// Which input directory a file lives under, for the output layout
+	struct RootFinder
+	{
+		static std::string Find(const std::vector<std::string>& roots, const std::string& path)
+		{
+			for (int idx = 0; idx < (int)roots.size(); ++idx)
+			{
+				const std::string& root = roots[ idx ];
+
+				if ((path.size() > root.size()) && (0 == path.compare(0, root.size(), root)) &&
+					(('/' == path[ root.size() ]) || ('\\' == path[ root.size() ])))
+					return root;
+			}
+			return "";
+		}
+	};
+
+	std::map<std::string, Uint32> pending;  // path -> ticks of the last event
+	std::set<std::string> inFlight;
+	std::set<std::string> outputs;          // so we don't convert our own results
+
+	// Start with anything that is out of date
+	for (int idx = 0; idx < (int)args.m_inputs.size(); ++idx)
+	{
+		const std::string& root = args.m_inputs[ idx ];
+
+		std::vector<std::string> files;
+		CollectImageFiles(root, args.m_bRecursive, files);
+
+		for (int fileIndex = 0; fileIndex < (int)files.size(); ++fileIndex)
+		{
+			const std::string& input = files[ fileIndex ];
+			std::string output = MakeOutputPath(input, root, args.m_outputDirectory,
+												args.m_options.m_iFormat);
+			outputs.insert(output);
+		}
+
+		for (int fileIndex = 0; fileIndex < (int)files.size(); ++fileIndex)
+		{
+			const std::string& input = files[ fileIndex ];
+
+			if (outputs.count(input))
+				continue;
+
+			std::string output = MakeOutputPath(input, root, args.m_outputDirectory,
+												args.m_options.m_iFormat);
+
+			if (GetModifiedTime(output) < GetModifiedTime(input))
+				pending[ input ] = 0;
+		}
+	}
+
+	signal(SIGINT, StopWatching);
+	signal(SIGTERM, StopWatching);
+
+	printf("Watching %d director%s, on %d threads, Ctrl+C to stop\n",
+		   (int)args.m_inputs.size(), args.m_inputs.size() == 1 ? "y" : "ies",
+		   jobs.GetNumWorkers() ? jobs.GetNumWorkers() : 1);
+	fflush(stdout);
+
+	int numFailed = 0;
+
+	while (!s_bStopWatching)
+	{
+		// Short timeout, so results get printed, and debounced files get
+		// sent out, without much delay
+		std::vector<std::string> changed;
+		watcher.Poll(50, changed);
+
+		Uint32 now = SDL_GetTicks();
+
+		for (int idx = 0; idx < (int)changed.size(); ++idx)
+		{
+			if (!outputs.count(changed[ idx ]))
+				pending[ changed[ idx ] ] = now;
+		}
+
+		// Anything that has been quiet long enough, and isn't already being
+		// worked on, goes out to the pool
+		std::map<std::string, Uint32>::iterator it = pending.begin();
+
+		while (it != pending.end())
+		{
+			if (((now - it->second) >= (Uint32)args.m_debounceMS) && !inFlight.count(it->first))
+			{
+				ConvertJob* pJob = new ConvertJob;
+				pJob->m_input  = it->first;
+				pJob->m_output = MakeOutputPath(pJob->m_input,
+												RootFinder::Find(args.m_inputs, pJob->m_input),
+												args.m_outputDirectory, args.m_options.m_iFormat);
+				outputs.insert(pJob->m_output);
+				inFlight.insert(pJob->m_input);
+
+				WatchPool* pPool = &pool;
+				handles.push_back(jobs.Submit([pPool, pJob]() { WatchConvert(pPool, pJob); }));
+
+				it = pending.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		ConvertJob* pDone = nullptr;
+
+		while (pool.m_done.try_pop(pDone))
+		{
+			PrintConvertJob(*pDone, nullptr);
+
+			if (!pDone->m_bSuccess)
+				++numFailed;
+
+			inFlight.erase(pDone->m_input);
+			delete pDone;
+		}
+
+		// A watch can run for days, don't hang on to finished handles
+		for (int idx = (int)handles.size() - 1; idx >= 0; --idx)
+		{
+			if (handles[ idx ].IsDone())
+			{
+				handles[ idx ] = handles.back();
+				handles.pop_back();
+			}
+		}
+	}
+
+	printf("Stopping\n");
+
+	// Let the ones that are running finish, the rest just get dropped
+	SDL_AtomicSet(&pool.m_bStopping, 1);
+
+	jobs.Wait(handles);
+
+	ConvertJob* pDone = nullptr;
+
+	while (pool.m_done.try_pop(pDone))
+	{
+		PrintConvertJob(*pDone, nullptr);
+		delete pDone;
+	}
+
+	for (int idx = 0; idx < (int)pool.m_converters.size(); ++idx)
+	{
+		delete pool.m_converters[ idx ];
+	}
+
+	delete pool.m_pCache;
+
+	return numFailed ? eExitFailed : eExitSuccess;
+}
+
+//------------------------------------------------------------------------------
+//
+// d16 run
+//
+//------------------------------------------------------------------------------
+
+static void RunUsage()
+{
+	printf("Usage: d16 run [options] <manifest.ini> [file|directory]...\n\n");
+	printf("Runs the stages in the manifest, over its [inputs], and any given here\n\n");
+	printf("  -R, --recursive           Go into sub directories\n");
+	printf("  -j, --jobs <n>            Worker threads (default: number of CPUs)\n");
+	printf("  -m, --memory <MB>         Images in flight, before new ones wait (default: 1024)\n");
+	printf("      --cache <dir>         Where to keep quantize results, for next time\n");
+	printf("      --no-cache            Quantize everything, don't read or write the cache\n");
+	printf("      --progress[=<file>]   Progress, and item lines, as JSON, for scripts, to\n");
+	printf("                            stderr, or the file (default: off)\n");
+	printf("  -h, --help                This help\n");
+}
+
+struct RunReport
+{
+	int m_numSaved;
+	BatchTicker m_ticker;
+};
+
+static void TickRun(void* pUserData)
+{
+	TickBatch(&((RunReport*)pUserData)->m_ticker);
+}
+
+static void ReportRunResult(const ManifestResult& result, void* pUserData)
+{
+	RunReport* pReport = (RunReport*)pUserData;
+
+	if (result.m_bSuccess)
+	{
+		++pReport->m_numSaved;
+		printf("  %s -> %s\n", result.m_input.c_str(), result.m_output.c_str());
+		fflush(stdout);
+	}
+	else
+	{
+		fprintf(ErrorFile(pReport->m_ticker.m_pProgressFile), "  FAILED %s -> %s: %s\n",
+				result.m_input.c_str(), result.m_output.c_str(), result.m_error.c_str());
+	}
+}
+
+//------------------------------------------------------------------------------
+
+static int RunCommand(int argc, char* argv[])
+{
+	ManifestRunOptions options;
+	int numThreads = SDL_GetCPUCount();
+
+	std::string manifestPath;
+	std::vector<std::string> inputs;
+	bool bRecursive = false;
+	bool bCache = true;
+	bool bProgress = false;
+	std::string progressFile;  // --progress=<file>, empty for stderr
+	std::string cacheDirectory;
+
+	for (int idx = 1; idx < argc; ++idx)
+	{
+		std::string arg = argv[ idx ];
+		const char* pValue = ((idx + 1) < argc) ? argv[ idx + 1 ] : nullptr;
+
+		if ((arg == "-h") || (arg == "--help"))
+		{
+			RunUsage();
+			return eExitSuccess;
+		}
+		else if ((arg == "-R") || (arg == "--recursive"))
+		{
+			bRecursive = true;
+		}
+		else if (arg == "--no-cache")
+		{
+			bCache = false;
+		}
+		else if (arg == "--progress")
+		{
+			bProgress = true;
+		}
+		else if (0 == arg.compare(0, 11, "--progress="))
+		{
+			bProgress = true;
+			progressFile = arg.substr(11);
+		}
+		else if ('-' != arg[0])
+		{
+			if (manifestPath.empty())
+				manifestPath = arg;
+			else
+				inputs.push_back(arg);
+		}
+		else if (nullptr == pValue)
+		{
+			fprintf(stderr, "d16 run: %s needs a value\n", arg.c_str());
+			return eExitUsage;
+		}
+		else if ((arg == "-j") || (arg == "--jobs"))
+		{
+			numThreads = atoi(pValue);
+			++idx;
+
+			if (numThreads < 1)
+			{
+				fprintf(stderr, "d16 run: jobs must be at least 1\n");
+				return eExitUsage;
+			}
+		}
+		else if ((arg == "-m") || (arg == "--memory"))
+		{
+			int megabytes = atoi(pValue);
+			++idx;
+
+			if (megabytes < 1)
+			{
+				fprintf(stderr, "d16 run: memory must be at least 1MB\n");
+				return eExitUsage;
+			}
+
+			options.m_maxBytes = megabytes * 1024LL * 1024LL;
+		}
+		else if (arg == "--cache")
+		{
+			cacheDirectory = pValue;
+			++idx;
+		}
+		else
+		{
+			fprintf(stderr, "d16 run: unknown option %s\n", arg.c_str());
+			RunUsage();
+			return eExitUsage;
+		}
+	}
+
+	if (manifestPath.empty())
+	{
+		RunUsage();
+		return eExitUsage;
+	}
+
+	Manifest manifest;
+
+	if (!manifest.Load(manifestPath))
+	{
+		fprintf(stderr, "d16 run: %s\n", D16_GetError());
+		return eExitFailed;
+	}
+
+	for (int idx = 0; idx < (int)inputs.size(); ++idx)
+	{
+		manifest.AddInput(inputs[ idx ]);
+	}
+
+	if (bRecursive)
+		manifest.SetRecursive(true);
+
+	if (bCache)
+	{
+		if (cacheDirectory.empty())
+			cacheDirectory = ConversionCache::DefaultDirectory();
+
+		if (!cacheDirectory.empty())
+			options.m_pCache = new ConversionCache(cacheDirectory, ConversionCache::DEFAULT_MAX_BYTES);
+	}
+
+	FILE* pProgressFile = nullptr;
+
+	if (bProgress)
+	{
+		pProgressFile = OpenProgressFile("run", progressFile);
+
+		if (nullptr == pProgressFile)
+		{
+			delete options.m_pCache;
+			return eExitFailed;
+		}
+	}
+
+	BatchProgress progress;
+
+	RunReport report;
+	report.m_numSaved = 0;
+	report.m_ticker.m_pProgress = &progress;
+	report.m_ticker.m_pProgressFile = pProgressFile;
+	report.m_ticker.m_bCanceled = false;
+	report.m_ticker.m_lastPrint = 0;
+	report.m_ticker.m_pPrintMutex = nullptr;
+
+	options.m_pReport = ReportRunResult;
+	options.m_pUserData = &report;
+	options.m_pProgress = &progress;
+	options.m_pTick = TickRun;
+
+	JobSystem::CreateDefault(numThreads);
+	int numWorkers = JobSystem::GetDefault().GetNumWorkers();
+
+	s_bCancelBatch = 0;
+	signal(SIGINT, CancelBatch);
+
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	int numFailed = RunManifest(manifest, options);
+
+	double totalMilliseconds = ElapsedMilliseconds(startTime);
+
+	signal(SIGINT, SIG_DFL);
+
+	if (pProgressFile && (numFailed >= 0))
+		PrintFinalProgress(progress, pProgressFile);
+
+	CloseProgressFile(pProgressFile);
+
+	delete options.m_pCache;
+
+	if (numFailed < 0)
+	{
+		fprintf(stderr, "d16 run: %s\n", D16_GetError());
+		return eExitFailed;
+	}
+
+	printf("%d saved, %d failed, %.1fms on %d threads\n",
+		   report.m_numSaved, numFailed, totalMilliseconds, numWorkers ? numWorkers : 1);
+
+	return numFailed ? eExitFailed : eExitSuccess;
+}
+
+//------------------------------------------------------------------------------
+//
+// d16 bench
+//
+//------------------------------------------------------------------------------
+
+static void BenchUsage()
+{
+	printf("Usage: d16 bench queue [options]\n");
+	printf("       d16 bench dither [options]\n\n");
+	printf("queue times passing items between threads, through concurrent_queue (mutex,\n");
+	printf("and condition variable), and bounded_queue (lock-free ring)\n\n");
+	printf("  -p, --producers <n>       Threads pushing (default: 4)\n");
+	printf("  -c, --consumers <n>       Threads popping (default: 4)\n");
+	printf("  -n, --items <n>           Items per producer (default: 1000000)\n");
+	printf("  -q, --capacity <n>        bounded_queue size (default: 1024)\n\n");
+	printf("dither runs every dither method over a test image, a row at a time, then on\n");
+	printf("1, 2, 4.. workers, and checks every run comes out the same as the serial one\n\n");
+	printf("  -s, --size <n>            Test image is n x n (default: 512)\n");
+	printf("  -j, --workers <n>         Most workers to try (default: one per CPU, 4 or more)\n");
+	printf("  -n, --runs <n>            Runs per method, and worker count (default: 4)\n\n");
+	printf("  -h, --help                This help\n");
+}
+
+// Both queues, behind the same calls, 0 tells a consumer to stop
+static void BenchPush(concurrent_queue<Uint32>& queue, Uint32 value) { queue.push(value); }
+static void BenchPush(bounded_queue<Uint32>& queue, Uint32 value)    { queue.wait_and_push(value); }
+
+template<typename Queue>
+struct QueueBench
+{
+	Queue* m_pQueue;
+	int m_numItems;         // per producer
+	SDL_atomic_t m_numPopped;
+	SDL_SpinLock m_sumLock;
+	Uint64 m_sum;           // so we know nothing was lost, or doubled
+
+	static int Producer(void* pData)
+	{
+		QueueBench* pBench = (QueueBench*)pData;
+
+		for (int idx = 1; idx <= pBench->m_numItems; ++idx)
+		{
+			BenchPush(*pBench->m_pQueue, (Uint32)idx);
+		}
+
+		return 0;
+	}
+
+	static int Consumer(void* pData)
+	{
+		QueueBench* pBench = (QueueBench*)pData;
+		Uint64 sum = 0;
+		int numPopped = 0;
+
+		for (;;)
+		{
+			Uint32 value = 0;
+			pBench->m_pQueue->wait_and_pop(value);
+
+			if (0 == value)
+				break;
+
+			sum += value;
+			++numPopped;
+		}
+
+		SDL_AtomicAdd(&pBench->m_numPopped, numPopped);
+
+		SDL_AtomicLock(&pBench->m_sumLock);
+		pBench->m_sum += sum;
+		SDL_AtomicUnlock(&pBench->m_sumLock);
+
+		return 0;
+	}
+
+	// Returns false, if the items that came out, aren't the ones that went in
+	static bool Run(const char* pName, Queue& queue, int numProducers, int numConsumers,
+					int numItems)
+	{
+		QueueBench bench;
+		bench.m_pQueue = &queue;
+		bench.m_numItems = numItems;
+		SDL_AtomicSet(&bench.m_numPopped, 0);
+		bench.m_sumLock = 0;
+		bench.m_sum = 0;
+
+		Uint64 startTime = SDL_GetPerformanceCounter();
+
+		std::vector<SDL_Thread*> producers;
+		std::vector<SDL_Thread*> consumers;
+
+		for (int idx = 0; idx < numConsumers; ++idx)
+		{
+			consumers.push_back(SDL_CreateThread(Consumer, "d16 bench", &bench));
+		}
+
+		for (int idx = 0; idx < numProducers; ++idx)
+		{
+			producers.push_back(SDL_CreateThread(Producer, "d16 bench", &bench));
+		}
+
+		for (int idx = 0; idx < (int)producers.size(); ++idx)
+		{
+			SDL_WaitThread(producers[ idx ], nullptr);
+		}
+
+		for (int idx = 0; idx < (int)consumers.size(); ++idx)
+		{
+			BenchPush(queue, 0);
+		}
+
+		for (int idx = 0; idx < (int)consumers.size(); ++idx)
+		{
+			SDL_WaitThread(consumers[ idx ], nullptr);
+		}
+
+		double milliseconds = ElapsedMilliseconds(startTime);
+
+		Uint64 total = (Uint64)numProducers * numItems;
+		Uint64 expectedSum = (Uint64)numProducers * ((Uint64)numItems * (numItems + 1) / 2);
+
+		bool bGood = ((Uint64)SDL_AtomicGet(&bench.m_numPopped) == total) &&
+					 (bench.m_sum == expectedSum);
+
+		printf("  %-22s %9.1fms  %7.2fM items/s%s\n", pName, milliseconds,
+			   (total / 1000.0) / (milliseconds > 0.0 ? milliseconds : 1.0),
+			   bGood ? "" : "  MISMATCH");
+		fflush(stdout);
+
+		return bGood;
+	}
+};
+
+//------------------------------------------------------------------------------
+//
+// d16 bench dither
+//
+//------------------------------------------------------------------------------
+
+// The same every time, gradients, so the error carries a long way, with
+// noise over them, and a transparent corner
+static RGBAImage* CreateBenchImage(int size)
+{
+	RGBAImage* pImage = new RGBAImage(size, size);
+	Uint32 seed = 0x12345678;
+
+	for (int y = 0; y < size; ++y)
+	{
+		Uint32* pRow = pImage->GetPixels() + ((size_t)y * size);
+
+		for (int x = 0; x < size; ++x)
+		{
+			seed = (seed * 1664525) + 1013904223;
+			int noise = (int)(seed >> 27) - 16;
+
+			int r = SDL_min(SDL_max(((x * 255) / size) + noise, 0), 255);
+			int g = SDL_min(SDL_max(((y * 255) / size) + noise, 0), 255);
+			int b = SDL_min(SDL_max((((x + y) * 255) / (size * 2)) - noise, 0), 255);
+			int a = ((x < (size / 8)) && (y < (size / 8))) ? 0 : 255;
+
+			pRow[ x ] = ((Uint32)a << 24) | ((Uint32)b << 16) | ((Uint32)g << 8) | (Uint32)r;
+		}
+	}
+
+	return pImage;
+}
+
+// Transparent, the corners of the RGB cube, and grays between
+static void CreateBenchPalette(Uint32* pPalette)
+{
+	pPalette[ 0 ] = 0;
+
+	for (int idx = 0; idx < 8; ++idx)
+	{
+		Uint32 r = (idx & 1) ? 0xFF : 0;
+		Uint32 g = (idx & 2) ? 0xFF : 0;
+		Uint32 b = (idx & 4) ? 0xFF : 0;
+
+		pPalette[ 1 + idx ] = 0xFF000000 | (b << 16) | (g << 8) | r;
+	}
+
+	for (int idx = 1; idx < 8; ++idx)
+	{
+		Uint32 gray = (Uint32)(idx * 32);
+
+		pPalette[ 8 + idx ] = 0xFF000000 | (gray << 16) | (gray << 8) | gray;
+	}
+}
+
+static int BenchDitherCommand(int argc, char* argv[])
+{
+	int size = 512;
+	int maxWorkers = SDL_max(SDL_GetCPUCount(), 4);
+	int numRuns = 4;
+
+	for (int idx = 2; idx < argc; ++idx)
+	{
+		std::string arg = argv[ idx ];
+		const char* pValue = ((idx + 1) < argc) ? argv[ idx + 1 ] : nullptr;
+
+		if ((arg == "-h") || (arg == "--help"))
+		{
+			BenchUsage();
+			return eExitSuccess;
+		}
+		else if (nullptr == pValue)
+		{
+			fprintf(stderr, "d16 bench: %s needs a value\n", arg.c_str());
+			return eExitUsage;
+		}
+		else if ((arg == "-s") || (arg == "--size"))
+		{
+			size = atoi(pValue);
+			++idx;
+		}
+		else if ((arg == "-j") || (arg == "--workers"))
+		{
+			maxWorkers = atoi(pValue);
+			++idx;
+		}
+		else if ((arg == "-n") || (arg == "--runs"))
+		{
+			numRuns = atoi(pValue);
+			++idx;
+		}
+		else
+		{
+			fprintf(stderr, "d16 bench: unknown option %s\n", arg.c_str());
+			BenchUsage();
+			return eExitUsage;
+		}
+	}
+
+	if ((size < 1) || (maxWorkers < 1) || (numRuns < 1))
+	{
+		fprintf(stderr, "d16 bench: size, workers, and runs must be at least 1\n");
+		return eExitUsage;
+	}
+
+	// 1, 2, 4.. and the most
+	std::vector<int> workerCounts;
+
+	for (int numWorkers = 1; numWorkers < maxWorkers; numWorkers *= 2)
+	{
+		workerCounts.push_back(numWorkers);
+	}
+
+	workerCounts.push_back(maxWorkers);
+
+	RGBAImage* pImage = CreateBenchImage(size);
+
+	Uint32 palette[ 16 ];
+	CreateBenchPalette(palette);
+
+	printf("%d x %d, 16 colors, %d runs each, best time\n", size, size, numRuns);
+
+	std::vector<IndexedImage*> expected(eNumDitherMethods, nullptr);
+	bool bGood = true;
+
+	// Serial first, one row after another on this thread, that's what the
+	// worker counts are checked against
+	for (int count = -1; count < (int)workerCounts.size(); ++count)
+	{
+		JobSystem* pJobs = (count >= 0) ? new JobSystem(workerCounts[ count ]) : nullptr;
+
+		char label[ 32 ];
+
+		if (pJobs)
+			snprintf(label, sizeof(label), "%d worker%s", workerCounts[ count ],
+					 (1 == workerCounts[ count ]) ? "" : "s");
+		else
+			snprintf(label, sizeof(label), "serial");
+
+		for (int iMethod = eDitherBayer2; iMethod < eNumDitherMethods; ++iMethod)
+		{
+			Ditherer ditherer(palette, 16, iMethod, 100, 0, pJobs);
+
+			double bestMilliseconds = 0.0;
+			int numMismatched = 0;
+
+			for (int run = 0; run < numRuns; ++run)
+			{
+				Uint64 startTime = SDL_GetPerformanceCounter();
+
+				IndexedImage* pResult = pJobs ? ditherer.Dither(*pImage) : ditherer.DitherSerial(*pImage);
+
+				double milliseconds = (double)(SDL_GetPerformanceCounter() - startTime) * 1000.0 /
+									  (double)SDL_GetPerformanceFrequency();
+
+				if ((0 == run) || (milliseconds < bestMilliseconds))
+					bestMilliseconds = milliseconds;
+
+				if (nullptr == expected[ iMethod ])
+				{
+					expected[ iMethod ] = pResult;
+					continue;
+				}
+
+				if (0 != memcmp(pResult->GetPixels(), expected[ iMethod ]->GetPixels(), (size_t)size * size))
+					++numMismatched;
+
+				delete pResult;
+			}
+
+			printf("  %-12s %-11s %9.1fms%s\n", GetDitherName(iMethod), label, bestMilliseconds,
+				   numMismatched ? "  MISMATCH" : "");
+			fflush(stdout);
+
+			if (numMismatched)
+				bGood = false;
+		}
+
+		delete pJobs;
+	}
+
+	for (size_t idx = 0; idx < expected.size(); ++idx)
+	{
+		delete expected[ idx ];
+	}
+
+	delete pImage;
+
+	return bGood ? eExitSuccess : eExitFailed;
+}
+
+//------------------------------------------------------------------------------
+
+static int BenchCommand(int argc, char* argv[])
+{
+	int numProducers = 4;
+	int numConsumers = 4;
+	int numItems = 1000000;
+	int capacity = 1024;
+
+	if ((argc >= 2) && (0 == strcmp(argv[1], "dither")))
+		return BenchDitherCommand(argc, argv);
+
+	if ((argc < 2) || (0 != strcmp(argv[1], "queue")))
+	{
+		BenchUsage();
+		return eExitUsage;
+	}
+
+	for (int idx = 2; idx < argc; ++idx)
+	{
+		std::string arg = argv[ idx ];
+		const char* pValue = ((idx + 1) < argc) ? argv[ idx + 1 ] : nullptr;
+
+		if ((arg == "-h") || (arg == "--help"))
+		{
+			BenchUsage();
+			return eExitSuccess;
+		}
+		else if (nullptr == pValue)
+		{
+			fprintf(stderr, "d16 bench: %s needs a value\n", arg.c_str());
+			return eExitUsage;
+		}
+		else if ((arg == "-p") || (arg == "--producers"))
+		{
+			numProducers = atoi(pValue);
+			++idx;
+		}
+		else if ((arg == "-c") || (arg == "--consumers"))
+		{
+			numConsumers = atoi(pValue);
+			++idx;
+		}
+		else if ((arg == "-n") || (arg == "--items"))
+		{
+			numItems = atoi(pValue);
+			++idx;
+		}
+		else if ((arg == "-q") || (arg == "--capacity"))
+		{
+			capacity = atoi(pValue);
+			++idx;
+		}
+		else
+		{
+			fprintf(stderr, "d16 bench: unknown option %s\n", arg.c_str());
+			BenchUsage();
+			return eExitUsage;
+		}
+	}
+
+	if ((numProducers < 1) || (numConsumers < 1) || (numItems < 1) || (capacity < 1))
+	{
+		fprintf(stderr, "d16 bench: producers, consumers, items, and capacity must be at least 1\n");
+		return eExitUsage;
+	}
+
+	printf("%d producers, %d consumers, %d items each\n", numProducers, numConsumers, numItems);
+
+	bool bGood = true;
+
+	{
+		concurrent_queue<Uint32> queue;
+		bGood &= QueueBench< concurrent_queue<Uint32> >::Run("concurrent_queue", queue,
+															 numProducers, numConsumers, numItems);
+	}
+
+	{
+		bounded_queue<Uint32> queue(capacity);
+
+		char name[ 64 ];
+		snprintf(name, sizeof(name), "bounded_queue (%d)", queue.capacity());
+
+		bGood &= QueueBench< bounded_queue<Uint32> >::Run(name, queue,
+														  numProducers, numConsumers, numItems);
+	}
+
+	return bGood ? eExitSuccess : eExitFailed;
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,17 @@
+//
+// Command Line Interface
+//
+// "d16 <command> ..." runs without a window, or an OpenGL context, for
+// the asset build, and the build farm
+//
+#ifndef CLI_H_
+#define CLI_H_
+
+// Is argv[1] one of our commands, if not, we're the GUI
+bool CLI_IsCommand(const char* pArg);
+
+// Returns the process exit code, 0 on success
+int CLI_Main(int argc, char* argv[]);
+
+#endif // CLI_H_
+
@@ -0,0 +1,313 @@
+//
+// bounded_queue
+//
+// Fixed size, lock-free, multi producer, multi consumer ring, for passing
+// work between pipeline stages.  Unlike concurrent_queue, a producer that
+// gets ahead, blocks (or gets false back) once the ring is full, so a fast
+// decoder can't pile up frames in front of a slow quantizer.
+//
+// Each cell carries a sequence number, that says whether it is waiting to
+// be written, or read, for the current trip around the ring (the bounded
+// MPMC queue by Dmitry Vyukov).  try_push, and try_pop never take a lock.
+// The blocking, and timed versions only touch a mutex, when they have to
+// sleep, and the other side only touches it, when somebody is asleep.
+//
+#ifndef BOUNDED_QUEUE_H_
+#define BOUNDED_QUEUE_H_
+
+#include <SDL.h>
+
+#include <utility>
+
+template<typename Data>
+class bounded_queue
+{
+private:
+	struct Cell
+	{
+		SDL_atomic_t m_sequence;
+		Data m_data;
+	};
+
+	Cell* m_pCells;
+	Uint32 m_mask;
+
+	// Each on its own cache line, so producers, and consumers don't fight
+	char m_pad0[ 64 ];
+	SDL_atomic_t m_enqueuePos;
+	char m_pad1[ 64 ];
+	SDL_atomic_t m_dequeuePos;
+	char m_pad2[ 64 ];
+
+	SDL_atomic_t m_numPushWaiting;
+	SDL_atomic_t m_numPopWaiting;
+
+	SDL_mutex* m_pPushMutex;
+	SDL_cond*  m_pPushCond;  // there's room now
+	SDL_mutex* m_pPopMutex;
+	SDL_cond*  m_pPopCond;   // there's data now
+
+	static const int SPIN_COUNT = 16;
+
+	// Positions wrap, compare them this way
+	static int Distance(int from, int to)
+	{
+		return (int)((Uint32)to - (Uint32)from);
+	}
+
+	static int Next(int pos, Uint32 step)
+	{
+		return (int)((Uint32)pos + step);
+	}
+
+	bool enqueue(Data const& data)
+	{
+		Cell* pCell;
+		int pos = SDL_AtomicGet(&m_enqueuePos);
+
+		for (;;)
+		{
+			pCell = &m_pCells[ (Uint32)pos & m_mask ];
+			int diff = Distance(pos, SDL_AtomicGet(&pCell->m_sequence));
+
+			if (0 == diff)
+			{
+				if (SDL_AtomicCAS(&m_enqueuePos, pos, Next(pos, 1)))
+					break;
+
+				pos = SDL_AtomicGet(&m_enqueuePos);
+			}
+			else if (diff < 0)
+			{
+				return false;  // full
+			}
+			else
+			{
+				pos = SDL_AtomicGet(&m_enqueuePos);
+			}
+		}
+
+		pCell->m_data = data;
+		SDL_AtomicSet(&pCell->m_sequence, Next(pos, 1));
+
+		return true;
+	}
+
+	bool dequeue(Data& popped_value)
+	{
+		Cell* pCell;
+		int pos = SDL_AtomicGet(&m_dequeuePos);
+
+		for (;;)
+		{
+			pCell = &m_pCells[ (Uint32)pos & m_mask ];
+			int diff = Distance(Next(pos, 1), SDL_AtomicGet(&pCell->m_sequence));
+
+			if (0 == diff)
+			{
+				if (SDL_AtomicCAS(&m_dequeuePos, pos, Next(pos, 1)))
+					break;
+
+				pos = SDL_AtomicGet(&m_dequeuePos);
+			}
+			else if (diff < 0)
+			{
+				return false;  // empty
+			}
+			else
+			{
+				pos = SDL_AtomicGet(&m_dequeuePos);
+			}
+		}
+
+		popped_value = std::move(pCell->m_data);
+		SDL_AtomicSet(&pCell->m_sequence, Next(pos, m_mask + 1));
+
+		return true;
+	}
+
+	static void wake(SDL_atomic_t* pNumWaiting, SDL_mutex* pMutex, SDL_cond* pCond)
+	{
+		if (SDL_AtomicGet(pNumWaiting) > 0)
+		{
+			SDL_LockMutex(pMutex);
+			SDL_CondSignal(pCond);
+			SDL_UnlockMutex(pMutex);
+		}
+	}
+
+	// Sleep, until tryFunc works, or timeoutMS runs out, < 0 waits for ever.
+	// The waiting count goes up, before we look, so whoever makes room, or
+	// data after that, is sure to see us, and signal
+	template<typename Try>
+	bool wait(SDL_atomic_t* pNumWaiting, SDL_mutex* pMutex, SDL_cond* pCond,
+			  int timeoutMS, Try tryFunc)
+	{
+		Uint32 startTicks = SDL_GetTicks();
+		bool bDone = false;
+
+		// The caller has already tried once, 0 means don't wait at all
+		if (0 == timeoutMS)
+			return false;
+
+		// Most waits are short, give the other side a few chances, before
+		// paying for a sleep, and a wake up
+		for (int idx = 0; idx < SPIN_COUNT; ++idx)
+		{
+			SDL_Delay(0);
+
+			if (tryFunc())
+				return true;
+		}
+
+		SDL_AtomicAdd(pNumWaiting, 1);
+		SDL_LockMutex(pMutex);
+
+		for (;;)
+		{
+			bDone = tryFunc();
+
+			if (bDone)
+				break;
+
+			if (timeoutMS < 0)
+			{
+				SDL_CondWait(pCond, pMutex);
+			}
+			else
+			{
+				int remaining = timeoutMS - (int)(SDL_GetTicks() - startTicks);
+
+				if (remaining <= 0)
+					break;
+
+				SDL_CondWaitTimeout(pCond, pMutex, (Uint32)remaining);
+			}
+		}
+
+		SDL_UnlockMutex(pMutex);
+		SDL_AtomicAdd(pNumWaiting, -1);
+
+		return bDone;
+	}
+
+public:
+	// Rounded up to a power of 2
+	bounded_queue(int capacity)
+	{
+		Uint32 size = 2;
+
+		while ((int)size < capacity)
+			size <<= 1;
+
+		m_pCells = new Cell[ size ];
+		m_mask = size - 1;
+
+		for (Uint32 idx = 0; idx < size; ++idx)
+		{
+			SDL_AtomicSet(&m_pCells[ idx ].m_sequence, (int)idx);
+		}
+
+		SDL_AtomicSet(&m_enqueuePos, 0);
+		SDL_AtomicSet(&m_dequeuePos, 0);
+		SDL_AtomicSet(&m_numPushWaiting, 0);
+		SDL_AtomicSet(&m_numPopWaiting, 0);
+
+		m_pPushMutex = SDL_CreateMutex();
+		m_pPushCond  = SDL_CreateCond();
+		m_pPopMutex  = SDL_CreateMutex();
+		m_pPopCond   = SDL_CreateCond();
+	}
+
+	~bounded_queue()
+	{
+		SDL_DestroyCond(m_pPopCond);
+		SDL_DestroyMutex(m_pPopMutex);
+		SDL_DestroyCond(m_pPushCond);
+		SDL_DestroyMutex(m_pPushMutex);
+
+		delete[] m_pCells;
+	}
+
+	int capacity() const { return (int)(m_mask + 1); }
+
+	// Only a hint, with other threads pushing, and popping
+	bool empty()
+	{
+		int pos = SDL_AtomicGet(&m_dequeuePos);
+		Cell* pCell = &m_pCells[ (Uint32)pos & m_mask ];
+
+		return Distance(Next(pos, 1), SDL_AtomicGet(&pCell->m_sequence)) < 0;
+	}
+
+	//--------------------------------------------------------------------------
+
+	// false if it's full
+	bool try_push(Data const& data)
+	{
+		if (!enqueue(data))
+			return false;
+
+		wake(&m_numPopWaiting, m_pPopMutex, m_pPopCond);
+		return true;
+	}
+
+	// Blocks while it's full
+	void wait_and_push(Data const& data)
+	{
+		wait_and_push(data, -1);
+	}
+
+	// false if it was still full, after timeoutMS
+	bool wait_and_push(Data const& data, int timeoutMS)
+	{
+		if (try_push(data))
+			return true;
+
+		if (!wait(&m_numPushWaiting, m_pPushMutex, m_pPushCond, timeoutMS,
+				  [this, &data]() { return enqueue(data); }))
+			return false;
+
+		wake(&m_numPopWaiting, m_pPopMutex, m_pPopCond);
+		return true;
+	}
+
+	//--------------------------------------------------------------------------
+
+	// false if it's empty
+	bool try_pop(Data& popped_value)
+	{
+		if (!dequeue(popped_value))
+			return false;
+
+		wake(&m_numPushWaiting, m_pPushMutex, m_pPushCond);
+		return true;
+	}
+
+	// Blocks while it's empty
+	void wait_and_pop(Data& popped_value)
+	{
+		wait_and_pop(popped_value, -1);
+	}
+
+	// false if it was still empty, after timeoutMS
+	bool wait_and_pop(Data& popped_value, int timeoutMS)
+	{
+		if (try_pop(popped_value))
+			return true;
+
+		if (!wait(&m_numPopWaiting, m_pPopMutex, m_pPopCond, timeoutMS,
+				  [this, &popped_value]() { return dequeue(popped_value); }))
+			return false;
+
+		wake(&m_numPushWaiting, m_pPushMutex, m_pPushCond);
+		return true;
+	}
+
+private:
+	// Not copyable
+	bounded_queue(const bounded_queue&);
+	bounded_queue& operator=(const bounded_queue&);
+};
+
+#endif // BOUNDED_QUEUE_H_
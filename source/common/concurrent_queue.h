@@ -77,8 +77,7 @@ public:
 
     void wait_and_pop(Data& popped_value)
     {
-        //SDL2_Scoped_Lock lock(the_mutex);
-		SDL_LockMutex(the_mutex);
+        SDL2_Scoped_Lock lock(the_mutex);
         while(the_queue.empty())
         {
 			SDL_CondWait(the_condition_variable, the_mutex);
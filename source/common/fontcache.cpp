@@ -0,0 +1,343 @@
+//
+// FontCache - Dear ImGui font atlases, rasterized once, then loaded from disk
+//
+#include "fontcache.h"
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include "cache.h"
+#include "files.h"
+#include "mappedfile.h"
+
+#include <SDL.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char   FONTCACHE_MAGIC[8] = { 'D','1','6','F','O','N','T','C' };
+static const Uint32 FONTCACHE_VERSION = 1;
+static const Uint32 FONTCACHE_BYTE_ORDER = 0x01020304;
+
+struct FontCacheHeader
+{
+	char   m_magic[8];
+	Uint32 m_version;
+	Uint32 m_byteOrder;     // written native, a file from the other endian is stale
+	Uint64 m_key;
+
+	Sint32 m_texWidth;
+	Sint32 m_texHeight;
+
+	// Where the build put the mouse cursors, and white pixel
+	Sint32 m_rectX;
+	Sint32 m_rectY;
+	Sint32 m_rectWidth;
+	Sint32 m_rectHeight;
+
+	float  m_fontSize;
+	float  m_ascent;
+	float  m_descent;
+	Sint32 m_metricsTotalSurface;
+
+	Sint32 m_numGlyphs;     // FontCacheGlyph x numGlyphs, then the Alpha8 texture
+};
+
+struct FontCacheGlyph
+{
+	Uint32 m_codepoint;
+	Uint32 m_bVisible;
+	float  m_advanceX;
+	float  m_x0, m_y0, m_x1, m_y1;
+	float  m_u0, m_v0, m_u1, m_v1;
+};
+
+//------------------------------------------------------------------------------
+// Everything that changes what the build comes out with
+
+static Uint64 MakeFontKey(const ImFontAtlas* pAtlas, const ImFontConfig& config,
+						  const void* pTTF, size_t ttfBytes)
+{
+	struct
+	{
+		Sint32 m_imguiVersion;
+		Sint32 m_flags;
+		Sint32 m_texDesiredWidth;
+		Sint32 m_texGlyphPadding;
+		Sint32 m_oversampleH;
+		Sint32 m_oversampleV;
+		Sint32 m_bPixelSnapH;
+		float  m_sizePixels;
+		float  m_rasterizerMultiply;
+	} settings;
+
+	memset(&settings, 0, sizeof(settings));
+
+	settings.m_imguiVersion = IMGUI_VERSION_NUM;
+	settings.m_flags = pAtlas->Flags;
+	settings.m_texDesiredWidth = pAtlas->TexDesiredWidth;
+	settings.m_texGlyphPadding = pAtlas->TexGlyphPadding;
+	settings.m_oversampleH = config.OversampleH;
+	settings.m_oversampleV = config.OversampleV;
+	settings.m_bPixelSnapH = config.PixelSnapH ? 1 : 0;
+	settings.m_sizePixels = config.SizePixels;
+	settings.m_rasterizerMultiply = config.RasterizerMultiply;
+
+	return HashBytes(pTTF, ttfBytes, HashBytes(&settings, sizeof(settings)));
+}
+
+static std::string FontCachePath(Uint64 key)
+{
+	char* pPrefPath = SDL_GetPrefPath("dwsJason", "d16");
+
+	if (nullptr == pPrefPath)
+		return "";
+
+	char filename[ 64 ];
+	snprintf(filename, sizeof(filename), "%016llx.fnt", (unsigned long long)key);
+
+	std::string path = JoinPath(JoinPath(pPrefPath, "fonts"), filename);
+
+	SDL_free(pPrefPath);
+
+	return path;
+}
+
+//------------------------------------------------------------------------------
+// Rebuild the atlas from the file, the same as ImFontAtlasBuildWithStbTruetype
+// would have left it, false (and the atlas cleared) if the file doesn't fit
+
+static ImFont* LoadFontCache(ImFontAtlas* pAtlas, const ImFontConfig& config,
+							 Uint64 key, const std::string& path)
+{
+	MappedFile file;
+
+	if (path.empty() || !file.Open(path))
+		return nullptr;
+
+	const Uint8* pData = file.GetData();
+	size_t numBytes = file.GetSize();
+
+	if (numBytes < sizeof(FontCacheHeader))
+		return nullptr;
+
+	FontCacheHeader header;
+	memcpy(&header, pData, sizeof(header));
+
+	if ((0 != memcmp(header.m_magic, FONTCACHE_MAGIC, sizeof(header.m_magic))) ||
+		(FONTCACHE_VERSION != header.m_version) ||
+		(FONTCACHE_BYTE_ORDER != header.m_byteOrder) ||
+		(key != header.m_key))
+	{
+		return nullptr;
+	}
+
+	if ((header.m_texWidth < 1) || (header.m_texHeight < 1) ||
+		(header.m_texWidth > 16384) || (header.m_texHeight > 16384) ||
+		(header.m_numGlyphs < 1) || (header.m_numGlyphs >= 0xFFFF))
+	{
+		return nullptr;
+	}
+
+	size_t texBytes = (size_t)header.m_texWidth * header.m_texHeight;
+	size_t glyphBytes = sizeof(FontCacheGlyph) * header.m_numGlyphs;
+
+	if (numBytes != (sizeof(FontCacheHeader) + glyphBytes + texBytes))
+		return nullptr;
+
+	ImFontAtlasBuildInit(pAtlas);
+
+	ImFontAtlasCustomRect& rect = pAtlas->CustomRects[ pAtlas->CustomRectIds[0] ];
+
+	if ((rect.Width != header.m_rectWidth) || (rect.Height != header.m_rectHeight) ||
+		(header.m_rectX < 0) || (header.m_rectY < 0) ||
+		(header.m_rectX + header.m_rectWidth > header.m_texWidth) ||
+		(header.m_rectY + header.m_rectHeight > header.m_texHeight))
+	{
+		pAtlas->Clear();
+		return nullptr;
+	}
+
+	rect.X = (unsigned short)header.m_rectX;
+	rect.Y = (unsigned short)header.m_rectY;
+
+	pAtlas->ConfigData.push_back(config);
+
+	ImFont* pFont = IM_NEW(ImFont);
+	pAtlas->Fonts.push_back(pFont);
+
+	pFont->ContainerAtlas = pAtlas;
+	pFont->ConfigData = &pAtlas->ConfigData.back();
+	pFont->ConfigDataCount = 1;
+	pFont->FontSize = header.m_fontSize;
+	pFont->Ascent = header.m_ascent;
+	pFont->Descent = header.m_descent;
+	pFont->MetricsTotalSurface = header.m_metricsTotalSurface;
+
+	const FontCacheGlyph* pGlyphs = (const FontCacheGlyph*)(pData + sizeof(FontCacheHeader));
+
+	pFont->Glyphs.resize(header.m_numGlyphs);
+
+	for (int idx = 0; idx < header.m_numGlyphs; ++idx)
+	{
+		FontCacheGlyph cached;
+		memcpy(&cached, pGlyphs + idx, sizeof(cached));
+
+		ImFontGlyph& glyph = pFont->Glyphs[ idx ];
+
+		glyph.Codepoint = cached.m_codepoint;
+		glyph.Visible = cached.m_bVisible ? 1 : 0;
+		glyph.AdvanceX = cached.m_advanceX;
+		glyph.X0 = cached.m_x0;
+		glyph.Y0 = cached.m_y0;
+		glyph.X1 = cached.m_x1;
+		glyph.Y1 = cached.m_y1;
+		glyph.U0 = cached.m_u0;
+		glyph.V0 = cached.m_v0;
+		glyph.U1 = cached.m_u1;
+		glyph.V1 = cached.m_v1;
+	}
+
+	pFont->DirtyLookupTables = true;
+
+	pAtlas->TexWidth = header.m_texWidth;
+	pAtlas->TexHeight = header.m_texHeight;
+	pAtlas->TexUvScale = ImVec2(1.0f / header.m_texWidth, 1.0f / header.m_texHeight);
+	pAtlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(texBytes);
+
+	memcpy(pAtlas->TexPixelsAlpha8, pData + sizeof(FontCacheHeader) + glyphBytes, texBytes);
+
+	// White pixel, cursors, lookup tables, ellipsis
+	ImFontAtlasBuildFinish(pAtlas);
+
+	return pFont;
+}
+
+//------------------------------------------------------------------------------
+// Not being able to save is only slower next time
+
+static void SaveFontCache(const ImFontAtlas* pAtlas, const ImFont* pFont,
+						  Uint64 key, const std::string& path)
+{
+	if (path.empty() || (nullptr == pAtlas->TexPixelsAlpha8))
+		return;
+
+	const ImFontAtlasCustomRect& rect = pAtlas->CustomRects[ pAtlas->CustomRectIds[0] ];
+
+	FontCacheHeader header;
+	memset(&header, 0, sizeof(header));
+
+	memcpy(header.m_magic, FONTCACHE_MAGIC, sizeof(header.m_magic));
+	header.m_version = FONTCACHE_VERSION;
+	header.m_byteOrder = FONTCACHE_BYTE_ORDER;
+	header.m_key = key;
+	header.m_texWidth = pAtlas->TexWidth;
+	header.m_texHeight = pAtlas->TexHeight;
+	header.m_rectX = rect.X;
+	header.m_rectY = rect.Y;
+	header.m_rectWidth = rect.Width;
+	header.m_rectHeight = rect.Height;
+	header.m_fontSize = pFont->FontSize;
+	header.m_ascent = pFont->Ascent;
+	header.m_descent = pFont->Descent;
+	header.m_metricsTotalSurface = pFont->MetricsTotalSurface;
+	header.m_numGlyphs = pFont->Glyphs.Size;
+
+	std::vector<Uint8> bytes(sizeof(header));
+	memcpy(&bytes[0], &header, sizeof(header));
+
+	for (int idx = 0; idx < pFont->Glyphs.Size; ++idx)
+	{
+		const ImFontGlyph& glyph = pFont->Glyphs[ idx ];
+
+		FontCacheGlyph cached;
+
+		cached.m_codepoint = glyph.Codepoint;
+		cached.m_bVisible = glyph.Visible;
+		cached.m_advanceX = glyph.AdvanceX;
+		cached.m_x0 = glyph.X0;
+		cached.m_y0 = glyph.Y0;
+		cached.m_x1 = glyph.X1;
+		cached.m_y1 = glyph.Y1;
+		cached.m_u0 = glyph.U0;
+		cached.m_v0 = glyph.V0;
+		cached.m_u1 = glyph.U1;
+		cached.m_v1 = glyph.V1;
+
+		const Uint8* pCached = (const Uint8*)&cached;
+		bytes.insert(bytes.end(), pCached, pCached + sizeof(cached));
+	}
+
+	bytes.insert(bytes.end(), pAtlas->TexPixelsAlpha8,
+				 pAtlas->TexPixelsAlpha8 + ((size_t)pAtlas->TexWidth * pAtlas->TexHeight));
+
+	if (!MakeDirectories(GetDirectory(path)))
+		return;
+
+	std::string tempPath = path + ".tmp";
+
+	FILE* pFile = fopen(tempPath.c_str(), "wb");
+
+	if (nullptr == pFile)
+		return;
+
+	bool bWritten = (bytes.size() == fwrite(&bytes[0], 1, bytes.size(), pFile));
+
+	bWritten = (0 == fclose(pFile)) && bWritten;
+
+	if (bWritten)
+	{
+		// Windows won't rename on top of an existing file
+		if (0 != rename(tempPath.c_str(), path.c_str()))
+		{
+			remove(path.c_str());
+			bWritten = (0 == rename(tempPath.c_str(), path.c_str()));
+		}
+	}
+
+	if (!bWritten)
+		remove(tempPath.c_str());
+}
+
+//------------------------------------------------------------------------------
+
+ImFont* AddCachedFont(ImFontAtlas* pAtlas, const void* pTTF, size_t ttfBytes,
+					  float sizePixels, const char* pName, bool* pFromCache)
+{
+	if (pFromCache)
+		*pFromCache = false;
+
+	ImFontConfig config;
+
+	// The bytes are the caller's (an embedded asset), not the atlas's
+	config.FontData = nullptr;
+	config.FontDataOwnedByAtlas = false;
+	config.SizePixels = sizePixels;
+
+	snprintf(config.Name, sizeof(config.Name), "%s, %.0fpx", pName, sizePixels);
+
+	Uint64 key = MakeFontKey(pAtlas, config, pTTF, ttfBytes);
+	std::string path = FontCachePath(key);
+
+	ImFont* pFont = LoadFontCache(pAtlas, config, key, path);
+
+	if (pFont)
+	{
+		if (pFromCache)
+			*pFromCache = true;
+
+		return pFont;
+	}
+
+	pFont = pAtlas->AddFontFromMemoryTTF(const_cast<void*>(pTTF), (int)ttfBytes,
+										 sizePixels, &config);
+
+	if (nullptr == pFont)
+		return nullptr;
+
+	if (!pAtlas->Build())
+		return nullptr;
+
+	SaveFontCache(pAtlas, pFont, key, path);
+
+	return pFont;
+}
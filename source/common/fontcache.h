@@ -0,0 +1,24 @@
+//
+// FontCache - Dear ImGui font atlases, rasterized once, then loaded from disk
+//
+// Building the atlas runs stb_truetype over every glyph, at startup, before
+// the first frame can draw.  The built atlas (glyph metrics, and the alpha
+// texture) is saved under the pref path, keyed by a hash of the font bytes,
+// its size, and the ImGui version, so the next start just reads it back.
+//
+#ifndef FONTCACHE_H_
+#define FONTCACHE_H_
+
+#include <stddef.h>
+
+struct ImFont;
+struct ImFontAtlas;
+
+// Adds the font to an empty atlas, and builds it.  The atlas doesn't take
+// the ttf bytes, they have to stay around.  The whole atlas is what's
+// cached, so this has to be the only font in it.  bFromCache (optional) is
+// set if nothing had to be rasterized.  nullptr if the font won't load
+ImFont* AddCachedFont(ImFontAtlas* pAtlas, const void* pTTF, size_t ttfBytes,
+					  float sizePixels, const char* pName, bool* pFromCache = nullptr);
+
+#endif // FONTCACHE_H_
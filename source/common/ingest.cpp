@@ -0,0 +1,375 @@
+//
+// ImageIngest - Single pass feed from an SDL_Surface into libimagequant
+//
+
+#include "ingest.h"
+
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define INGEST_SSE2 1
+#include <emmintrin.h>
+#endif
+
+//------------------------------------------------------------------------------
+// Since we're not supporting Alpha, pre-multiply Alpha, and set the alpha to 1
+// Fully opaque pixels are left alone
+static inline Uint32 Premultiply(Uint32 rgba)
+{
+	Uint32 a = rgba >> 24;
+
+	if (0xFF == a)
+	{
+		return rgba;
+	}
+
+	Uint32 r = ((rgba >>  0) & 0xFF) * a; r >>= 8;
+	Uint32 g = ((rgba >>  8) & 0xFF) * a; g >>= 8;
+	Uint32 b = ((rgba >> 16) & 0xFF) * a; b >>= 8;
+
+	return 0xFF000000 | (b << 16) | (g << 8) | r;
+}
+
+//------------------------------------------------------------------------------
+// BGRA byte order -> RGBA byte order, swap red and blue
+static inline Uint32 SwapRedBlue(Uint32 bgra)
+{
+	return (bgra & 0xFF00FF00) | ((bgra >> 16) & 0xFF) | ((bgra & 0xFF) << 16);
+}
+
+#if INGEST_SSE2
+//------------------------------------------------------------------------------
+// 4 pixels at a time version of Premultiply, exact same results
+static inline __m128i Premultiply4(__m128i rgba)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+
+	__m128i lo = _mm_unpacklo_epi8(rgba, zero);
+	__m128i hi = _mm_unpackhi_epi8(rgba, zero);
+
+	// Broadcast alpha across each pixel's lanes
+	__m128i alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, 0xFF), 0xFF);
+	__m128i ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, 0xFF), 0xFF);
+
+	lo = _mm_srli_epi16(_mm_mullo_epi16(lo, alo), 8);
+	hi = _mm_srli_epi16(_mm_mullo_epi16(hi, ahi), 8);
+
+	__m128i premultiplied = _mm_or_si128(_mm_packus_epi16(lo, hi), alphaMask);
+
+	// Keep the original pixel, where alpha was already 0xFF
+	__m128i opaque = _mm_cmpeq_epi32(_mm_and_si128(rgba, alphaMask), alphaMask);
+
+	return _mm_or_si128(_mm_and_si128(opaque, rgba),
+						_mm_andnot_si128(opaque, premultiplied));
+}
+
+static inline __m128i SwapRedBlue4(__m128i bgra)
+{
+	const __m128i agMask = _mm_set1_epi32((int)0xFF00FF00);
+	const __m128i lowMask = _mm_set1_epi32(0x000000FF);
+
+	__m128i ag = _mm_and_si128(bgra, agMask);
+	__m128i r  = _mm_and_si128(_mm_srli_epi32(bgra, 16), lowMask);
+	__m128i b  = _mm_slli_epi32(_mm_and_si128(bgra, lowMask), 16);
+
+	return _mm_or_si128(ag, _mm_or_si128(r, b));
+}
+#endif
+
+//------------------------------------------------------------------------------
+
+ImageIngest::ImageIngest(SDL_Surface* pSurface)
+	: m_pSurface(pSurface)
+	, m_bLocked(false)
+	, m_width(pSurface->w)
+	, m_height(pSurface->h)
+	, m_uniqueColors(0)
+{
+	if( SDL_MUSTLOCK(m_pSurface) )
+	{
+		SDL_LockSurface(m_pSurface);
+		m_bLocked = true;
+	}
+
+	// Pixels past the end of the palette come out opaque black, like every
+	// other row out of ConvertRow, never 0
+	for (int idx = 0; idx < 256; ++idx)
+	{
+		m_clut[ idx ] = 0xFF000000;
+	}
+
+	SDL_Palette* pPalette = m_pSurface->format->palette;
+
+	if (pPalette)
+	{
+		for (int idx = 0; idx < pPalette->ncolors && idx < 256; ++idx)
+		{
+			const SDL_Color& color = pPalette->colors[ idx ];
+
+			Uint32 rgba = color.r | (color.g << 8) | (color.b << 16) | (((Uint32)color.a) << 24);
+
+			m_clut[ idx ] = Premultiply(rgba);
+		}
+	}
+
+}
+
+ImageIngest::~ImageIngest()
+{
+	if (m_bLocked)
+	{
+		SDL_UnlockSurface(m_pSurface);
+		m_bLocked = false;
+	}
+}
+
+//------------------------------------------------------------------------------
+
+liq_image* ImageIngest::CreateLiqImage(liq_attr* pAttr)
+{
+	return liq_image_create_custom(pAttr, RowCallback, this, m_width, m_height, 0);
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ void ImageIngest::RowCallback(liq_color row_out[], int row, int width, void* user_info)
+{
+	ImageIngest* pIngest = (ImageIngest*)user_info;
+
+	(void)width;
+
+	Uint32* pDest = (Uint32*)row_out;
+
+	pIngest->ConvertRow(pDest, row);
+}
+
+//------------------------------------------------------------------------------
+
+void ImageIngest::ConvertRow(Uint32* pDest, int row)
+{
+	const Uint8* pSource = (const Uint8*)m_pSurface->pixels + (row * m_pSurface->pitch);
+	const SDL_PixelFormat* pFormat = m_pSurface->format;
+
+	int x = 0;
+
+	switch (pFormat->format)
+	{
+	case SDL_PIXELFORMAT_RGBA32:
+		#if INGEST_SSE2
+		for (; x + 4 <= m_width; x += 4)
+		{
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(pSource + (x * 4)));
+			_mm_storeu_si128((__m128i*)(pDest + x), Premultiply4(pixels));
+		}
+		#endif
+		for (; x < m_width; ++x)
+		{
+			Uint32 pixel;
+			memcpy(&pixel, pSource + (x * 4), sizeof(Uint32));
+			pDest[ x ] = Premultiply(pixel);
+		}
+		break;
+
+	case SDL_PIXELFORMAT_BGRA32:
+		#if INGEST_SSE2
+		for (; x + 4 <= m_width; x += 4)
+		{
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(pSource + (x * 4)));
+			_mm_storeu_si128((__m128i*)(pDest + x), Premultiply4(SwapRedBlue4(pixels)));
+		}
+		#endif
+		for (; x < m_width; ++x)
+		{
+			Uint32 pixel;
+			memcpy(&pixel, pSource + (x * 4), sizeof(Uint32));
+			pDest[ x ] = Premultiply(SwapRedBlue(pixel));
+		}
+		break;
+
+	case SDL_PIXELFORMAT_RGB24:
+		for (; x < m_width; ++x)
+		{
+			const Uint8* pPixel = pSource + (x * 3);
+			pDest[ x ] = 0xFF000000 | (pPixel[2] << 16) | (pPixel[1] << 8) | pPixel[0];
+		}
+		break;
+
+	case SDL_PIXELFORMAT_BGR24:
+		for (; x < m_width; ++x)
+		{
+			const Uint8* pPixel = pSource + (x * 3);
+			pDest[ x ] = 0xFF000000 | (pPixel[0] << 16) | (pPixel[1] << 8) | pPixel[2];
+		}
+		break;
+
+	case SDL_PIXELFORMAT_INDEX8:
+		for (; x < m_width; ++x)
+		{
+			pDest[ x ] = m_clut[ pSource[ x ] ];
+		}
+		break;
+
+	default:
+		// Anything else, let SDL pick it apart
+		for (; x < m_width; ++x)
+		{
+			const Uint8* pPixel = pSource + (x * pFormat->BytesPerPixel);
+			Uint32 pixel = 0;
+
+			switch (pFormat->BytesPerPixel)
+			{
+			case 1:
+				pixel = *pPixel;
+				break;
+			case 2:
+				pixel = *((const Uint16*)pPixel);
+				break;
+			case 3:
+				#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+				pixel = pPixel[0] | (pPixel[1] << 8) | (pPixel[2] << 16);
+				#else
+				pixel = pPixel[2] | (pPixel[1] << 8) | (pPixel[0] << 16);
+				#endif
+				break;
+			case 4:
+				pixel = *((const Uint32*)pPixel);
+				break;
+			}
+
+			Uint8 r,g,b,a;
+			SDL_GetRGBA(pixel, pFormat, &r, &g, &b, &a);
+
+			pDest[ x ] = Premultiply(r | (g << 8) | (b << 16) | (((Uint32)a) << 24));
+		}
+		break;
+	}
+}
+
+//------------------------------------------------------------------------------
+
+static const int COLOR_HASH_MIN_BITS = 12;
+
+static inline Uint32 ColorHash(Uint32 color, int hashBits)
+{
+	return (color * 0x9E3779B1u) >> (32 - hashBits);
+}
+
+ColorCounts::ColorCounts()
+	: m_hashBits(COLOR_HASH_MIN_BITS)
+	, m_numColors(0)
+	, m_colors((size_t)1 << COLOR_HASH_MIN_BITS, 0)
+	, m_counts((size_t)1 << COLOR_HASH_MIN_BITS, 0)
+{
+}
+
+void ColorCounts::Insert(Uint32 color, Uint32 count)
+{
+	Uint32 mask = (Uint32)m_colors.size() - 1;
+	Uint32 slot = ColorHash(color, m_hashBits);
+
+	while (m_colors[ slot ] && (m_colors[ slot ] != color))
+		slot = (slot + 1) & mask;
+
+	if (0 == m_colors[ slot ])
+	{
+		m_colors[ slot ] = color;
+		++m_numColors;
+	}
+
+	m_counts[ slot ] += count;
+
+	// Keep it under half full
+	if ((size_t)m_numColors * 2 > m_colors.size())
+	{
+		std::vector<Uint32> oldColors(m_colors.size() * 2, 0);
+		std::vector<Uint32> oldCounts(m_counts.size() * 2, 0);
+		oldColors.swap(m_colors);
+		oldCounts.swap(m_counts);
+
+		++m_hashBits;
+		m_numColors = 0;
+
+		for (size_t old = 0; old < oldColors.size(); ++old)
+		{
+			if (oldColors[ old ])
+				Insert(oldColors[ old ], oldCounts[ old ]);
+		}
+	}
+}
+
+void ColorCounts::AddRow(const Uint32* pRow, int width)
+{
+	// Runs of the same color are common, and only go in once
+	for (int x = 0; x < width; )
+	{
+		Uint32 color = pRow[ x ];
+		int run = x + 1;
+
+		while ((run < width) && (pRow[ run ] == color))
+			++run;
+
+		Insert(color, (Uint32)(run - x));
+
+		x = run;
+	}
+}
+
+void ColorCounts::Merge(const ColorCounts& other)
+{
+	for (size_t slot = 0; slot < other.m_colors.size(); ++slot)
+	{
+		if (other.m_colors[ slot ])
+			Insert(other.m_colors[ slot ], other.m_counts[ slot ]);
+	}
+}
+
+void ColorCounts::GetHistogram(std::vector<liq_histogram_entry>& histogram) const
+{
+	histogram.clear();
+	histogram.reserve(m_numColors);
+
+	for (size_t slot = 0; slot < m_colors.size(); ++slot)
+	{
+		Uint32 color = m_colors[ slot ];
+
+		if (0 == color)
+			continue;
+
+		liq_histogram_entry entry;
+		entry.color.r = (unsigned char) ((color >>  0) & 0xFF);
+		entry.color.g = (unsigned char) ((color >>  8) & 0xFF);
+		entry.color.b = (unsigned char) ((color >> 16) & 0xFF);
+		entry.color.a = (unsigned char) ((color >> 24) & 0xFF);
+		entry.count = m_counts[ slot ];
+
+		histogram.push_back(entry);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+void ImageIngest::CountColors(ColorCounts& counts)
+{
+	std::vector<Uint32> row(m_width);
+
+	for (int y = 0; y < m_height; ++y)
+	{
+		ConvertRow(&row[0], y);
+		counts.AddRow(&row[0], m_width);
+	}
+}
+
+void ImageIngest::CountColors(std::vector<liq_histogram_entry>& histogram)
+{
+	ColorCounts counts;
+
+	CountColors(counts);
+
+	m_uniqueColors = counts.GetNumColors();
+
+	counts.GetHistogram(histogram);
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,88 @@
+//
+// ImageIngest - Single pass feed from an SDL_Surface into libimagequant
+//
+// Reads the source format, swizzles to RGBA, pre-multiplies alpha, and
+// forces opaque, a row at a time.  There is no intermediate RGBA copy of
+// the image.  The colors are counted in the same pass, and go to
+// libimagequant as a liq_histogram, so it doesn't walk the image to make
+// its own, the rows are only read again for the remap.
+//
+#ifndef INGEST_H_
+#define INGEST_H_
+
+#include <SDL.h>
+#include <vector>
+
+#include "libimagequant.h"
+
+//------------------------------------------------------------------------------
+//
+// How many pixels have each color, an open addressing hash.  Every row out
+// of ConvertRow is opaque, so 0 is never a color, and marks an empty slot.
+// Counts from more than one image merge, for frames that share a palette
+//
+class ColorCounts
+{
+public:
+	ColorCounts();
+
+	void AddRow(const Uint32* pRow, int width);
+	void Merge(const ColorCounts& other);
+
+	int GetNumColors() const { return m_numColors; }
+
+	// For liq_histogram_add_colors, in no particular order
+	void GetHistogram(std::vector<liq_histogram_entry>& histogram) const;
+
+private:
+	void Insert(Uint32 color, Uint32 count);
+
+	int m_hashBits;
+	int m_numColors;
+	std::vector<Uint32> m_colors;
+	std::vector<Uint32> m_counts;
+};
+
+//------------------------------------------------------------------------------
+
+class ImageIngest
+{
+public:
+	ImageIngest(SDL_Surface* pSurface);
+	~ImageIngest();
+
+	// The ImageIngest has to outlive the liq_image, because libimagequant
+	// calls back into us for rows, during quantize and during remap
+	liq_image* CreateLiqImage(liq_attr* pAttr);
+
+	// Convert one row into RGBA, can be used without libimagequant
+	void ConvertRow(Uint32* pDest, int row);
+
+	// Converts every row, and counts how many pixels have each color, for
+	// liq_histogram_add_colors, in no particular order
+	void CountColors(std::vector<liq_histogram_entry>& histogram);
+
+	// Same, into counts, which can already have colors from other images
+	void CountColors(ColorCounts& counts);
+
+	// Number of unique (opaque) colors, after CountColors
+	int GetUniqueColorCount() { return m_uniqueColors; }
+
+private:
+
+	static void RowCallback(liq_color row_out[], int row, int width, void* user_info);
+
+	SDL_Surface* m_pSurface;
+	bool m_bLocked;
+
+	int m_width;
+	int m_height;
+
+	// Pre-multiplied palette, for the 8 bit indexed case
+	Uint32 m_clut[ 256 ];
+
+	int m_uniqueColors;
+};
+
+#endif // INGEST_H_
+
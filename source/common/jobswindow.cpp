@@ -0,0 +1,134 @@
+//
+// JobsWindow - What the background jobs are up to, with throughput, ETA, and
+// a way to cancel them
+//
+#include "jobswindow.h"
+
+#include "imgui.h"
+
+#include <stdio.h>
+
+//------------------------------------------------------------------------------
+
+/*static*/ BatchProgress& JobsWindow::GetProgress()
+{
+	static BatchProgress progress;
+	return progress;
+}
+
+//------------------------------------------------------------------------------
+
+static void FormatSeconds(char* pText, size_t size, double seconds)
+{
+	if (seconds < 0.0)
+		snprintf(pText, size, "--");
+	else if (seconds < 60.0)
+		snprintf(pText, size, "%.1fs", seconds);
+	else
+		snprintf(pText, size, "%dm %02ds", (int)(seconds / 60.0), (int)seconds % 60);
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ void JobsWindow::Draw(const char* title, bool* p_open)
+{
+	ImGui::SetNextWindowSize(ImVec2(500, 300), ImGuiCond_FirstUseEver);
+
+	if (!ImGui::Begin(title, p_open))
+	{
+		ImGui::End();
+		return;
+	}
+
+	BatchProgress& progress = GetProgress();
+
+	ProgressSummary summary;
+	progress.GetSummary(summary);
+
+	char eta[ 32 ];
+	FormatSeconds(eta, sizeof(eta), summary.m_etaSeconds);
+
+	ImGui::Text("%d jobs, %d running, %d queued, %d done, %d failed, %d canceled",
+				summary.m_numItems, summary.m_numRunning, summary.m_numQueued,
+				summary.m_numDone, summary.m_numFailed, summary.m_numCanceled);
+
+	ImGui::ProgressBar(summary.m_percent / 100.0f, ImVec2(-1.0f, 0.0f));
+
+	ImGui::Text("%.1f images/s   %.1f MP/s   ETA %s",
+				summary.m_imagesPerSecond, summary.m_megapixelsPerSecond, eta);
+
+	std::vector<ProgressItem> items;
+	progress.GetItems(items);
+
+	// One at a time, rather than CancelAll, which would cancel anything
+	// opened after this too
+	if (ImGui::Button("Cancel All"))
+	{
+		for (int idx = 0; idx < (int)items.size(); ++idx)
+		{
+			progress.Cancel(items[ idx ].m_id);
+		}
+	}
+
+	ImGui::SameLine();
+
+	if (ImGui::Button("Clear Finished"))
+	{
+		progress.RemoveFinished();
+	}
+
+	ImGui::Separator();
+
+	ImGui::BeginChild("jobs");
+	ImGui::Columns(4, "jobs");
+
+	for (int idx = 0; idx < (int)items.size(); ++idx)
+	{
+		const ProgressItem& item = items[ idx ];
+
+		ImGui::PushID(item.m_id);
+
+		ImGui::TextUnformatted(item.m_name.c_str());
+
+		if (!item.m_error.empty() && ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("%s", item.m_error.c_str());
+		}
+
+		ImGui::NextColumn();
+
+		ImGui::TextUnformatted(ProgressStateName(item.m_iState));
+		ImGui::NextColumn();
+
+		ImGui::ProgressBar(item.m_percent / 100.0f, ImVec2(-1.0f, 0.0f));
+		ImGui::NextColumn();
+
+		if ((eProgressQueued == item.m_iState) || (eProgressRunning == item.m_iState))
+		{
+			if (item.m_bCancel)
+			{
+				ImGui::TextDisabled("canceling");
+			}
+			else if (ImGui::SmallButton("Cancel"))
+			{
+				progress.Cancel(item.m_id);
+			}
+		}
+		else
+		{
+			ImGui::Text("%.1fms", item.m_milliseconds);
+		}
+
+		ImGui::NextColumn();
+
+		ImGui::PopID();
+	}
+
+	ImGui::Columns(1);
+	ImGui::EndChild();
+
+	ImGui::End();
+}
+
+//------------------------------------------------------------------------------
+
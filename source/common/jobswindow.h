@@ -0,0 +1,20 @@
+//
+// JobsWindow - What the background jobs are up to, with throughput, ETA, and
+// a way to cancel them
+//
+#ifndef JOBSWINDOW_H_
+#define JOBSWINDOW_H_
+
+#include "progress.h"
+
+class JobsWindow
+{
+public:
+	// Everything the GUI runs in the background reports here
+	static BatchProgress& GetProgress();
+
+	// Dear ImGui Window
+	static void Draw(const char* title, bool* p_open = NULL);
+};
+
+#endif // JOBSWINDOW_H_
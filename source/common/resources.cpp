@@ -0,0 +1,376 @@
+//
+// ResourceTracker - Who owns what, SDL Surfaces, GL Textures, pixel buffers
+// and libimagequant allocations, with high water marks
+//
+#include "resources.h"
+
+#include "imgui.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <mutex>
+#include <utility>
+
+//------------------------------------------------------------------------------
+
+struct ResourceEntry
+{
+	std::string m_owner;
+	size_t m_bytes;
+};
+
+struct OwnerCounts
+{
+	ResourceCount m_types[ eResourceType_COUNT ];
+
+	bool IsEmpty() const
+	{
+		for (int type = 0; type < eResourceType_COUNT; ++type)
+		{
+			if (m_types[ type ].m_count || m_types[ type ].m_bytes)
+				return false;
+		}
+
+		return true;
+	}
+};
+
+struct ResourceBook
+{
+	std::mutex m_mutex;
+
+	// (type, handle) -> who, and how big
+	std::map<std::pair<int, uintptr_t>, ResourceEntry> m_entries;
+
+	// owner -> counts for each type
+	std::map<std::string, OwnerCounts> m_owners;
+	ResourceCount m_totals[ eResourceType_COUNT ];
+};
+
+// Function static, so this works during static construction too
+static ResourceBook& GetBook()
+{
+	static ResourceBook book;
+	return book;
+}
+
+static thread_local ResourceScope* t_pScope = nullptr;
+
+// In front of every libimagequant allocation, so the free knows the size,
+// 16 bytes, to keep the memory as aligned as malloc's
+static const size_t LIQ_HEADER_SIZE = 16;
+
+//------------------------------------------------------------------------------
+
+static void Charge(ResourceCount& counts, int deltaCount, ptrdiff_t deltaBytes)
+{
+	counts.m_count += deltaCount;
+	counts.m_bytes = (size_t)((ptrdiff_t)counts.m_bytes + deltaBytes);
+
+	if (counts.m_count > counts.m_peakCount) counts.m_peakCount = counts.m_count;
+	if (counts.m_bytes > counts.m_peakBytes) counts.m_peakBytes = counts.m_bytes;
+}
+
+// The owner's row goes, once it has nothing left (a closed document), so
+// the list doesn't keep growing
+static void ChargeOwner(ResourceBook& book, const std::string& owner, int type,
+						int deltaCount, ptrdiff_t deltaBytes)
+{
+	std::map<std::string, OwnerCounts>::iterator it = book.m_owners.insert(
+		std::make_pair(owner, OwnerCounts())).first;
+
+	Charge(it->second.m_types[ type ], deltaCount, deltaBytes);
+
+	if (it->second.IsEmpty())
+		book.m_owners.erase(it);
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ void ResourceTracker::Add(const std::string& owner, int type, uintptr_t handle, size_t bytes)
+{
+	if (!handle) return;
+
+	ResourceBook& book = GetBook();
+	std::lock_guard<std::mutex> lock(book.m_mutex);
+
+	std::pair<int, uintptr_t> key(type, handle);
+
+	// Somebody is reusing a handle, without telling us it went away
+	std::map<std::pair<int, uintptr_t>, ResourceEntry>::iterator it = book.m_entries.find(key);
+	if (it != book.m_entries.end())
+	{
+		ChargeOwner(book, it->second.m_owner, type, -1, -(ptrdiff_t)it->second.m_bytes);
+		Charge(book.m_totals[ type ], -1, -(ptrdiff_t)it->second.m_bytes);
+	}
+
+	ResourceEntry& entry = book.m_entries[ key ];
+	entry.m_owner = owner;
+	entry.m_bytes = bytes;
+
+	ChargeOwner(book, owner, type, 1, (ptrdiff_t)bytes);
+	Charge(book.m_totals[ type ], 1, (ptrdiff_t)bytes);
+}
+
+/*static*/ void ResourceTracker::Resize(int type, uintptr_t handle, size_t bytes)
+{
+	ResourceBook& book = GetBook();
+	std::lock_guard<std::mutex> lock(book.m_mutex);
+
+	std::map<std::pair<int, uintptr_t>, ResourceEntry>::iterator it = book.m_entries.find(std::make_pair(type, handle));
+
+	if (it != book.m_entries.end())
+	{
+		ptrdiff_t delta = (ptrdiff_t)bytes - (ptrdiff_t)it->second.m_bytes;
+		it->second.m_bytes = bytes;
+
+		ChargeOwner(book, it->second.m_owner, type, 0, delta);
+		Charge(book.m_totals[ type ], 0, delta);
+	}
+}
+
+/*static*/ void ResourceTracker::Remove(int type, uintptr_t handle)
+{
+	if (!handle) return;
+
+	ResourceBook& book = GetBook();
+	std::lock_guard<std::mutex> lock(book.m_mutex);
+
+	std::map<std::pair<int, uintptr_t>, ResourceEntry>::iterator it = book.m_entries.find(std::make_pair(type, handle));
+
+	if (it != book.m_entries.end())
+	{
+		ChargeOwner(book, it->second.m_owner, type, -1, -(ptrdiff_t)it->second.m_bytes);
+		Charge(book.m_totals[ type ], -1, -(ptrdiff_t)it->second.m_bytes);
+
+		book.m_entries.erase(it);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ void ResourceTracker::AddSurface(const std::string& owner, SDL_Surface* pSurface)
+{
+	if (pSurface)
+	{
+		Add(owner, eResSurface, (uintptr_t)pSurface, (size_t)pSurface->pitch * pSurface->h);
+	}
+}
+
+/*static*/ void ResourceTracker::RemoveSurface(SDL_Surface* pSurface)
+{
+	Remove(eResSurface, (uintptr_t)pSurface);
+}
+
+/*static*/ void ResourceTracker::AddTexture(const std::string& owner, unsigned int texture, int width, int height)
+{
+	Add(owner, eResTexture, (uintptr_t)texture, (size_t)width * height * 4);
+}
+
+/*static*/ void ResourceTracker::RemoveTexture(unsigned int texture)
+{
+	Remove(eResTexture, (uintptr_t)texture);
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ ResourceCount ResourceTracker::GetCount(const std::string& owner, int type)
+{
+	ResourceBook& book = GetBook();
+	std::lock_guard<std::mutex> lock(book.m_mutex);
+
+	ResourceCount result;
+
+	std::map<std::string, OwnerCounts>::iterator it = book.m_owners.find(owner);
+
+	if (it != book.m_owners.end())
+	{
+		result = it->second.m_types[ type ];
+	}
+
+	return result;
+}
+
+/*static*/ ResourceCount ResourceTracker::GetTotal(int type)
+{
+	ResourceBook& book = GetBook();
+	std::lock_guard<std::mutex> lock(book.m_mutex);
+
+	return book.m_totals[ type ];
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ void* ResourceTracker::LiqMalloc(size_t size)
+{
+	Uint8* pBlock = (Uint8*)malloc(size + LIQ_HEADER_SIZE);
+
+	if (nullptr == pBlock)
+		return nullptr;
+
+	memcpy(pBlock, &size, sizeof(size));
+
+	ResourceScope* pScope = t_pScope;
+
+	if (pScope)
+	{
+		pScope->m_liqBytes += size;
+
+		if (pScope->m_liqBytes > pScope->m_liqPeakBytes)
+			pScope->m_liqPeakBytes = pScope->m_liqBytes;
+	}
+
+	return pBlock + LIQ_HEADER_SIZE;
+}
+
+/*static*/ void ResourceTracker::LiqFree(void* pMemory)
+{
+	if (nullptr == pMemory)
+		return;
+
+	Uint8* pBlock = (Uint8*)pMemory - LIQ_HEADER_SIZE;
+
+	size_t size;
+	memcpy(&size, pBlock, sizeof(size));
+
+	ResourceScope* pScope = t_pScope;
+
+	// Freed outside the scope it came from, it's just left in the peak
+	if (pScope && (pScope->m_liqBytes >= size))
+		pScope->m_liqBytes -= size;
+
+	free(pBlock);
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ const char* ResourceTracker::TypeName(int type)
+{
+	static const char* names[] =
+	{
+		"Surfaces",
+		"Textures",
+		"Pixel Buffers",
+		"libimagequant"
+	};
+
+	if ((type >= 0) && (type < eResourceType_COUNT))
+		return names[ type ];
+
+	return "?";
+}
+
+//------------------------------------------------------------------------------
+
+static void DrawCount(const ResourceCount& counts)
+{
+	ImGui::Text("%d (%d)", counts.m_count, counts.m_peakCount);
+	ImGui::NextColumn();
+	ImGui::Text("%zuK (%zuK)", (counts.m_bytes + 1023) / 1024, (counts.m_peakBytes + 1023) / 1024);
+	ImGui::NextColumn();
+}
+
+/*static*/ void ResourceTracker::Draw(const char* title, bool* p_open)
+{
+	ImGui::SetNextWindowSize(ImVec2(500, 300), ImGuiCond_FirstUseEver);
+
+	if (!ImGui::Begin(title, p_open))
+	{
+		ImGui::End();
+		return;
+	}
+
+	ImGui::TextDisabled("Count (Peak)   Size (Peak)");
+	ImGui::Separator();
+
+	ResourceBook& book = GetBook();
+	std::lock_guard<std::mutex> lock(book.m_mutex);
+
+	ImGui::Columns(3, "resources");
+
+	ImGui::Text("Total");
+	ImGui::NextColumn();
+	ImGui::NextColumn();
+	ImGui::NextColumn();
+
+	for (int type = 0; type < eResourceType_COUNT; ++type)
+	{
+		ImGui::Text("  %s", TypeName(type));
+		ImGui::NextColumn();
+		DrawCount(book.m_totals[ type ]);
+	}
+
+	ImGui::Separator();
+
+	std::map<std::string, OwnerCounts>::iterator it;
+
+	for (it = book.m_owners.begin(); it != book.m_owners.end(); ++it)
+	{
+		ImGui::TextUnformatted(it->first.c_str());
+		ImGui::NextColumn();
+		ImGui::NextColumn();
+		ImGui::NextColumn();
+
+		for (int type = 0; type < eResourceType_COUNT; ++type)
+		{
+			const ResourceCount& counts = it->second.m_types[ type ];
+
+			// Skip the empty stuff, to keep the list down
+			if (!counts.m_peakCount)
+				continue;
+
+			ImGui::Text("  %s", TypeName(type));
+			ImGui::NextColumn();
+			DrawCount(counts);
+		}
+	}
+
+	ImGui::Columns(1);
+
+	ImGui::End();
+}
+
+//------------------------------------------------------------------------------
+
+ResourceScope::ResourceScope(const std::string& owner)
+	: m_owner(owner)
+	, m_pPrevious(t_pScope)
+	, m_liqBytes(0)
+	, m_liqPeakBytes(0)
+{
+	t_pScope = this;
+}
+
+ResourceScope::~ResourceScope()
+{
+	t_pScope = m_pPrevious;
+
+	if (m_liqPeakBytes)
+	{
+		ResourceBook& book = GetBook();
+		std::lock_guard<std::mutex> lock(book.m_mutex);
+
+		// In and out again, it's the peak that's interesting, libimagequant
+		// has let go of everything by the time a quantize is done
+		Charge(book.m_totals[ eResQuantizer ], 1, (ptrdiff_t)m_liqPeakBytes);
+		Charge(book.m_totals[ eResQuantizer ], -1, -(ptrdiff_t)m_liqPeakBytes);
+
+		OwnerCounts& counts = book.m_owners[ m_owner ];
+		Charge(counts.m_types[ eResQuantizer ], 1, (ptrdiff_t)m_liqPeakBytes);
+		Charge(counts.m_types[ eResQuantizer ], -1, -(ptrdiff_t)m_liqPeakBytes);
+
+		if (counts.IsEmpty())
+			book.m_owners.erase(m_owner);
+	}
+}
+
+/*static*/ const std::string& ResourceScope::GetOwner()
+{
+	static const std::string unscoped = "Unscoped";
+
+	return t_pScope ? t_pScope->m_owner : unscoped;
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,93 @@
+//
+// ResourceTracker - Who owns what, SDL Surfaces, GL Textures, pixel buffers
+// and libimagequant allocations, with high water marks
+//
+#ifndef RESOURCES_H_
+#define RESOURCES_H_
+
+#include <SDL.h>
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+enum ResourceType
+{
+	eResSurface,
+	eResTexture,
+	eResPixelBuffer,
+	eResQuantizer,
+
+	eResourceType_COUNT
+};
+
+struct ResourceCount
+{
+	ResourceCount()
+		: m_count(0)
+		, m_bytes(0)
+		, m_peakCount(0)
+		, m_peakBytes(0)
+	{
+	}
+
+	int    m_count;
+	size_t m_bytes;
+	int    m_peakCount;
+	size_t m_peakBytes;
+};
+
+class ResourceTracker
+{
+public:
+
+	// Generic interface, handle just has to be unique within the type
+	static void Add(const std::string& owner, int type, uintptr_t handle, size_t bytes);
+	static void Resize(int type, uintptr_t handle, size_t bytes);
+	static void Remove(int type, uintptr_t handle);
+
+	// Helpers, for the common cases
+	static void AddSurface(const std::string& owner, SDL_Surface* pSurface);
+	static void RemoveSurface(SDL_Surface* pSurface);
+	static void AddTexture(const std::string& owner, unsigned int texture, int width, int height);
+	static void RemoveTexture(unsigned int texture);
+
+	// Queries, for the UI, and for tests
+	static ResourceCount GetCount(const std::string& owner, int type);
+	static ResourceCount GetTotal(int type);
+
+	// Allocator for liq_attr_create_with_allocator, the allocations are
+	// added up, without a lock, in whichever ResourceScope is active on the
+	// calling thread, and the scope charges its owner when it closes
+	static void* LiqMalloc(size_t size);
+	static void  LiqFree(void* pMemory);
+
+	// Dear ImGui Window
+	static void Draw(const char* title, bool* p_open = NULL);
+
+	static const char* TypeName(int type);
+};
+
+//------------------------------------------------------------------------------
+// Charge libimagequant allocations, made on this thread, to an owner.  Put
+// one around a quantize, it goes in as one libimagequant entry, as big as
+// the most that was allocated at once
+class ResourceScope
+{
+public:
+	ResourceScope(const std::string& owner);
+	~ResourceScope();
+
+	static const std::string& GetOwner();
+
+private:
+	friend class ResourceTracker;
+
+	std::string m_owner;
+	ResourceScope* m_pPrevious;
+
+	size_t m_liqBytes;
+	size_t m_liqPeakBytes;
+};
+
+#endif // RESOURCES_H_
+
@@ -0,0 +1,209 @@
+//
+// OpenGL Texture helpers, for getting SDL_Surfaces up onto the GPU
+//
+#include "texture.h"
+
+#include "imgui.h"
+#include "imgui_impl_opengl3.h"
+
+// About Desktop OpenGL function loaders:
+//  Modern desktop OpenGL doesn't have a standard portable header file to load OpenGL function pointers.
+//  Helper libraries are often used for this purpose! Here we are supporting a few common ones (gl3w, glew, glad).
+//  You may use another loader/header of your choice (glext, glLoadGen, etc.), or chose to manually implement your own.
+#if defined(IMGUI_IMPL_OPENGL_LOADER_GL3W)
+#include <GL/gl3w.h>    // Initialize with gl3wInit()
+#elif defined(IMGUI_IMPL_OPENGL_LOADER_GLEW)
+#include <GL/glew.h>    // Initialize with glewInit()
+#elif defined(IMGUI_IMPL_OPENGL_LOADER_GLAD)
+#include <glad/glad.h>  // Initialize with gladLoadGL()
+#else
+#include IMGUI_IMPL_OPENGL_LOADER_CUSTOM
+#endif
+
+// If there are more rectangles than this, just upload the bounding box
+static const int MAX_DIRTY_RECTS = 16;
+
+//------------------------------------------------------------------------------
+/* Quick utility function for texture creation */
+int SDL_GL_TextureSize(int input)
+{
+    int value = 1;
+
+    while (value < input) {
+        value <<= 1;
+    }
+    return value;
+}
+
+//------------------------------------------------------------------------------
+GLuint
+SDL_GL_LoadTexture(SDL_Surface * surface, GLfloat * texcoord)
+{
+    GLuint texture;
+    int w, h;
+    SDL_Surface *image;
+    SDL_Rect area;
+    SDL_BlendMode saved_mode;
+
+    /* Use the surface width and height expanded to powers of 2 */
+    w = SDL_GL_TextureSize(surface->w);
+    h = SDL_GL_TextureSize(surface->h);
+    texcoord[0] = 0.0f;         /* Min X */
+    texcoord[1] = 0.0f;         /* Min Y */
+    texcoord[2] = (GLfloat) surface->w / w;     /* Max X */
+    texcoord[3] = (GLfloat) surface->h / h;     /* Max Y */
+
+    image = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32,
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN     /* OpenGL RGBA masks */
+                                 0x000000FF,
+                                 0x0000FF00, 0x00FF0000, 0xFF000000
+#else
+                                 0xFF000000,
+                                 0x00FF0000, 0x0000FF00, 0x000000FF
+#endif
+        );
+    if (image == NULL) {
+        return 0;
+    }
+
+    /* Save the alpha blending attributes */
+    SDL_GetSurfaceBlendMode(surface, &saved_mode);
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+
+    /* Copy the surface into the GL texture image */
+    area.x = 0;
+    area.y = 0;
+    area.w = surface->w;
+    area.h = surface->h;
+    SDL_BlitSurface(surface, &area, image, &area);
+
+    /* Restore the alpha blending attributes */
+    SDL_SetSurfaceBlendMode(surface, saved_mode);
+
+    /* Create an OpenGL texture for the image */
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D,
+                 0,
+                 GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, image->pixels);
+    SDL_FreeSurface(image);     /* No longer needed */
+
+    return texture;
+}
+
+//------------------------------------------------------------------------------
+//
+// Only the pixels inside of area get converted, and sent to the GPU
+//
+void SDL_GL_UpdateTexture(GLuint texture, SDL_Surface * surface,
+						  const SDL_Rect& area, std::vector<Uint32>& staging)
+{
+	if ((area.w <= 0) || (area.h <= 0))
+		return;
+
+	size_t numPixels = (size_t)area.w * area.h;
+
+	if (staging.size() < numPixels)
+	{
+		staging.resize(numPixels);
+	}
+
+	// Wrap the staging buffer, so SDL can convert whatever format the
+	// surface is in, into RGBA for us
+	SDL_Surface* pStage = SDL_CreateRGBSurfaceWithFormatFrom(&staging[0],
+										area.w, area.h, 32, area.w * sizeof(Uint32),
+										SDL_PIXELFORMAT_RGBA32);
+	if (nullptr == pStage)
+		return;
+
+	SDL_BlendMode saved_mode;
+	SDL_GetSurfaceBlendMode(surface, &saved_mode);
+	SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+
+	SDL_Rect source_area = area;
+	SDL_BlitSurface(surface, &source_area, pStage, nullptr);
+
+	SDL_SetSurfaceBlendMode(surface, saved_mode);
+
+	SDL_FreeSurface(pStage);  // staging pixels are still ours
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glTexSubImage2D(GL_TEXTURE_2D, 0,
+					area.x, area.y, area.w, area.h,
+					GL_RGBA, GL_UNSIGNED_BYTE, &staging[0]);
+}
+
+//------------------------------------------------------------------------------
+
+DirtyRects::DirtyRects()
+{
+}
+
+void DirtyRects::Add(int x, int y, int w, int h)
+{
+	SDL_Rect area = { x, y, w, h };
+	Add(area);
+}
+
+void DirtyRects::Add(const SDL_Rect& area)
+{
+	if ((area.w <= 0) || (area.h <= 0))
+		return;
+
+	SDL_Rect merged = area;
+
+	// Keep absorbing anything we touch, until nothing else overlaps
+	bool bMerged = true;
+	while (bMerged)
+	{
+		bMerged = false;
+
+		for (int idx = 0; idx < (int)m_rects.size(); ++idx)
+		{
+			const SDL_Rect& rect = m_rects[ idx ];
+
+			// Touching counts, so neighboring pixels turn into one upload
+			if ((rect.x <= merged.x + merged.w) && (merged.x <= rect.x + rect.w) &&
+				(rect.y <= merged.y + merged.h) && (merged.y <= rect.y + rect.h))
+			{
+				SDL_UnionRect(&merged, &rect, &merged);
+				m_rects.erase(m_rects.begin() + idx);
+				bMerged = true;
+				break;
+			}
+		}
+	}
+
+	m_rects.push_back(merged);
+
+	if (m_rects.size() > MAX_DIRTY_RECTS)
+	{
+		SDL_Rect bounds = m_rects[0];
+
+		for (int idx = 1; idx < (int)m_rects.size(); ++idx)
+		{
+			SDL_UnionRect(&bounds, &m_rects[ idx ], &bounds);
+		}
+
+		m_rects.clear();
+		m_rects.push_back(bounds);
+	}
+}
+
+int DirtyRects::GetArea() const
+{
+	int area = 0;
+
+	for (int idx = 0; idx < (int)m_rects.size(); ++idx)
+	{
+		area += m_rects[ idx ].w * m_rects[ idx ].h;
+	}
+
+	return area;
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,52 @@
+//
+// OpenGL Texture helpers, for getting SDL_Surfaces up onto the GPU
+//
+#ifndef TEXTURE_H_
+#define TEXTURE_H_
+
+#include <SDL.h>
+#include <vector>
+
+#ifndef GLuint
+typedef unsigned int	GLuint;		/* 4-byte unsigned */
+typedef float		GLfloat;	/* single precision float */
+#endif
+
+// Textures are allocated with power of 2 dimensions
+int SDL_GL_TextureSize(int input);
+
+// Full upload, allocates a new texture
+GLuint SDL_GL_LoadTexture(SDL_Surface * surface, GLfloat * texcoord);
+
+// Partial upload, into a texture that already exists, and is big enough
+// the area is staged through the pStaging buffer, so keep it around
+void SDL_GL_UpdateTexture(GLuint texture, SDL_Surface * surface,
+						  const SDL_Rect& area, std::vector<Uint32>& staging);
+
+//------------------------------------------------------------------------------
+//
+// Keep track of which parts of a surface have changed since the last upload
+// Overlapping areas are merged, and if it gets too fragmented, collapse
+// everything down to a single bounding rectangle
+//
+class DirtyRects
+{
+public:
+	DirtyRects();
+
+	void Add(const SDL_Rect& area);
+	void Add(int x, int y, int w, int h);
+	void Clear() { m_rects.clear(); }
+
+	bool IsEmpty() const { return m_rects.empty(); }
+	int  GetArea() const;
+
+	const std::vector<SDL_Rect>& GetRects() const { return m_rects; }
+
+private:
+
+	std::vector<SDL_Rect> m_rects;
+};
+
+#endif // TEXTURE_H_
+
@@ -0,0 +1,327 @@
+//
+// ThumbnailPane - Thumbnails of the images in the Open Image dialog's folder
+//
+#include "thumbnailpane.h"
+
+#include "imgui.h"
+#include "ImGuiFileDialog.h"
+#include "texture.h"
+#include "resources.h"
+
+#include "files.h"
+#include "thumbcache.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#if defined(IMGUI_IMPL_OPENGL_LOADER_GL3W)
+#include <GL/gl3w.h>    // Initialize with gl3wInit()
+#elif defined(IMGUI_IMPL_OPENGL_LOADER_GLEW)
+#include <GL/glew.h>    // Initialize with glewInit()
+#elif defined(IMGUI_IMPL_OPENGL_LOADER_GLAD)
+#include <glad/glad.h>  // Initialize with gladLoadGL()
+#else
+#include IMGUI_IMPL_OPENGL_LOADER_CUSTOM
+#endif
+
+static const int THUMB_COLUMNS        = 2;
+static const int THUMB_UPLOADS        = 8;     // most new textures a frame
+static const int THUMB_MAX_TEXTURES   = 256;   // off screen ones go past this
+static const int THUMB_MAX_IMAGES     = 1024;  // thumbnails kept in memory
+static const float THUMB_PADDING      = 4.0f;
+
+struct ThumbTexture
+{
+	GLuint m_texture;
+	GLfloat m_uv[ 4 ];
+	int m_width;
+	int m_height;
+	int m_lastFrame;
+};
+
+struct ThumbnailPaneState
+{
+	ThumbnailPaneState()
+		: m_pCache(nullptr)
+		, m_frame(0)
+	{
+	}
+
+	ThumbnailCache* m_pCache;
+	int m_frame;
+
+	// What's listed, rebuilt when the folder, the filter, or the search changes
+	std::string m_directory;
+	std::string m_filter;
+	std::string m_search;
+	std::vector<std::string> m_allFiles;
+	std::vector<int> m_shown;
+
+	std::map<std::string, ThumbTexture> m_textures;
+
+	std::string m_picked;
+};
+
+static ThumbnailPaneState s_pane;
+
+//------------------------------------------------------------------------------
+
+static void FreeTexture(ThumbTexture& texture)
+{
+	if (texture.m_texture)
+	{
+		ResourceTracker::RemoveTexture(texture.m_texture);
+		glDeleteTextures(1, &texture.m_texture);
+		texture.m_texture = 0;
+	}
+}
+
+// Least recently drawn first, until there are only so many
+static void TrimTextures()
+{
+	if ((int)s_pane.m_textures.size() <= THUMB_MAX_TEXTURES)
+		return;
+
+	std::vector<std::pair<int, std::string>> byFrame;
+
+	for (std::map<std::string, ThumbTexture>::iterator it = s_pane.m_textures.begin();
+		 it != s_pane.m_textures.end(); ++it)
+	{
+		byFrame.push_back(std::make_pair(it->second.m_lastFrame, it->first));
+	}
+
+	std::sort(byFrame.begin(), byFrame.end());
+
+	int numRemove = (int)s_pane.m_textures.size() - THUMB_MAX_TEXTURES;
+
+	for (int idx = 0; idx < numRemove; ++idx)
+	{
+		std::map<std::string, ThumbTexture>::iterator it = s_pane.m_textures.find(byFrame[ idx ].second);
+
+		FreeTexture(it->second);
+		s_pane.m_textures.erase(it);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+static void UpdateFileList(const std::string& filter)
+{
+	std::string directory = ImGuiFileDialog::Instance()->GetCurrentPath();
+	std::string search = ImGuiFileDialog::SearchBuffer;
+
+	bool bRescan = (directory != s_pane.m_directory);
+
+	if (!bRescan && (filter == s_pane.m_filter) && (search == s_pane.m_search))
+		return;
+
+	if (bRescan)
+	{
+		s_pane.m_directory = directory;
+		s_pane.m_allFiles.clear();
+
+		CollectImageFiles(directory, false, s_pane.m_allFiles);
+	}
+
+	s_pane.m_filter = filter;
+	s_pane.m_search = search;
+	s_pane.m_shown.clear();
+
+	// Same rules as the dialog's own list, so the two agree
+	bool bFilter = !filter.empty() && (".*" != filter);
+
+	for (int idx = 0; idx < (int)s_pane.m_allFiles.size(); ++idx)
+	{
+		std::string name = GetFileName(s_pane.m_allFiles[ idx ]);
+
+		if (bFilter)
+		{
+			size_t dot = name.find_last_of('.');
+
+			if ((std::string::npos == dot) || (name.substr(dot) != filter))
+				continue;
+		}
+
+		if (!search.empty() && (std::string::npos == name.find(search)))
+			continue;
+
+		s_pane.m_shown.push_back(idx);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ float ThumbnailPane::GetWidth()
+{
+	ImGuiStyle& style = ImGui::GetStyle();
+
+	float cell = (float)ThumbnailCache::DEFAULT_SIZE + (THUMB_PADDING * 2.0f) +
+				 (style.FramePadding.x * 2.0f) + style.ItemSpacing.x;
+
+	return (cell * THUMB_COLUMNS) + style.ScrollbarSize + (style.WindowPadding.x * 2.0f);
+}
+
+/*static*/ std::string ThumbnailPane::TakePicked()
+{
+	std::string picked;
+	picked.swap(s_pane.m_picked);
+
+	return picked;
+}
+
+/*static*/ void ThumbnailPane::Release()
+{
+	for (std::map<std::string, ThumbTexture>::iterator it = s_pane.m_textures.begin();
+		 it != s_pane.m_textures.end(); ++it)
+	{
+		FreeTexture(it->second);
+	}
+
+	s_pane.m_textures.clear();
+
+	delete s_pane.m_pCache;
+	s_pane.m_pCache = nullptr;
+
+	s_pane.m_directory.clear();
+	s_pane.m_allFiles.clear();
+	s_pane.m_shown.clear();
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ void ThumbnailPane::Draw(std::string filter, void* pUserDatas, bool* pCanContinue)
+{
+	(void)pUserDatas;
+	(void)pCanContinue;
+
+	if (nullptr == s_pane.m_pCache)
+		s_pane.m_pCache = new ThumbnailCache(ThumbnailCache::DefaultDirectory());
+
+	ThumbnailCache& cache = *s_pane.m_pCache;
+
+	cache.NextFrame();
+	++s_pane.m_frame;
+
+	UpdateFileList(filter);
+
+	int numShown = (int)s_pane.m_shown.size();
+	int numPending = cache.GetNumPending();
+
+	if (numPending)
+		ImGui::Text("%d images, %d coming", numShown, numPending);
+	else
+		ImGui::Text("%d images", numShown);
+
+	ImGui::Separator();
+
+	ImGui::BeginChild("##Thumbnails");
+
+	float thumbSize = (float)cache.GetThumbSize();
+	ImVec2 buttonSize(thumbSize + (THUMB_PADDING * 2.0f), thumbSize + (THUMB_PADDING * 2.0f));
+
+	// Image buttons add the frame padding around the image
+	ImGuiStyle& style = ImGui::GetStyle();
+	ImVec2 cellSize(buttonSize.x + (style.FramePadding.x * 2.0f), buttonSize.y + (style.FramePadding.y * 2.0f));
+
+	int columns = SDL_max(1, (int)((ImGui::GetContentRegionAvail().x + style.ItemSpacing.x) /
+								   (cellSize.x + style.ItemSpacing.x)));
+	int rows = (numShown + columns - 1) / columns;
+
+	int uploads = 0;
+
+	ImGuiListClipper clipper(rows, cellSize.y + style.ItemSpacing.y);
+
+	while (clipper.Step())
+	{
+		for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+		{
+			for (int column = 0; column < columns; ++column)
+			{
+				int shownIndex = (row * columns) + column;
+
+				if (shownIndex >= numShown)
+					break;
+
+				const std::string& path = s_pane.m_allFiles[ s_pane.m_shown[ shownIndex ] ];
+
+				if (column)
+					ImGui::SameLine();
+
+				ImGui::PushID(shownIndex);
+
+				const RGBAImage* pImage = nullptr;
+				int state = cache.Request(path, &pImage);
+
+				std::map<std::string, ThumbTexture>::iterator it = s_pane.m_textures.find(path);
+
+				if ((it == s_pane.m_textures.end()) && pImage && (uploads < THUMB_UPLOADS))
+				{
+					ThumbTexture texture;
+
+					SDL_Surface* pSurface = pImage->WrapSurface();
+
+					texture.m_texture = SDL_GL_LoadTexture(pSurface, texture.m_uv);
+					texture.m_width = pImage->GetWidth();
+					texture.m_height = pImage->GetHeight();
+					texture.m_lastFrame = s_pane.m_frame;
+
+					SDL_FreeSurface(pSurface);
+
+					if (texture.m_texture)
+					{
+						ResourceTracker::AddTexture("Thumbnails", texture.m_texture,
+													SDL_GL_TextureSize(texture.m_width),
+													SDL_GL_TextureSize(texture.m_height));
+					}
+
+					it = s_pane.m_textures.insert(std::make_pair(path, texture)).first;
+
+					++uploads;
+				}
+
+				if ((it != s_pane.m_textures.end()) && it->second.m_texture)
+				{
+					ThumbTexture& texture = it->second;
+					texture.m_lastFrame = s_pane.m_frame;
+
+					// Centered in the cell, at its own size
+					float scale = thumbSize / (float)SDL_max(texture.m_width, texture.m_height);
+					scale = SDL_min(scale, 1.0f);
+
+					ImVec2 imageSize(texture.m_width * scale, texture.m_height * scale);
+					ImVec2 padding((buttonSize.x - imageSize.x) * 0.5f, (buttonSize.y - imageSize.y) * 0.5f);
+
+					ImGui::PushStyleVar(ImGuiStyleVar_FramePadding,
+										ImVec2(style.FramePadding.x + padding.x,
+											   style.FramePadding.y + padding.y));
+
+					ImGui::ImageButton((ImTextureID)((size_t)texture.m_texture), imageSize,
+									   ImVec2(texture.m_uv[0], texture.m_uv[1]),
+									   ImVec2(texture.m_uv[2], texture.m_uv[3]));
+
+					ImGui::PopStyleVar();
+				}
+				else
+				{
+					ImGui::Button((eThumbFailed == state) ? "?" : "...", cellSize);
+				}
+
+				if (ImGui::IsItemHovered())
+				{
+					ImGui::SetTooltip("%s\nDouble click to open", GetFileName(path).c_str());
+
+					if (ImGui::IsMouseDoubleClicked(0))
+						s_pane.m_picked = path;
+				}
+
+				ImGui::PopID();
+			}
+		}
+	}
+
+	ImGui::EndChild();
+
+	TrimTextures();
+	cache.Trim(THUMB_MAX_IMAGES);
+}
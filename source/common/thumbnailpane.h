@@ -0,0 +1,30 @@
+//
+// ThumbnailPane - Thumbnails of the images in the Open Image dialog's folder
+//
+// Goes in ImGuiFileDialog's options pane.  Only the rows on screen ask the
+// ThumbnailCache for anything (ImGuiListClipper), and only a few finished
+// thumbnails are uploaded to textures a frame, so a big folder scrolls
+// smoothly while the workers catch up.
+//
+#ifndef THUMBNAILPANE_H_
+#define THUMBNAILPANE_H_
+
+#include <string>
+
+class ThumbnailPane
+{
+public:
+	// ImGuiFileDialog options pane callback
+	static void Draw(std::string filter, void* pUserDatas, bool* pCanContinue);
+
+	// Width to ask the dialog for
+	static float GetWidth();
+
+	// The image that was double clicked, then "", so it only opens once
+	static std::string TakePicked();
+
+	// Textures, and thumbnails, once the dialog is closed
+	static void Release();
+};
+
+#endif // THUMBNAILPANE_H_
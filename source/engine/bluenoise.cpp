@@ -0,0 +1,274 @@
+//
+// Engine BlueNoise - A tileable 64x64 void-and-cluster threshold mask
+//
+// Made once, offline, and kept here as a table (see bluenoise.h)
+//
+#include "bluenoise.h"
+
+// Ranks 0-4095, row by row
+static const Uint16 s_blueNoise[ BLUE_NOISE_SIZE * BLUE_NOISE_SIZE ] =
+{
+	 169, 2348, 3414, 2119,  745, 1856, 1145, 3674,  474, 2993, 1822, 2292,  605, 3011, 2255, 2795,
+	3593, 1241,  614, 3321, 2631, 1378, 3069,  204, 3299, 1972, 1233, 3066, 2195, 2752, 3677, 2525,
+	3130, 1985,  198, 3818, 3171,  281, 4094, 2335,  997,   46, 3140, 1480, 3513,  229, 3781, 2108,
+	 666, 2547, 1641, 2077, 2974, 1128, 3640, 1571, 2923,  106, 3718, 1211, 3971, 2506, 3345,  760,
+	1944, 4024,  899, 2964, 3539,  364, 2339, 2696, 1658, 1317, 2586,   19, 3626, 1500,  196, 1712,
+	 858, 2532, 1575,  187, 2025,  515, 3913, 2735,  807,  452, 4030, 1580,  895,  396, 1914, 1659,
+	 773, 1203, 2875,  720, 2612, 1959, 2911,  566, 1742, 2155, 3965,  601, 2862, 1100, 1682, 2731,
+	  26, 3937, 1028, 3483,  419, 2621, 1877,  534, 2526, 2020,  734, 2677,  192, 2203, 1677, 2944,
+	2651, 1373,  263, 1666, 2516, 1409, 4095,  152, 3178,  737, 3868, 3226, 1219, 2106, 3985, 3377,
+	 448, 3905, 3146, 2317, 3750, 1013, 1668, 2215, 1437, 2564, 3382,  137, 2466, 3506, 2946,  118,
+	3879, 2449, 3554, 2196, 1504, 1057, 3589, 1351, 3458, 2726, 1220, 2457, 1866, 3170,  775, 3375,
+	1355, 2240, 3051,  719, 1507, 4031,  877, 3241, 3862, 1379, 3454, 3064,  957, 3604,  357, 1123,
+	 580, 3474, 2805, 3821,  533, 3255,  864, 1956, 3518, 2158,  431, 1733, 2808,  744, 2468, 1042,
+	2919, 2093, 1125,  671, 2857, 3448,  107, 2990, 3724, 1088, 1779, 2111, 3777, 1349, 1016, 3328,
+	1462,  524, 1759,   32, 3774,  489, 2461,  155, 3101,  857,  393, 3754,  113, 2326, 4089,  490,
+	1905, 3570,  321, 2481, 2015, 2868,   62, 2303, 1050, 1739,  272, 2279, 1861, 1348, 3106, 3813,
+	2425, 1791,  958, 2058, 1228, 2220, 2747, 1518, 1082, 2893, 2459,  966, 3468,  330, 3157, 1876,
+	1438,   47, 3687, 1815, 1352, 2490, 1946,  644, 3224,  265, 2901,  693, 3147,  478, 2045, 2312,
+	2825, 3452,  967, 3060, 2699, 3280, 1697, 3988, 2022, 1501, 3526, 1661, 3297, 1053, 1484, 2494,
+	2833,  876, 1738, 3800, 1073, 3419, 1354, 3025,  384, 3592, 2831,  588, 4082, 2594,  789, 2092,
+	 236, 3286,  408, 3612, 2924,   70, 3856,  585, 3708,  220, 1419, 4018, 2055, 1595, 3737,  581,
+	2659, 3309, 2381,  326, 3186,  853, 4084, 1249, 1625, 2343, 3945,  987, 2615, 1699, 4075,  785,
+	 262, 1927, 3982, 1302, 1978,  772, 1182, 2352,  636, 2977, 2227, 2700,  704, 2061, 3068,  214,
+	3876, 1248, 3258,  158, 2716,  573, 1821, 3942, 2062, 2489, 1173, 3231, 1607,  146, 3353, 1531,
+	4005, 1114, 2603, 1442,  764, 3431, 1665, 2402, 3082, 1869, 3210,  550, 2635,   93, 2337, 1185,
+	3955,  885, 1557, 2755, 3784,  437, 2247, 2799, 3563,  509, 1995, 1418, 3679,   72, 2435, 3022,
+	1190, 2597,  591, 2287,  246, 3843, 2841,  306, 3672, 1033,  171, 1279, 3794,  409, 3625, 1701,
+	 668, 2311, 2957, 1430, 2139, 3660, 2561,  944,  537, 1511, 3822,  827, 2183, 3690, 1194, 2820,
+	1987, 3125, 2246, 3927, 1845, 2531,  363, 1181, 2118,  813, 3565, 1167, 2983,  922, 3493, 2930,
+	2128,  248, 3545, 2035, 1072, 1711, 3412,   29,  932, 2523, 3264,  399, 2878, 1139, 3371, 1522,
+	3797, 3238, 1657, 3684, 2558, 1481, 3348, 1823, 3109, 2512, 3928, 1837, 2873, 2282, 1130, 2629,
+	3427, 1935,  450, 4013,  797, 1614,  191, 3236, 3523, 2766,   35, 1884, 2884,  492, 2485,  722,
+	  75, 1610,  640,  273, 2991,  978, 3323, 4042, 2836,  145, 1588, 2229, 3882, 1901, 1476,  462,
+	1764, 3148, 1311,  598, 3028, 2573, 1396, 2110, 3833, 1187, 1748, 3540, 2245, 1890,  683,  421,
+	2177,  873,   86, 3000, 1024,  497, 2172,  790, 1253, 1633,  538, 3364,  831, 1494, 3283,   42,
+	 900, 3701, 1117, 2399, 3367, 2903, 1204, 2241, 1773, 1111, 2351, 3196, 1359, 3497, 1795, 3751,
+	 955, 2852, 3403, 1336, 3654, 2148, 1464,  632, 1755, 3764, 2589,  470, 3242,  199, 2488, 3790,
+	 828, 2628, 4027, 2313,  290, 3885,  736, 3180, 2895,  658, 2639,  168,  890, 3924, 2725, 3579,
+	1730, 2888, 1347, 3456, 2050, 3599, 2665, 4029,   18, 3543, 2084, 2624,  252, 4033, 1910, 2975,
+	2239, 1560, 2750,  105, 1886,  557, 3959, 3094,  412, 3710,  675, 3908,  234, 1017, 2331, 3244,
+	2577, 3849, 2038, 2450,  814, 2788,   49, 3173, 2424,  934, 3429, 1370,  841, 2854, 1146, 3276,
+	2232,   56, 1599,  925, 3229, 1198, 1805,  208, 1957, 1459, 3659, 3195, 1627, 3050, 1315, 2417,
+	 318, 3901, 2361,  685, 1700,  278, 1360, 3198, 2296, 2897,  912, 1326, 3059, 2365,  508, 1230,
+	3850,  359, 3153, 3566, 1304, 2616, 2032,  865, 1525, 2822, 2056, 2552, 1680, 3002,  328, 1415,
+	1736,  429, 1153,  216, 3893, 1621, 3446, 2031, 1283,  331, 2955, 2145, 1691, 4071, 1967,  615,
+	1401, 3480, 2792, 3661, 2081, 2693, 3603, 2448, 4049,  392, 2298, 1216,  532, 2099,    6,  974,
+	3267, 1924, 1109, 2753, 3951, 3033,  623, 1900, 1062,  438, 3859, 1743, 3606,  732, 3413, 1692,
+	2596,  755, 2133, 1707,  953, 3768,  254, 2480, 3406,  175, 1294,  816, 3561, 2002, 3986,  705,
+	2258, 3595, 3162, 1907, 2619,  520, 1070, 3979, 2681, 1803, 3831,  599, 3512,  350, 2545, 3697,
+	3008, 1047, 1882,  674,  188, 1420,  559, 1041, 3256,  847, 2961, 3755, 2566, 3449, 4037, 2666,
+	1524,  522, 3380,  126, 2123,  977, 2539, 3789, 1550, 3344, 2479,   97, 2175, 1046, 2789,  210,
+	3628, 1404, 4078,  531, 2879, 3219, 1384, 3613, 1735, 2953, 4072, 3214,  416, 1095, 2816, 3388,
+	1001, 2692,  622, 1367, 3494, 2320, 2910,  759,  197, 3227, 1078, 2386, 2771,  975, 1515,  149,
+	2169,  463, 2497, 3946, 2933, 3339, 1675, 2821, 2166, 1505, 1870,  324, 1000, 1778,  611, 2049,
+	3007, 3756, 2504, 1394, 3624, 1631, 3288,  154, 2764, 1990,  651, 3003, 1475, 3964, 2021, 3197,
+	2306,  985, 3006, 2407,  309, 1994,  723, 2283, 1015,  564, 2100, 1600, 2710, 2340, 1521,   17,
+	2089, 1574, 4079, 3014,   94, 1728, 3711, 1421, 2096, 3652, 1573,   25, 1942, 3373, 2921, 1802,
+	3870, 3301, 1270, 1714,  937, 2222, 3788,  440, 3481,  100, 3957, 2252, 2883, 1445, 3322, 1183,
+	 212,  915, 1817,  645, 2865,  433, 2325,  855, 1319, 4065, 1105, 3535, 2653,  282, 1296,  662,
+	1772,   59, 3369, 1846, 1471, 3866, 2758,   28, 3798, 2571, 1179,  138, 3840,  610, 3120, 3703,
+	2899,  244, 2345,  791, 1223, 2201,  415, 3078, 2501,  541, 2863, 3999, 1267,  673, 3614, 1138,
+	 751, 2654,  268, 3531, 2420,   16, 1256, 1971, 2582, 1099, 3138,  672, 3617,  140, 2434, 3864,
+	2760, 2206, 3154, 4014, 1160, 3424, 2034, 3736, 3073,  232, 2223, 1676,  861, 3293, 2463, 3723,
+	2851, 3558, 1186, 2683,  830, 3460, 1218, 3296, 1867, 3061, 3509, 2226, 3307, 1332, 1897,  837,
+	1288, 3356, 1777, 3615, 2670, 3875,  892, 3426, 1168, 1862,  833, 3156, 2122, 2617,  307, 2389,
+	3117, 1477, 2042, 3038,  692, 4023, 2994,  793, 3731, 1634, 2358, 1340, 1913, 3207,  781, 1586,
+	3464,  339, 1474, 2413,   44, 2698, 1496,  500, 1760, 2543, 3357,  466, 3819, 1909,  366, 1548,
+	 845, 2174,  472, 3967,  227, 2443, 2109,  481, 1446,  806,  332, 1724,  884, 2623,  348, 3865,
+	 543, 2535, 1079,  314, 3240, 1499, 1939, 2723,  362, 3607, 2362, 1495,  464, 3715, 1566, 1968,
+	4055,  521, 3669, 1107, 1655, 2608, 1399, 3306,  498, 2827,  221, 3902,  969, 2736, 2135,  506,
+	1883, 1086, 3709,  727, 1906, 3894,  950, 2942, 3567,  694, 1425, 2917, 2344, 1229, 3143, 3895,
+	2567, 1353, 3187, 1966, 1530, 3029,  976, 4035, 2737, 2411, 3898, 2824, 3623, 2065, 3165, 2260,
+	1523, 3972, 3091, 2068,  642, 2403,  205, 4051, 1639, 3216,  112, 3886, 1097, 2976, 3324,   63,
+	 965, 2757, 2330,  201, 3376, 2124,  300, 1842, 1039, 2016, 3368, 2518,  430, 3658, 1303, 4053,
+	3020, 2242, 3271, 2604, 1272, 3142,  333, 2359, 1154, 1961, 3719,  962,   24, 2707,  637, 2051,
+	 133, 3622,  697, 2796, 3683,  604, 1799, 3194,  109, 1664, 1142,  552, 1456,   77, 1010, 3470,
+	 270, 1919,  817, 2784, 3740, 1140, 3017,  782, 2170, 1289, 2777, 1922, 2527,  698, 2194, 1275,
+	3507, 1790, 1356, 3863,  629, 2800, 3621, 2464, 3940, 2988,  649, 1452, 1793, 3070,   15, 2595,
+	 886,  242, 1667,  484, 3541, 2156, 1695, 3796, 2781,  213, 3169, 2146, 3966, 1719, 3459, 1036,
+	2906, 1645, 2370, 1112,  163, 2591, 3499, 1312, 2131, 3728, 3384, 2285, 3036, 4032, 1804, 2811,
+	2329, 3550, 1386,   34, 1729, 3305, 1450, 2630, 3776,  486,  923, 3453,  267, 1720, 3961, 2568,
+	 406, 2952,  788, 3160, 1963, 1202,  812, 1538,  101, 1280, 3720, 2178, 3447, 1085, 2333, 1528,
+	3577, 2867, 3838,  963, 2815,  174,  875, 3381,  606, 1592, 2613, 1262,  517, 2979, 1461, 2442,
+	4085,  424, 3379, 1889, 3943, 2184,  801,  405, 2908,  914,  256, 1874,  796, 2498, 1341,  678,
+	2959,  998, 2576, 3932, 2248,  546, 3546,  136, 1758, 2992, 2243, 3825, 1324, 2885,  917, 3274,
+	2024, 3769, 2430, 1620,   55, 3981, 2907, 3417, 2261, 2694,  927,  195, 2638,  731, 3922, 2033,
+	 561, 1286, 2410, 2014, 1458, 4059, 2314, 1318, 2036, 3918,  799, 3439, 1881, 3657,  230,  754,
+	1962, 1299, 3015,  846, 1382, 3150, 1681, 3854, 2423, 1503, 3228, 2768, 3680,  365, 3208, 3814,
+	 178, 1642, 3359,  413, 2922,  980, 2007, 2510, 1133, 3354, 1488,  657, 3168, 2385,  518, 1544,
+	 141, 1150,  495, 3583, 2609, 2192,  336, 1769,  592, 3284, 1945, 3134, 3773, 1717,  371, 3099,
+	3358, 1854,   76, 3441, 3119,  504, 2650, 3049,   78, 3246, 2269,  276, 2537,  951, 2767, 3192,
+	3699, 2294,   38, 3551, 2508,  298, 2763, 1137, 3430, 2023,  539, 1214, 1638, 2200, 1115, 1955,
+	3714, 2214,  716, 1857, 1344, 3190, 4010,  677, 3620,  351, 2701, 2086,   69, 3581, 1933, 3828,
+	2995, 2152, 2830, 1388,  924, 3205, 1310, 3631, 1029, 4044, 1596,  487, 1322, 2374, 2828, 1213,
+	 872, 2686, 3933,  729, 1178, 1818, 3678, 1031, 1725, 2751, 1124, 1559, 4016, 2132, 1374, 1747,
+	 499, 1075, 2846, 1605,  620, 3757, 1915,  700,  114, 4086, 2550, 3538,   14, 3934, 2656,  593,
+	3055, 1212, 2842, 3871, 2371,  241, 1628, 2286, 2866, 1928,  844, 4067, 1602, 1032, 2645, 1284,
+	3386,  753, 4045, 1871, 3473,  664, 1980, 2418, 3018,  250, 2530, 2905,  829, 3605,  121, 2153,
+	3525,  345, 1591, 2940, 2491,  293, 2211,  686, 3416,  426, 3634, 3021,  584, 3312,  153, 3869,
+	2675, 3492, 2028, 3980, 2235, 1264, 3273, 2322, 3080, 1412,  752, 1820, 2928,  907, 3315, 1465,
+	2360, 3537,   71, 1064, 3469, 2769,  881, 1325,   95, 3779, 1238, 3243, 2284, 3079,  715,  243,
+	2316, 1640,  373, 2452,  179, 2870, 3929,  456, 1497, 2144, 1174, 3842, 1843, 3261, 1486, 4066,
+	1744, 2387, 1056, 2066, 3803, 3260, 1512, 4006, 2391, 1271, 2094,  880, 1832, 2882, 1236, 2356,
+	 730, 1453,  353,  941, 2951,  165, 3641, 1587, 1019, 2802, 2127, 3372,  439, 2404, 1894,  284,
+	 849, 1727, 2663, 2095,  627, 1781, 3733, 3336, 3009, 1673, 2467,  551,  297, 3650, 1810, 3941,
+	2759, 1089, 3642, 3047, 1254, 1696,  989, 2618, 3745,  774, 3462,  164, 2281,  582, 1008, 2729,
+	 468, 3151, 3618,  159, 1335,  832, 2744,  177, 1863, 2708, 3903,   31, 2519, 3763,  391, 3402,
+	1872, 3108, 2477, 3361, 1841,  784, 2520,  514, 3734,  388, 3916, 1199, 1582, 3730, 1132, 4007,
+	3263,  488, 3810, 1509, 3204,  335, 2548, 1970,  427,  984, 3465, 2754, 1506, 2091, 2915, 1366,
+	 540, 3259, 2083,  825, 3823, 2262, 3167,  132, 3291, 1798, 2719, 1569, 3132, 2602, 1938, 3432,
+	 818, 1417, 2782,  635, 3039, 1783, 3575, 1104, 3087,  738, 1593, 3466, 1135, 1533, 2157,  973,
+	4056,  116, 1210, 3665, 1519, 2748, 3200, 2069, 1687, 2469,  131, 3193, 2648,  661, 2858, 2070,
+	2517, 1309, 2987,  821, 2353, 3963, 1158,  702, 2327, 3993, 1879,  792, 3848, 1127,   37, 3482,
+	2513, 1763,  128, 1529, 2674,  570, 1965, 1395, 2347,  496, 1027, 4009,  338, 1290, 3795,   58,
+	2270, 3897, 1864, 2521, 3973, 2228,  525, 2476, 3749,  295, 3221, 2278, 2837,  659, 3175, 2605,
+	1606, 2806, 2221,  653,  310, 4026,  968, 1285, 3477, 2936, 1930,  956, 2210, 3596,  184, 1613,
+	3478,  111, 1923, 3532,  238, 1406, 3085, 3643, 2819, 1460,  180, 3097, 2350, 3332,  735, 2216,
+	 971, 3807, 2929, 3591,  352, 3352, 4091,  746, 3691, 3034, 2030, 3351,  768, 2197, 2962, 1585,
+	3275, 1175,  291,  948, 1516,   51, 3250, 1307, 1710, 2147, 1074,  407, 3874, 1908,  183, 3717,
+	 511,  891, 3839, 3004, 1921, 2301,   73, 3787,  451,  798, 1443, 3440,  414, 1357, 3103,  769,
+	1119, 4038, 2643, 1030, 2876, 2138, 1706,   13, 1043, 3342, 2173, 1243,  398, 1579, 2625, 4057,
+	1444,  460, 2151, 1232, 2419, 1045, 1632, 2790, 1244,   12, 2462, 1432, 2756, 3562, 1077,  667,
+	2540, 2012, 2937, 3705, 3129, 1916, 3524,  840, 2949, 3956, 2679, 1485,  810, 3346, 2384, 1333,
+	2101, 3233, 1715, 1323, 3488, 2583, 1491, 2770, 2182, 3116, 2433, 4061, 1786, 2551, 3857, 2129,
+	2960, 2271,  422, 1775, 3846,  547, 3435, 2658, 1992,  647, 3881, 2534, 3729, 2989, 1848,  189,
+	3172, 2715,  839, 3247, 1888, 3019,  225, 2140, 3423, 1746, 3762,  577, 1918,  151, 1723, 3832,
+	 444, 3542,  740, 2357, 1144,  583, 2632, 2244,  190,  650, 1975, 3582, 2984, 1702, 1003, 2826,
+	3547,    1, 2640,  401, 1021,  709, 3316, 1808, 1051, 3635,  654,    5, 2880,  999,  529, 1684,
+	3362,  703, 1520, 3268, 2393, 1300,  848, 4087, 1558, 2918,  271, 1789,  943,  603, 3584, 1006,
+	1976, 3760, 1654,   53, 3960,  691, 3611, 2553,  453,  920, 2848, 1196, 3949, 3302, 2299, 2706,
+	3174, 1403, 1776,  209, 2838, 4093, 1364, 3629, 1601, 3397, 1152,   80, 2483,  358, 3909,  554,
+	1891, 1157, 3675, 2149, 3889, 2913,  360, 3990,  237, 1583, 2079, 1293, 3289, 2231, 3692,  286,
+	1329, 2776, 3759,  930,  172, 3149, 2188,  387, 2427, 1151, 3549, 3182, 1478, 2295, 2775, 1313,
+	2482,  638, 3451, 2191, 2642, 1368, 1811, 1141, 3912, 2300, 3139,  320, 2538,  795, 1342,  308,
+	1035, 2159, 3877, 3341, 1584, 2104,  266,  961, 3104, 2346, 2787, 4036, 1301, 2126, 3444, 1549,
+	3071, 2416,  761, 3131, 1568, 1964, 1281, 2455, 2982, 3393, 2688, 3744,  728, 1541, 2641, 1949,
+	3969,   45, 2507, 1988, 3590, 2690, 1826, 3673, 3035,  757, 2073, 2697,   54, 3398,  380, 3976,
+	3056,  259, 1493, 1087, 3722,  341, 2972, 3374,  718, 1526, 1958, 3648, 1617, 3024, 2026, 4047,
+	2886,    0, 2465,  894,  402, 3158, 2592, 3851, 1904,  410,  871, 1752, 3272,  710, 2600,  945,
+	 323, 4062, 1358,  157, 2741,  607, 3726, 2121,  767, 1180,  411, 1835, 2970,  219, 3500,  834,
+	2168, 1651, 1165, 2965,  458, 1362,  959,  240, 1457, 3935,  501, 1287, 3771, 1754, 2125,  870,
+	1672, 2280, 2814, 3218,  820, 2426, 2048,   81, 2711, 3265,  203,  990, 2259,  455, 3495,  684,
+	1849, 3560, 1197, 2785, 3725, 1794, 1242,  714, 2902, 1391, 3502, 2219,  269, 3030, 1929, 3668,
+	2861, 2037, 3385, 2341, 3597, 1071, 3230,   61, 1643, 3892, 2544, 1022, 4022, 2377, 1201, 3121,
+	 376, 3300, 3688,  758, 1716, 4003, 3390, 2743, 2288, 3326, 1812, 2484,  935, 2891,  594, 3287,
+	3573, 1188, 3809,  403, 1767, 3514, 1554, 4046, 1305, 2202, 3780, 1407, 2721, 3232, 1166, 2529,
+	1517, 3086,  579, 1448, 2342,  477, 3415, 2137,   36, 3767, 2572,  600, 3806, 1434, 1096,   66,
+	1612,  621,  979, 1713,  445, 2542, 1825, 2807, 3536, 2186, 3093,  110, 2074, 1435,  589, 2809,
+	1076, 2460,  218, 2256, 3110, 2475,  646, 2005, 1116,  142, 2859, 3609,  292, 3890, 1451, 2458,
+	  84, 1960,  717, 2578, 3076, 1069,  548, 2601,  911,  420, 2904,  699, 3997,   79, 1787, 3716,
+	 344, 2266, 3915, 1950, 3253, 1044, 3954, 2502, 1685, 3137, 1061, 1630, 2791, 2369, 3995, 2115,
+	3327, 2718, 3861, 3063, 2134, 4004, 1298,  901,  479, 1372,  713, 1708, 3580, 3188, 3827, 1859,
+	3486, 1468, 3921, 1880, 1226,   85, 1508, 3647, 3092,  843, 1534, 2217, 1189, 1926, 3118, 1037,
+	2745, 4064, 1536, 2116,  194, 3826, 2253, 3163, 3610, 1903, 3399, 1683, 2445, 2071,  756, 2786,
+	 991, 3463,  231,  856, 2864,  166, 1467, 3010,  910,  312, 2080, 3400,  160,  824, 3096,  494,
+	2473, 1255,  176, 1447,  803,  283, 3436, 3111, 2376, 3835, 3340, 2712,  347,  874, 2509,  457,
+	3058,  643, 2734,  952, 3330, 3847, 2871,  367, 1780, 4048, 3360,  441, 2607, 3484,  211, 2207,
+	 558, 3251, 1113, 3670, 2817, 1320, 1816,  125, 1487, 2388, 1023,  255, 3564, 1234, 3891, 3057,
+	1423, 2041, 2611, 1694, 3501, 2405, 2013,  562, 3467, 4041, 2447, 1247, 3695, 1827, 1398, 3522,
+	 904, 1858, 3418, 2297, 3653, 2664, 2047, 1540,  139, 1847,  995, 2315, 1306, 2916, 1616, 2198,
+	1207, 2001, 3588,  389, 2379,  724, 2057, 2579, 1260, 2429,  688, 2968, 1693,  766, 3953, 1594,
+	2941, 1851,  317, 2432,  630, 3355,  878, 2986, 3977,  624, 2778, 3191, 1535, 2647,  294, 2293,
+	 586, 3314, 1170, 4081,  687, 1258, 3816, 2702, 1134, 1784,  425, 3239,  656, 2912, 2289,  207,
+	3836, 2958,  569, 2798, 1690, 1020,  618, 3738, 2554, 2932,  555, 3983, 1982, 3616,  287, 4073,
+	2626,   65, 1572, 3183, 1274, 1669, 3739,  982, 3516,   39, 2114, 3782, 1092, 3199, 2367, 1265,
+	3649,  863, 3510, 1479, 2003, 3920, 2657,  374, 2043, 1184, 3702, 2171,  530,  905, 3422, 1622,
+	3753,   43, 2931, 2204,  400, 3112, 1637,   89, 2212, 2943, 1454, 2646, 2044, 3936, 1110, 2684,
+	1604, 2054, 1159, 4090,   23, 3308, 2971, 1176,  319, 3553, 1649, 3133,  119, 1102, 3225,  786,
+	3772, 2973, 2161, 3958, 2682,  156, 2963,  523, 3176, 1831, 1397, 2705,  322, 1999,  505, 2671,
+	   4, 2150, 2581, 3062,  143, 1014, 2318, 1387, 3252, 2541,   22, 1819, 3830, 3100, 2017, 1126,
+	2746, 1878,  918, 1482, 3586, 2536,  897, 3694, 3266,  763, 3844, 1007,   60, 1656,  473, 3126,
+	 707, 3681,  329, 2199, 1390, 2421, 1797, 3968, 2078, 1338,  860, 2224, 2722, 1556, 2383, 1830,
+	1405, 1055,  512,  805, 1893, 3396, 2154, 1466, 2661, 3855,  779, 3105, 3548, 1463, 3804, 3333,
+	1054, 4011,  597, 1231, 3311, 1757, 3663,  681, 3534, 1650,  940, 2839, 1291, 2334,  247, 4019,
+	 669, 2515, 3696, 3166,  170, 1977, 2869, 1339, 1844,  274, 2273, 3077, 3576, 2505, 3420, 2181,
+	1449, 3317, 2584, 3067,  887, 3503,  394,  794, 2844, 2409, 3343,  443, 3917,  663, 3519,  397,
+	2580, 3455, 2319, 3044, 1149,  356, 4021,  742, 2305,  346, 1147, 2267,  122, 2546,  690, 1824,
+	3032, 1547, 1932, 3713, 2720,  485, 2896, 1951,  217, 3048, 3989,  434, 3491,  726, 2926, 1732,
+	3234, 1327,  469, 2324, 1718,  712, 4008,  483, 2511, 3383, 1570,  612, 1892, 1273,  867, 3984,
+	  98,  988, 1806,  544, 3899, 2027, 2689, 1611, 3201,   57, 3667, 1911, 1282, 2835, 2053, 3177,
+	1792,  313, 3834, 1553, 3552, 2401, 1726, 1237, 3636, 3279, 1943, 4083, 1689, 2938, 1222, 2263,
+	 372, 2772,  206, 2249,  879, 1577, 4076, 1118, 2268, 1345, 2439, 1996, 1537, 2636,  994, 3528,
+	 127, 2040, 3887, 1094, 3504, 3052, 2372, 1068, 3619, 2845, 1192, 4088, 2738,  264, 2998, 1925,
+	2779, 2364, 3633, 1539, 2860,  129, 1250, 3766,  626, 1143, 1581, 2633,  931, 3792,   90,  862,
+	1239, 2855, 1997,    7, 2749,  563, 3203, 2927,   82, 1502, 2813,  913,  510, 3428, 3914,  882,
+	3209, 3820, 1156, 3391, 2472,   52, 3217, 2606,  826, 3770,  568, 3304,  104, 3925, 2167, 1377,
+	2456, 2954,  804, 2672, 1381,  327, 1542, 2009,   21,  851, 2112,  418, 2310, 3644, 1431,  660,
+	3793, 1251,  285, 3179, 1108, 2392, 3310, 1788, 2309, 4060, 3042,  275, 2257, 3098, 1513, 3559,
+	4054,  608, 3290, 1385,  919, 3900, 1981,  992, 2599,  679, 3727, 2328, 1371, 2059,  239, 2514,
+	1429, 1991,  695, 1686, 3878, 1278, 2060,  423, 3485, 1745, 2730, 1161, 3013, 1721,  542, 3747,
+	 378, 1671, 3370,  185, 2213, 3775, 3262, 2685, 3888, 1652, 3496, 3127, 1004, 1761, 3347, 2557,
+	 432, 3285, 2218, 1839,  572, 3662,  868, 2947,  334, 1953,  770, 3487, 1741,  567, 2503, 2088,
+	2680, 1065, 2251, 3732, 2570, 1609,  235, 3527, 2190, 1800, 3037,  161, 2691, 3164, 1722, 3646,
+	 519, 3517, 2637, 3083,  459, 2812, 3637, 1469, 2950,  299, 2208,  739, 3557, 2378,  921, 2717,
+	3206, 1169, 4069, 1896, 2887,  939,  536, 1217, 3088,  305, 2471, 1383, 3873,   87,  819, 2105,
+	1567, 2850,  854, 4043, 2660, 2067,  186, 1441, 3434, 2496, 1263, 2780, 3952, 1093, 3235,  257,
+	1704, 3095,  182, 1868,  676, 3407, 2338, 1330, 3998,  368, 3387, 1200, 3801,  634, 1059, 2856,
+	2304, 1120,  253, 2180,  983, 1875,  747, 2406, 1038, 3335, 3805, 1393, 1936,  258, 3349, 1543,
+	2113,  682, 2431,  476, 1578, 3421, 2549, 1756,  749, 2029, 2925,  545, 1899, 2394, 3041, 3992,
+	1018, 3571,    3, 1343, 3389, 1618, 3919, 2733,  996, 3799,  436, 2075,  103, 1426, 3602,  771,
+	3896, 1361, 3479, 2783, 1193, 3084,  491, 2727,  733, 1653,  949, 1984, 2441, 1490, 3974,   30,
+	1836, 3329, 4052, 1561, 3706, 3141,  134, 3931, 2000, 1624,   92, 2533, 4040, 2945, 1148, 3783,
+	  20, 3054, 3556, 1252, 3815,  130, 2087, 4012, 3298, 1295, 3802,  926, 2761, 3585, 1276,  301,
+	2627, 1705, 2302, 3072,  377, 1131, 2254,  665, 1855, 3113, 1648, 3338, 2436, 2997, 1954, 2354,
+	 513,  933, 2438,  417, 4015, 1774, 1009, 3735, 3222, 2274, 2823, 3533,  296, 3277, 2082, 3065,
+	 842, 1389, 2801,  625, 2382, 1227, 3442, 2678,  502, 2877, 3184, 1002,  628, 1678, 2585,  765,
+	1801, 2762,  916, 2019, 3102, 2390, 1090,  447, 2644,   74, 2275, 3350,  222, 1629,  706, 2004,
+	3450,  595, 3845, 1941,  808, 2598, 3249, 3594,  316, 2366,  903,  578, 3685,  960,  349, 2892,
+	3318, 2018, 3698, 1514, 2162,  147, 2522, 1993, 1436,   67, 3907,  613, 1833,  898, 2662,  493,
+	3655, 2474,  167, 2010, 2948,  337, 1766, 1424,  822, 2336, 1321, 3638, 2234,  383, 3475, 2165,
+	3987, 1369,  303, 2652,  575, 1422, 3490, 2985, 1527, 3572, 1731, 1172, 2141, 3212, 3883, 2422,
+	2909, 1470, 1098, 2810, 3743, 1688,  150, 1215, 2847, 1428, 3906, 2673, 1314, 1853, 3811, 1555,
+	2649,   41, 3107,  800, 2881, 3295, 3555,  354, 3012, 1106, 2559, 1363, 2996, 3786, 1266, 1662,
+	2176, 3181, 1205, 3824,  888, 3600, 2225, 3045, 4017, 3366,  343, 1838, 2793, 3211, 1261,  233,
+	3123, 2272, 3627, 3294, 1814, 3950,  743, 1983,  964, 2486,  641, 4074, 2574,  381, 1375,  938,
+	 102, 3313,  342, 2415,  560, 3090, 2142, 4092, 1952, 3405,   11, 2164, 3282,  202, 2321, 1101,
+	4080, 1762, 1209, 2400,  549, 1246, 1619,  809, 3817, 1751, 3363, 2163,  249, 2368, 3411,  115,
+	4001,  725, 1796, 3320, 1498, 2524,  639, 1122,    2, 2072,  928, 3858, 1492,  748, 3712, 1703,
+	 972,  619, 1615, 1058,   64, 2238, 2794,  228, 3758, 3145,  289, 2898,  859, 1948, 3023, 3765,
+	1809, 2209, 4025, 1563, 3511, 1350,  889, 2565,  609, 1034, 3053, 1670,  802, 2740, 3505,  616,
+	2187,  369, 3433, 3752, 1887, 3939, 2291, 2834, 2107,  435,  741, 4068, 1025, 1740,  655, 2742,
+	1103, 2956,  446, 2668,  200, 3904, 1898, 3530, 2446, 1603, 2966, 2563,  144, 2397, 1979, 2843,
+	2500, 3910, 3005, 2428, 3748, 1277, 3425, 1626, 2193, 1259, 1807, 3664, 1473, 3498,  602, 2620,
+	1163, 3115,  787, 2046,   68, 2739, 3707,  251, 1608, 3785, 2453,  526, 3970, 1998, 1439, 3152,
+	2575, 1392, 2724,  986,   96, 3040,  482, 1063, 3598, 2655, 3213, 1564, 2493, 3671, 3159, 1989,
+	1546, 2349, 3742, 2103, 1066, 2890,  382, 3136, 1297, 3746,  576, 3401, 1206, 4070,  475, 3529,
+	 123, 1346,  355, 1902,  776, 2562,  461, 3031,  711, 3884, 2375, 1052, 2732,  135, 2277, 1623,
+	3587,  503, 2829, 3404, 1049, 2332, 1829, 3365, 2804, 2098, 1328, 3544, 1081, 2914,  277,  946,
+	3656,  689, 3089, 2076, 1545, 2528, 3457, 1408,  215, 1840, 1177,   10, 2849,  428,  909, 3923,
+	 311, 3438,  850, 1416, 3278, 2307, 1565,  811, 2687,  261, 1885, 2179,  783, 2920, 1562, 1040,
+	3319, 2130, 3645, 2774, 3270, 1753, 4050, 1005, 2669,    9, 3392,  480, 2102, 3245, 3944,  906,
+	 223, 2499, 1308, 1737, 3948,  652, 3135, 1208,  780,  395, 2978,  120, 1709, 2396, 3853, 1934,
+	 117, 1698, 4002,  516, 3303,  902, 1986, 4020, 2414, 3026, 3812, 2011, 3471, 1365, 2237, 2622,
+	1225, 3046, 1834,   48, 4077,  571, 3476, 1828, 3962,  993, 3001, 3682, 1413, 3248, 2323, 1852,
+	2709,  835, 1510,  556, 1195,  162, 2143, 1376, 3257, 1974, 1552, 2980,  778, 1749, 1235, 2999,
+	1920, 3837, 2233,  288, 2894, 1472,  361, 2185, 3911, 3443, 1873, 2587, 3185,  471, 1268, 3292,
+	2969, 2444, 1136, 2230, 3741,  193, 2935,  587, 1644,  866,  467, 2308,  701, 3081, 1785,  181,
+	3578,  633, 2451, 2803, 2006, 1224, 2560,  124, 3202, 2355, 1646,  385, 2610,   99,  670, 3693,
+	 390, 3128, 3994, 2373, 3437, 2900, 3704, 2454,  340, 3608, 1164, 4028, 2556, 3639,  404, 2676,
+	3410, 1011, 3189,  750, 3489, 2395, 3761, 1635, 2478,  970, 1440, 4058,  708, 3574, 2276,  777,
+	1427, 3445,  280, 2797, 1331, 1813, 2588, 1129, 3395, 3689, 2703, 1532, 4000, 1048, 3700, 2889,
+	2117, 1636, 3808,  454, 3122,  869, 3721, 2064, 1337,  596, 3852, 1171, 3515, 1947, 3938, 1221,
+	2487, 1734,   40, 1969,  947, 1576,  648, 1850,  893, 2818,  590, 2052,  108, 1455, 2189,  696,
+	1589,   83, 1414, 2667, 1912, 1083,   33, 2934,  553, 3237,  226, 2063, 1162, 1647, 2840, 1865,
+	3947,  954, 1973, 3632,  631, 3114, 3841, 2265,   88, 1895, 1257, 3281,  148, 2555,  528, 1410,
+	 823, 3254, 1060, 1433, 3568, 1679, 2939,  379, 2765, 3408, 2136, 2872,  836, 2412, 1590, 2981,
+	 896, 3601, 1269, 3016, 3867,  224, 2714, 3161, 3926, 1674, 2398, 3409, 1084, 3223, 2874, 3975,
+	2440, 3630, 2160, 4063,  507, 3124, 3569, 2008, 1292, 2704, 3676, 2380, 3043,   50, 3778,  370,
+	2590,  565, 3220, 2492, 1660,  981,  315, 1489, 3155, 2470,  386, 2853, 2039, 1663, 3334, 2408,
+	4034,   91, 2695, 2205,  260, 2437,  680, 3996, 1597,  942,   27, 1765, 3215,  245, 3394, 2120,
+	 304, 2728, 2236,  535, 2495, 3521, 2090, 1191,  302, 1334, 2967,  449, 3860, 1768,  325,  936,
+	1860,  465, 2832,  908, 1771, 1380, 2569,  721, 3991, 1750,  442,  852, 3472, 2713, 1067, 2097,
+	3074, 1598, 1240,    8, 3930, 2773, 3337, 2085,  815, 3978, 1091, 3508,  883, 3829, 1121,  375,
+	1940, 3027, 1770, 3880,  929, 3461, 1917, 1155, 2363, 3651, 2634,  617, 3872, 1402, 1080,  574,
+	4039, 1483, 3378, 1026, 1782, 1411,  762, 3331, 2614, 3686, 1937,  838, 2250, 2593, 1316, 3075,
+	3520, 1245, 3269,  173, 3791, 2290,  279, 3325, 1012, 2264, 3144, 1551, 1931,  527, 1400, 3666
+};
+
+//------------------------------------------------------------------------------
+
+const Uint16* GetBlueNoiseMask()
+{
+	return s_blueNoise;
+}
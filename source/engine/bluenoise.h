@@ -0,0 +1,25 @@
+//
+// Engine BlueNoise - A tileable 64x64 void-and-cluster threshold mask
+//
+// Every pixel has a rank, 0-4095, and the pixels below any rank are spread
+// as evenly as they can be, with no pattern, at every level, so
+// thresholding with it looks like error diffusion, but each pixel only
+// depends on itself.  It wraps at the edges, so it tiles without seams.
+//
+// Made once, with Ulichney's void-and-cluster: a Gaussian energy (sigma
+// 1.5, wrapping), a 10% random start settled into an even prototype, then
+// the tightest clusters ranked down from it, and the largest voids ranked
+// up, to the end.  It's kept as a table, rather than made at startup, so
+// the output never depends on a random number generator.
+//
+#ifndef ENGINE_BLUENOISE_H_
+#define ENGINE_BLUENOISE_H_
+
+#include <SDL.h>
+
+static const int BLUE_NOISE_SIZE = 64;
+
+// BLUE_NOISE_SIZE x BLUE_NOISE_SIZE ranks, row by row
+const Uint16* GetBlueNoiseMask();
+
+#endif // ENGINE_BLUENOISE_H_
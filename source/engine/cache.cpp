@@ -0,0 +1,535 @@
+//
+// Engine Cache - Conversion results kept on disk
+//
+#include "cache.h"
+
+#include "files.h"
+#include "libimagequant.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//------------------------------------------------------------------------------
+//
+// Hashing
+//
+//------------------------------------------------------------------------------
+
+static const Uint64 HASH_PRIME1 = 0x9E3779B185EBCA87ULL;
+static const Uint64 HASH_PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+
+static inline Uint64 RotateLeft(Uint64 value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+// Final avalanche, from MurmurHash3
+static inline Uint64 Mix(Uint64 value)
+{
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDULL;
+	value ^= value >> 33;
+	value *= 0xC4CEB9FE1A85EC53ULL;
+	value ^= value >> 33;
+	return value;
+}
+
+//------------------------------------------------------------------------------
+// Two independent lanes, so we get 128 bits of key, in one pass
+class Hasher
+{
+public:
+	Hasher()
+		: m_lane0(HASH_PRIME1)
+		, m_lane1(HASH_PRIME2)
+		, m_length(0)
+	{
+	}
+
+	void Add(const void* pData, size_t numBytes)
+	{
+		const Uint8* pBytes = (const Uint8*)pData;
+
+		m_length += numBytes;
+
+		while (numBytes >= 8)
+		{
+			Uint64 word;
+			memcpy(&word, pBytes, 8);
+
+			m_lane0 = RotateLeft(m_lane0 ^ (word * HASH_PRIME2), 31) * HASH_PRIME1;
+			m_lane1 = RotateLeft(m_lane1 + (word * HASH_PRIME1), 27) * HASH_PRIME2;
+
+			pBytes += 8;
+			numBytes -= 8;
+		}
+
+		if (numBytes)
+		{
+			Uint64 word = 0;
+			memcpy(&word, pBytes, numBytes);
+
+			m_lane0 = RotateLeft(m_lane0 ^ (word * HASH_PRIME2), 31) * HASH_PRIME1;
+			m_lane1 = RotateLeft(m_lane1 + (word * HASH_PRIME1), 27) * HASH_PRIME2;
+		}
+	}
+
+	void Add(int value)
+	{
+		Sint32 value32 = (Sint32)value;
+		Add(&value32, sizeof(value32));
+	}
+
+	CacheKey Finish() const
+	{
+		CacheKey key;
+		key.m_hash[0] = Mix(m_lane0 ^ m_length);
+		key.m_hash[1] = Mix(m_lane1 + m_lane0 + m_length);
+		return key;
+	}
+
+private:
+	Uint64 m_lane0;
+	Uint64 m_lane1;
+	Uint64 m_length;
+};
+
+//------------------------------------------------------------------------------
+
+Uint64 HashBytes(const void* pData, size_t numBytes, Uint64 seed)
+{
+	Hasher hasher;
+	hasher.Add(&seed, sizeof(seed));
+	hasher.Add(pData, numBytes);
+
+	return hasher.Finish().m_hash[0];
+}
+
+//------------------------------------------------------------------------------
+
+CacheKey MakeCacheKey(SDL_Surface* pSource, const ConvertOptions& options)
+{
+	Hasher hasher;
+
+	hasher.Add(D16_ENGINE_VERSION);
+	hasher.Add(LIQ_VERSION);
+
+	//--------------------------------------------------------------------------
+	// Source pixels, row by row, so pitch padding doesn't matter
+
+	int width  = pSource->w;
+	int height = pSource->h;
+
+	hasher.Add((int)pSource->format->format);
+	hasher.Add(width);
+	hasher.Add(height);
+
+	if (pSource->format->palette)
+	{
+		SDL_Palette* pPalette = pSource->format->palette;
+		hasher.Add(pPalette->ncolors);
+		hasher.Add(pPalette->colors, pPalette->ncolors * sizeof(SDL_Color));
+	}
+
+	if( SDL_MUSTLOCK(pSource) )
+		SDL_LockSurface(pSource);
+
+	size_t rowBytes = (size_t)width * pSource->format->BytesPerPixel;
+
+	for (int y = 0; y < height; ++y)
+	{
+		hasher.Add((const Uint8*)pSource->pixels + (y * pSource->pitch), rowBytes);
+	}
+
+	if( SDL_MUSTLOCK(pSource) )
+		SDL_UnlockSurface(pSource);
+
+	//--------------------------------------------------------------------------
+	// Resize, only when it's going to happen
+
+	int newWidth  = options.m_width  > 0 ? options.m_width  : width;
+	int newHeight = options.m_height > 0 ? options.m_height : height;
+
+	if ((newWidth != width) || (newHeight != height))
+	{
+		hasher.Add(newWidth);
+		hasher.Add(newHeight);
+		hasher.Add(options.m_bCrop ? 1 : 0);
+
+		if (options.m_bCrop)
+		{
+			hasher.Add(options.m_iJustify);
+		}
+		else
+		{
+			hasher.Add(options.m_iFilter);
+			hasher.Add(options.m_bResizeDither ? 1 : 0);
+		}
+	}
+	else
+	{
+		hasher.Add(0);
+		hasher.Add(0);
+	}
+
+	//--------------------------------------------------------------------------
+	// Quantize, the allocator doesn't change anything
+
+	const QuantizeSettings& quantize = options.m_quantize;
+
+	hasher.Add(quantize.m_numColors);
+	hasher.Add(quantize.m_speed);
+	hasher.Add(quantize.m_iPosterize);
+	hasher.Add(quantize.m_iDither);
+	hasher.Add(quantize.m_iDitherMethod);
+	hasher.Add((int)quantize.m_lockedColors.size());
+
+	if (!quantize.m_lockedColors.empty())
+	{
+		hasher.Add(&quantize.m_lockedColors[0], quantize.m_lockedColors.size() * sizeof(Uint32));
+	}
+
+	return hasher.Finish();
+}
+
+CacheKey MakeCacheKey(const RGBAImage& source, const ConvertOptions& options)
+{
+	SDL_Surface* pSurface = source.WrapSurface();
+
+	CacheKey key = MakeCacheKey(pSurface, options);
+
+	SDL_FreeSurface(pSurface);
+
+	return key;
+}
+
+//------------------------------------------------------------------------------
+//
+// Entries on disk
+//
+//  CacheHeader
+//  Uint32 palette[ m_numColors ]
+//  Uint8  indexes[ m_width * m_height ]
+//
+// Native byte order, a cache isn't meant to move between machines
+//
+//------------------------------------------------------------------------------
+
+#define CACHE_MAGIC   0x43363144  // "D16C"
+#define CACHE_VERSION 1
+
+static const char* CACHE_EXTENSION = ".d16c";
+
+struct CacheHeader
+{
+	Uint32 m_magic;
+	Uint32 m_version;
+	Uint64 m_key[2];
+	Uint32 m_width;
+	Uint32 m_height;
+	Uint32 m_numColors;
+	Uint32 m_uniqueColors;
+	Uint64 m_checksum;  // HashBytes of the palette, then the indexes
+};
+
+static Uint64 EntryChecksum(const IndexedImage& image)
+{
+	Uint64 checksum = HashBytes(image.GetPalette(), image.GetNumColors() * sizeof(Uint32));
+
+	return HashBytes(image.GetPixels(),
+					 (size_t)image.GetWidth() * image.GetHeight(), checksum);
+}
+
+//------------------------------------------------------------------------------
+
+ConversionCache::ConversionCache(const std::string& directory, long long maxBytes)
+	: m_directory(directory)
+	, m_maxBytes(maxBytes)
+	, m_pMutex(SDL_CreateMutex())
+	, m_totalBytes(-1)
+	, m_bShortLived(false)
+{
+	SDL_AtomicSet(&m_tempCounter, 0);
+	SDL_AtomicSet(&m_hits, 0);
+	SDL_AtomicSet(&m_misses, 0);
+}
+
+ConversionCache::~ConversionCache()
+{
+	if (m_pMutex)
+	{
+		SDL_DestroyMutex(m_pMutex);
+		m_pMutex = nullptr;
+	}
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ std::string ConversionCache::DefaultDirectory()
+{
+	char* pPrefPath = SDL_GetPrefPath("dwsJason", "d16");
+
+	if (nullptr == pPrefPath)
+		return "";
+
+	std::string directory = JoinPath(pPrefPath, "cache");
+
+	SDL_free(pPrefPath);
+
+	return directory;
+}
+
+//------------------------------------------------------------------------------
+// 256 sub directories, so no one directory gets too big
+std::string ConversionCache::EntryPath(const CacheKey& key) const
+{
+	char name[ 64 ];
+
+	snprintf(name, sizeof(name), "%02x/%016llx%016llx%s",
+			 (unsigned int)(key.m_hash[0] >> 56),
+			 (unsigned long long)key.m_hash[0],
+			 (unsigned long long)key.m_hash[1],
+			 CACHE_EXTENSION);
+
+	return JoinPath(m_directory, name);
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* ConversionCache::Load(const CacheKey& key, int* pUniqueColors)
+{
+	std::string path = EntryPath(key);
+
+	FILE* pFile = fopen(path.c_str(), "rb");
+
+	if (nullptr == pFile)
+	{
+		SDL_AtomicAdd(&m_misses, 1);
+		return nullptr;
+	}
+
+	IndexedImage* pImage = nullptr;
+
+	CacheHeader header;
+
+	if ((1 == fread(&header, sizeof(header), 1, pFile)) &&
+		(CACHE_MAGIC == header.m_magic) &&
+		(CACHE_VERSION == header.m_version) &&
+		(key.m_hash[0] == header.m_key[0]) &&
+		(key.m_hash[1] == header.m_key[1]) &&
+		(header.m_width > 0) && (header.m_width <= 65536) &&
+		(header.m_height > 0) && (header.m_height <= 65536) &&
+		(header.m_numColors > 0) && (header.m_numColors <= 256))
+	{
+		pImage = new IndexedImage(header.m_width, header.m_height, header.m_numColors);
+
+		size_t numPixels = (size_t)header.m_width * header.m_height;
+
+		bool bValid = (header.m_numColors == fread(pImage->GetPalette(), sizeof(Uint32),
+												   header.m_numColors, pFile)) &&
+					  (numPixels == fread(pImage->GetPixels(), 1, numPixels, pFile)) &&
+					  (EOF == fgetc(pFile)) &&  // nothing extra on the end
+					  (header.m_checksum == EntryChecksum(*pImage));
+
+		if (!bValid)
+		{
+			delete pImage;
+			pImage = nullptr;
+		}
+	}
+
+	fclose(pFile);
+
+	if (nullptr == pImage)
+	{
+		// Truncated, or damaged, get rid of it, so it gets rebuilt
+		remove(path.c_str());
+		SDL_AtomicAdd(&m_misses, 1);
+		return nullptr;
+	}
+
+	if (pUniqueColors)
+	{
+		*pUniqueColors = (int)header.m_uniqueColors;
+	}
+
+	// The modified time, is the last used time, for Trim
+	TouchFile(path);
+
+	SDL_AtomicAdd(&m_hits, 1);
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+
+bool ConversionCache::Store(const CacheKey& key, const IndexedImage& image, int uniqueColors)
+{
+	std::string path = EntryPath(key);
+
+	if (!MakeDirectories(::GetDirectory(path)))
+	{
+		D16_SetError("ConversionCache, can't make %s", ::GetDirectory(path).c_str());
+		return false;
+	}
+
+	CacheHeader header;
+	memset(&header, 0, sizeof(header));
+
+	header.m_magic        = CACHE_MAGIC;
+	header.m_version      = CACHE_VERSION;
+	header.m_key[0]       = key.m_hash[0];
+	header.m_key[1]       = key.m_hash[1];
+	header.m_width        = image.GetWidth();
+	header.m_height       = image.GetHeight();
+	header.m_numColors    = image.GetNumColors();
+	header.m_uniqueColors = uniqueColors;
+	header.m_checksum     = EntryChecksum(image);
+
+	// Unique per thread, and per process, since thread ids are system wide
+	char suffix[ 64 ];
+	snprintf(suffix, sizeof(suffix), ".tmp%lu_%d", (unsigned long)SDL_ThreadID(),
+			 SDL_AtomicAdd(&m_tempCounter, 1));
+
+	std::string tempPath = path + suffix;
+
+	FILE* pFile = fopen(tempPath.c_str(), "wb");
+
+	if (nullptr == pFile)
+	{
+		D16_SetError("ConversionCache, can't write %s", tempPath.c_str());
+		return false;
+	}
+
+	size_t numPixels = (size_t)image.GetWidth() * image.GetHeight();
+
+	bool bWritten = (1 == fwrite(&header, sizeof(header), 1, pFile)) &&
+					(header.m_numColors == fwrite(image.GetPalette(), sizeof(Uint32),
+												  header.m_numColors, pFile)) &&
+					(numPixels == fwrite(image.GetPixels(), 1, numPixels, pFile));
+
+	bWritten = (0 == fclose(pFile)) && bWritten;
+
+	if (bWritten)
+	{
+		// Windows won't rename on top of an existing file
+		if (0 != rename(tempPath.c_str(), path.c_str()))
+		{
+			remove(path.c_str());
+			bWritten = (0 == rename(tempPath.c_str(), path.c_str()));
+		}
+	}
+
+	if (!bWritten)
+	{
+		remove(tempPath.c_str());
+		D16_SetError("ConversionCache, can't write %s", path.c_str());
+		return false;
+	}
+
+	//--------------------------------------------------------------------------
+
+	bool bTrim = false;
+
+	SDL_LockMutex(m_pMutex);
+
+	if (m_totalBytes >= 0)
+	{
+		m_totalBytes += sizeof(header) + (header.m_numColors * sizeof(Uint32)) + numPixels;
+		bTrim = m_totalBytes > m_maxBytes;
+	}
+	else
+	{
+		// First store, Trim will count what's there
+		bTrim = !m_bShortLived || (0 == (key.m_hash[0] & 0xFF));
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+
+	if (bTrim)
+	{
+		Trim();
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+struct CacheEntry
+{
+	std::string m_path;
+	long long m_modifiedTime;
+	long long m_size;
+
+	bool operator<(const CacheEntry& other) const
+	{
+		return m_modifiedTime < other.m_modifiedTime;
+	}
+};
+
+void ConversionCache::Trim()
+{
+	SDL_LockMutex(m_pMutex);
+
+	std::vector<std::string> files;
+	CollectFiles(m_directory, true, files);
+
+	std::vector<CacheEntry> entries;
+	long long totalBytes = 0;
+	long long now = (long long)time(nullptr);
+
+	for (int idx = 0; idx < (int)files.size(); ++idx)
+	{
+		CacheEntry entry;
+		entry.m_path = files[ idx ];
+		entry.m_modifiedTime = GetModifiedTime(entry.m_path);
+		entry.m_size = GetFileSize(entry.m_path);
+
+		if (entry.m_size < 0)
+			continue;  // someone else removed it
+
+		const std::string& path = entry.m_path;
+		size_t extLength = strlen(CACHE_EXTENSION);
+
+		bool bEntry = (path.size() > extLength) &&
+					  (0 == path.compare(path.size() - extLength, extLength, CACHE_EXTENSION));
+
+		if (!bEntry)
+		{
+			// A temporary file, that has been sitting for an hour, is from
+			// a run that didn't finish
+			if ((std::string::npos != path.find(".tmp")) && ((now - entry.m_modifiedTime) > 3600))
+				remove(path.c_str());
+
+			continue;
+		}
+
+		totalBytes += entry.m_size;
+		entries.push_back(entry);
+	}
+
+	if (totalBytes > m_maxBytes)
+	{
+		// Oldest first, and go a bit under the cap, so we aren't back in
+		// here on the very next Store
+		std::sort(entries.begin(), entries.end());
+
+		long long targetBytes = m_maxBytes - (m_maxBytes / 10);
+
+		for (int idx = 0; (idx < (int)entries.size()) && (totalBytes > targetBytes); ++idx)
+		{
+			if (0 == remove(entries[ idx ].m_path.c_str()))
+				totalBytes -= entries[ idx ].m_size;
+		}
+	}
+
+	m_totalBytes = totalBytes;
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,89 @@
+//
+// Engine Cache - Conversion results kept on disk
+//
+// The key is a hash of the decoded source pixels, and everything that can
+// change the output pixels (size, filter, posterize, dither, locked colors,
+// the engine, and libimagequant versions).  A hit hands back the indexes,
+// and palette, without resizing, or quantizing anything.
+//
+// One cache can be shared by any number of threads, and processes; entries
+// are written to a temporary file, then renamed into place.
+//
+#ifndef ENGINE_CACHE_H_
+#define ENGINE_CACHE_H_
+
+#include "pipeline.h"
+
+#include <string>
+
+//------------------------------------------------------------------------------
+
+struct CacheKey
+{
+	Uint64 m_hash[2];
+
+	bool operator==(const CacheKey& other) const
+	{
+		return (m_hash[0] == other.m_hash[0]) && (m_hash[1] == other.m_hash[1]);
+	}
+};
+
+// The output format isn't part of the key, the cache holds the indexed
+// image, before it's saved
+CacheKey MakeCacheKey(SDL_Surface* pSource, const ConvertOptions& options);
+CacheKey MakeCacheKey(const RGBAImage& source, const ConvertOptions& options);
+
+// 64 bit hash, not cryptographic, just fast
+Uint64 HashBytes(const void* pData, size_t numBytes, Uint64 seed = 0);
+
+//------------------------------------------------------------------------------
+
+class ConversionCache
+{
+public:
+	// maxBytes is a soft cap, when a Store goes over, the least recently
+	// used entries are removed
+	ConversionCache(const std::string& directory, long long maxBytes);
+	~ConversionCache();
+
+	// nullptr on a miss, a damaged entry counts as a miss, and gets removed
+	IndexedImage* Load(const CacheKey& key, int* pUniqueColors = nullptr);
+
+	bool Store(const CacheKey& key, const IndexedImage& image, int uniqueColors = 0);
+
+	// Remove least recently used entries, until we're under the cap
+	void Trim();
+
+	// For a process that Stores once, and goes (d16 convert -), where
+	// counting the whole cache would cost more than the conversion.  The
+	// first Store doesn't Trim, unless the key picks it, about one in 256,
+	// so the cap still holds, across many processes
+	void SetShortLived(bool bShortLived) { m_bShortLived = bShortLived; }
+
+	const std::string& GetDirectory() const { return m_directory; }
+
+	int GetHits() const   { return SDL_AtomicGet(const_cast<SDL_atomic_t*>(&m_hits)); }
+	int GetMisses() const { return SDL_AtomicGet(const_cast<SDL_atomic_t*>(&m_misses)); }
+
+	// Per user cache location, "" if SDL can't find one
+	static std::string DefaultDirectory();
+
+	static const long long DEFAULT_MAX_BYTES = 512LL * 1024 * 1024;
+
+private:
+	std::string EntryPath(const CacheKey& key) const;
+
+	std::string m_directory;
+	long long m_maxBytes;
+
+	SDL_mutex* m_pMutex;     // m_totalBytes, and Trim
+	long long m_totalBytes;  // -1 until we've looked
+	bool m_bShortLived;
+	SDL_atomic_t m_tempCounter;
+
+	SDL_atomic_t m_hits;
+	SDL_atomic_t m_misses;
+};
+
+#endif // ENGINE_CACHE_H_
+
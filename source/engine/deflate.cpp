@@ -0,0 +1,1119 @@
+//
+// Engine Deflate - zlib streams (RFC 1950, 1951), compressed in parallel
+//
+#include "deflate.h"
+
+#include "jobs.h"
+
+#include <algorithm>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static const int WINDOW_SIZE   = 32768;
+static const int MIN_MATCH     = 3;
+static const int MAX_MATCH     = 258;
+static const int TOO_FAR       = 4096;     // a 3 byte match further back isn't worth it
+static const int HASH_BITS     = 15;
+static const int HASH_SIZE     = 1 << HASH_BITS;
+
+static const int CHUNK_SIZE    = 128 * 1024;
+static const int BLOCK_SYMBOLS = 16384;    // symbols per block, before it's written
+
+static const int NUM_LITLEN    = 286;
+static const int NUM_DIST      = 30;
+static const int NUM_CODELEN   = 19;
+static const int END_OF_BLOCK  = 256;
+
+static const int MAX_CODE_BITS    = 15;
+static const int MAX_CODELEN_BITS = 7;
+
+// zlib's table, so the levels feel the same
+struct LevelSettings
+{
+	int  m_goodLength;  // cut the search short, once we already have this
+	int  m_maxLazy;     // lazy: don't look for better than this, otherwise
+						// longer matches don't get all their bytes hashed
+	int  m_niceLength;  // stop looking, once a match is this long
+	int  m_maxChain;    // how far down a hash chain to look
+	bool m_bLazy;       // see if the next byte starts a better match
+};
+
+static const LevelSettings s_levels[ 10 ] =
+{
+	{  0,   0,   0,    0, false },  // 0, stored
+	{  4,   4,   8,    4, false },
+	{  4,   5,  16,    8, false },
+	{  4,   6,  32,   32, false },
+	{  4,   4,  16,   16, true  },
+	{  8,  16,  32,   32, true  },
+	{  8,  16, 128,  128, true  },
+	{  8,  32, 128,  256, true  },
+	{ 32, 128, 258, 1024, true  },
+	{ 32, 258, 258, 4096, true  },
+};
+
+//------------------------------------------------------------------------------
+//
+// Tables, from RFC 1951
+//
+//------------------------------------------------------------------------------
+
+static const int s_lengthBase[ 29 ] =
+{
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+static const int s_lengthExtra[ 29 ] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+static const int s_distBase[ 30 ] =
+{
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+
+static const int s_distExtra[ 30 ] =
+{
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+// The order the code length code lengths are sent in
+static const int s_codeLengthOrder[ NUM_CODELEN ] =
+{
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+// Length, and distance to code lookups, built the first time they're needed
+struct CodeTables
+{
+	CodeTables()
+	{
+		for (int code = 0; code < 29; ++code)
+		{
+			int end = (28 == code) ? 259 : s_lengthBase[ code ] + (1 << s_lengthExtra[ code ]);
+
+			for (int length = s_lengthBase[ code ]; length < end; ++length)
+				m_lengthCode[ length ] = (Uint8)code;
+		}
+
+		// 258 could also be 284, with all its extra bits set, 285 is shorter
+		m_lengthCode[ 258 ] = 28;
+
+		for (int code = 0; code < 30; ++code)
+		{
+			int end = s_distBase[ code ] + (1 << s_distExtra[ code ]);
+
+			for (int dist = s_distBase[ code ]; dist < end; ++dist)
+			{
+				if (dist <= 256)
+					m_distCodeLow[ dist - 1 ] = (Uint8)code;
+				else
+					m_distCodeHigh[ (dist - 1) >> 7 ] = (Uint8)code;
+			}
+		}
+
+		// Fixed Huffman lengths
+		for (int idx = 0; idx < 288; ++idx)
+		{
+			if (idx < 144)
+				m_fixedLitLengths[ idx ] = 8;
+			else if (idx < 256)
+				m_fixedLitLengths[ idx ] = 9;
+			else if (idx < 280)
+				m_fixedLitLengths[ idx ] = 7;
+			else
+				m_fixedLitLengths[ idx ] = 8;
+		}
+
+		for (int idx = 0; idx < 32; ++idx)
+			m_fixedDistLengths[ idx ] = 5;
+	}
+
+	int GetDistCode(int dist) const
+	{
+		return (dist <= 256) ? m_distCodeLow[ dist - 1 ] : m_distCodeHigh[ (dist - 1) >> 7 ];
+	}
+
+	Uint8 m_lengthCode[ 259 ];
+	Uint8 m_distCodeLow[ 256 ];
+	Uint8 m_distCodeHigh[ 256 ];
+
+	Uint8 m_fixedLitLengths[ 288 ];
+	Uint8 m_fixedDistLengths[ 32 ];
+};
+
+static const CodeTables& GetCodeTables()
+{
+	static CodeTables s_tables;
+	return s_tables;
+}
+
+//------------------------------------------------------------------------------
+//
+// Checksums
+//
+//------------------------------------------------------------------------------
+
+static const Uint32 ADLER_BASE = 65521;
+static const size_t ADLER_NMAX = 5552;  // most bytes before the sums can overflow
+
+Uint32 Adler32(Uint32 adler, const Uint8* pData, size_t numBytes)
+{
+	Uint32 sum1 = adler & 0xFFFF;
+	Uint32 sum2 = adler >> 16;
+
+	while (numBytes > 0)
+	{
+		size_t count = std::min(numBytes, ADLER_NMAX);
+		numBytes -= count;
+
+		while (count >= 4)
+		{
+			sum1 += pData[0]; sum2 += sum1;
+			sum1 += pData[1]; sum2 += sum1;
+			sum1 += pData[2]; sum2 += sum1;
+			sum1 += pData[3]; sum2 += sum1;
+			pData += 4;
+			count -= 4;
+		}
+
+		while (count-- > 0)
+		{
+			sum1 += *pData++;
+			sum2 += sum1;
+		}
+
+		sum1 %= ADLER_BASE;
+		sum2 %= ADLER_BASE;
+	}
+
+	return (sum2 << 16) | sum1;
+}
+
+// What Adler32 would have been, over two pieces, back to back (from zlib)
+static Uint32 Adler32Combine(Uint32 adler1, Uint32 adler2, size_t length2)
+{
+	Uint32 remainder = (Uint32)(length2 % ADLER_BASE);
+
+	Uint32 sum1 = adler1 & 0xFFFF;
+	Uint32 sum2 = (remainder * sum1) % ADLER_BASE;
+
+	sum1 += (adler2 & 0xFFFF) + ADLER_BASE - 1;
+	sum2 += (adler1 >> 16) + (adler2 >> 16) + ADLER_BASE - remainder;
+
+	if (sum1 >= ADLER_BASE) sum1 -= ADLER_BASE;
+	if (sum1 >= ADLER_BASE) sum1 -= ADLER_BASE;
+	if (sum2 >= (ADLER_BASE << 1)) sum2 -= (ADLER_BASE << 1);
+	if (sum2 >= ADLER_BASE) sum2 -= ADLER_BASE;
+
+	return (sum2 << 16) | sum1;
+}
+
+//------------------------------------------------------------------------------
+
+struct CRCTable
+{
+	CRCTable()
+	{
+		for (Uint32 idx = 0; idx < 256; ++idx)
+		{
+			Uint32 crc = idx;
+
+			for (int bit = 0; bit < 8; ++bit)
+				crc = (crc & 1) ? (0xEDB88320 ^ (crc >> 1)) : (crc >> 1);
+
+			m_table[ idx ] = crc;
+		}
+	}
+
+	Uint32 m_table[ 256 ];
+};
+
+Uint32 CRC32(Uint32 crc, const Uint8* pData, size_t numBytes)
+{
+	static CRCTable s_crc;
+
+	crc = ~crc;
+
+	for (size_t idx = 0; idx < numBytes; ++idx)
+	{
+		crc = s_crc.m_table[ (crc ^ pData[ idx ]) & 0xFF ] ^ (crc >> 8);
+	}
+
+	return ~crc;
+}
+
+//------------------------------------------------------------------------------
+//
+// Huffman codes
+//
+//------------------------------------------------------------------------------
+
+// Code lengths for the frequencies, none longer than maxLength
+static void BuildLengths(const Uint32* pFreqs, int numSymbols, int maxLength, Uint8* pLengths)
+{
+	memset(pLengths, 0, numSymbols);
+
+	struct Leaf
+	{
+		Uint32 m_freq;
+		int m_symbol;
+
+		bool operator<(const Leaf& other) const
+		{
+			return (m_freq != other.m_freq) ? (m_freq < other.m_freq)
+											: (m_symbol < other.m_symbol);
+		}
+	};
+
+	Leaf leaves[ 288 ];
+	int numLeaves = 0;
+
+	for (int symbol = 0; symbol < numSymbols; ++symbol)
+	{
+		if (pFreqs[ symbol ])
+		{
+			leaves[ numLeaves ].m_freq = pFreqs[ symbol ];
+			leaves[ numLeaves ].m_symbol = symbol;
+			++numLeaves;
+		}
+	}
+
+	if (0 == numLeaves)
+		return;
+
+	if (1 == numLeaves)
+	{
+		pLengths[ leaves[0].m_symbol ] = 1;
+		return;
+	}
+
+	std::sort(leaves, leaves + numLeaves);
+
+	// Two queues, the sorted leaves, and the nodes we make, which come out
+	// in order too, so the two smallest are always at one of the fronts
+	int numNodes = (2 * numLeaves) - 1;
+
+	Uint32 weight[ 2 * 288 ];
+	int parent[ 2 * 288 ];
+
+	for (int idx = 0; idx < numLeaves; ++idx)
+		weight[ idx ] = leaves[ idx ].m_freq;
+
+	int nextLeaf = 0;
+	int nextInner = numLeaves;
+
+	for (int node = numLeaves; node < numNodes; ++node)
+	{
+		int pick[ 2 ];
+
+		for (int side = 0; side < 2; ++side)
+		{
+			if ((nextLeaf < numLeaves) &&
+				((nextInner >= node) || (weight[ nextLeaf ] <= weight[ nextInner ])))
+			{
+				pick[ side ] = nextLeaf++;
+			}
+			else
+			{
+				pick[ side ] = nextInner++;
+			}
+		}
+
+		weight[ node ] = weight[ pick[0] ] + weight[ pick[1] ];
+		parent[ pick[0] ] = node;
+		parent[ pick[1] ] = node;
+	}
+
+	// Parents always come after their children, so walk back from the root
+	int depth[ 2 * 288 ];
+	depth[ numNodes - 1 ] = 0;
+
+	for (int node = numNodes - 2; node >= 0; --node)
+		depth[ node ] = depth[ parent[ node ] ] + 1;
+
+	// Anything too deep gets pulled up to maxLength, which over subscribes
+	// the code, then push shorter codes down, until it fits again (miniz)
+	int numCodes[ MAX_CODE_BITS + 1 ] = { 0 };
+
+	for (int idx = 0; idx < numLeaves; ++idx)
+		++numCodes[ std::min(depth[ idx ], maxLength) ];
+
+	Uint32 total = 0;
+
+	for (int length = maxLength; length > 0; --length)
+		total += (Uint32)numCodes[ length ] << (maxLength - length);
+
+	while (total != (1u << maxLength))
+	{
+		--numCodes[ maxLength ];
+
+		for (int length = maxLength - 1; length > 0; --length)
+		{
+			if (numCodes[ length ])
+			{
+				--numCodes[ length ];
+				numCodes[ length + 1 ] += 2;
+				break;
+			}
+		}
+
+		--total;
+	}
+
+	// Shortest codes to the most frequent symbols
+	int leaf = numLeaves - 1;
+
+	for (int length = 1; length <= maxLength; ++length)
+	{
+		for (int count = numCodes[ length ]; count > 0; --count)
+			pLengths[ leaves[ leaf-- ].m_symbol ] = (Uint8)length;
+	}
+}
+
+// Canonical codes, bit reversed, since deflate sends Huffman codes from
+// the top bit down, and everything else from the bottom up
+static void BuildCodes(const Uint8* pLengths, int numSymbols, Uint16* pCodes)
+{
+	int numCodes[ MAX_CODE_BITS + 1 ] = { 0 };
+
+	for (int symbol = 0; symbol < numSymbols; ++symbol)
+		++numCodes[ pLengths[ symbol ] ];
+
+	numCodes[ 0 ] = 0;
+
+	int nextCode[ MAX_CODE_BITS + 2 ];
+	int code = 0;
+
+	for (int length = 1; length <= MAX_CODE_BITS; ++length)
+	{
+		code = (code + numCodes[ length - 1 ]) << 1;
+		nextCode[ length ] = code;
+	}
+
+	for (int symbol = 0; symbol < numSymbols; ++symbol)
+	{
+		int length = pLengths[ symbol ];
+
+		if (0 == length)
+		{
+			pCodes[ symbol ] = 0;
+			continue;
+		}
+
+		int value = nextCode[ length ]++;
+		int reversed = 0;
+
+		for (int bit = 0; bit < length; ++bit)
+		{
+			reversed = (reversed << 1) | (value & 1);
+			value >>= 1;
+		}
+
+		pCodes[ symbol ] = (Uint16)reversed;
+	}
+}
+
+//------------------------------------------------------------------------------
+//
+// Writing bits
+//
+//------------------------------------------------------------------------------
+
+class BitWriter
+{
+public:
+	BitWriter(std::vector<Uint8>& out)
+		: m_out(out)
+		, m_bits(0)
+		, m_numBits(0)
+	{
+	}
+
+	void Put(Uint32 bits, int numBits)
+	{
+		m_bits |= (Uint64)bits << m_numBits;
+		m_numBits += numBits;
+
+		while (m_numBits >= 8)
+		{
+			m_out.push_back((Uint8)m_bits);
+			m_bits >>= 8;
+			m_numBits -= 8;
+		}
+	}
+
+	void Align()
+	{
+		if (m_numBits)
+			Put(0, 8 - m_numBits);
+	}
+
+private:
+	std::vector<Uint8>& m_out;
+	Uint64 m_bits;
+	int m_numBits;
+};
+
+//------------------------------------------------------------------------------
+//
+// Blocks
+//
+//------------------------------------------------------------------------------
+
+// A literal when m_dist is 0, otherwise a match of m_litLen bytes
+struct DeflateSymbol
+{
+	Uint16 m_litLen;
+	Uint16 m_dist;
+};
+
+static void WriteStored(BitWriter& writer, const Uint8* pRaw, size_t numBytes, bool bFinal)
+{
+	do
+	{
+		size_t count = std::min(numBytes, (size_t)0xFFFF);
+		numBytes -= count;
+
+		writer.Put((bFinal && (0 == numBytes)) ? 1 : 0, 1);
+		writer.Put(0, 2);
+		writer.Align();
+		writer.Put((Uint32)count, 16);
+		writer.Put((Uint32)(~count & 0xFFFF), 16);
+
+		for (size_t idx = 0; idx < count; ++idx)
+			writer.Put(pRaw[ idx ], 8);
+
+		pRaw += count;
+
+	} while (numBytes > 0);
+}
+
+// Bits for the symbols, not counting any header
+static size_t DataBits(const Uint32* pLitFreqs, const Uint8* pLitLengths,
+					   const Uint32* pDistFreqs, const Uint8* pDistLengths)
+{
+	size_t bits = 0;
+
+	for (int symbol = 0; symbol < NUM_LITLEN; ++symbol)
+	{
+		int extra = (symbol > END_OF_BLOCK) ? s_lengthExtra[ symbol - 257 ] : 0;
+		bits += (size_t)pLitFreqs[ symbol ] * (pLitLengths[ symbol ] + extra);
+	}
+
+	for (int symbol = 0; symbol < NUM_DIST; ++symbol)
+		bits += (size_t)pDistFreqs[ symbol ] * (pDistLengths[ symbol ] + s_distExtra[ symbol ]);
+
+	return bits;
+}
+
+// Code lengths, run length coded with 16 (repeat the last 3-6 times),
+// 17 (3-10 zeros), and 18 (11-138 zeros)
+static int RunLengthCode(const Uint8* pLengths, int numLengths, Uint8* pCodes, Uint8* pExtra)
+{
+	int numCodes = 0;
+	int idx = 0;
+
+	while (idx < numLengths)
+	{
+		int value = pLengths[ idx ];
+		int run = 1;
+
+		while ((idx + run < numLengths) && (pLengths[ idx + run ] == value))
+			++run;
+
+		idx += run;
+
+		if (0 == value)
+		{
+			while (run >= 11)
+			{
+				int count = std::min(run, 138);
+				pCodes[ numCodes ] = 18;
+				pExtra[ numCodes++ ] = (Uint8)(count - 11);
+				run -= count;
+			}
+
+			if (run >= 3)
+			{
+				pCodes[ numCodes ] = 17;
+				pExtra[ numCodes++ ] = (Uint8)(run - 3);
+				run = 0;
+			}
+		}
+		else
+		{
+			pCodes[ numCodes ] = (Uint8)value;
+			pExtra[ numCodes++ ] = 0;
+			--run;
+
+			while (run >= 3)
+			{
+				int count = std::min(run, 6);
+				pCodes[ numCodes ] = 16;
+				pExtra[ numCodes++ ] = (Uint8)(count - 3);
+				run -= count;
+			}
+		}
+
+		while (run-- > 0)
+		{
+			pCodes[ numCodes ] = (Uint8)value;
+			pExtra[ numCodes++ ] = 0;
+		}
+	}
+
+	return numCodes;
+}
+
+static void WriteSymbols(BitWriter& writer, const DeflateSymbol* pSymbols, int numSymbols,
+						 const Uint8* pLitLengths, const Uint16* pLitCodes,
+						 const Uint8* pDistLengths, const Uint16* pDistCodes)
+{
+	const CodeTables& tables = GetCodeTables();
+
+	for (int idx = 0; idx < numSymbols; ++idx)
+	{
+		const DeflateSymbol& symbol = pSymbols[ idx ];
+
+		if (0 == symbol.m_dist)
+		{
+			writer.Put(pLitCodes[ symbol.m_litLen ], pLitLengths[ symbol.m_litLen ]);
+			continue;
+		}
+
+		int lengthCode = tables.m_lengthCode[ symbol.m_litLen ];
+		int litLen = 257 + lengthCode;
+
+		writer.Put(pLitCodes[ litLen ], pLitLengths[ litLen ]);
+
+		if (s_lengthExtra[ lengthCode ])
+			writer.Put(symbol.m_litLen - s_lengthBase[ lengthCode ], s_lengthExtra[ lengthCode ]);
+
+		int distCode = tables.GetDistCode(symbol.m_dist);
+
+		writer.Put(pDistCodes[ distCode ], pDistLengths[ distCode ]);
+
+		if (s_distExtra[ distCode ])
+			writer.Put(symbol.m_dist - s_distBase[ distCode ], s_distExtra[ distCode ]);
+	}
+
+	writer.Put(pLitCodes[ END_OF_BLOCK ], pLitLengths[ END_OF_BLOCK ]);
+}
+
+// Whichever of dynamic, fixed, or stored comes out smallest
+static void WriteBlock(BitWriter& writer, const DeflateSymbol* pSymbols, int numSymbols,
+					   const Uint8* pRaw, size_t numRawBytes, bool bFinal)
+{
+	const CodeTables& tables = GetCodeTables();
+
+	Uint32 litFreqs[ NUM_LITLEN ] = { 0 };
+	Uint32 distFreqs[ NUM_DIST ] = { 0 };
+
+	for (int idx = 0; idx < numSymbols; ++idx)
+	{
+		const DeflateSymbol& symbol = pSymbols[ idx ];
+
+		if (0 == symbol.m_dist)
+		{
+			++litFreqs[ symbol.m_litLen ];
+		}
+		else
+		{
+			++litFreqs[ 257 + tables.m_lengthCode[ symbol.m_litLen ] ];
+			++distFreqs[ tables.GetDistCode(symbol.m_dist) ];
+		}
+	}
+
+	litFreqs[ END_OF_BLOCK ] = 1;
+
+	size_t fixedBits = 3 + DataBits(litFreqs, tables.m_fixedLitLengths,
+									distFreqs, tables.m_fixedDistLengths);
+
+	size_t storedBits = (((numRawBytes + 0xFFFE) / 0xFFFF) * (3 + 32)) + 7 + (numRawBytes * 8);
+
+	if (0 == numRawBytes)
+		storedBits = 3 + 7 + 32;
+
+	//--------------------------------------------------------------------------
+	// Dynamic, zlib keeps at least 2 distance codes, old inflaters
+	// choke on fewer, and it costs next to nothing
+
+	Uint32 dynamicDistFreqs[ NUM_DIST ];
+	memcpy(dynamicDistFreqs, distFreqs, sizeof(distFreqs));
+
+	int numUsed = 0;
+
+	for (int idx = 0; idx < NUM_DIST; ++idx)
+		numUsed += dynamicDistFreqs[ idx ] ? 1 : 0;
+
+	for (int idx = 0; (numUsed < 2) && (idx < NUM_DIST); ++idx)
+	{
+		if (0 == dynamicDistFreqs[ idx ])
+		{
+			dynamicDistFreqs[ idx ] = 1;
+			++numUsed;
+		}
+	}
+
+	Uint8 litLengths[ NUM_LITLEN ];
+	Uint8 distLengths[ NUM_DIST ];
+
+	BuildLengths(litFreqs, NUM_LITLEN, MAX_CODE_BITS, litLengths);
+	BuildLengths(dynamicDistFreqs, NUM_DIST, MAX_CODE_BITS, distLengths);
+
+	int numLit = NUM_LITLEN;
+	while ((numLit > 257) && (0 == litLengths[ numLit - 1 ]))
+		--numLit;
+
+	int numDist = NUM_DIST;
+	while ((numDist > 1) && (0 == distLengths[ numDist - 1 ]))
+		--numDist;
+
+	Uint8 allLengths[ NUM_LITLEN + NUM_DIST ];
+	memcpy(allLengths, litLengths, numLit);
+	memcpy(allLengths + numLit, distLengths, numDist);
+
+	Uint8 rleCodes[ NUM_LITLEN + NUM_DIST ];
+	Uint8 rleExtra[ NUM_LITLEN + NUM_DIST ];
+	int numRLE = RunLengthCode(allLengths, numLit + numDist, rleCodes, rleExtra);
+
+	Uint32 codeLenFreqs[ NUM_CODELEN ] = { 0 };
+
+	for (int idx = 0; idx < numRLE; ++idx)
+		++codeLenFreqs[ rleCodes[ idx ] ];
+
+	Uint8 codeLenLengths[ NUM_CODELEN ];
+	BuildLengths(codeLenFreqs, NUM_CODELEN, MAX_CODELEN_BITS, codeLenLengths);
+
+	int numCodeLen = NUM_CODELEN;
+	while ((numCodeLen > 4) && (0 == codeLenLengths[ s_codeLengthOrder[ numCodeLen - 1 ] ]))
+		--numCodeLen;
+
+	size_t dynamicBits = 3 + 5 + 5 + 4 + (3 * numCodeLen);
+
+	for (int idx = 0; idx < numRLE; ++idx)
+	{
+		int code = rleCodes[ idx ];
+		dynamicBits += codeLenLengths[ code ] + ((16 == code) ? 2 : (17 == code) ? 3 : (18 == code) ? 7 : 0);
+	}
+
+	dynamicBits += DataBits(litFreqs, litLengths, distFreqs, distLengths);
+
+	//--------------------------------------------------------------------------
+
+	if ((storedBits <= fixedBits) && (storedBits <= dynamicBits))
+	{
+		WriteStored(writer, pRaw, numRawBytes, bFinal);
+	}
+	else if (fixedBits <= dynamicBits)
+	{
+		Uint16 litCodes[ 288 ];
+		Uint16 distCodes[ 32 ];
+		BuildCodes(tables.m_fixedLitLengths, 288, litCodes);
+		BuildCodes(tables.m_fixedDistLengths, 32, distCodes);
+
+		writer.Put(bFinal ? 1 : 0, 1);
+		writer.Put(1, 2);
+
+		WriteSymbols(writer, pSymbols, numSymbols, tables.m_fixedLitLengths, litCodes,
+					 tables.m_fixedDistLengths, distCodes);
+	}
+	else
+	{
+		Uint16 litCodes[ NUM_LITLEN ];
+		Uint16 distCodes[ NUM_DIST ];
+		Uint16 codeLenCodes[ NUM_CODELEN ];
+		BuildCodes(litLengths, NUM_LITLEN, litCodes);
+		BuildCodes(distLengths, NUM_DIST, distCodes);
+		BuildCodes(codeLenLengths, NUM_CODELEN, codeLenCodes);
+
+		writer.Put(bFinal ? 1 : 0, 1);
+		writer.Put(2, 2);
+		writer.Put(numLit - 257, 5);
+		writer.Put(numDist - 1, 5);
+		writer.Put(numCodeLen - 4, 4);
+
+		for (int idx = 0; idx < numCodeLen; ++idx)
+			writer.Put(codeLenLengths[ s_codeLengthOrder[ idx ] ], 3);
+
+		for (int idx = 0; idx < numRLE; ++idx)
+		{
+			int code = rleCodes[ idx ];
+			writer.Put(codeLenCodes[ code ], codeLenLengths[ code ]);
+
+			if (16 == code)
+				writer.Put(rleExtra[ idx ], 2);
+			else if (17 == code)
+				writer.Put(rleExtra[ idx ], 3);
+			else if (18 == code)
+				writer.Put(rleExtra[ idx ], 7);
+		}
+
+		WriteSymbols(writer, pSymbols, numSymbols, litLengths, litCodes,
+					 distLengths, distCodes);
+	}
+}
+
+//------------------------------------------------------------------------------
+//
+// Matching
+//
+//------------------------------------------------------------------------------
+
+static inline int CountTrailingZeros(Uint64 value)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+	unsigned long index;
+	_BitScanForward64(&index, value);
+	return (int)index;
+#elif defined(__GNUC__)
+	return __builtin_ctzll(value);
+#else
+	int count = 0;
+	while (0 == (value & 1))
+	{
+		value >>= 1;
+		++count;
+	}
+	return count;
+#endif
+}
+
+// How many bytes are the same, up to maxLength, 8 at a time
+static inline int MatchLength(const Uint8* pA, const Uint8* pB, int maxLength)
+{
+	int length = 0;
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+	while (length + 8 <= maxLength)
+	{
+		Uint64 a, b;
+		memcpy(&a, pA + length, 8);
+		memcpy(&b, pB + length, 8);
+
+		Uint64 diff = a ^ b;
+
+		if (diff)
+			return length + (CountTrailingZeros(diff) >> 3);
+
+		length += 8;
+	}
+#endif
+
+	while ((length < maxLength) && (pA[ length ] == pB[ length ]))
+		++length;
+
+	return length;
+}
+
+static inline Uint32 Hash3(const Uint8* pBytes)
+{
+	Uint32 value = ((Uint32)pBytes[0] << 16) | ((Uint32)pBytes[1] << 8) | pBytes[2];
+
+	return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+//------------------------------------------------------------------------------
+// One chunk, [start, end), matches can reach back to dictStart
+class ChunkCompressor
+{
+public:
+	ChunkCompressor(const Uint8* pData, size_t dictStart, size_t start, size_t end,
+					int level, std::vector<Uint8>& out)
+		: m_pBase(pData + dictStart)
+		, m_start((int)(start - dictStart))
+		, m_end((int)(end - dictStart))
+		, m_settings(s_levels[ level ])
+		, m_writer(out)
+		, m_blockStart(m_start)
+		, m_emitted(m_start)
+	{
+		m_head.assign(HASH_SIZE, -1);
+		m_prev.resize(m_end);
+		m_symbols.reserve(BLOCK_SYMBOLS);
+	}
+
+	void Compress(bool bFinal);
+
+private:
+	// Adds pos to its chain, and hands back the one before it
+	int Insert(int pos)
+	{
+		Uint32 hash = Hash3(m_pBase + pos);
+		int previous = m_head[ hash ];
+		m_prev[ pos ] = previous;
+		m_head[ hash ] = pos;
+		return previous;
+	}
+
+	// Longest match, longer than bestLength, 0 if there isn't one
+	int FindMatch(int candidate, int pos, int bestLength, int& dist);
+
+	void EmitLiteral(int pos);
+	void EmitMatch(int length, int dist);
+	void FlushBlock(bool bFinal);
+
+	const Uint8* m_pBase;
+	int m_start;
+	int m_end;
+	LevelSettings m_settings;
+
+	BitWriter m_writer;
+
+	std::vector<int> m_head;
+	std::vector<int> m_prev;
+
+	std::vector<DeflateSymbol> m_symbols;
+	int m_blockStart;   // first byte the block's symbols cover
+	int m_emitted;      // first byte not covered yet
+};
+
+int ChunkCompressor::FindMatch(int candidate, int pos, int bestLength, int& dist)
+{
+	int maxLength = std::min(MAX_MATCH, m_end - pos);
+
+	if (maxLength < MIN_MATCH)
+		return 0;
+
+	int found = 0;
+	int limit = pos - WINDOW_SIZE;
+	int chain = m_settings.m_maxChain;
+
+	// Already have a good one, don't look as hard for better
+	if (bestLength >= m_settings.m_goodLength)
+		chain >>= 2;
+
+	bestLength = std::max(bestLength, MIN_MATCH - 1);
+
+	const Uint8* pCur = m_pBase + pos;
+
+	while ((candidate >= 0) && (candidate > limit) && (chain-- > 0) && (bestLength < maxLength))
+	{
+		const Uint8* pCandidate = m_pBase + candidate;
+
+		// Cheap check, it can only win if it gets past the best so far
+		if ((pCandidate[ bestLength ] == pCur[ bestLength ]) && (pCandidate[0] == pCur[0]))
+		{
+			int length = MatchLength(pCandidate, pCur, maxLength);
+
+			if (length > bestLength)
+			{
+				bestLength = length;
+				found = length;
+				dist = pos - candidate;
+
+				if (length >= m_settings.m_niceLength)
+					break;
+			}
+		}
+
+		candidate = m_prev[ candidate ];
+	}
+
+	if ((MIN_MATCH == found) && (dist > TOO_FAR))
+		return 0;
+
+	return found;
+}
+
+void ChunkCompressor::EmitLiteral(int pos)
+{
+	DeflateSymbol symbol;
+	symbol.m_litLen = m_pBase[ pos ];
+	symbol.m_dist = 0;
+
+	m_symbols.push_back(symbol);
+	m_emitted = pos + 1;
+
+	if ((int)m_symbols.size() >= BLOCK_SYMBOLS)
+		FlushBlock(false);
+}
+
+void ChunkCompressor::EmitMatch(int length, int dist)
+{
+	DeflateSymbol symbol;
+	symbol.m_litLen = (Uint16)length;
+	symbol.m_dist = (Uint16)dist;
+
+	m_symbols.push_back(symbol);
+	m_emitted += length;
+
+	if ((int)m_symbols.size() >= BLOCK_SYMBOLS)
+		FlushBlock(false);
+}
+
+void ChunkCompressor::FlushBlock(bool bFinal)
+{
+	WriteBlock(m_writer, m_symbols.empty() ? nullptr : &m_symbols[0], (int)m_symbols.size(),
+			   m_pBase + m_blockStart, m_emitted - m_blockStart, bFinal);
+
+	m_symbols.clear();
+	m_blockStart = m_emitted;
+}
+
+void ChunkCompressor::Compress(bool bFinal)
+{
+	if (0 == m_settings.m_maxChain)
+	{
+		WriteStored(m_writer, m_pBase + m_start, m_end - m_start, bFinal);
+		return;
+	}
+
+	// The dictionary goes in the chains, but doesn't get written
+	for (int pos = 0; (pos < m_start) && (pos + MIN_MATCH <= m_end); ++pos)
+		Insert(pos);
+
+	int pos = m_start;
+
+	// Lazy matching, the match found at pos - 1, waiting to see if pos
+	// has a better one
+	bool bPending = false;
+	int pendingLength = 0;
+	int pendingDist = 0;
+
+	while (pos < m_end)
+	{
+		int length = 0;
+		int dist = 0;
+
+		if (pos + MIN_MATCH <= m_end)
+		{
+			int candidate = Insert(pos);
+
+			if (!m_settings.m_bLazy || !bPending || (pendingLength < m_settings.m_maxLazy))
+				length = FindMatch(candidate, pos, bPending ? pendingLength : 0, dist);
+		}
+
+		if (!m_settings.m_bLazy)
+		{
+			if (length >= MIN_MATCH)
+			{
+				EmitMatch(length, dist);
+
+				// Long matches are probably runs, and the chains would fill
+				// up with them
+				if (length <= m_settings.m_maxLazy)
+				{
+					for (int next = pos + 1; (next < pos + length) && (next + MIN_MATCH <= m_end); ++next)
+						Insert(next);
+				}
+
+				pos += length;
+			}
+			else
+			{
+				EmitLiteral(pos);
+				++pos;
+			}
+
+			continue;
+		}
+
+		if (bPending && (pendingLength >= MIN_MATCH) && (length <= pendingLength))
+		{
+			// The one at pos - 1 wins, pos is already in the chains
+			int matchEnd = pos - 1 + pendingLength;
+
+			EmitMatch(pendingLength, pendingDist);
+
+			for (int next = pos + 1; (next < matchEnd) && (next + MIN_MATCH <= m_end); ++next)
+				Insert(next);
+
+			pos = matchEnd;
+			bPending = false;
+			continue;
+		}
+
+		if (bPending)
+			EmitLiteral(pos - 1);
+
+		bPending = true;
+		pendingLength = length;
+		pendingDist = dist;
+		++pos;
+	}
+
+	// Too close to the end to have been a match
+	if (bPending)
+		EmitLiteral(m_end - 1);
+
+	if (bFinal || !m_symbols.empty())
+		FlushBlock(bFinal);
+
+	if (!bFinal)
+	{
+		// Sync flush, an empty stored block, so the next chunk starts on
+		// a byte boundary
+		m_writer.Put(0, 3);
+		m_writer.Align();
+		m_writer.Put(0x0000, 16);
+		m_writer.Put(0xFFFF, 16);
+	}
+
+	m_writer.Align();
+}
+
+//------------------------------------------------------------------------------
+
+void DeflateZlib(const Uint8* pData, size_t numBytes, int level, std::vector<Uint8>& out)
+{
+	level = SDL_max(eDeflateStore, SDL_min(level, eDeflateSmallest));
+
+	// 32K window, deflate, and FLEVEL says roughly how hard we tried
+	Uint8 cmf = 0x78;
+	Uint8 flevel = (level <= 1) ? 0 : (level <= 5) ? 1 : (6 == level) ? 2 : 3;
+	Uint8 flg = (Uint8)(flevel << 6);
+	flg += (Uint8)(31 - (((cmf << 8) | flg) % 31));
+
+	out.push_back(cmf);
+	out.push_back(flg);
+
+	int numChunks = (int)SDL_max((size_t)1, (numBytes + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+	std::vector<std::vector<Uint8> > chunks(numChunks);
+	std::vector<Uint32> adlers(numChunks);
+
+	JobSystem::GetDefault().ParallelFor(0, numChunks, 1, [&](int first, int last)
+	{
+		for (int chunk = first; chunk < last; ++chunk)
+		{
+			size_t start = (size_t)chunk * CHUNK_SIZE;
+			size_t end = std::min(numBytes, start + CHUNK_SIZE);
+			size_t dictStart = (start > (size_t)WINDOW_SIZE) ? start - WINDOW_SIZE : 0;
+
+			chunks[ chunk ].reserve((end - start) / 2 + 64);
+
+			ChunkCompressor compressor(pData, dictStart, start, end, level, chunks[ chunk ]);
+			compressor.Compress(chunk == numChunks - 1);
+
+			adlers[ chunk ] = Adler32(1, pData + start, end - start);
+		}
+	});
+
+	Uint32 adler = adlers[0];
+
+	for (int chunk = 0; chunk < numChunks; ++chunk)
+	{
+		out.insert(out.end(), chunks[ chunk ].begin(), chunks[ chunk ].end());
+
+		if (chunk > 0)
+		{
+			size_t length = std::min((size_t)CHUNK_SIZE, numBytes - ((size_t)chunk * CHUNK_SIZE));
+			adler = Adler32Combine(adler, adlers[ chunk ], length);
+		}
+	}
+
+	out.push_back((Uint8)(adler >> 24));
+	out.push_back((Uint8)(adler >> 16));
+	out.push_back((Uint8)(adler >> 8));
+	out.push_back((Uint8)adler);
+}
@@ -0,0 +1,39 @@
+//
+// Engine Deflate - zlib streams (RFC 1950, 1951), compressed in parallel
+//
+// The input is cut into chunks, and each one is compressed on its own, on
+// whichever worker picks it up, with the 32K in front of it as a preset
+// dictionary, so matches still reach back across the cut.  Every chunk,
+// but the last, ends with an empty stored block (a zlib sync flush), which
+// leaves it on a byte boundary, so the chunks are just stuck together in
+// order, the way pigz does it.  That costs a few bytes a chunk, against
+// one long stream.
+//
+// level is the usual zlib speed/size knob, 0 only stores, 1 is fastest,
+// 9 looks hardest for matches.
+//
+#ifndef ENGINE_DEFLATE_H_
+#define ENGINE_DEFLATE_H_
+
+#include <SDL.h>
+
+#include <vector>
+
+enum DeflateLevel
+{
+	eDeflateStore    = 0,
+	eDeflateFastest  = 1,
+	eDeflateDefault  = 6,
+	eDeflateSmallest = 9
+};
+
+// Appends the zlib stream (header, blocks, Adler-32) to out
+void DeflateZlib(const Uint8* pData, size_t numBytes, int level, std::vector<Uint8>& out);
+
+// Start with 1, and keep passing back what came out, to check in pieces
+Uint32 Adler32(Uint32 adler, const Uint8* pData, size_t numBytes);
+
+// Start with 0, same idea, the one PNG, and zip use
+Uint32 CRC32(Uint32 crc, const Uint8* pData, size_t numBytes);
+
+#endif // ENGINE_DEFLATE_H_
@@ -0,0 +1,804 @@
+//
+// Engine Dither - Remap an image to a palette it was quantized to
+//
+#include "dither.h"
+
+#include "bluenoise.h"
+#include "jobs.h"
+#include "quantize.h"
+
+#include <math.h>
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define DITHER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Rows per band, for the workers
+static const int DITHER_ROWS_PER_BAND = 16;
+
+// The offset rows are at least this many pixels wide, the small matrices
+// repeat across it, so the SSE2 loop always has 4 whole pixels of offsets
+static const int MIN_OFFSET_PIXELS = 8;
+
+static const char* s_ditherNames[ eNumDitherMethods ] =
+{
+	"diffusion",
+	"bayer2",
+	"bayer4",
+	"bayer8",
+	"cluster4",
+	"cluster8",
+	"bluenoise",
+	"floyd",
+	"atkinson",
+	"sierralite",
+	"jjn"
+};
+
+// Clustered dot, the dot grows out from the middle of the cell
+static const int s_cluster4[ 4 * 4 ] =
+{
+	12,  5,  6, 13,
+	 4,  0,  1,  7,
+	11,  3,  2,  8,
+	15, 10,  9, 14
+};
+
+// Two dots, on a 45 degree screen
+static const int s_cluster8[ 8 * 8 ] =
+{
+	24, 10, 12, 26, 35, 47, 49, 37,
+	 8,  0,  2, 14, 45, 59, 61, 51,
+	22,  6,  4, 16, 43, 57, 63, 53,
+	30, 20, 18, 28, 33, 41, 55, 39,
+	34, 46, 48, 36, 25, 11, 13, 27,
+	44, 58, 60, 50,  9,  1,  3, 15,
+	42, 56, 62, 52, 23,  7,  5, 17,
+	32, 40, 54, 38, 31, 21, 19, 29
+};
+
+//------------------------------------------------------------------------------
+// Error diffusion kernels, m_dx is ahead, in the direction the row goes
+
+struct DiffusionTap
+{
+	int m_dx;
+	int m_dy;      // 0-2 rows down
+	int m_weight;
+};
+
+struct DiffusionKernel
+{
+	const DiffusionTap* m_pTaps;
+	int m_numTaps;
+	int m_divisor;
+	int m_reach;   // furthest m_dx, either way
+};
+
+static const DiffusionTap s_floydTaps[] =
+{
+	{  1, 0, 7 },
+	{ -1, 1, 3 }, { 0, 1, 5 }, { 1, 1, 1 }
+};
+
+// Only 6/8 of the error goes on, so it keeps more contrast
+static const DiffusionTap s_atkinsonTaps[] =
+{
+	{  1, 0, 1 }, { 2, 0, 1 },
+	{ -1, 1, 1 }, { 0, 1, 1 }, { 1, 1, 1 },
+	{  0, 2, 1 }
+};
+
+static const DiffusionTap s_sierraLiteTaps[] =
+{
+	{  1, 0, 2 },
+	{ -1, 1, 1 }, { 0, 1, 1 }
+};
+
+static const DiffusionTap s_jjnTaps[] =
+{
+	{  1, 0, 7 }, {  2, 0, 5 },
+	{ -2, 1, 3 }, { -1, 1, 5 }, { 0, 1, 7 }, { 1, 1, 5 }, { 2, 1, 3 },
+	{ -2, 2, 1 }, { -1, 2, 3 }, { 0, 2, 5 }, { 1, 2, 3 }, { 2, 2, 1 }
+};
+
+static const DiffusionKernel s_floyd      = { s_floydTaps,      SDL_arraysize(s_floydTaps),      16, 1 };
+static const DiffusionKernel s_atkinson   = { s_atkinsonTaps,   SDL_arraysize(s_atkinsonTaps),   8,  2 };
+static const DiffusionKernel s_sierraLite = { s_sierraLiteTaps, SDL_arraysize(s_sierraLiteTaps), 4,  1 };
+static const DiffusionKernel s_jjn        = { s_jjnTaps,        SDL_arraysize(s_jjnTaps),        48, 2 };
+
+static const DiffusionKernel& GetKernel(int iMethod)
+{
+	switch (iMethod)
+	{
+	case eDitherAtkinson:
+		return s_atkinson;
+	case eDitherSierraLite:
+		return s_sierraLite;
+	case eDitherJJN:
+		return s_jjn;
+	default:
+		return s_floyd;
+	}
+}
+
+// Errors are kept in 1/16ths
+static const int DIFFUSE_FRACTION_BITS = 4;
+
+// Rows go the same way for this many rows, then turn around
+static const int SERPENTINE_ROWS = 16;
+
+// A row tells the row below how far it's got, every this many pixels
+static const int PROGRESS_PIXELS = 16;
+
+//------------------------------------------------------------------------------
+
+int DitherFromName(const char* pName)
+{
+	// Allow the enum names too, eDitherBayer4
+	if (0 == SDL_strncasecmp(pName, "eDither", 7))
+		pName += 7;
+
+	for (int idx = 0; idx < eNumDitherMethods; ++idx)
+	{
+		if (0 == SDL_strcasecmp(pName, s_ditherNames[ idx ]))
+			return idx;
+	}
+
+	return -1;
+}
+
+const char* GetDitherName(int iMethod)
+{
+	if ((iMethod < 0) || (iMethod >= eNumDitherMethods))
+		return "unknown";
+
+	return s_ditherNames[ iMethod ];
+}
+
+bool IsOrderedDither(int iMethod)
+{
+	return (iMethod >= eDitherBayer2) && (iMethod <= eDitherBlueNoise);
+}
+
+bool IsErrorDiffusion(int iMethod)
+{
+	return (iMethod >= eDitherFloyd) && (iMethod <= eDitherJJN);
+}
+
+//------------------------------------------------------------------------------
+// Each size is the one before it, 4 times over, in the 0 2 / 3 1 order
+
+static void BuildBayer(int size, std::vector<int>& matrix)
+{
+	static const int order[ 4 ] = { 0, 2, 3, 1 };
+
+	matrix.assign(1, 0);
+
+	for (int n = 1; n < size; n *= 2)
+	{
+		std::vector<int> bigger((size_t)(n * 2) * (n * 2));
+
+		for (int y = 0; y < n * 2; ++y)
+		{
+			for (int x = 0; x < n * 2; ++x)
+			{
+				int quadrant = ((y / n) * 2) + (x / n);
+
+				bigger[ (y * n * 2) + x ] = (matrix[ ((y % n) * n) + (x % n) ] * 4) + order[ quadrant ];
+			}
+		}
+
+		matrix.swap(bigger);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Average distance from each color, to the one closest to it, in RGB,
+// colors that are in there twice only count once
+
+static float PaletteSpacing(const Uint32* pPalette, int numColors)
+{
+	float total = 0.0f;
+	int numCounted = 0;
+
+	for (int idx = 0; idx < numColors; ++idx)
+	{
+		Uint32 color = pPalette[ idx ];
+
+		if (0 == (color >> 24))
+			continue;
+
+		int nearestDistance = 0x7FFFFFFF;
+
+		for (int other = 0; other < numColors; ++other)
+		{
+			Uint32 entry = pPalette[ other ];
+
+			if ((0 == (entry >> 24)) || ((entry & 0xFFFFFF) == (color & 0xFFFFFF)))
+				continue;
+
+			int deltaRed   = (int)((entry >>  0) & 0xFF) - (int)((color >>  0) & 0xFF);
+			int deltaGreen = (int)((entry >>  8) & 0xFF) - (int)((color >>  8) & 0xFF);
+			int deltaBlue  = (int)((entry >> 16) & 0xFF) - (int)((color >> 16) & 0xFF);
+
+			int distance = (deltaRed * deltaRed) + (deltaGreen * deltaGreen) + (deltaBlue * deltaBlue);
+
+			if (distance < nearestDistance)
+				nearestDistance = distance;
+		}
+
+		if (nearestDistance != 0x7FFFFFFF)
+		{
+			total += sqrtf((float)nearestDistance);
+			++numCounted;
+		}
+	}
+
+	return numCounted ? (total / numCounted) : 255.0f;
+}
+
+static float PosterizeStep(int iPosterize)
+{
+	switch (iPosterize)
+	{
+	case ePosterize555:
+		return 255.0f / 31.0f;
+	case ePosterize888:
+		return 1.0f;
+	default:
+		return 255.0f / 15.0f;
+	}
+}
+
+static int ClampChannel(int value)
+{
+	return (value < 0) ? 0 : ((value > 255) ? 255 : value);
+}
+
+//------------------------------------------------------------------------------
+
+Ditherer::Ditherer(const Uint32* pPalette, int numColors, int iMethod, int iDither, int iPosterize,
+				   JobSystem* pJobs)
+	: m_pJobs(pJobs ? pJobs : &JobSystem::GetDefault())
+	, m_palette(pPalette, pPalette + numColors)
+	, m_iMethod((IsOrderedDither(iMethod) || IsErrorDiffusion(iMethod)) ? iMethod : eDitherFloyd)
+	, m_iDither(SDL_min(SDL_max(iDither, 0), 100))
+	, m_matrixSize(1)
+	, m_offsetPixels(MIN_OFFSET_PIXELS)
+	, m_spread(0)
+	, m_transparentIndex(0)
+{
+	std::vector<int> matrix(1, 0);
+
+	switch (iMethod)
+	{
+	case eDitherBayer2:
+		BuildBayer(2, matrix);
+		break;
+	case eDitherBayer4:
+		BuildBayer(4, matrix);
+		break;
+	case eDitherBayer8:
+		BuildBayer(8, matrix);
+		break;
+	case eDitherCluster4:
+		matrix.assign(s_cluster4, s_cluster4 + (4 * 4));
+		break;
+	case eDitherCluster8:
+		matrix.assign(s_cluster8, s_cluster8 + (8 * 8));
+		break;
+	case eDitherBlueNoise:
+		matrix.assign(GetBlueNoiseMask(), GetBlueNoiseMask() + (BLUE_NOISE_SIZE * BLUE_NOISE_SIZE));
+		break;
+	}
+
+	m_matrixSize = (int)(sqrtf((float)matrix.size()) + 0.5f);
+	m_offsetPixels = SDL_max(m_matrixSize, MIN_OFFSET_PIXELS);
+
+	//-----------------------------------------------
+	// Half again the palette spacing, so colors a little past the nearest
+	// one get mixed in too, in whole posterize steps, at least one, so a
+	// threshold always lands on a color the target can show
+
+	float step = PosterizeStep(iPosterize);
+	float steps = floorf(((PaletteSpacing(pPalette, numColors) * 1.5f) / step) + 0.5f);
+
+	float spread = SDL_min(SDL_max(steps, 1.0f) * step, 255.0f);
+
+	m_spread = (m_matrixSize > 1) ? (int)((spread * m_iDither) / 100.0f + 0.5f) : 0;
+
+	//-----------------------------------------------
+	// Centered on 0, so a flat area between two colors splits evenly
+
+	int numLevels = m_matrixSize * m_matrixSize;
+	int rowBytes = m_offsetPixels * 4;
+
+	m_addOffsets.assign((size_t)m_matrixSize * rowBytes, 0);
+	m_subOffsets.assign((size_t)m_matrixSize * rowBytes, 0);
+
+	for (int y = 0; y < m_matrixSize; ++y)
+	{
+		for (int x = 0; x < m_offsetPixels; ++x)
+		{
+			int level = matrix[ (y * m_matrixSize) + (x % m_matrixSize) ];
+
+			float threshold = ((level + 0.5f) / numLevels) - 0.5f;
+			int offset = (int)floorf((threshold * m_spread) + 0.5f);
+
+			for (int channel = 0; channel < 3; ++channel)
+			{
+				size_t pos = ((size_t)y * rowBytes) + (x * 4) + channel;
+
+				if (offset > 0)
+					m_addOffsets[ pos ] = (Uint8)offset;
+				else
+					m_subOffsets[ pos ] = (Uint8)(-offset);
+			}
+		}
+	}
+
+	m_transparentIndex = NearestColor(0, 0, 0, 0);
+
+	BuildColorTable();
+}
+
+//------------------------------------------------------------------------------
+// Squared RGBA distance, first one wins, same as the frame remap
+
+int Ditherer::NearestColor(int r, int g, int b, int a) const
+{
+	int nearest = 0;
+	int nearestDistance = 0x7FFFFFFF;
+
+	for (int idx = 0; idx < (int)m_palette.size(); ++idx)
+	{
+		Uint32 entry = m_palette[ idx ];
+
+		int deltaRed   = (int)((entry >>  0) & 0xFF) - r;
+		int deltaGreen = (int)((entry >>  8) & 0xFF) - g;
+		int deltaBlue  = (int)((entry >> 16) & 0xFF) - b;
+		int deltaAlpha = (int)((entry >> 24) & 0xFF) - a;
+
+		int distance = (deltaRed * deltaRed) + (deltaGreen * deltaGreen) +
+					   (deltaBlue * deltaBlue) + (deltaAlpha * deltaAlpha);
+
+		if (distance < nearestDistance)
+		{
+			nearestDistance = distance;
+			nearest = idx;
+		}
+	}
+
+	return nearest;
+}
+
+//------------------------------------------------------------------------------
+// Every 6 bit RGB, measured from the middle of the values it stands for,
+// a red at a time, on the workers
+
+void Ditherer::BuildColorTable()
+{
+	m_colorTable.resize(64 * 64 * 64);
+
+	m_pJobs->ParallelFor(0, 64, 4, [&](int start, int end)
+	{
+		for (int red = start; red < end; ++red)
+		{
+			Uint8* pTable = &m_colorTable[ red << 12 ];
+
+			for (int green = 0; green < 64; ++green)
+			{
+				for (int blue = 0; blue < 64; ++blue)
+				{
+					pTable[ (green << 6) | blue ] = (Uint8)NearestColor((red << 2) | 2, (green << 2) | 2,
+																		(blue << 2) | 2, 255);
+				}
+			}
+		}
+	});
+}
+
+//------------------------------------------------------------------------------
+
+void Ditherer::DitherRow(const Uint32* pSource, Uint8* pDest, int width, int y) const
+{
+	const Uint8* pAdd = &m_addOffsets[ (size_t)(y % m_matrixSize) * m_offsetPixels * 4 ];
+	const Uint8* pSub = &m_subOffsets[ (size_t)(y % m_matrixSize) * m_offsetPixels * 4 ];
+
+	const Uint8* pTable = &m_colorTable[0];
+
+	int x = 0;
+
+	#if DITHER_SSE2
+	// 4 pixels, 16 channels, at a time, the offsets go on with saturating
+	// byte adds, then the top 6 bits of R, G, and B become the table index.
+	// Anything not opaque, drops out to the full search
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+	const __m128i sixBits = _mm_set1_epi32(0x3F);
+
+	for (; x + 4 <= width; x += 4)
+	{
+		int offset = (x % m_offsetPixels) * 4;
+
+		__m128i add = _mm_loadu_si128((const __m128i*)(pAdd + offset));
+		__m128i sub = _mm_loadu_si128((const __m128i*)(pSub + offset));
+
+		__m128i pixels = _mm_loadu_si128((const __m128i*)(pSource + x));
+
+		pixels = _mm_subs_epu8(_mm_adds_epu8(pixels, add), sub);
+
+		__m128i red   = _mm_and_si128(_mm_srli_epi32(pixels,  2), sixBits);
+		__m128i green = _mm_and_si128(_mm_srli_epi32(pixels, 10), sixBits);
+		__m128i blue  = _mm_and_si128(_mm_srli_epi32(pixels, 18), sixBits);
+
+		__m128i index = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(red, 12), _mm_slli_epi32(green, 6)), blue);
+
+		int opaque = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(pixels, alphaMask), alphaMask));
+
+		Sint32 indexes[ 4 ];
+		_mm_storeu_si128((__m128i*)indexes, index);
+
+		if (0xFFFF == opaque)
+		{
+			pDest[ x + 0 ] = pTable[ indexes[0] ];
+			pDest[ x + 1 ] = pTable[ indexes[1] ];
+			pDest[ x + 2 ] = pTable[ indexes[2] ];
+			pDest[ x + 3 ] = pTable[ indexes[3] ];
+			continue;
+		}
+
+		Uint32 dithered[ 4 ];
+		_mm_storeu_si128((__m128i*)dithered, pixels);
+
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			Uint32 color = dithered[ lane ];
+			int alpha = (int)(color >> 24);
+
+			if (255 == alpha)
+				pDest[ x + lane ] = pTable[ indexes[ lane ] ];
+			else if (0 == alpha)
+				pDest[ x + lane ] = (Uint8)m_transparentIndex;
+			else
+				pDest[ x + lane ] = (Uint8)NearestColor((color >> 0) & 0xFF, (color >> 8) & 0xFF,
+														(color >> 16) & 0xFF, alpha);
+		}
+	}
+	#endif
+
+	for (; x < width; ++x)
+	{
+		Uint32 color = pSource[ x ];
+		int alpha = (int)(color >> 24);
+
+		if (0 == alpha)
+		{
+			pDest[ x ] = (Uint8)m_transparentIndex;
+			continue;
+		}
+
+		const Uint8* pPixelAdd = pAdd + ((x % m_offsetPixels) * 4);
+		const Uint8* pPixelSub = pSub + ((x % m_offsetPixels) * 4);
+
+		int red   = ClampChannel((int)((color >>  0) & 0xFF) + pPixelAdd[0] - pPixelSub[0]);
+		int green = ClampChannel((int)((color >>  8) & 0xFF) + pPixelAdd[1] - pPixelSub[1]);
+		int blue  = ClampChannel((int)((color >> 16) & 0xFF) + pPixelAdd[2] - pPixelSub[2]);
+
+		if (255 == alpha)
+			pDest[ x ] = pTable[ ((red >> 2) << 12) | ((green >> 2) << 6) | (blue >> 2) ];
+		else
+			pDest[ x ] = (Uint8)NearestColor(red, green, blue, alpha);
+	}
+}
+
+//------------------------------------------------------------------------------
+// What the rows of one image share, while it's being diffused
+//
+// Each row gets its error from the row above in m_below, and from two rows
+// above in m_twoBelow, so every buffer has one writer.  Only the rows being
+// worked on need them, so they go round in a ring, a row clears the ones
+// it writes to, when it starts.  Rows finish in order (the last pixel of a
+// row waits for the whole row above), and at most numLanes are going, so
+// by then, the row that had them last is done
+
+struct Ditherer::Wavefront
+{
+	Wavefront(int width, int height, int numLanes, int reach)
+		: m_width(width)
+		, m_height(height)
+		, m_reach(reach)
+		, m_stride((width + (reach * 2)) * 3)
+		, m_numRing(numLanes + 3)
+		, m_progress(height)
+		, m_below((size_t)m_numRing * m_stride, 0)
+		, m_twoBelow((size_t)m_numRing * m_stride, 0)
+	{
+		SDL_AtomicSet(&m_nextRow, 0);
+
+		for (int y = 0; y < height; ++y)
+		{
+			SDL_AtomicSet(&m_progress[ y ], 0);
+		}
+	}
+
+	// RGB errors, for pixel 0 of row y, there's m_reach pixels of slop,
+	// on each end, so the kernel doesn't have to check
+	Sint32* GetRow(std::vector<Sint32>& rows, int y)
+	{
+		return &rows[ (size_t)(y % m_numRing) * m_stride ] + (m_reach * 3);
+	}
+
+	int m_width;
+	int m_height;
+	int m_reach;
+	int m_stride;
+	int m_numRing;
+
+	SDL_atomic_t m_nextRow;
+	std::vector<SDL_atomic_t> m_progress;  // pixels done, per row
+
+	std::vector<Sint32> m_below;
+	std::vector<Sint32> m_twoBelow;
+};
+
+//------------------------------------------------------------------------------
+// Until at least needed pixels of the row are done, returns how many are
+
+static int WaitForRow(SDL_atomic_t* pProgress, int needed)
+{
+	int numSpins = 0;
+
+	for (;;)
+	{
+		int done = SDL_AtomicGet(pProgress);
+
+		if (done >= needed)
+		{
+			// So its errors are here too
+			SDL_MemoryBarrierAcquire();
+			return done;
+		}
+
+		// The row above is only a few pixels ahead, most of the time
+		if (++numSpins >= 64)
+			SDL_Delay(0);
+	}
+}
+
+static Sint32 RoundDivide(Sint32 value, int divisor)
+{
+	return (value >= 0) ? ((value + (divisor / 2)) / divisor) : -((-value + (divisor / 2)) / divisor);
+}
+
+//------------------------------------------------------------------------------
+
+void Ditherer::DiffuseRow(const Uint32* pSource, Uint8* pDest, Wavefront& wave, int y) const
+{
+	const DiffusionKernel& kernel = GetKernel(m_iMethod);
+
+	int width = wave.m_width;
+	int band = y / SERPENTINE_ROWS;
+
+	bool bForward = (0 == (band & 1));
+	int step = bForward ? 1 : -1;
+
+	// The row above went the other way, so its last pixel is the first one
+	// this row needs
+	bool bSameWay = (y > 0) && (band == ((y - 1) / SERPENTINE_ROWS));
+
+	Sint32* pIn     = wave.GetRow(wave.m_below, y);
+	Sint32* pInTwo  = wave.GetRow(wave.m_twoBelow, y);
+	Sint32* pOut    = wave.GetRow(wave.m_below, y + 1);
+	Sint32* pOutTwo = wave.GetRow(wave.m_twoBelow, y + 2);
+
+	memset(pOut - (wave.m_reach * 3), 0, wave.m_stride * sizeof(Sint32));
+	memset(pOutTwo - (wave.m_reach * 3), 0, wave.m_stride * sizeof(Sint32));
+
+	SDL_atomic_t* pAbove = (y > 0) ? &wave.m_progress[ y - 1 ] : nullptr;
+	SDL_atomic_t* pDone = &wave.m_progress[ y ];
+
+	int available = pAbove ? 0 : width;
+
+	// Error for the next 2 pixels along this row
+	Sint32 carry[ 2 ][ 3 ] = { { 0, 0, 0 }, { 0, 0, 0 } };
+
+	const Uint8* pTable = &m_colorTable[0];
+
+	const int fullScale = 255 << DIFFUSE_FRACTION_BITS;
+	const int half = 1 << (DIFFUSE_FRACTION_BITS - 1);
+
+	for (int count = 0; count < width; ++count)
+	{
+		int x = bForward ? count : (width - 1 - count);
+
+		// Everything in the row above, that sends to this pixel
+		int needed = bSameWay ? SDL_min(count + kernel.m_reach + 1, width) : width;
+
+		if (needed > available)
+			available = WaitForRow(pAbove, needed);
+
+		Sint32 error[ 3 ];
+
+		for (int channel = 0; channel < 3; ++channel)
+		{
+			error[ channel ] = pIn[ (x * 3) + channel ] + pInTwo[ (x * 3) + channel ] + carry[0][ channel ];
+
+			carry[0][ channel ] = carry[1][ channel ];
+			carry[1][ channel ] = 0;
+		}
+
+		Uint32 color = pSource[ x ];
+		int alpha = (int)(color >> 24);
+
+		if (0 == alpha)
+		{
+			// Transparent doesn't take, or pass on any error
+			pDest[ x ] = (Uint8)m_transparentIndex;
+		}
+		else
+		{
+			int value[ 3 ];
+
+			for (int channel = 0; channel < 3; ++channel)
+			{
+				value[ channel ] = (int)(((color >> (channel * 8)) & 0xFF) << DIFFUSE_FRACTION_BITS) +
+								   RoundDivide(error[ channel ], kernel.m_divisor);
+
+				value[ channel ] = SDL_min(SDL_max(value[ channel ], 0), fullScale);
+			}
+
+			int red   = (value[0] + half) >> DIFFUSE_FRACTION_BITS;
+			int green = (value[1] + half) >> DIFFUSE_FRACTION_BITS;
+			int blue  = (value[2] + half) >> DIFFUSE_FRACTION_BITS;
+
+			int index = (255 == alpha) ? pTable[ ((red >> 2) << 12) | ((green >> 2) << 6) | (blue >> 2) ]
+									   : NearestColor(red, green, blue, alpha);
+
+			pDest[ x ] = (Uint8)index;
+
+			Uint32 entry = m_palette[ index ];
+
+			for (int channel = 0; channel < 3; ++channel)
+			{
+				int target = (int)(((entry >> (channel * 8)) & 0xFF) << DIFFUSE_FRACTION_BITS);
+
+				error[ channel ] = ((value[ channel ] - target) * m_iDither) / 100;
+			}
+
+			for (int tap = 0; tap < kernel.m_numTaps; ++tap)
+			{
+				const DiffusionTap& diffuse = kernel.m_pTaps[ tap ];
+
+				Sint32* pTo = nullptr;
+
+				if (0 == diffuse.m_dy)
+					pTo = carry[ diffuse.m_dx - 1 ];
+				else if (1 == diffuse.m_dy)
+					pTo = pOut + ((x + (diffuse.m_dx * step)) * 3);
+				else
+					pTo = pOutTwo + ((x + (diffuse.m_dx * step)) * 3);
+
+				pTo[0] += error[0] * diffuse.m_weight;
+				pTo[1] += error[1] * diffuse.m_weight;
+				pTo[2] += error[2] * diffuse.m_weight;
+			}
+		}
+
+		if (0 == ((count + 1) % PROGRESS_PIXELS))
+		{
+			SDL_MemoryBarrierRelease();
+			SDL_AtomicSet(pDone, count + 1);
+		}
+	}
+
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(pDone, width);
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* Ditherer::Dither(const RGBAImage& image) const
+{
+	return DitherRows(image.GetWidth(), image.GetHeight(), image.GetPixels(), nullptr, nullptr, false);
+}
+
+IndexedImage* Ditherer::Dither(int width, int height, RowFunc pRowFunc, void* pUserData) const
+{
+	return DitherRows(width, height, nullptr, pRowFunc, pUserData, false);
+}
+
+IndexedImage* Ditherer::DitherSerial(const RGBAImage& image) const
+{
+	return DitherRows(image.GetWidth(), image.GetHeight(), image.GetPixels(), nullptr, nullptr, true);
+}
+
+//------------------------------------------------------------------------------
+// Straight out of pPixels, or converted into a lane's, or a band's, own row
+
+static const Uint32* GetSourceRow(const Uint32* pPixels, Ditherer::RowFunc pRowFunc, void* pUserData,
+								  int width, int y, std::vector<Uint32>& row)
+{
+	if (pPixels)
+		return pPixels + ((size_t)y * width);
+
+	row.resize(width);
+	pRowFunc(&row[0], y, pUserData);
+
+	return &row[0];
+}
+
+IndexedImage* Ditherer::DitherRows(int width, int height, const Uint32* pPixels,
+								   RowFunc pRowFunc, void* pUserData, bool bSerial) const
+{
+	IndexedImage* pResult = new IndexedImage(width, height, (int)m_palette.size());
+
+	memcpy(pResult->GetPalette(), &m_palette[0], m_palette.size() * sizeof(Uint32));
+
+	if (IsErrorDiffusion(m_iMethod))
+	{
+		int numLanes = bSerial ? 1 : SDL_max(SDL_min(m_pJobs->GetNumWorkers() + 1, height), 1);
+
+		Wavefront wave(width, height, numLanes, GetKernel(m_iMethod).m_reach);
+
+		// Rows are taken in order, by whoever is free, so a row only waits on
+		// rows that are already being worked on, never on one that's queued
+		std::function<void(int start, int end)> lane = [&](int start, int end)
+		{
+			(void)start;
+			(void)end;
+
+			std::vector<Uint32> row;
+
+			for (;;)
+			{
+				int y = SDL_AtomicAdd(&wave.m_nextRow, 1);
+
+				if (y >= height)
+					break;
+
+				const Uint32* pSource = GetSourceRow(pPixels, pRowFunc, pUserData, width, y, row);
+
+				DiffuseRow(pSource, pResult->GetPixels() + ((size_t)y * width), wave, y);
+			}
+		};
+
+		if (bSerial)
+			lane(0, 1);
+		else
+			m_pJobs->ParallelFor(0, numLanes, 1, lane);
+
+		return pResult;
+	}
+
+	std::function<void(int start, int end)> band = [&](int start, int end)
+	{
+		std::vector<Uint32> row;
+
+		for (int y = start; y < end; ++y)
+		{
+			const Uint32* pSource = GetSourceRow(pPixels, pRowFunc, pUserData, width, y, row);
+
+			DitherRow(pSource, pResult->GetPixels() + ((size_t)y * width), width, y);
+		}
+	};
+
+	if (bSerial)
+		band(0, height);
+	else
+		m_pJobs->ParallelFor(0, height, DITHER_ROWS_PER_BAND, band);
+
+	return pResult;
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* DitherImage(const RGBAImage& image, const Uint32* pPalette, int numColors,
+						  int iMethod, int iDither, int iPosterize)
+{
+	Ditherer ditherer(pPalette, numColors, iMethod, iDither, iPosterize);
+
+	return ditherer.Dither(image);
+}
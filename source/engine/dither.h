@@ -0,0 +1,135 @@
+//
+// Engine Dither - Remap an image to a palette it was quantized to
+//
+// eDitherDiffusion is libimagequant's own remap.  The ordered methods
+// here add a threshold from a small tiled matrix to every pixel, so each
+// pixel only depends on itself, and where it is, rows go out to the
+// workers in bands, and a pixel that doesn't change, doesn't shimmer from
+// frame to frame.  Bayer matrices spread the pattern out, clustered dot
+// ones grow it from the middle, like a halftone screen, and blue noise
+// (see bluenoise.h) scatters it, so it looks close to error diffusion.
+//
+// The error diffusion kernels here (Floyd-Steinberg, Atkinson, Sierra
+// Lite, and Jarvis-Judice-Ninke) are fixed point, and run as a wavefront,
+// each row a few pixels behind the one above it, so a worker per row can
+// go at once.  Every error buffer has one writer, and a pixel is only read
+// once everything that sends to it is done, so the output is the same,
+// however many workers there are.  Direction flips every few rows
+// (serpentine), but not every row, a row going the other way has to wait
+// for the whole row above.  "d16 bench dither" checks it.
+//
+// The threshold spread comes from the palette (half again the distance to
+// each color's nearest neighbor, on average), in whole posterize steps (17
+// for 444, about 8 for 555), times the dither percentage.
+//
+#ifndef ENGINE_DITHER_H_
+#define ENGINE_DITHER_H_
+
+#include "pixels.h"
+
+#include <vector>
+
+class JobSystem;
+
+enum DitherMethods
+{
+	eDitherDiffusion,  // libimagequant
+	eDitherBayer2,
+	eDitherBayer4,
+	eDitherBayer8,
+	eDitherCluster4,
+	eDitherCluster8,
+	eDitherBlueNoise,
+	eDitherFloyd,
+	eDitherAtkinson,
+	eDitherSierraLite,
+	eDitherJJN,
+
+	eNumDitherMethods
+};
+
+// Get a dither method from a name like "diffusion", "bayer4", "cluster8",
+// "bluenoise", "floyd", "atkinson", "sierralite", or "jjn" (or
+// "eDitherBayer4")
+// returns -1 if the name is not known
+int DitherFromName(const char* pName);
+
+// Short name, for the UI, and for printing settings
+const char* GetDitherName(int iMethod);
+
+// Bayer, clustered dot, and blue noise
+bool IsOrderedDither(int iMethod);
+
+// Our own error diffusion kernels, not eDitherDiffusion
+bool IsErrorDiffusion(int iMethod);
+
+//------------------------------------------------------------------------------
+//
+// Sets up the matrix, or the kernel, and a nearest color table (6 bits
+// per channel), for one palette, then dithers as many images to it as you
+// like, from as many threads as you like
+//
+class Ditherer
+{
+public:
+	// The color table, and every Dither, go on pJobs, or the default JobSystem
+	Ditherer(const Uint32* pPalette, int numColors, int iMethod, int iDither, int iPosterize,
+			 JobSystem* pJobs = nullptr);
+
+	// Rows in parallel, the result has the palette, eDitherDiffusion is
+	// treated as eDitherFloyd
+	IndexedImage* Dither(const RGBAImage& image) const;
+
+	// Fills pDest (width pixels) with a row of the source, as RGBA, called
+	// from the workers, like liq_image_create_custom's rows
+	typedef void (*RowFunc)(Uint32* pDest, int row, void* pUserData);
+
+	// Same, the source comes a row at a time from pRowFunc, so there doesn't
+	// have to be a copy of the whole image
+	IndexedImage* Dither(int width, int height, RowFunc pRowFunc, void* pUserData) const;
+
+	// One row after another, on the calling thread, what the parallel runs
+	// are checked against
+	IndexedImage* DitherSerial(const RGBAImage& image) const;
+
+	// How far apart the thresholds go, 0-255
+	int GetSpread() const { return m_spread; }
+
+private:
+	struct Wavefront;
+
+	// pPixels, or if that's nullptr, pRowFunc
+	IndexedImage* DitherRows(int width, int height, const Uint32* pPixels,
+							 RowFunc pRowFunc, void* pUserData, bool bSerial) const;
+
+	void BuildColorTable();
+	void DitherRow(const Uint32* pSource, Uint8* pDest, int width, int y) const;
+	void DiffuseRow(const Uint32* pSource, Uint8* pDest, Wavefront& wave, int y) const;
+	int NearestColor(int r, int g, int b, int a) const;
+
+	JobSystem* m_pJobs;
+
+	std::vector<Uint32> m_palette;
+
+	int m_iMethod;
+	int m_iDither;
+
+	int m_matrixSize;
+	int m_offsetPixels;
+	int m_spread;
+	int m_transparentIndex;
+
+	// Per matrix row, m_offsetPixels of RGBA offsets (A is always 0), split
+	// into what gets added, and what gets taken away, so saturating adds work
+	std::vector<Uint8> m_addOffsets;
+	std::vector<Uint8> m_subOffsets;
+
+	// Opaque RGB, 6 bits each, to a palette index
+	std::vector<Uint8> m_colorTable;
+};
+
+// Same, for one image
+IndexedImage* DitherImage(const RGBAImage& image, const Uint32* pPalette, int numColors,
+						  int iMethod, int iDither, int iPosterize);
+
+#endif // ENGINE_DITHER_H_
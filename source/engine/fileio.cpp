@@ -0,0 +1,342 @@
+//
+// Engine File IO - Getting images in, and results back out to disk
+//
+#include "fileio.h"
+
+#include "ilbm.h"
+#include "packbytes.h"
+#include "pngwriter.h"
+#include "shr.h"
+
+#include <SDL_image.h>
+
+#include <stdio.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+
+static RGBAImage* IndexedToRGBA(const IndexedImage& image)
+{
+	RGBAImage* pImage = new RGBAImage(image.GetWidth(), image.GetHeight());
+
+	const Uint8* pIn = image.GetPixels();
+	const Uint32* pClut = image.GetPalette();
+	Uint32* pOut = pImage->GetPixels();
+
+	for (int idx = 0; idx < image.GetWidth() * image.GetHeight(); ++idx)
+	{
+		pOut[ idx ] = pClut[ pIn[ idx ] ];
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+
+RGBAImage* LoadRGBAImage(const std::string& filenamepath)
+{
+	if (IsILBMFile(filenamepath))
+	{
+		IndexedImage* pIndexed = LoadILBMImage(filenamepath);
+
+		if (pIndexed)
+		{
+			RGBAImage* pImage = IndexedToRGBA(*pIndexed);
+			delete pIndexed;
+			return pImage;
+		}
+
+		// HAM, 24 bit, and the rest, SDL_image might still manage
+	}
+
+	if (IsSHRFile(filenamepath))
+	{
+		SHRImage* pSHR = LoadSHRImage(filenamepath);
+		RGBAImage* pImage = pSHR ? pSHR->CreateRGBA() : nullptr;
+
+		delete pSHR;
+
+		return pImage;
+	}
+
+	SDL_Surface* pSurface = IMG_Load(filenamepath.c_str());
+
+	if (nullptr == pSurface)
+	{
+		D16_SetError("IMG_Load: %s", IMG_GetError());
+		return nullptr;
+	}
+
+	RGBAImage* pImage = RGBAImage::FromSurface(pSurface);
+
+	SDL_FreeSurface(pSurface);
+
+	return pImage;
+}
+
+RGBAImage* LoadRGBAImage(const void* pData, size_t numBytes)
+{
+	if ((numBytes >= 4) && (0 == memcmp(pData, "FORM", 4)))
+	{
+		IndexedImage* pIndexed = LoadILBMImage((const Uint8*)pData, numBytes);
+
+		if (pIndexed)
+		{
+			RGBAImage* pImage = IndexedToRGBA(*pIndexed);
+			delete pIndexed;
+			return pImage;
+		}
+	}
+
+	SDL_RWops* pRW = SDL_RWFromConstMem(pData, (int)numBytes);
+
+	if (nullptr == pRW)
+	{
+		D16_SetError("LoadRGBAImage: %s", SDL_GetError());
+		return nullptr;
+	}
+
+	// Frees pRW
+	SDL_Surface* pSurface = IMG_Load_RW(pRW, 1);
+
+	if (nullptr == pSurface)
+	{
+		std::string error = IMG_GetError();
+
+		// No name to go on, so Super Hi-Res is the last thing to try
+		SHRImage* pSHR = LoadSHRImage((const Uint8*)pData, numBytes);
+
+		if (pSHR)
+		{
+			RGBAImage* pImage = pSHR->CreateRGBA();
+			delete pSHR;
+			return pImage;
+		}
+
+		D16_SetError("IMG_Load: %s", error.c_str());
+		return nullptr;
+	}
+
+	RGBAImage* pImage = RGBAImage::FromSurface(pSurface);
+
+	SDL_FreeSurface(pSurface);
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+
+Uint16 RGBAToIIgsColor(Uint32 rgba)
+{
+	Uint16 color = (Uint16)(((rgba>>4) & 0xF) << 8); // Red
+
+	color |= (Uint16) (((rgba>>12) & 0xF) << 4); // Green
+	color |= (Uint16) (((rgba>>20) & 0xF) << 0); // Blue
+
+	return color;
+}
+
+//------------------------------------------------------------------------------
+
+void BuildC1(const IndexedImage& image, unsigned char* c1data)
+{
+	memset(c1data, 0, 0x8000 );
+
+	// Nibblized pixel data
+	for (int y = 0; y < 200; ++y)
+	{
+		for (int x = 0; x < 320; x+=2)
+		{
+			Uint32 index0 = image.GetIndex(x, y) & 0xF;
+			Uint32 index1 = image.GetIndex(x+1, y) & 0xF;
+
+			c1data[ (y * 160) + (x>>1) ] = (unsigned char) (index1 | (index0<<4));
+		}
+	}
+
+	// Color Data, little endian words
+	unsigned char* pPal = &c1data[ 0x7E00 ];
+	const Uint32* pClut = image.GetPalette();
+
+	for (int idx = 0; (idx < 16) && (idx < image.GetNumColors()); ++idx)
+	{
+		Uint16 targetColor = RGBAToIIgsColor(pClut[ idx ]);
+
+		pPal[ (idx * 2) + 0 ] = (unsigned char)(targetColor & 0xFF);
+		pPal[ (idx * 2) + 1 ] = (unsigned char)(targetColor >> 8);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+bool SaveC1(const IndexedImage& image, const std::string& filenamepath)
+{
+	// Copy of the C1 memory
+	std::vector<unsigned char> c1data( 0x8000 );
+
+	BuildC1(image, &c1data[0]);
+
+	// Serialize to disk
+	FILE* file = fopen(filenamepath.c_str(), "wb");
+
+	if (nullptr == file)
+	{
+		D16_SetError("SaveC1: Unable to open %s", filenamepath.c_str());
+		return false;
+	}
+
+	size_t written = fwrite(&c1data[0], 1, c1data.size(), file);
+
+	fclose(file);
+
+	if (written != c1data.size())
+	{
+		D16_SetError("SaveC1: Unable to write %s", filenamepath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool EncodePNT(const IndexedImage& image, std::vector<Uint8>& data)
+{
+	std::vector<Uint8> c1data( 0x8000 );
+
+	BuildC1(image, &c1data[0]);
+
+	data.clear();
+	PackBytes(&c1data[0], c1data.size(), data);
+
+	// Anything that goes out, has to come back exactly
+	std::vector<Uint8> unpacked( 0x8000 );
+
+	if ((UnpackBytes(&data[0], data.size(), &unpacked[0], unpacked.size()) != data.size()) ||
+		(0 != memcmp(&unpacked[0], &c1data[0], c1data.size())))
+	{
+		D16_SetError("EncodePNT: PackBytes didn't round trip");
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool SavePNT(const IndexedImage& image, const std::string& filenamepath)
+{
+	std::vector<Uint8> data;
+
+	if (!EncodePNT(image, data))
+		return false;
+
+	FILE* file = fopen(filenamepath.c_str(), "wb");
+
+	if (nullptr == file)
+	{
+		D16_SetError("SavePNT: Unable to open %s", filenamepath.c_str());
+		return false;
+	}
+
+	size_t written = fwrite(&data[0], 1, data.size(), file);
+
+	fclose(file);
+
+	if (written != data.size())
+	{
+		D16_SetError("SavePNT: Unable to write %s", filenamepath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool EncodeAPF(const IndexedImage& image, std::vector<Uint8>& data)
+{
+	SHRImage* pSHR = SHRImage::FromIndexed(image);
+
+	bool bResult = pSHR && EncodeAPF(*pSHR, data);
+
+	delete pSHR;
+
+	return bResult;
+}
+
+bool SaveAPF(const IndexedImage& image, const std::string& filenamepath)
+{
+	SHRImage* pSHR = SHRImage::FromIndexed(image);
+
+	bool bResult = pSHR && SaveAPF(*pSHR, filenamepath);
+
+	delete pSHR;
+
+	return bResult;
+}
+
+//------------------------------------------------------------------------------
+
+bool SavePNG(const IndexedImage& image, const std::string& filenamepath, int level)
+{
+	std::vector<Uint8> data;
+
+	if (!EncodePNG(image, data, level))
+		return false;
+
+	FILE* file = fopen(filenamepath.c_str(), "wb");
+
+	if (nullptr == file)
+	{
+		D16_SetError("SavePNG: Unable to open %s", filenamepath.c_str());
+		return false;
+	}
+
+	size_t written = fwrite(&data[0], 1, data.size(), file);
+
+	fclose(file);
+
+	if (written != data.size())
+	{
+		D16_SetError("SavePNG: Unable to write %s", filenamepath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool EncodePNG(const IndexedImage& image, std::vector<Uint8>& data, int level)
+{
+	return EncodeIndexedPNG(image, level, data);
+}
+
+//------------------------------------------------------------------------------
+// For now, I'm just making this easy
+// and using what SDL gave me
+
+bool SavePNG(const RGBAImage& image, const std::string& filenamepath)
+{
+	SDL_Surface* pSurface = image.CreateSurface();
+
+	if (nullptr == pSurface)
+	{
+		D16_SetError("SavePNG: %s", SDL_GetError());
+		return false;
+	}
+
+	bool bResult = true;
+
+	if (IMG_SavePNG(pSurface, filenamepath.c_str()) < 0)
+	{
+		D16_SetError("IMG_SavePNG: %s", IMG_GetError());
+		bResult = false;
+	}
+
+	SDL_FreeSurface(pSurface);
+
+	return bResult;
+}
+
+//------------------------------------------------------------------------------
+
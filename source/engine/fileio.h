@@ -0,0 +1,51 @@
+//
+// Engine File IO - Getting images in, and results back out to disk
+//
+#ifndef ENGINE_FILEIO_H_
+#define ENGINE_FILEIO_H_
+
+#include "pixels.h"
+#include "deflate.h"
+
+#include <string>
+
+// Anything SDL_image can load, and Super Hi-Res files (see shr.h),
+// converted into RGBA
+RGBAImage* LoadRGBAImage(const std::string& filenamepath);
+
+// Same, from a file that is already in memory
+RGBAImage* LoadRGBAImage(const void* pData, size_t numBytes);
+
+// Apple IIgs $C1/$0000, 320x200 16 colors, one palette, 32K
+// Images that are not 320x200 are clamped to the edges
+bool SaveC1(const IndexedImage& image, const std::string& filenamepath);
+
+// Build the raw $C1 memory image, c1data needs to be 0x8000 bytes
+void BuildC1(const IndexedImage& image, unsigned char* c1data);
+
+// Apple IIgs $C0/$0001, the same 32K as $C1, PackBytes compressed.  The
+// packed bytes are unpacked, and checked against the original, before
+// they're handed back, or written
+bool SavePNT(const IndexedImage& image, const std::string& filenamepath);
+bool EncodePNT(const IndexedImage& image, std::vector<Uint8>& data);
+
+// Apple IIgs $C0/$0002, Apple Preferred Format, any size, one palette per
+// 16 colors (see SHRImage::FromIndexed), PackBytes compressed per line
+bool SaveAPF(const IndexedImage& image, const std::string& filenamepath);
+bool EncodeAPF(const IndexedImage& image, std::vector<Uint8>& data);
+
+// Indexed images go through our own writer (pngwriter.h), level is 0-9,
+// like zlib, RGBA ones through SDL_image
+bool SavePNG(const IndexedImage& image, const std::string& filenamepath,
+			 int level = eDeflateDefault);
+bool SavePNG(const RGBAImage& image, const std::string& filenamepath);
+
+// The bytes of the PNG file, without going to disk
+bool EncodePNG(const IndexedImage& image, std::vector<Uint8>& data,
+			   int level = eDeflateDefault);
+
+// Apple IIgs 12 bit color $0RGB, just doing a floor conversion
+Uint16 RGBAToIIgsColor(Uint32 rgba);
+
+#endif // ENGINE_FILEIO_H_
+
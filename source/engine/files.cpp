@@ -0,0 +1,291 @@
+//
+// Engine Files - Finding images on disk, and building output paths
+//
+#include "files.h"
+
+#include "shr.h"
+
+#include "dirent.h"
+
+#include <algorithm>
+#include <ctype.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <sys/utime.h>
+#define d16_mkdir(path) _mkdir(path)
+#else
+#include <utime.h>
+#define d16_mkdir(path) mkdir(path, 0777)
+#endif
+
+//------------------------------------------------------------------------------
+
+bool IsImageFile(const std::string& filenamepath)
+{
+	if (IsSHRFile(filenamepath))
+		return true;
+
+	static const char* extensions[] =
+	{
+		"png", "jpg", "jpeg", "bmp", "gif", "tga", "tif", "tiff", "webp",
+		"pcx", "lbm", "iff", "xpm", "pnm", "ppm", "pgm", "pbm"
+	};
+
+	size_t dot = filenamepath.find_last_of('.');
+
+	if (std::string::npos == dot)
+		return false;
+
+	std::string ext = filenamepath.substr(dot + 1);
+
+	for (size_t idx = 0; idx < ext.size(); ++idx)
+	{
+		ext[ idx ] = (char)tolower(ext[ idx ]);
+	}
+
+	for (int idx = 0; idx < (int)(sizeof(extensions)/sizeof(extensions[0])); ++idx)
+	{
+		if (ext == extensions[ idx ])
+			return true;
+	}
+
+	return false;
+}
+
+//------------------------------------------------------------------------------
+
+bool IsDirectory(const std::string& path)
+{
+	struct stat info;
+
+	if (0 != stat(path.c_str(), &info))
+		return false;
+
+	return 0 != (info.st_mode & S_IFDIR);
+}
+
+bool FileExists(const std::string& path)
+{
+	struct stat info;
+
+	return 0 == stat(path.c_str(), &info);
+}
+
+long long GetModifiedTime(const std::string& path)
+{
+	struct stat info;
+
+	if (0 != stat(path.c_str(), &info))
+		return 0;
+
+	return (long long)info.st_mtime;
+}
+
+long long GetFileSize(const std::string& path)
+{
+	struct stat info;
+
+	if (0 != stat(path.c_str(), &info))
+		return -1;
+
+	return (long long)info.st_size;
+}
+
+bool TouchFile(const std::string& path)
+{
+	// null, means now
+	return 0 == utime(path.c_str(), nullptr);
+}
+
+//------------------------------------------------------------------------------
+
+void CollectImageFiles(const std::string& directory, bool bRecursive,
+					   std::vector<std::string>& files)
+{
+	struct dirent **entries = nullptr;
+	int count = scandir(directory.c_str(), &entries, nullptr, alphasort);
+
+	for (int idx = 0; idx < count; ++idx)
+	{
+		struct dirent *ent = entries[idx];
+
+		std::string name = ent->d_name;
+
+		if (("." != name) && (".." != name))
+		{
+			std::string path = JoinPath(directory, name);
+
+			bool bDirectory = (DT_DIR == ent->d_type);
+#ifdef DT_UNKNOWN
+			// Some file systems don't fill in d_type
+			if (DT_UNKNOWN == ent->d_type)
+				bDirectory = IsDirectory(path);
+#endif
+			if (bDirectory)
+			{
+				if (bRecursive)
+					CollectImageFiles(path, bRecursive, files);
+			}
+			else if (IsImageFile(name))
+			{
+				files.push_back(path);
+			}
+		}
+
+		free(ent);
+	}
+
+	free(entries);
+}
+
+//------------------------------------------------------------------------------
+
+void CollectFiles(const std::string& directory, bool bRecursive,
+				  std::vector<std::string>& files)
+{
+	struct dirent **entries = nullptr;
+	int count = scandir(directory.c_str(), &entries, nullptr, alphasort);
+
+	for (int idx = 0; idx < count; ++idx)
+	{
+		struct dirent *ent = entries[idx];
+
+		std::string name = ent->d_name;
+
+		if (("." != name) && (".." != name))
+		{
+			std::string path = JoinPath(directory, name);
+
+			bool bDirectory = (DT_DIR == ent->d_type);
+#ifdef DT_UNKNOWN
+			if (DT_UNKNOWN == ent->d_type)
+				bDirectory = IsDirectory(path);
+#endif
+			if (bDirectory)
+			{
+				if (bRecursive)
+					CollectFiles(path, bRecursive, files);
+			}
+			else
+			{
+				files.push_back(path);
+			}
+		}
+
+		free(ent);
+	}
+
+	free(entries);
+}
+
+//------------------------------------------------------------------------------
+
+void CollectDirectories(const std::string& directory, std::vector<std::string>& directories)
+{
+	struct dirent **entries = nullptr;
+	int count = scandir(directory.c_str(), &entries, nullptr, alphasort);
+
+	for (int idx = 0; idx < count; ++idx)
+	{
+		struct dirent *ent = entries[idx];
+
+		std::string name = ent->d_name;
+
+		if (("." != name) && (".." != name))
+		{
+			std::string path = JoinPath(directory, name);
+
+			bool bDirectory = (DT_DIR == ent->d_type);
+#ifdef DT_UNKNOWN
+			if (DT_UNKNOWN == ent->d_type)
+				bDirectory = IsDirectory(path);
+#endif
+			if (bDirectory)
+			{
+				directories.push_back(path);
+				CollectDirectories(path, directories);
+			}
+		}
+
+		free(ent);
+	}
+
+	free(entries);
+}
+
+//------------------------------------------------------------------------------
+
+static size_t FindLastSeparator(const std::string& filenamepath)
+{
+	return filenamepath.find_last_of("/\\");
+}
+
+std::string GetFileName(const std::string& filenamepath)
+{
+	size_t separator = FindLastSeparator(filenamepath);
+
+	if (std::string::npos == separator)
+		return filenamepath;
+
+	return filenamepath.substr(separator + 1);
+}
+
+std::string GetDirectory(const std::string& filenamepath)
+{
+	size_t separator = FindLastSeparator(filenamepath);
+
+	if (std::string::npos == separator)
+		return ".";
+
+	return filenamepath.substr(0, separator);
+}
+
+std::string RemoveExtension(const std::string& filenamepath)
+{
+	size_t dot = filenamepath.find_last_of('.');
+	size_t separator = FindLastSeparator(filenamepath);
+
+	if ((std::string::npos == dot) ||
+		((std::string::npos != separator) && (dot < separator)))
+	{
+		return filenamepath;
+	}
+
+	return filenamepath.substr(0, dot);
+}
+
+std::string JoinPath(const std::string& directory, const std::string& filename)
+{
+	if (directory.empty())
+		return filename;
+
+	char last = directory[ directory.size() - 1 ];
+
+	if (('/' == last) || ('\\' == last))
+		return directory + filename;
+
+	return directory + "/" + filename;
+}
+
+//------------------------------------------------------------------------------
+
+bool MakeDirectories(const std::string& path)
+{
+	if (path.empty() || IsDirectory(path))
+		return true;
+
+	std::string parent = GetDirectory(path);
+
+	if ((parent != path) && (parent != ".") && !MakeDirectories(parent))
+		return false;
+
+	// Another thread might have just made it
+	return (0 == d16_mkdir(path.c_str())) || (EEXIST == errno) || IsDirectory(path);
+}
+
+//------------------------------------------------------------------------------
+
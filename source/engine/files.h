@@ -0,0 +1,48 @@
+//
+// Engine Files - Finding images on disk, and building output paths
+//
+#ifndef ENGINE_FILES_H_
+#define ENGINE_FILES_H_
+
+#include <string>
+#include <vector>
+
+// Does the extension look like something SDL_image, or the Super Hi-Res
+// readers can load?
+bool IsImageFile(const std::string& filenamepath);
+
+bool IsDirectory(const std::string& path);
+bool FileExists(const std::string& path);
+
+// Last modified time, in seconds, 0 if the file isn't there
+long long GetModifiedTime(const std::string& path);
+
+// Size in bytes, -1 if the file isn't there
+long long GetFileSize(const std::string& path);
+
+// Set the modified time to now
+bool TouchFile(const std::string& path);
+
+// Add every image in a directory to files, optionally going down into
+// sub-directories, results are sorted, so runs are repeatable
+void CollectImageFiles(const std::string& directory, bool bRecursive,
+					   std::vector<std::string>& files);
+
+// Add every file, whatever it is, to files
+void CollectFiles(const std::string& directory, bool bRecursive,
+				  std::vector<std::string>& files);
+
+// Add every sub-directory (not including directory itself) to directories
+void CollectDirectories(const std::string& directory, std::vector<std::string>& directories);
+
+// Both '/' and '\\' count as separators
+std::string GetFileName(const std::string& filenamepath);      // "dir/name.png" -> "name.png"
+std::string GetDirectory(const std::string& filenamepath);     // "dir/name.png" -> "dir"
+std::string RemoveExtension(const std::string& filenamepath);  // "dir/name.png" -> "dir/name"
+std::string JoinPath(const std::string& directory, const std::string& filename);
+
+// mkdir -p
+bool MakeDirectories(const std::string& path);
+
+#endif // ENGINE_FILES_H_
+
@@ -0,0 +1,651 @@
+//
+// Engine Frames - Animated GIFs, and numbered image sequences
+//
+#include "frames.h"
+
+#include "fileio.h"
+#include "files.h"
+#include "jobs.h"
+#include "mappedfile.h"
+
+#include <algorithm>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Past these, it's more likely a broken file than an animation
+static const int GIF_MAX_SIZE = 16384;
+static const long long GIF_MAX_TOTAL_PIXELS = 1LL << 28;   // all the frames
+
+// Graphic Control Extension, what happens to a frame's area after it's shown
+enum
+{
+	eDisposeNone,          // unspecified, left as it is
+	eDisposeKeep,
+	eDisposeBackground,    // cleared, to transparent, like browsers do
+	eDisposePrevious       // put back to what was there before
+};
+
+//------------------------------------------------------------------------------
+
+static Uint16 ReadLittleWord(const Uint8* pData)
+{
+	return (Uint16)(pData[0] | (pData[1] << 8));
+}
+
+// Where the block after the sub-blocks at pos starts, pBytes (if there is
+// one) gets the data.  numBytes if the file ends first
+static size_t ReadSubBlocks(const Uint8* pData, size_t numBytes, size_t pos,
+							std::vector<Uint8>* pBytes)
+{
+	while (pos < numBytes)
+	{
+		size_t count = pData[ pos++ ];
+
+		if (0 == count)
+			return pos;
+
+		if (pos + count > numBytes)
+			count = numBytes - pos;
+
+		if (pBytes)
+			pBytes->insert(pBytes->end(), pData + pos, pData + pos + count);
+
+		pos += count;
+	}
+
+	return numBytes;
+}
+
+// Color table, as RGBA
+static size_t ReadColorTable(const Uint8* pData, size_t numBytes, size_t pos,
+							 int numColors, std::vector<Uint32>& colors)
+{
+	colors.assign(256, 0xFF000000);
+
+	for (int idx = 0; (idx < numColors) && (pos + 3 <= numBytes); ++idx, pos += 3)
+	{
+		colors[ idx ] = pData[pos] | (pData[pos+1] << 8) | (pData[pos+2] << 16) | 0xFF000000;
+	}
+
+	return pos;
+}
+
+//------------------------------------------------------------------------------
+// Variable length LZW, up to 12 bit codes.  Returns how many indexes it got,
+// which is less than numPixels if the data is short, or goes bad
+
+static size_t DecodeLZW(const Uint8* pSrc, size_t srcBytes, int minCodeSize,
+						Uint8* pDst, size_t numPixels)
+{
+	if ((minCodeSize < 1) || (minCodeSize > 11))
+		return 0;
+
+	const int clearCode = 1 << minCodeSize;
+	const int endCode = clearCode + 1;
+
+	Uint16 prefix[ 4096 ];
+	Uint8  suffix[ 4096 ];
+	Uint8  stack[ 4097 ];
+
+	for (int idx = 0; idx < clearCode; ++idx)
+	{
+		prefix[ idx ] = 0;
+		suffix[ idx ] = (Uint8)idx;
+	}
+
+	int codeSize = minCodeSize + 1;
+	int codeMask = (1 << codeSize) - 1;
+	int nextCode = clearCode + 2;
+	int oldCode = -1;
+	Uint8 firstByte = 0;
+
+	Uint32 bits = 0;
+	int numBits = 0;
+	size_t in = 0;
+	size_t out = 0;
+
+	while (out < numPixels)
+	{
+		while (numBits < codeSize)
+		{
+			if (in >= srcBytes)
+				return out;
+
+			bits |= (Uint32)pSrc[ in++ ] << numBits;
+			numBits += 8;
+		}
+
+		int code = bits & codeMask;
+		bits >>= codeSize;
+		numBits -= codeSize;
+
+		if (clearCode == code)
+		{
+			codeSize = minCodeSize + 1;
+			codeMask = (1 << codeSize) - 1;
+			nextCode = clearCode + 2;
+			oldCode = -1;
+			continue;
+		}
+
+		if (endCode == code)
+			break;
+
+		if (oldCode < 0)
+		{
+			if (code >= clearCode)
+				break;
+
+			pDst[ out++ ] = (Uint8)code;
+			oldCode = code;
+			firstByte = (Uint8)code;
+			continue;
+		}
+
+		if (code > nextCode)
+			break;
+
+		int newCode = code;
+		int depth = 0;
+
+		// The code that's being defined right now, KwKwK
+		if (code == nextCode)
+		{
+			stack[ depth++ ] = firstByte;
+			code = oldCode;
+		}
+
+		while (code >= clearCode)
+		{
+			stack[ depth++ ] = suffix[ code ];
+			code = prefix[ code ];
+		}
+
+		firstByte = suffix[ code ];
+		stack[ depth++ ] = firstByte;
+
+		// A full table stays as it is, until the next clear
+		if (nextCode < 4096)
+		{
+			prefix[ nextCode ] = (Uint16)oldCode;
+			suffix[ nextCode ] = firstByte;
+			++nextCode;
+
+			if ((nextCode > codeMask) && (codeSize < 12))
+			{
+				++codeSize;
+				codeMask = (1 << codeSize) - 1;
+			}
+		}
+
+		oldCode = newCode;
+
+		while ((depth > 0) && (out < numPixels))
+		{
+			pDst[ out++ ] = stack[ --depth ];
+		}
+	}
+
+	return out;
+}
+
+//------------------------------------------------------------------------------
+
+bool LoadGIFFrames(const Uint8* pData, size_t numBytes, std::vector<RGBAImage*>& frames,
+				   std::vector<int>* pDelays)
+{
+	if ((numBytes < 13) ||
+		((0 != memcmp(pData, "GIF87a", 6)) && (0 != memcmp(pData, "GIF89a", 6))))
+	{
+		D16_SetError("LoadGIFFrames: not a GIF file");
+		return false;
+	}
+
+	int width = ReadLittleWord(pData + 6);
+	int height = ReadLittleWord(pData + 8);
+	int flags = pData[ 10 ];
+
+	size_t pos = 13;
+
+	std::vector<Uint32> globalColors;
+	bool bGlobalColors = (0 != (flags & 0x80));
+
+	if (bGlobalColors)
+		pos = ReadColorTable(pData, numBytes, pos, 2 << (flags & 7), globalColors);
+
+	std::vector<Uint32> canvas;
+	std::vector<Uint32> previous;
+	std::vector<Uint32> localColors;
+	std::vector<Uint8> lzw;
+	std::vector<Uint8> indexes;
+	std::vector<int> rows;
+
+	// From the last Graphic Control Extension, for the next image
+	int disposal = eDisposeNone;
+	int transparent = -1;
+	int delay = 0;
+
+	size_t numFrames = frames.size();
+	long long totalPixels = 0;
+
+	bool bDone = false;
+	bool bError = false;
+
+	while (!bDone && (pos < numBytes))
+	{
+		int block = pData[ pos++ ];
+
+		switch (block)
+		{
+		case 0x21:   // Extension
+			{
+				if (pos >= numBytes)
+				{
+					bDone = true;
+					break;
+				}
+
+				int label = pData[ pos++ ];
+
+				if ((0xF9 == label) && (pos + 5 <= numBytes) && (pData[ pos ] >= 4))
+				{
+					int packed = pData[ pos + 1 ];
+
+					disposal = (packed >> 2) & 7;
+					delay = ReadLittleWord(pData + pos + 2);
+					transparent = (packed & 1) ? pData[ pos + 4 ] : -1;
+				}
+
+				pos = ReadSubBlocks(pData, numBytes, pos, nullptr);
+			}
+			break;
+
+		case 0x2C:   // Image
+			{
+				if (pos + 9 > numBytes)
+				{
+					bDone = true;
+					break;
+				}
+
+				int left = ReadLittleWord(pData + pos);
+				int top = ReadLittleWord(pData + pos + 2);
+				int frameWidth = ReadLittleWord(pData + pos + 4);
+				int frameHeight = ReadLittleWord(pData + pos + 6);
+				int imageFlags = pData[ pos + 8 ];
+				pos += 9;
+
+				const std::vector<Uint32>* pColors = &globalColors;
+
+				if (imageFlags & 0x80)
+				{
+					pos = ReadColorTable(pData, numBytes, pos, 2 << (imageFlags & 7), localColors);
+					pColors = &localColors;
+				}
+				else if (!bGlobalColors)
+				{
+					D16_SetError("LoadGIFFrames: frame %d has no colors", (int)(frames.size() - numFrames));
+					bError = true;
+					bDone = true;
+					break;
+				}
+
+				if (pos >= numBytes)
+				{
+					bDone = true;
+					break;
+				}
+
+				int minCodeSize = pData[ pos++ ];
+
+				lzw.clear();
+				pos = ReadSubBlocks(pData, numBytes, pos, &lzw);
+
+				// The screen size doesn't limit the frames, so they're checked
+				// too, before anything is sized from them
+				if ((frameWidth > GIF_MAX_SIZE) || (frameHeight > GIF_MAX_SIZE))
+				{
+					D16_SetError("LoadGIFFrames: frame %d is %d x %d, that's too big",
+								 (int)(frames.size() - numFrames), frameWidth, frameHeight);
+					bError = true;
+					bDone = true;
+					break;
+				}
+
+				// Some encoders leave the screen size at 0, the first frame
+				// decides then
+				if (canvas.empty())
+				{
+					if ((0 == width) || (0 == height))
+					{
+						width = left + frameWidth;
+						height = top + frameHeight;
+					}
+
+					if ((width < 1) || (height < 1) || (width > GIF_MAX_SIZE) || (height > GIF_MAX_SIZE))
+					{
+						D16_SetError("LoadGIFFrames: %d x %d is not a size I can do", width, height);
+						bError = true;
+						bDone = true;
+						break;
+					}
+
+					canvas.assign((size_t)width * height, 0);
+				}
+
+				totalPixels += (long long)width * height;
+
+				if (totalPixels > GIF_MAX_TOTAL_PIXELS)
+				{
+					D16_SetError("LoadGIFFrames: too many frames, stopped at %d", (int)(frames.size() - numFrames));
+					bError = true;
+					bDone = true;
+					break;
+				}
+
+				if (eDisposePrevious == disposal)
+					previous = canvas;
+
+				size_t framePixels = (size_t)frameWidth * frameHeight;
+
+				// Rows below the canvas are thrown away, so they aren't
+				// decoded, unless it's interlaced, and they're mixed in
+				if (!(imageFlags & 0x40))
+				{
+					int visibleRows = SDL_max(0, SDL_min(frameHeight, height - top));
+
+					if (left >= width)
+						visibleRows = 0;
+
+					framePixels = (size_t)frameWidth * visibleRows;
+				}
+
+				indexes.resize(framePixels);
+
+				size_t decoded = framePixels ? DecodeLZW(lzw.empty() ? nullptr : &lzw[0], lzw.size(),
+														 minCodeSize, &indexes[0], framePixels) : 0;
+
+				// Interlaced rows come 0, 8, 16.., then 4, 12.., then 2, 6.., then the odd ones
+				rows.resize(frameHeight);
+
+				if (imageFlags & 0x40)
+				{
+					static const int starts[4] = { 0, 4, 2, 1 };
+					static const int steps[4]  = { 8, 8, 4, 2 };
+
+					int row = 0;
+
+					for (int pass = 0; pass < 4; ++pass)
+					{
+						for (int y = starts[ pass ]; y < frameHeight; y += steps[ pass ])
+						{
+							rows[ row++ ] = y;
+						}
+					}
+				}
+				else
+				{
+					for (int y = 0; y < frameHeight; ++y)
+					{
+						rows[ y ] = y;
+					}
+				}
+
+				const Uint32* pPalette = &(*pColors)[0];
+
+				for (size_t idx = 0; idx < decoded; ++idx)
+				{
+					int x = left + (int)(idx % frameWidth);
+					int y = top + rows[ idx / frameWidth ];
+
+					if ((x >= width) || (y >= height))
+						continue;
+
+					int index = indexes[ idx ];
+
+					if (index != transparent)
+						canvas[ ((size_t)y * width) + x ] = pPalette[ index ];
+				}
+
+				frames.push_back(new RGBAImage(&canvas[0], width, height));
+
+				if (pDelays)
+					pDelays->push_back(delay);
+
+				// Get ready for the next one
+				if (eDisposeBackground == disposal)
+				{
+					int x1 = SDL_min(left + frameWidth, width);
+					int y1 = SDL_min(top + frameHeight, height);
+
+					for (int y = top; y < y1; ++y)
+					{
+						for (int x = left; x < x1; ++x)
+						{
+							canvas[ ((size_t)y * width) + x ] = 0;
+						}
+					}
+				}
+				else if ((eDisposePrevious == disposal) && !previous.empty())
+				{
+					canvas.swap(previous);
+				}
+
+				disposal = eDisposeNone;
+				transparent = -1;
+				delay = 0;
+			}
+			break;
+
+		case 0x3B:   // Trailer
+			bDone = true;
+			break;
+
+		default:
+			// Garbage between the blocks, keep what we have
+			bDone = true;
+			break;
+		}
+	}
+
+	if (frames.size() == numFrames)
+	{
+		if (!bError)
+			D16_SetError("LoadGIFFrames: there are no frames");
+
+		return false;
+	}
+
+	return true;
+}
+
+bool LoadGIFFrames(const std::string& filenamepath, std::vector<RGBAImage*>& frames,
+				   std::vector<int>* pDelays)
+{
+	MappedFile file;
+
+	if (!file.Open(filenamepath))
+		return false;
+
+	return LoadGIFFrames(file.GetData(), file.GetSize(), frames, pDelays);
+}
+
+//------------------------------------------------------------------------------
+
+bool IsGIFFile(const std::string& filenamepath)
+{
+	size_t dot = filenamepath.find_last_of('.');
+
+	if (std::string::npos == dot)
+		return false;
+
+	std::string ext = filenamepath.substr(dot + 1);
+
+	for (size_t idx = 0; idx < ext.size(); ++idx)
+	{
+		ext[ idx ] = (char)tolower(ext[ idx ]);
+	}
+
+	return "gif" == ext;
+}
+
+//------------------------------------------------------------------------------
+// The last run of digits, before the extension, false if there isn't one
+
+static bool SplitSequenceName(const std::string& name, std::string& prefix, std::string& suffix)
+{
+	size_t end = name.find_last_of('.');
+
+	if (std::string::npos == end)
+		end = name.size();
+
+	while ((end > 0) && !isdigit((unsigned char)name[ end - 1 ]))
+		--end;
+
+	if (0 == end)
+		return false;
+
+	size_t start = end;
+
+	while ((start > 0) && isdigit((unsigned char)name[ start - 1 ]))
+		--start;
+
+	prefix = name.substr(0, start);
+	suffix = name.substr(end);
+
+	return true;
+}
+
+bool IsSequenceName(const std::string& filenamepath)
+{
+	std::string prefix, suffix;
+
+	return SplitSequenceName(GetFileName(filenamepath), prefix, suffix);
+}
+
+//------------------------------------------------------------------------------
+
+void FindFrameSequence(const std::string& filenamepath, std::vector<std::string>& files)
+{
+	files.clear();
+
+	std::string prefix, suffix;
+
+	if (!SplitSequenceName(GetFileName(filenamepath), prefix, suffix))
+	{
+		files.push_back(filenamepath);
+		return;
+	}
+
+	std::string directory = GetDirectory(filenamepath);
+
+	std::vector<std::string> candidates;
+	CollectFiles(directory, false, candidates);
+
+	// By number, so "frame9" comes before "frame10"
+	std::vector<std::pair<long long, std::string>> numbered;
+
+	for (size_t idx = 0; idx < candidates.size(); ++idx)
+	{
+		std::string name = GetFileName(candidates[ idx ]);
+
+		if (name.size() <= prefix.size() + suffix.size())
+			continue;
+
+		if ((0 != name.compare(0, prefix.size(), prefix)) ||
+			(0 != name.compare(name.size() - suffix.size(), suffix.size(), suffix)))
+		{
+			continue;
+		}
+
+		std::string digits = name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+
+		bool bDigits = true;
+
+		for (size_t digit = 0; digit < digits.size(); ++digit)
+		{
+			if (!isdigit((unsigned char)digits[ digit ]))
+				bDigits = false;
+		}
+
+		if (bDigits)
+			numbered.push_back(std::make_pair(strtoll(digits.c_str(), nullptr, 10), candidates[ idx ]));
+	}
+
+	std::stable_sort(numbered.begin(), numbered.end(),
+					 [](const std::pair<long long, std::string>& a, const std::pair<long long, std::string>& b)
+					 {
+						 return a.first < b.first;
+					 });
+
+	for (size_t idx = 0; idx < numbered.size(); ++idx)
+	{
+		files.push_back(numbered[ idx ].second);
+	}
+
+	// Couldn't list the directory
+	if (files.empty())
+		files.push_back(filenamepath);
+}
+
+//------------------------------------------------------------------------------
+
+bool LoadFrameSequence(const std::vector<std::string>& files, std::vector<RGBAImage*>& frames)
+{
+	int numFiles = (int)files.size();
+
+	if (0 == numFiles)
+	{
+		D16_SetError("LoadFrameSequence: no files");
+		return false;
+	}
+
+	std::vector<RGBAImage*> loaded(numFiles, nullptr);
+	std::vector<std::string> errors(numFiles);
+
+	// Errors are per thread, so each file keeps its own
+	JobSystem::GetDefault().ParallelFor(0, numFiles, 1, [&](int start, int end)
+	{
+		for (int idx = start; idx < end; ++idx)
+		{
+			loaded[ idx ] = LoadRGBAImage(files[ idx ]);
+
+			if (nullptr == loaded[ idx ])
+				errors[ idx ] = D16_GetError();
+		}
+	});
+
+	int failed = -1;
+
+	for (int idx = 0; (idx < numFiles) && (failed < 0); ++idx)
+	{
+		if (nullptr == loaded[ idx ])
+		{
+			D16_SetError("%s: %s", GetFileName(files[ idx ]).c_str(), errors[ idx ].c_str());
+			failed = idx;
+		}
+		else if ((loaded[ idx ]->GetWidth() != loaded[0]->GetWidth()) ||
+				 (loaded[ idx ]->GetHeight() != loaded[0]->GetHeight()))
+		{
+			D16_SetError("%s: is %d x %d, the first frame is %d x %d", GetFileName(files[ idx ]).c_str(),
+						 loaded[ idx ]->GetWidth(), loaded[ idx ]->GetHeight(),
+						 loaded[0]->GetWidth(), loaded[0]->GetHeight());
+			failed = idx;
+		}
+	}
+
+	if (failed >= 0)
+	{
+		for (int idx = 0; idx < numFiles; ++idx)
+		{
+			delete loaded[ idx ];
+		}
+
+		return false;
+	}
+
+	frames.insert(frames.end(), loaded.begin(), loaded.end());
+
+	return true;
+}
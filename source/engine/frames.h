@@ -0,0 +1,44 @@
+//
+// Engine Frames - Animated GIFs, and numbered image sequences
+//
+// SDL_image only hands back the first frame of a GIF, so GIFs are decoded
+// here, every frame composited onto the logical screen, the way a viewer
+// shows it (disposal, and transparency applied), so each frame stands on
+// its own.  Parts of the screen nothing has drawn on are transparent.
+//
+// A sequence is "walk_0001.png", "walk_0002.png", ..., every file in the
+// directory with the same name around the last run of digits, sorted by
+// the number, decoded in parallel.
+//
+#ifndef ENGINE_FRAMES_H_
+#define ENGINE_FRAMES_H_
+
+#include "pixels.h"
+
+#include <string>
+#include <vector>
+
+// .gif
+bool IsGIFFile(const std::string& filenamepath);
+
+// Every frame, the caller owns them, pDelays gets each frame's delay, in
+// 1/100ths of a second.  false, and D16_SetError if it isn't a GIF, or has
+// no frames, a file that's cut short keeps the frames it has
+bool LoadGIFFrames(const std::string& filenamepath, std::vector<RGBAImage*>& frames,
+				   std::vector<int>* pDelays = nullptr);
+bool LoadGIFFrames(const Uint8* pData, size_t numBytes, std::vector<RGBAImage*>& frames,
+				   std::vector<int>* pDelays = nullptr);
+
+// Does the name have a number to count with?
+bool IsSequenceName(const std::string& filenamepath);
+
+// The files in filenamepath's sequence, including itself, in order, just
+// filenamepath if its name doesn't have a number
+void FindFrameSequence(const std::string& filenamepath, std::vector<std::string>& files);
+
+// Decodes the files, in parallel, with LoadRGBAImage.  They all have to be
+// the same size as the first one.  false, and D16_SetError, with nothing
+// in frames, if any of them can't be loaded
+bool LoadFrameSequence(const std::vector<std::string>& files, std::vector<RGBAImage*>& frames);
+
+#endif // ENGINE_FRAMES_H_
@@ -0,0 +1,459 @@
+//
+// Engine ILBM - Deluxe Paint, and friends, IFF pictures
+//
+#include "ilbm.h"
+
+#include "mappedfile.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ILBM_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// BMHD
+enum
+{
+	eMaskNone,
+	eMaskHasMask,         // an extra plane, after the others
+	eMaskTransparent,
+	eMaskLasso
+};
+
+enum
+{
+	eCompressNone,
+	eCompressByteRun1
+};
+
+// Sizes are 16 bit, DPaint never went past 1024, these keep a damaged
+// BMHD from asking for gigabytes
+static const int ILBM_MAX_SIZE = 16384;
+static const long long ILBM_MAX_PIXELS = 1LL << 26;
+
+#define CAMG_EHB  0x0080
+#define CAMG_HAM  0x0800
+
+//------------------------------------------------------------------------------
+
+static Uint16 ReadBigWord(const Uint8* pData)
+{
+	return (Uint16)((pData[0] << 8) | pData[1]);
+}
+
+static Uint32 ReadBigLong(const Uint8* pData)
+{
+	return ((Uint32)pData[0] << 24) | ((Uint32)pData[1] << 16) |
+		   ((Uint32)pData[2] << 8) | (Uint32)pData[3];
+}
+
+//------------------------------------------------------------------------------
+
+// Unpacks a row at a time, a run that goes past the end of one Read
+// carries on into the next, the same as unpacking the whole body at once
+class ByteRun1Reader
+{
+public:
+	ByteRun1Reader(const Uint8* pSrc, size_t srcBytes)
+		: m_pSrc(pSrc)
+		, m_srcBytes(srcBytes)
+		, m_in(0)
+		, m_pLiteral(nullptr)
+		, m_numLiteral(0)
+		, m_numRepeat(0)
+		, m_repeat(0)
+	{
+	}
+
+	// Fills all of pDst, false if the data ran out first
+	bool Read(Uint8* pDst, size_t dstBytes);
+
+	// Packed bytes used so far, including all of the last run
+	size_t GetPosition() const { return m_in; }
+
+private:
+	const Uint8* m_pSrc;
+	size_t m_srcBytes;
+	size_t m_in;
+
+	const Uint8* m_pLiteral;
+	size_t m_numLiteral;   // still to copy
+	size_t m_numRepeat;    // m_repeat, still to write
+	Uint8 m_repeat;
+};
+
+bool ByteRun1Reader::Read(Uint8* pDst, size_t dstBytes)
+{
+	size_t out = 0;
+
+	while (out < dstBytes)
+	{
+		if (m_numLiteral)
+		{
+			size_t count = SDL_min(m_numLiteral, dstBytes - out);
+
+			memcpy(pDst + out, m_pLiteral, count);
+			m_pLiteral += count;
+			m_numLiteral -= count;
+			out += count;
+			continue;
+		}
+
+		if (m_numRepeat)
+		{
+			size_t count = SDL_min(m_numRepeat, dstBytes - out);
+
+			memset(pDst + out, m_repeat, count);
+			m_numRepeat -= count;
+			out += count;
+			continue;
+		}
+
+		if (m_in >= m_srcBytes)
+			return false;
+
+		int n = (Sint8)m_pSrc[ m_in++ ];
+
+		if (n >= 0)
+		{
+			size_t count = n + 1;
+
+			if (m_in + count > m_srcBytes)
+				return false;
+
+			m_pLiteral = m_pSrc + m_in;
+			m_numLiteral = count;
+			m_in += count;
+		}
+		else if (n != -128)
+		{
+			if (m_in >= m_srcBytes)
+				return false;
+
+			m_repeat = m_pSrc[ m_in++ ];
+			m_numRepeat = 1 - n;
+		}
+	}
+
+	return true;
+}
+
+// A run past the end is the file's problem, what fits is kept
+size_t UnpackByteRun1(const Uint8* pSrc, size_t srcBytes, Uint8* pDst, size_t dstBytes)
+{
+	ByteRun1Reader reader(pSrc, srcBytes);
+
+	return reader.Read(pDst, dstBytes) ? reader.GetPosition() : 0;
+}
+
+//------------------------------------------------------------------------------
+// One row, numPlanes rows of bits, rowBytes each, to one byte per pixel.
+// Pixel x takes bit (7 - (x & 7)) of byte (x >> 3) in every plane, plane
+// p giving bit p.  That's an 8x8 bit transpose, for every 8 pixels
+static void PlanarToChunky(const Uint8* const* pPlanes, int numPlanes, int width, Uint8* pOut)
+{
+	int x = 0;
+
+	#if ILBM_SSE2
+	// 16 pixels at a time.  Bytes 0-7 hold the first 8 pixels, from each
+	// plane, bytes 8-15 the next 8.  After shifting left by i, the top bit
+	// of every byte is bit (7 - i), and movemask gathers all 16 of them,
+	// pixel i of the first 8, in the low byte, of the second 8 in the high
+	for (; x + 16 <= width; x += 16)
+	{
+		Uint8 gathered[ 16 ] = { 0 };
+
+		for (int plane = 0; plane < numPlanes; ++plane)
+		{
+			gathered[ plane ]     = pPlanes[ plane ][ (x >> 3) + 0 ];
+			gathered[ plane + 8 ] = pPlanes[ plane ][ (x >> 3) + 1 ];
+		}
+
+		__m128i bits = _mm_loadu_si128((const __m128i*)gathered);
+
+		for (int idx = 0; idx < 8; ++idx)
+		{
+			int mask = _mm_movemask_epi8(_mm_slli_epi64(bits, idx));
+
+			pOut[ x + idx ]     = (Uint8)(mask & 0xFF);
+			pOut[ x + 8 + idx ] = (Uint8)(mask >> 8);
+		}
+	}
+	#endif
+
+	for (; x < width; ++x)
+	{
+		int shift = 7 - (x & 7);
+		Uint8 value = 0;
+
+		for (int plane = 0; plane < numPlanes; ++plane)
+		{
+			value |= (Uint8)(((pPlanes[ plane ][ x >> 3 ] >> shift) & 1) << plane);
+		}
+
+		pOut[ x ] = value;
+	}
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* LoadILBMImage(const Uint8* pData, size_t numBytes, int* pNumCMAPColors)
+{
+	if ((numBytes < 12) || (0 != memcmp(pData, "FORM", 4)))
+	{
+		D16_SetError("LoadILBMImage: not an IFF file");
+		return nullptr;
+	}
+
+	bool bPBM = (0 == memcmp(pData + 8, "PBM ", 4));
+
+	if (!bPBM && (0 != memcmp(pData + 8, "ILBM", 4)))
+	{
+		D16_SetError("LoadILBMImage: IFF, but not ILBM, or PBM");
+		return nullptr;
+	}
+
+	size_t formEnd = 8 + (size_t)ReadBigLong(pData + 4);
+
+	if (formEnd > numBytes)
+		formEnd = numBytes;   // truncated, see what's there
+
+	const Uint8* pBMHD = nullptr;
+	const Uint8* pCMAP = nullptr;
+	const Uint8* pBody = nullptr;
+	size_t cmapBytes = 0;
+	size_t bodyBytes = 0;
+	Uint32 camg = 0;
+
+	for (size_t pos = 12; pos + 8 <= formEnd; )
+	{
+		const Uint8* pChunk = pData + pos;
+		size_t length = ReadBigLong(pChunk + 4);
+		size_t available = formEnd - (pos + 8);
+
+		if (length > available)
+			length = available;
+
+		if (0 == memcmp(pChunk, "BMHD", 4) && (length >= 20))
+			pBMHD = pChunk + 8;
+		else if (0 == memcmp(pChunk, "CMAP", 4))
+		{
+			pCMAP = pChunk + 8;
+			cmapBytes = length;
+		}
+		else if (0 == memcmp(pChunk, "CAMG", 4) && (length >= 4))
+			camg = ReadBigLong(pChunk + 8);
+		else if (0 == memcmp(pChunk, "BODY", 4))
+		{
+			pBody = pChunk + 8;
+			bodyBytes = length;
+		}
+
+		// Chunks are padded to an even length
+		pos += 8 + length + (length & 1);
+	}
+
+	if ((nullptr == pBMHD) || (nullptr == pBody))
+	{
+		D16_SetError("LoadILBMImage: no %s chunk", pBMHD ? "BODY" : "BMHD");
+		return nullptr;
+	}
+
+	int width       = ReadBigWord(pBMHD + 0);
+	int height      = ReadBigWord(pBMHD + 2);
+	int numPlanes   = pBMHD[ 8 ];
+	int masking     = pBMHD[ 9 ];
+	int compression = pBMHD[ 10 ];
+
+	if ((0 == width) || (0 == height))
+	{
+		D16_SetError("LoadILBMImage: the picture is empty");
+		return nullptr;
+	}
+
+	if ((numPlanes < 1) || (numPlanes > 8) || (camg & CAMG_HAM))
+	{
+		D16_SetError("LoadILBMImage: %d planes%s, only indexed pictures are done here",
+					 numPlanes, (camg & CAMG_HAM) ? ", HAM" : "");
+		return nullptr;
+	}
+
+	if (compression > eCompressByteRun1)
+	{
+		D16_SetError("LoadILBMImage: unknown compression %d", compression);
+		return nullptr;
+	}
+
+	if ((width > ILBM_MAX_SIZE) || (height > ILBM_MAX_SIZE) ||
+		((long long)width * height > ILBM_MAX_PIXELS))
+	{
+		D16_SetError("LoadILBMImage: %dx%d is too big", width, height);
+		return nullptr;
+	}
+
+	//--------------------------------------------------------------------------
+	// A row at a time, straight into the image, it's the same either way
+
+	int rowBytes;     // per plane, for ILBM, the whole row, for PBM
+	int numRowPlanes;
+
+	if (bPBM)
+	{
+		rowBytes = (width + 1) & ~1;
+		numRowPlanes = 1;
+	}
+	else
+	{
+		rowBytes = ((width + 15) >> 4) * 2;
+		numRowPlanes = numPlanes + ((eMaskHasMask == masking) ? 1 : 0);
+	}
+
+	size_t bytesPerRow = (size_t)rowBytes * numRowPlanes;
+
+	// Before anything is allocated, a short BODY is found here
+	if ((eCompressNone == compression) && (bodyBytes / bytesPerRow < (size_t)height))
+	{
+		D16_SetError("LoadILBMImage: BODY is %lld bytes short",
+					 (long long)(bytesPerRow * height) - (long long)bodyBytes);
+		return nullptr;
+	}
+
+	IndexedImage* pImage = new IndexedImage(width, height, 1 << numPlanes);
+
+	ByteRun1Reader reader(pBody, bodyBytes);
+	std::vector<Uint8> unpacked;
+
+	if (eCompressByteRun1 == compression)
+		unpacked.resize(bytesPerRow);
+
+	for (int y = 0; y < height; ++y)
+	{
+		const Uint8* pRow = pBody + (y * bytesPerRow);
+		Uint8* pOut = pImage->GetPixels() + ((size_t)y * width);
+
+		if (eCompressByteRun1 == compression)
+		{
+			if (!reader.Read(&unpacked[0], bytesPerRow))
+			{
+				D16_SetError("LoadILBMImage: BODY ran out of data, at row %d", y);
+				delete pImage;
+				return nullptr;
+			}
+
+			pRow = &unpacked[0];
+		}
+
+		if (bPBM)
+		{
+			memcpy(pOut, pRow, width);
+		}
+		else
+		{
+			const Uint8* pPlanes[ 8 ];
+
+			for (int plane = 0; plane < numPlanes; ++plane)
+			{
+				pPlanes[ plane ] = pRow + (plane * rowBytes);
+			}
+
+			PlanarToChunky(pPlanes, numPlanes, width, pOut);
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// Palette
+
+	Uint32* pClut = pImage->GetPalette();
+	int numColors = pImage->GetNumColors();
+	int numCMAPColors = (int)(cmapBytes / 3);
+
+	if (numCMAPColors > numColors)
+		numCMAPColors = numColors;
+
+	// Old Amiga software wrote 4 bit colors, in the high nibble, those get
+	// stretched, so $F0 comes out as $FF
+	bool bFourBit = true;
+
+	for (int idx = 0; idx < numCMAPColors * 3; ++idx)
+	{
+		if (pCMAP[ idx ] & 0x0F)
+			bFourBit = false;
+	}
+
+	for (int idx = 0; idx < numColors; ++idx)
+	{
+		Uint32 r = 0, g = 0, b = 0;
+
+		if (idx < numCMAPColors)
+		{
+			r = pCMAP[ (idx * 3) + 0 ];
+			g = pCMAP[ (idx * 3) + 1 ];
+			b = pCMAP[ (idx * 3) + 2 ];
+
+			if (bFourBit)
+			{
+				r |= r >> 4;
+				g |= g >> 4;
+				b |= b >> 4;
+			}
+		}
+		else if ((camg & CAMG_EHB) && (idx >= 32) && (idx - 32 < numCMAPColors))
+		{
+			// Extra Half-Brite, the top 32 are the bottom 32, at half
+			Uint32 color = pClut[ idx - 32 ];
+
+			r = ((color >> 0) & 0xFF) >> 1;
+			g = ((color >> 8) & 0xFF) >> 1;
+			b = ((color >> 16) & 0xFF) >> 1;
+		}
+
+		pClut[ idx ] = 0xFF000000 | (b << 16) | (g << 8) | r;
+	}
+
+	if (pNumCMAPColors)
+		*pNumCMAPColors = numCMAPColors;
+
+	return pImage;
+}
+
+IndexedImage* LoadILBMImage(const std::string& filenamepath, int* pNumCMAPColors)
+{
+	MappedFile file;
+
+	if (!file.Open(filenamepath))
+		return nullptr;
+
+	return LoadILBMImage(file.GetData(), file.GetSize(), pNumCMAPColors);
+}
+
+//------------------------------------------------------------------------------
+
+bool IsILBMFile(const std::string& filenamepath)
+{
+	static const char* extensions[] = { "lbm", "iff", "ilbm", "bbm" };
+
+	size_t dot = filenamepath.find_last_of('.');
+
+	if (std::string::npos == dot)
+		return false;
+
+	std::string ext = filenamepath.substr(dot + 1);
+
+	for (size_t idx = 0; idx < ext.size(); ++idx)
+	{
+		ext[ idx ] = (char)tolower(ext[ idx ]);
+	}
+
+	for (int idx = 0; idx < (int)(sizeof(extensions)/sizeof(extensions[0])); ++idx)
+	{
+		if (ext == extensions[ idx ])
+			return true;
+	}
+
+	return false;
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,30 @@
+//
+// Engine ILBM - Deluxe Paint, and friends, IFF pictures
+//
+// FORM ILBM (bitplanes), and FORM PBM (DPaint's chunky version), 1-8
+// planes, uncompressed, or ByteRun1, with the CMAP kept as the palette.
+// Extra Half-Brite is expanded to 64 colors.  HAM, and 24 bit pictures
+// aren't indexed, so they're left to SDL_image.
+//
+#ifndef ENGINE_ILBM_H_
+#define ENGINE_ILBM_H_
+
+#include "pixels.h"
+
+#include <string>
+
+// .lbm, .iff, .ilbm, or .bbm
+bool IsILBMFile(const std::string& filenamepath);
+
+// The palette has 1 << planes colors, the CMAP first, then black.  The file
+// is memory mapped, caller owns the result, nullptr, and D16_SetError if
+// it can't be read, or isn't a kind we do.  pNumCMAPColors, is how many
+// colors the CMAP actually had
+IndexedImage* LoadILBMImage(const std::string& filenamepath, int* pNumCMAPColors = nullptr);
+IndexedImage* LoadILBMImage(const Uint8* pData, size_t numBytes, int* pNumCMAPColors = nullptr);
+
+// ByteRun1 (PackBits), unpacks until dstBytes have been written, returns
+// how many packed bytes that took, or 0 if the data ran out
+size_t UnpackByteRun1(const Uint8* pSrc, size_t srcBytes, Uint8* pDst, size_t dstBytes);
+
+#endif // ENGINE_ILBM_H_
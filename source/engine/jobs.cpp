@@ -0,0 +1,482 @@
+//
+// Engine Jobs - Work stealing thread pool
+//
+#include "jobs.h"
+
+#include <deque>
+
+//------------------------------------------------------------------------------
+
+struct JobSystem::Job
+{
+	std::function<void()> m_func;
+	std::shared_ptr<JobState> m_pState;
+	int m_iPriority;
+};
+
+struct JobState
+{
+	JobState()
+		: m_lock(0)
+	{
+		SDL_AtomicSet(&m_bDone, 0);
+	}
+
+	SDL_atomic_t m_bDone;
+
+	SDL_SpinLock m_lock;  // m_continuations
+	std::vector<JobSystem::Job*> m_continuations;
+};
+
+// The locks are only held for a push, or a pop, so spin
+struct JobSystem::JobQueue
+{
+	JobQueue()
+		: m_lock(0)
+	{
+	}
+
+	SDL_SpinLock m_lock;
+	std::deque<Job*> m_jobs[ eNumJobPriorities ];
+};
+
+//------------------------------------------------------------------------------
+
+bool JobHandle::IsDone() const
+{
+	return !m_pState || (0 != SDL_AtomicGet(&m_pState->m_bDone));
+}
+
+//------------------------------------------------------------------------------
+
+static thread_local JobSystem* t_pWorkerSystem = nullptr;
+static thread_local int t_workerIndex = -1;
+
+struct WorkerStart
+{
+	JobSystem* m_pSystem;
+	int m_workerIndex;
+};
+
+//------------------------------------------------------------------------------
+
+JobSystem::JobSystem(int numWorkers)
+	: m_pWakeMutex(SDL_CreateMutex())
+	, m_pWakeCond(SDL_CreateCond())
+{
+	if (numWorkers < 1)
+		numWorkers = SDL_GetCPUCount();
+
+	if (numWorkers < 1)
+		numWorkers = 1;
+
+	SDL_AtomicSet(&m_numPending, 0);
+	SDL_AtomicSet(&m_numSleeping, 0);
+	SDL_AtomicSet(&m_bQuit, 0);
+
+	for (int idx = 0; idx <= numWorkers; ++idx)
+	{
+		m_queues.push_back(new JobQueue);
+	}
+
+	for (int idx = 0; idx < numWorkers; ++idx)
+	{
+		WorkerStart* pStart = new WorkerStart;
+		pStart->m_pSystem = this;
+		pStart->m_workerIndex = (int)m_workers.size();
+
+		SDL_Thread* pThread = SDL_CreateThread(WorkerThread, "d16 worker", pStart);
+
+		if (pThread)
+			m_workers.push_back(pThread);
+		else
+			delete pStart;
+	}
+
+	// Without any threads, everything gets run by whoever waits on it
+}
+
+JobSystem::~JobSystem()
+{
+	SDL_AtomicSet(&m_bQuit, 1);
+
+	SDL_LockMutex(m_pWakeMutex);
+	SDL_CondBroadcast(m_pWakeCond);
+	SDL_UnlockMutex(m_pWakeMutex);
+
+	for (int idx = 0; idx < (int)m_workers.size(); ++idx)
+	{
+		SDL_WaitThread(m_workers[ idx ], nullptr);
+	}
+
+	// Nobody to run them, if there were no workers
+	while (Job* pJob = FindJob(-1, eNumJobPriorities - 1))
+	{
+		RunJob(pJob);
+	}
+
+	for (int idx = 0; idx < (int)m_queues.size(); ++idx)
+	{
+		delete m_queues[ idx ];
+	}
+
+	SDL_DestroyCond(m_pWakeCond);
+	SDL_DestroyMutex(m_pWakeMutex);
+}
+
+//------------------------------------------------------------------------------
+
+static JobSystem* s_pDefaultSystem = nullptr;
+static SDL_SpinLock s_defaultLock = 0;
+
+/*static*/ void JobSystem::CreateDefault(int numWorkers)
+{
+	SDL_AtomicLock(&s_defaultLock);
+
+	if (nullptr == s_pDefaultSystem)
+		s_pDefaultSystem = new JobSystem(numWorkers);
+
+	SDL_AtomicUnlock(&s_defaultLock);
+}
+
+/*static*/ JobSystem& JobSystem::GetDefault()
+{
+	if (nullptr == s_pDefaultSystem)
+		CreateDefault(0);
+
+	return *s_pDefaultSystem;
+}
+
+//------------------------------------------------------------------------------
+
+int JobSystem::GetCurrentWorker() const
+{
+	return (this == t_pWorkerSystem) ? t_workerIndex : -1;
+}
+
+//------------------------------------------------------------------------------
+
+JobHandle JobSystem::Submit(const std::function<void()>& func, int iPriority)
+{
+	Job* pJob = new Job;
+	pJob->m_func = func;
+	pJob->m_pState = std::make_shared<JobState>();
+	pJob->m_iPriority = iPriority;
+
+	JobHandle handle;
+	handle.m_pState = pJob->m_pState;
+
+	Push(pJob);
+
+	return handle;
+}
+
+//------------------------------------------------------------------------------
+
+JobHandle JobSystem::Then(const JobHandle& after, const std::function<void()>& func,
+						  int iPriority)
+{
+	if (!after.IsValid())
+		return Submit(func, iPriority);
+
+	Job* pJob = new Job;
+	pJob->m_func = func;
+	pJob->m_pState = std::make_shared<JobState>();
+	pJob->m_iPriority = iPriority;
+
+	JobHandle handle;
+	handle.m_pState = pJob->m_pState;
+
+	JobState* pAfter = after.m_pState.get();
+
+	SDL_AtomicLock(&pAfter->m_lock);
+
+	bool bReady = (0 != SDL_AtomicGet(&pAfter->m_bDone));
+
+	if (!bReady)
+		pAfter->m_continuations.push_back(pJob);
+
+	SDL_AtomicUnlock(&pAfter->m_lock);
+
+	if (bReady)
+		Push(pJob);
+
+	return handle;
+}
+
+//------------------------------------------------------------------------------
+
+void JobSystem::Push(Job* pJob)
+{
+	// Our own workers keep what they make, everybody else goes in the
+	// shared queue on the end
+	int queueIndex = GetCurrentWorker();
+
+	if (queueIndex < 0)
+		queueIndex = (int)m_queues.size() - 1;
+
+	JobQueue* pQueue = m_queues[ queueIndex ];
+
+	// Count it first, so m_numPending is never less than what's queued
+	SDL_AtomicAdd(&m_numPending, 1);
+
+	SDL_AtomicLock(&pQueue->m_lock);
+	pQueue->m_jobs[ pJob->m_iPriority ].push_back(pJob);
+	SDL_AtomicUnlock(&pQueue->m_lock);
+
+	// Only pay for the mutex, if somebody is asleep
+	if (SDL_AtomicGet(&m_numSleeping) > 0)
+	{
+		SDL_LockMutex(m_pWakeMutex);
+		SDL_CondSignal(m_pWakeCond);
+		SDL_UnlockMutex(m_pWakeMutex);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+JobSystem::Job* JobSystem::FindJob(int workerIndex, int maxPriority)
+{
+	if (0 == SDL_AtomicGet(&m_numPending))
+		return nullptr;
+
+	int numQueues = (int)m_queues.size();
+	int sharedIndex = numQueues - 1;
+
+	for (int iPriority = 0; iPriority <= maxPriority; ++iPriority)
+	{
+		// Newest from our own
+		if (workerIndex >= 0)
+		{
+			JobQueue* pQueue = m_queues[ workerIndex ];
+			Job* pJob = nullptr;
+
+			SDL_AtomicLock(&pQueue->m_lock);
+
+			if (!pQueue->m_jobs[ iPriority ].empty())
+			{
+				pJob = pQueue->m_jobs[ iPriority ].back();
+				pQueue->m_jobs[ iPriority ].pop_back();
+			}
+
+			SDL_AtomicUnlock(&pQueue->m_lock);
+
+			if (pJob)
+			{
+				SDL_AtomicAdd(&m_numPending, -1);
+				return pJob;
+			}
+		}
+
+		// Then steal the oldest from everyone else, and the shared queue,
+		// starting with our neighbour, so the thieves spread out
+		int start = (workerIndex >= 0) ? workerIndex + 1 : sharedIndex;
+
+		for (int offset = 0; offset < numQueues; ++offset)
+		{
+			int queueIndex = (start + offset) % numQueues;
+
+			if (queueIndex == workerIndex)
+				continue;
+
+			JobQueue* pQueue = m_queues[ queueIndex ];
+			Job* pJob = nullptr;
+
+			SDL_AtomicLock(&pQueue->m_lock);
+
+			if (!pQueue->m_jobs[ iPriority ].empty())
+			{
+				pJob = pQueue->m_jobs[ iPriority ].front();
+				pQueue->m_jobs[ iPriority ].pop_front();
+			}
+
+			SDL_AtomicUnlock(&pQueue->m_lock);
+
+			if (pJob)
+			{
+				SDL_AtomicAdd(&m_numPending, -1);
+				return pJob;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+void JobSystem::RunJob(Job* pJob)
+{
+	pJob->m_func();
+
+	JobState* pState = pJob->m_pState.get();
+
+	std::vector<Job*> continuations;
+
+	SDL_AtomicLock(&pState->m_lock);
+	SDL_AtomicSet(&pState->m_bDone, 1);
+	continuations.swap(pState->m_continuations);
+	SDL_AtomicUnlock(&pState->m_lock);
+
+	for (int idx = 0; idx < (int)continuations.size(); ++idx)
+	{
+		Push(continuations[ idx ]);
+	}
+
+	delete pJob;
+}
+
+//------------------------------------------------------------------------------
+
+void JobSystem::WorkerLoop(int workerIndex)
+{
+	t_pWorkerSystem = this;
+	t_workerIndex = workerIndex;
+
+	for (;;)
+	{
+		Job* pJob = FindJob(workerIndex, eNumJobPriorities - 1);
+
+		if (pJob)
+		{
+			RunJob(pJob);
+			continue;
+		}
+
+		// Nothing to do, sleep until Push has something.  m_numSleeping
+		// goes up before we look at m_numPending, and Push does it the
+		// other way around, so one of us always sees the other
+		SDL_LockMutex(m_pWakeMutex);
+		SDL_AtomicAdd(&m_numSleeping, 1);
+
+		while ((0 == SDL_AtomicGet(&m_numPending)) && (0 == SDL_AtomicGet(&m_bQuit)))
+		{
+			SDL_CondWait(m_pWakeCond, m_pWakeMutex);
+		}
+
+		SDL_AtomicAdd(&m_numSleeping, -1);
+		SDL_UnlockMutex(m_pWakeMutex);
+
+		// Finish what's queued, before quitting
+		if ((0 != SDL_AtomicGet(&m_bQuit)) && (0 == SDL_AtomicGet(&m_numPending)))
+			break;
+	}
+
+	t_pWorkerSystem = nullptr;
+	t_workerIndex = -1;
+}
+
+/*static*/ int JobSystem::WorkerThread(void* pData)
+{
+	WorkerStart* pStart = (WorkerStart*)pData;
+
+	JobSystem* pSystem = pStart->m_pSystem;
+	int workerIndex = pStart->m_workerIndex;
+
+	delete pStart;
+
+	pSystem->WorkerLoop(workerIndex);
+
+	return 0;
+}
+
+//------------------------------------------------------------------------------
+
+void JobSystem::Wait(const JobHandle& handle)
+{
+	Wait(handle, -1);
+}
+
+bool JobSystem::Wait(const JobHandle& handle, int timeoutMS)
+{
+	Uint32 startTicks = SDL_GetTicks();
+	int numIdle = 0;
+
+	while (!handle.IsDone())
+	{
+		if ((timeoutMS >= 0) && ((int)(SDL_GetTicks() - startTicks) >= timeoutMS))
+			return false;
+
+		// Help out, with anything that won't nest badly
+		Job* pJob = FindJob(GetCurrentWorker(), eJobInteractive);
+
+		if (pJob)
+		{
+			RunJob(pJob);
+			numIdle = 0;
+		}
+		else if (m_workers.empty())
+		{
+			// No workers, so it's on us, whatever it is
+			pJob = FindJob(GetCurrentWorker(), eNumJobPriorities - 1);
+
+			if (pJob)
+				RunJob(pJob);
+		}
+		else if (++numIdle < 64)
+		{
+			SDL_Delay(0);
+		}
+		else
+		{
+			SDL_Delay(1);
+		}
+	}
+
+	return true;
+}
+
+void JobSystem::Wait(const std::vector<JobHandle>& handles)
+{
+	for (int idx = 0; idx < (int)handles.size(); ++idx)
+	{
+		Wait(handles[ idx ]);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+void JobSystem::ParallelFor(int begin, int end, int grainSize,
+							const std::function<void(int start, int end)>& func,
+							int iPriority)
+{
+	int count = end - begin;
+
+	if (count <= 0)
+		return;
+
+	if (grainSize < 1)
+		grainSize = 1;
+
+	// A few bands per worker, so a slow band doesn't hold everyone up
+	int numBands = (count + grainSize - 1) / grainSize;
+	int maxBands = ((int)m_workers.size() + 1) * 4;
+
+	if (numBands > maxBands)
+		numBands = maxBands;
+
+	if ((numBands <= 1) || m_workers.empty())
+	{
+		func(begin, end);
+		return;
+	}
+
+	std::vector<JobHandle> handles;
+	handles.reserve(numBands - 1);
+
+	// Band 0 is ours
+	for (int band = 1; band < numBands; ++band)
+	{
+		int start = begin + (int)(((long long)count * band) / numBands);
+		int stop  = begin + (int)(((long long)count * (band + 1)) / numBands);
+
+		handles.push_back(Submit([func, start, stop]() { func(start, stop); }, iPriority));
+	}
+
+	func(begin, begin + (int)((long long)count / numBands));
+
+	Wait(handles);
+}
+
+//------------------------------------------------------------------------------
+
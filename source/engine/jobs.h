@@ -0,0 +1,198 @@
+//
+// Engine Jobs - Work stealing thread pool
+//
+// Every worker has its own deque of jobs, per priority.  A worker pushes,
+// and pops at the back of its own deque (so the work it just made, is
+// still in the cache), and when it runs dry, steals from the front of
+// another worker's deque.  Jobs submitted from outside the pool, go in a
+// shared queue, that all the workers take from.
+//
+// Interactive jobs always go before batch jobs, wherever they are queued,
+// so a UI request doesn't sit behind a folder full of conversions.
+//
+// Waiting (Wait, ParallelFor, JobFuture::Get) doesn't just block, the
+// waiting thread runs interactive jobs, until what it's waiting on is done.
+// It never picks up batch jobs, so a batch job, in the middle of a
+// resize, won't find itself running a second conversion, on the same
+// thread.  Because of that, a batch job shouldn't Wait on another batch
+// job, use Then instead.
+//
+#ifndef ENGINE_JOBS_H_
+#define ENGINE_JOBS_H_
+
+#include <SDL.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+enum JobPriority
+{
+	eJobInteractive,  // the user is waiting, and row bands of a ParallelFor
+	eJobBatch,        // folders of conversions, background work
+
+	eNumJobPriorities
+};
+
+struct JobState;
+class JobSystem;
+
+//------------------------------------------------------------------------------
+
+class JobHandle
+{
+public:
+	bool IsValid() const { return nullptr != m_pState.get(); }
+	bool IsDone() const;
+
+private:
+	friend class JobSystem;
+	std::shared_ptr<JobState> m_pState;
+};
+
+//------------------------------------------------------------------------------
+// Handle to a job, that hands back a T
+template<typename T>
+class JobFuture
+{
+public:
+	JobFuture()
+		: m_pSystem(nullptr)
+	{
+	}
+
+	bool IsDone() const { return m_handle.IsDone(); }
+
+	// Waits, if it has to
+	T& Get();
+
+	const JobHandle& GetHandle() const { return m_handle; }
+
+private:
+	friend class JobSystem;
+
+	JobSystem* m_pSystem;
+	JobHandle m_handle;
+	std::shared_ptr<T> m_pValue;
+};
+
+//------------------------------------------------------------------------------
+
+class JobSystem
+{
+public:
+	// 0 workers, means one per CPU
+	JobSystem(int numWorkers = 0);
+
+	// Runs everything that's still queued, then stops the workers
+	~JobSystem();
+
+	// The pool shared by the engine (resizing, histograms), and anything
+	// that doesn't need its own.  CreateDefault sets the number of workers,
+	// and has to be called before the first GetDefault to have any effect
+	static JobSystem& GetDefault();
+	static void CreateDefault(int numWorkers);
+
+	int GetNumWorkers() const { return (int)m_workers.size(); }
+
+	// 0 to GetNumWorkers()-1 when called from one of our workers, -1 from
+	// anywhere else, for keeping warm per worker state
+	int GetCurrentWorker() const;
+
+	//--------------------------------------------------------------------------
+
+	JobHandle Submit(const std::function<void()>& func, int iPriority = eJobBatch);
+
+	// Runs func, once after is done (right away, if it already is)
+	JobHandle Then(const JobHandle& after, const std::function<void()>& func,
+				   int iPriority = eJobBatch);
+
+	template<typename T>
+	JobFuture<T> Async(const std::function<T()>& func, int iPriority = eJobBatch);
+
+	template<typename T, typename U>
+	JobFuture<U> Then(const JobFuture<T>& after, const std::function<U(T&)>& func,
+					  int iPriority = eJobBatch);
+
+	// Run interactive jobs, until the handle is done
+	void Wait(const JobHandle& handle);
+	void Wait(const std::vector<JobHandle>& handles);
+
+	// Same, but gives up after about timeoutMS (a job we're helping with,
+	// can make it longer), returns true if the handle is done
+	bool Wait(const JobHandle& handle, int timeoutMS);
+
+	// func(start, end) over [begin, end), in bands of at least grainSize,
+	// the calling thread runs a band too, and returns once they are all done
+	void ParallelFor(int begin, int end, int grainSize,
+					 const std::function<void(int start, int end)>& func,
+					 int iPriority = eJobInteractive);
+
+private:
+	friend struct JobState;
+
+	struct Job;
+	struct JobQueue;
+
+	void Push(Job* pJob);
+	Job* FindJob(int workerIndex, int maxPriority);
+	void RunJob(Job* pJob);
+	void WorkerLoop(int workerIndex);
+
+	static int WorkerThread(void* pData);
+
+	std::vector<SDL_Thread*> m_workers;
+
+	// One per worker, and one more on the end, for jobs from outside
+	std::vector<JobQueue*> m_queues;
+
+	SDL_atomic_t m_numPending;   // jobs sitting in queues
+	SDL_atomic_t m_numSleeping;
+	SDL_atomic_t m_bQuit;
+
+	SDL_mutex* m_pWakeMutex;
+	SDL_cond*  m_pWakeCond;
+};
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+T& JobFuture<T>::Get()
+{
+	m_pSystem->Wait(m_handle);
+
+	return *m_pValue;
+}
+
+template<typename T>
+JobFuture<T> JobSystem::Async(const std::function<T()>& func, int iPriority)
+{
+	JobFuture<T> future;
+	future.m_pSystem = this;
+	future.m_pValue = std::make_shared<T>();
+
+	std::shared_ptr<T> pValue = future.m_pValue;
+
+	future.m_handle = Submit([pValue, func]() { *pValue = func(); }, iPriority);
+
+	return future;
+}
+
+template<typename T, typename U>
+JobFuture<U> JobSystem::Then(const JobFuture<T>& after, const std::function<U(T&)>& func,
+							 int iPriority)
+{
+	JobFuture<U> future;
+	future.m_pSystem = this;
+	future.m_pValue = std::make_shared<U>();
+
+	std::shared_ptr<T> pIn  = after.m_pValue;
+	std::shared_ptr<U> pOut = future.m_pValue;
+
+	future.m_handle = Then(after.m_handle, [pIn, pOut, func]() { *pOut = func(*pIn); }, iPriority);
+
+	return future;
+}
+
+#endif // ENGINE_JOBS_H_
+
@@ -0,0 +1,1206 @@
+//
+// Engine Manifest - A conversion, written down as stages, run as a DAG
+//
+#include "manifest.h"
+
+#include "cache.h"
+#include "files.h"
+#include "jobs.h"
+#include "palettes.h"
+#include "progress.h"
+
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+//
+// Parsing
+//
+//------------------------------------------------------------------------------
+
+static const struct
+{
+	const char* pName;
+	int iType;
+} s_stageTypes[] =
+{
+	{ "load",     eStageLoad },
+	{ "crop",     eStageCrop },
+	{ "resize",   eStageResize },
+	{ "quantize", eStageQuantize },
+	{ "save",     eStageSave },
+};
+
+static int StageTypeFromName(const std::string& name)
+{
+	for (int idx = 0; idx < (int)(sizeof(s_stageTypes)/sizeof(s_stageTypes[0])); ++idx)
+	{
+		if (0 == SDL_strcasecmp(name.c_str(), s_stageTypes[ idx ].pName))
+			return s_stageTypes[ idx ].iType;
+	}
+
+	return -1;
+}
+
+static std::string Trim(const std::string& text)
+{
+	size_t start = text.find_first_not_of(" \t\r\n");
+
+	if (std::string::npos == start)
+		return "";
+
+	size_t end = text.find_last_not_of(" \t\r\n");
+
+	return text.substr(start, end - start + 1);
+}
+
+static bool IsAbsolutePath(const std::string& path)
+{
+	return !path.empty() &&
+		   (('/' == path[0]) || ('\\' == path[0]) ||
+			((path.size() > 1) && (':' == path[1])));
+}
+
+static std::string ResolvePath(const std::string& baseDirectory, const std::string& path)
+{
+	if (path.empty() || IsAbsolutePath(path) || baseDirectory.empty())
+		return path;
+
+	return JoinPath(baseDirectory, path);
+}
+
+static bool ParseBool(const std::string& value)
+{
+	return (value == "1") || (0 == SDL_strcasecmp(value.c_str(), "true")) ||
+		   (0 == SDL_strcasecmp(value.c_str(), "yes")) ||
+		   (0 == SDL_strcasecmp(value.c_str(), "on"));
+}
+
+//------------------------------------------------------------------------------
+
+struct ManifestKey
+{
+	std::string m_key;
+	std::string m_value;
+	int m_line;
+};
+
+struct ManifestSection
+{
+	std::string m_name;
+	int m_line;
+	std::vector<ManifestKey> m_keys;
+};
+
+//------------------------------------------------------------------------------
+
+Manifest::Manifest()
+	: m_bRecursive(false)
+{
+}
+
+Manifest::~Manifest()
+{
+}
+
+//------------------------------------------------------------------------------
+
+bool Manifest::Load(const std::string& filenamepath)
+{
+	FILE* pFile = fopen(filenamepath.c_str(), "rb");
+
+	if (nullptr == pFile)
+	{
+		D16_SetError("Manifest, can't open %s", filenamepath.c_str());
+		return false;
+	}
+
+	std::string text;
+	char buffer[ 4096 ];
+	size_t numRead;
+
+	while ((numRead = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+	{
+		text.append(buffer, numRead);
+	}
+
+	fclose(pFile);
+
+	std::string baseDirectory = GetDirectory(filenamepath);
+
+	if (!Parse(text, baseDirectory))
+	{
+		std::string error = D16_GetError();
+		D16_SetError("%s: %s", filenamepath.c_str(), error.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool Manifest::Parse(const std::string& text, const std::string& baseDirectory)
+{
+	//--------------------------------------------------------------------------
+	// Split into sections, and key = value
+
+	std::vector<ManifestSection> sections;
+
+	size_t lineStart = 0;
+	int lineNumber = 0;
+
+	while (lineStart < text.size())
+	{
+		size_t lineEnd = text.find('\n', lineStart);
+
+		if (std::string::npos == lineEnd)
+			lineEnd = text.size();
+
+		std::string line = text.substr(lineStart, lineEnd - lineStart);
+		lineStart = lineEnd + 1;
+		++lineNumber;
+
+		// Comments, a whole line, or after some white space
+		for (size_t idx = 0; idx < line.size(); ++idx)
+		{
+			if ((';' == line[idx]) || ('#' == line[idx]))
+			{
+				if ((0 == idx) || (' ' == line[idx-1]) || ('\t' == line[idx-1]))
+				{
+					line = line.substr(0, idx);
+					break;
+				}
+			}
+		}
+
+		line = Trim(line);
+
+		if (line.empty())
+			continue;
+
+		if ('[' == line[0])
+		{
+			size_t close = line.find(']');
+
+			if (std::string::npos == close)
+			{
+				D16_SetError("line %d, missing ]", lineNumber);
+				return false;
+			}
+
+			ManifestSection section;
+			section.m_name = Trim(line.substr(1, close - 1));
+			section.m_line = lineNumber;
+
+			for (int idx = 0; idx < (int)sections.size(); ++idx)
+			{
+				if (sections[ idx ].m_name == section.m_name)
+				{
+					D16_SetError("line %d, [%s] is already on line %d", lineNumber,
+								 section.m_name.c_str(), sections[ idx ].m_line);
+					return false;
+				}
+			}
+
+			sections.push_back(section);
+			continue;
+		}
+
+		size_t equals = line.find('=');
+
+		if ((std::string::npos == equals) || sections.empty())
+		{
+			D16_SetError("line %d, expected key = value, inside a [section]", lineNumber);
+			return false;
+		}
+
+		ManifestKey key;
+		key.m_key   = Trim(line.substr(0, equals));
+		key.m_value = Trim(line.substr(equals + 1));
+		key.m_line  = lineNumber;
+
+		// Allow quotes, for paths with spaces on the ends
+		if ((key.m_value.size() >= 2) && ('"' == key.m_value[0]) &&
+			('"' == key.m_value[ key.m_value.size() - 1 ]))
+		{
+			key.m_value = key.m_value.substr(1, key.m_value.size() - 2);
+		}
+
+		sections.back().m_keys.push_back(key);
+	}
+
+	//--------------------------------------------------------------------------
+	// Turn the sections into stages
+
+	m_stages.clear();
+
+	ManifestStage load;
+	load.m_name  = "load";
+	load.m_iType = eStageLoad;
+	m_stages.push_back(load);
+
+	// Names, until Link can turn them into indexes
+	m_parentNames.clear();
+	m_parentNames.push_back("");
+
+	for (int sectionIndex = 0; sectionIndex < (int)sections.size(); ++sectionIndex)
+	{
+		const ManifestSection& section = sections[ sectionIndex ];
+
+		if (section.m_name == "inputs")
+		{
+			for (int idx = 0; idx < (int)section.m_keys.size(); ++idx)
+			{
+				const ManifestKey& key = section.m_keys[ idx ];
+
+				if (key.m_key == "path")
+					m_inputs.push_back(ResolvePath(baseDirectory, key.m_value));
+				else if (key.m_key == "recursive")
+					m_bRecursive = ParseBool(key.m_value);
+				else
+				{
+					D16_SetError("line %d, unknown key %s in [inputs]", key.m_line, key.m_key.c_str());
+					return false;
+				}
+			}
+			continue;
+		}
+
+		if (section.m_name == "load")
+		{
+			if (!section.m_keys.empty())
+			{
+				D16_SetError("line %d, [load] doesn't take anything", section.m_keys[0].m_line);
+				return false;
+			}
+			continue;
+		}
+
+		ManifestStage stage;
+		stage.m_name  = section.m_name;
+		stage.m_iType = StageTypeFromName(section.m_name);
+
+		// With no "from", a stage follows the one before it
+		std::string parentName = m_stages.back().m_name;
+
+		for (int idx = 0; idx < (int)section.m_keys.size(); ++idx)
+		{
+			const ManifestKey& key = section.m_keys[ idx ];
+
+			if (key.m_key == "type")
+			{
+				stage.m_iType = StageTypeFromName(key.m_value);
+
+				if ((stage.m_iType < 0) || (eStageLoad == stage.m_iType))
+				{
+					D16_SetError("line %d, type should be crop, resize, quantize, or save", key.m_line);
+					return false;
+				}
+			}
+		}
+
+		if ((stage.m_iType < 0) || (eStageLoad == stage.m_iType))
+		{
+			D16_SetError("line %d, [%s] needs a type", section.m_line, section.m_name.c_str());
+			return false;
+		}
+
+		for (int idx = 0; idx < (int)section.m_keys.size(); ++idx)
+		{
+			const ManifestKey& key = section.m_keys[ idx ];
+			const char* pValue = key.m_value.c_str();
+
+			bool bKnown = true;
+
+			if (key.m_key == "type")
+			{
+			}
+			else if (key.m_key == "from")
+			{
+				parentName = key.m_value;
+			}
+			else if ((eStageCrop == stage.m_iType) || (eStageResize == stage.m_iType))
+			{
+				if (key.m_key == "size")
+				{
+					if ((2 != sscanf(pValue, "%dx%d", &stage.m_width, &stage.m_height)) ||
+						(stage.m_width <= 0) || (stage.m_height <= 0))
+					{
+						D16_SetError("line %d, size should look like 320x200", key.m_line);
+						return false;
+					}
+				}
+				else if ((key.m_key == "justify") && (eStageCrop == stage.m_iType))
+				{
+					stage.m_iJustify = JustifyFromName(pValue);
+
+					if (stage.m_iJustify < 0)
+					{
+						D16_SetError("line %d, unknown justify %s", key.m_line, pValue);
+						return false;
+					}
+				}
+				else if ((key.m_key == "filter") && (eStageResize == stage.m_iType))
+				{
+					stage.m_iFilter = ScaleFilterFromName(pValue);
+
+					if (stage.m_iFilter < 0)
+					{
+						D16_SetError("line %d, unknown filter %s", key.m_line, pValue);
+						return false;
+					}
+				}
+				else if ((key.m_key == "dither") && (eStageResize == stage.m_iType))
+				{
+					stage.m_bResizeDither = ParseBool(key.m_value);
+				}
+				else
+				{
+					bKnown = false;
+				}
+			}
+			else if (eStageQuantize == stage.m_iType)
+			{
+				QuantizeSettings& quantize = stage.m_quantize;
+
+				if (key.m_key == "colors")
+				{
+					quantize.m_numColors = atoi(pValue);
+
+					if ((quantize.m_numColors < 2) || (quantize.m_numColors > 256))
+					{
+						D16_SetError("line %d, colors must be 2-256", key.m_line);
+						return false;
+					}
+				}
+				else if (key.m_key == "speed")
+				{
+					quantize.m_speed = atoi(pValue);
+
+					if ((quantize.m_speed < 1) || (quantize.m_speed > 10))
+					{
+						D16_SetError("line %d, speed must be 1-10", key.m_line);
+						return false;
+					}
+				}
+				else if (key.m_key == "posterize")
+				{
+					quantize.m_iPosterize = PosterizeFromName(pValue);
+
+					if (quantize.m_iPosterize < 0)
+					{
+						D16_SetError("line %d, posterize must be 444, 555, or 888", key.m_line);
+						return false;
+					}
+				}
+				else if (key.m_key == "dither")
+				{
+					quantize.m_iDither = atoi(pValue);
+
+					if ((quantize.m_iDither < 0) || (quantize.m_iDither > 100))
+					{
+						D16_SetError("line %d, dither must be 0-100", key.m_line);
+						return false;
+					}
+				}
+				else if (key.m_key == "dither-method")
+				{
+					quantize.m_iDitherMethod = DitherFromName(pValue);
+
+					if (quantize.m_iDitherMethod < 0)
+					{
+						D16_SetError("line %d, unknown dither-method %s", key.m_line, pValue);
+						return false;
+					}
+				}
+				else if (key.m_key == "palette")
+				{
+					std::string path = ResolvePath(baseDirectory, key.m_value);
+
+					quantize.m_lockedColors.clear();
+
+					if (!LoadPaletteFile(path, quantize.m_lockedColors, 256))
+					{
+						std::string error = D16_GetError();
+						D16_SetError("line %d, %s", key.m_line, error.c_str());
+						return false;
+					}
+				}
+				else
+				{
+					bKnown = false;
+				}
+			}
+			else if (eStageSave == stage.m_iType)
+			{
+				if (key.m_key == "format")
+				{
+					if (0 == SDL_strcasecmp(pValue, "c1"))
+						stage.m_iFormat = eOutputC1;
+					else if (0 == SDL_strcasecmp(pValue, "png"))
+						stage.m_iFormat = eOutputPNG;
+					else if (0 == SDL_strcasecmp(pValue, "pnt"))
+						stage.m_iFormat = eOutputPNT;
+					else if (0 == SDL_strcasecmp(pValue, "apf"))
+						stage.m_iFormat = eOutputAPF;
+					else
+					{
+						D16_SetError("line %d, format should be c1, pnt, apf, or png", key.m_line);
+						return false;
+					}
+				}
+				else if (key.m_key == "level")
+				{
+					stage.m_pngLevel = atoi(pValue);
+
+					if ((stage.m_pngLevel < eDeflateStore) || (stage.m_pngLevel > eDeflateSmallest))
+					{
+						D16_SetError("line %d, level must be 0-9", key.m_line);
+						return false;
+					}
+				}
+				else if (key.m_key == "output")
+				{
+					stage.m_outputDirectory = ResolvePath(baseDirectory, key.m_value);
+				}
+				else if (key.m_key == "suffix")
+				{
+					stage.m_suffix = key.m_value;
+				}
+				else
+				{
+					bKnown = false;
+				}
+			}
+
+			if (!bKnown)
+			{
+				D16_SetError("line %d, unknown key %s in [%s]", key.m_line,
+							 key.m_key.c_str(), section.m_name.c_str());
+				return false;
+			}
+		}
+
+		if (((eStageCrop == stage.m_iType) || (eStageResize == stage.m_iType)) &&
+			(stage.m_width <= 0))
+		{
+			D16_SetError("line %d, [%s] needs a size", section.m_line, section.m_name.c_str());
+			return false;
+		}
+
+		if ((eStageQuantize == stage.m_iType) &&
+			((int)stage.m_quantize.m_lockedColors.size() > stage.m_quantize.m_numColors))
+		{
+			stage.m_quantize.m_lockedColors.resize(stage.m_quantize.m_numColors);
+		}
+
+		m_stages.push_back(stage);
+		m_parentNames.push_back(parentName);
+	}
+
+	return Link();
+}
+
+//------------------------------------------------------------------------------
+// Stage names into indexes, check the types fit together, and merge stages
+// that would do the same work
+bool Manifest::Link()
+{
+	int numStages = (int)m_stages.size();
+
+	for (int idx = 1; idx < numStages; ++idx)
+	{
+		ManifestStage& stage = m_stages[ idx ];
+
+		stage.m_parent = -1;
+
+		for (int parentIndex = 0; parentIndex < numStages; ++parentIndex)
+		{
+			if (m_stages[ parentIndex ].m_name == m_parentNames[ idx ])
+				stage.m_parent = parentIndex;
+		}
+
+		if ((stage.m_parent < 0) || (stage.m_parent == idx))
+		{
+			D16_SetError("[%s] comes from \"%s\", which isn't a stage",
+						 stage.m_name.c_str(), m_parentNames[ idx ].c_str());
+			return false;
+		}
+
+		int iParentType = m_stages[ stage.m_parent ].m_iType;
+
+		bool bParentRGBA = (eStageLoad == iParentType) || (eStageCrop == iParentType) ||
+						   (eStageResize == iParentType);
+
+		if ((eStageSave == stage.m_iType) ? (eStageQuantize != iParentType) : !bParentRGBA)
+		{
+			D16_SetError("[%s] can't come from [%s]%s", stage.m_name.c_str(),
+						 m_stages[ stage.m_parent ].m_name.c_str(),
+						 (eStageSave == stage.m_iType) ? ", save needs a quantize" : "");
+			return false;
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// Walk down from load, so a stage is always seen after its parent, and
+	// merge anything that matches a stage we've already kept
+
+	std::vector<int> remap(numStages, -1);
+	std::vector<ManifestStage> stages;
+	std::map<std::string, int> signatures;
+
+	std::vector<int> order;
+	order.push_back(0);
+
+	for (int orderIndex = 0; orderIndex < (int)order.size(); ++orderIndex)
+	{
+		for (int idx = 1; idx < numStages; ++idx)
+		{
+			if (m_stages[ idx ].m_parent == order[ orderIndex ])
+				order.push_back(idx);
+		}
+	}
+
+	if ((int)order.size() != numStages)
+	{
+		D16_SetError("the stages go around in a circle, and never get back to load");
+		return false;
+	}
+
+	// Stages that don't lead to a save, would just be wasted work
+	std::vector<bool> bUseful(numStages, false);
+
+	for (int orderIndex = (int)order.size() - 1; orderIndex >= 0; --orderIndex)
+	{
+		int stageIndex = order[ orderIndex ];
+
+		if (eStageSave == m_stages[ stageIndex ].m_iType)
+			bUseful[ stageIndex ] = true;
+
+		if (bUseful[ stageIndex ] && (m_stages[ stageIndex ].m_parent >= 0))
+			bUseful[ m_stages[ stageIndex ].m_parent ] = true;
+	}
+
+	bUseful[ 0 ] = true;
+
+	for (int orderIndex = 0; orderIndex < (int)order.size(); ++orderIndex)
+	{
+		if (!bUseful[ order[ orderIndex ] ])
+			continue;
+
+		const ManifestStage& stage = m_stages[ order[ orderIndex ] ];
+
+		int parent = (stage.m_parent >= 0) ? remap[ stage.m_parent ] : -1;
+
+		char buffer[ 256 ];
+		snprintf(buffer, sizeof(buffer), "%d:%d:%d:%d:%d:%d:%d:%d:%d:%d:%d:%d:%d:%d:%d:",
+				 parent, stage.m_iType, stage.m_width, stage.m_height,
+				 stage.m_iJustify, stage.m_iFilter, stage.m_bResizeDither ? 1 : 0,
+				 stage.m_quantize.m_numColors, stage.m_quantize.m_speed,
+				 stage.m_quantize.m_iPosterize, stage.m_quantize.m_iDither,
+				 stage.m_quantize.m_iDitherMethod,
+				 (int)stage.m_quantize.m_lockedColors.size(), stage.m_iFormat,
+				 stage.m_pngLevel);
+
+		std::string signature = buffer;
+
+		for (int idx = 0; idx < (int)stage.m_quantize.m_lockedColors.size(); ++idx)
+		{
+			snprintf(buffer, sizeof(buffer), "%08x", stage.m_quantize.m_lockedColors[ idx ]);
+			signature += buffer;
+		}
+
+		signature += ":" + stage.m_outputDirectory + ":" + stage.m_suffix;
+
+		std::map<std::string, int>::iterator it = signatures.find(signature);
+
+		if (it != signatures.end())
+		{
+			remap[ order[ orderIndex ] ] = it->second;
+			continue;
+		}
+
+		int newIndex = (int)stages.size();
+
+		remap[ order[ orderIndex ] ] = newIndex;
+		signatures[ signature ] = newIndex;
+
+		stages.push_back(stage);
+		stages.back().m_parent = parent;
+		stages.back().m_children.clear();
+
+		if (parent >= 0)
+			stages[ parent ].m_children.push_back(newIndex);
+	}
+
+	m_stages = stages;
+	m_parentNames.clear();
+
+	if (0 == GetNumOutputs())
+	{
+		D16_SetError("nothing gets saved, add a save stage");
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+int Manifest::GetNumOutputs() const
+{
+	int numOutputs = 0;
+
+	for (int idx = 0; idx < (int)m_stages.size(); ++idx)
+	{
+		if (eStageSave == m_stages[ idx ].m_iType)
+			++numOutputs;
+	}
+
+	return numOutputs;
+}
+
+//------------------------------------------------------------------------------
+//
+// Running
+//
+// Tasks are (input, stage) pairs, each one a batch job.  When a stage
+// finishes, its children are submitted from the same worker, which runs
+// them next, so an input goes all the way through, before that worker
+// starts on anything else, which is what keeps the memory bounded.  A
+// stage's result is freed once all of its children have run.
+//
+//------------------------------------------------------------------------------
+
+struct RunTask
+{
+	int m_input;
+	int m_stage;
+};
+
+struct RunInput
+{
+	std::string m_path;
+	std::string m_root;  // directory it was found in, for the output layout
+
+	// Per stage, only one of these is used, depending on the stage type
+	std::vector<RGBAImage*>    m_rgba;
+	std::vector<IndexedImage*> m_indexed;
+	std::vector<int>           m_pendingChildren;
+	std::vector<long long>     m_bytes;
+
+	int m_numTasks;  // submitted, and not finished yet
+
+	// For ManifestRunOptions::m_pProgress
+	int m_progressId;
+	int m_numStagesDone;
+	long long m_numPixels;
+	bool m_bFailed;
+	std::string m_error;
+};
+
+class RunWorker;
+
+struct RunState
+{
+	const Manifest* m_pManifest;
+	const ManifestRunOptions* m_pOptions;
+	JobSystem* m_pJobs;
+
+	std::vector<RunInput> m_inputs;
+
+	// One per pool worker, and one for the calling thread, made on first use
+	std::vector<RunWorker*> m_workers;
+
+	SDL_mutex* m_pMutex;  // everything below
+
+	std::vector<JobHandle> m_handles;  // submitted, since the last look
+
+	int m_nextInput;
+	int m_maxLiveInputs;
+	int m_numLiveInputs;
+	int m_numDoneInputs;
+	long long m_liveBytes;
+	int m_numFailed;
+};
+
+//------------------------------------------------------------------------------
+
+static std::string SavePath(const RunInput& input, const ManifestStage& stage)
+{
+	std::string output = MakeOutputPath(input.m_path, input.m_root,
+										stage.m_outputDirectory, stage.m_iFormat);
+
+	if (!stage.m_suffix.empty())
+	{
+		output = RemoveExtension(output) + stage.m_suffix + OutputExtension(stage.m_iFormat);
+	}
+
+	return output;
+}
+
+//------------------------------------------------------------------------------
+// Report, every save under stageIndex, failed (with the lock held)
+static void FailOutputs(RunState& state, RunInput& input, int stageIndex, const std::string& error)
+{
+	const ManifestStage& stage = state.m_pManifest->GetStages()[ stageIndex ];
+
+	if (eStageSave == stage.m_iType)
+	{
+		ManifestResult result;
+		result.m_input = input.m_path;
+		result.m_output = SavePath(input, stage);
+		result.m_bSuccess = false;
+		result.m_error = error;
+
+		if (state.m_pOptions->m_pReport)
+			state.m_pOptions->m_pReport(result, state.m_pOptions->m_pUserData);
+
+		++state.m_numFailed;
+	}
+
+	for (int idx = 0; idx < (int)stage.m_children.size(); ++idx)
+	{
+		FailOutputs(state, input, stage.m_children[ idx ], error);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Frees the result of a stage (with the lock held)
+static void FreeResult(RunState& state, RunInput& input, int stageIndex)
+{
+	delete input.m_rgba[ stageIndex ];
+	delete input.m_indexed[ stageIndex ];
+
+	input.m_rgba[ stageIndex ] = nullptr;
+	input.m_indexed[ stageIndex ] = nullptr;
+
+	state.m_liveBytes -= input.m_bytes[ stageIndex ];
+	input.m_bytes[ stageIndex ] = 0;
+}
+
+//------------------------------------------------------------------------------
+
+class RunWorker
+{
+public:
+	RunWorker(RunState& state)
+		: m_state(state)
+		, m_quantizers(state.m_pManifest->GetStages().size(), nullptr)
+	{
+	}
+
+	~RunWorker()
+	{
+		for (int idx = 0; idx < (int)m_quantizers.size(); ++idx)
+		{
+			delete m_quantizers[ idx ];
+		}
+	}
+
+	// progressStart, and progressEnd are this task's slice of the input's
+	// progress, for the stages that report as they go
+	bool Execute(const RunTask& task, RGBAImage*& pRGBA, IndexedImage*& pIndexed,
+				 std::string& output, float progressStart, float progressEnd);
+
+private:
+	RunState& m_state;
+
+	// Warm, for every image this worker sees
+	Resizer m_resizer;
+	std::vector<Quantizer*> m_quantizers;  // per stage, made on first use
+};
+
+//------------------------------------------------------------------------------
+// Runs without the lock, the parent result can't go away while we need it
+bool RunWorker::Execute(const RunTask& task, RGBAImage*& pRGBA, IndexedImage*& pIndexed,
+						std::string& output, float progressStart, float progressEnd)
+{
+	const ManifestStage& stage = m_state.m_pManifest->GetStages()[ task.m_stage ];
+	RunInput& input = m_state.m_inputs[ task.m_input ];
+
+	const RGBAImage* pParentRGBA = nullptr;
+	const IndexedImage* pParentIndexed = nullptr;
+
+	if (stage.m_parent >= 0)
+	{
+		pParentRGBA    = input.m_rgba[ stage.m_parent ];
+		pParentIndexed = input.m_indexed[ stage.m_parent ];
+	}
+
+	switch (stage.m_iType)
+	{
+	case eStageLoad:
+		pRGBA = LoadRGBAImage(input.m_path);
+		return nullptr != pRGBA;
+
+	case eStageCrop:
+		pRGBA = CropImage(*pParentRGBA, stage.m_width, stage.m_height, stage.m_iJustify);
+		return nullptr != pRGBA;
+
+	case eStageResize:
+		pRGBA = m_resizer.Resize(*pParentRGBA, stage.m_width, stage.m_height,
+								 stage.m_iFilter, stage.m_bResizeDither);
+		return nullptr != pRGBA;
+
+	case eStageQuantize:
+		{
+			ConversionCache* pCache = m_state.m_pOptions->m_pCache;
+			CacheKey key;
+
+			if (pCache)
+			{
+				ConvertOptions options;
+				options.m_quantize = stage.m_quantize;
+
+				key = MakeCacheKey(*pParentRGBA, options);
+				pIndexed = pCache->Load(key);
+
+				if (pIndexed)
+					return true;
+			}
+
+			if (nullptr == m_quantizers[ task.m_stage ])
+				m_quantizers[ task.m_stage ] = new Quantizer(stage.m_quantize);
+
+			Quantizer* pQuantizer = m_quantizers[ task.m_stage ];
+			BatchProgress::Binding binding = { m_state.m_pOptions->m_pProgress, input.m_progressId };
+
+			if (binding.m_pProgress)
+			{
+				pQuantizer->SetProgress(BatchProgress::ReportItem, &binding,
+										progressStart, progressEnd);
+			}
+
+			pIndexed = pQuantizer->Quantize(*pParentRGBA);
+
+			pQuantizer->SetProgress(nullptr, nullptr);
+
+			if (pCache && pIndexed)
+				pCache->Store(key, *pIndexed);
+
+			return nullptr != pIndexed;
+		}
+
+	case eStageSave:
+		output = SavePath(input, stage);
+
+		return MakeDirectories(GetDirectory(output)) &&
+			   SaveConverted(*pParentIndexed, output, stage.m_iFormat,
+							 stage.m_pngLevel);
+	}
+
+	D16_SetError("Manifest, unknown stage type %d", stage.m_iType);
+	return false;
+}
+
+
+//------------------------------------------------------------------------------
+
+static void RunTaskJob(RunState* pState, RunTask task);
+
+// Hands a task to the pool (with the lock held)
+static void SubmitTask(RunState& state, const RunTask& task)
+{
+	RunState* pState = &state;
+
+	++state.m_inputs[ task.m_input ].m_numTasks;
+
+	state.m_handles.push_back(state.m_pJobs->Submit([pState, task]() { RunTaskJob(pState, task); }));
+}
+
+//------------------------------------------------------------------------------
+// Start loading more inputs, while there's room for them (with the lock held)
+static void StartInputs(RunState& state)
+{
+	const std::vector<ManifestStage>& stages = state.m_pManifest->GetStages();
+
+	while ((state.m_nextInput < (int)state.m_inputs.size()) &&
+		   (state.m_numLiveInputs < state.m_maxLiveInputs) &&
+		   ((0 == state.m_numLiveInputs) ||
+			(state.m_liveBytes < state.m_pOptions->m_maxBytes)))
+	{
+		RunTask task;
+		task.m_input = state.m_nextInput++;
+		task.m_stage = 0;
+
+		RunInput& input = state.m_inputs[ task.m_input ];
+		input.m_rgba.assign(stages.size(), nullptr);
+		input.m_indexed.assign(stages.size(), nullptr);
+		input.m_bytes.assign(stages.size(), 0);
+		input.m_pendingChildren.resize(stages.size());
+		input.m_numTasks = 0;
+
+		for (int idx = 0; idx < (int)stages.size(); ++idx)
+		{
+			input.m_pendingChildren[ idx ] = (int)stages[ idx ].m_children.size();
+		}
+
+		++state.m_numLiveInputs;
+
+		SubmitTask(state, task);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+static void RunTaskJob(RunState* pState, RunTask task)
+{
+	RunState& state = *pState;
+	const std::vector<ManifestStage>& stages = state.m_pManifest->GetStages();
+
+	// Only this thread touches its slot, so no lock needed
+	int slot = state.m_pJobs->GetCurrentWorker() + 1;
+
+	if (nullptr == state.m_workers[ slot ])
+		state.m_workers[ slot ] = new RunWorker(state);
+
+	RGBAImage* pRGBA = nullptr;
+	IndexedImage* pIndexed = nullptr;
+	std::string output;
+
+	BatchProgress* pProgress = state.m_pOptions->m_pProgress;
+	bool bSuccess = false;
+	std::string error;
+
+	float numStages = (float)stages.size();
+	float progressStart = 0.0f;
+
+	if (pProgress)
+	{
+		SDL_LockMutex(state.m_pMutex);
+		progressStart = 100.0f * state.m_inputs[ task.m_input ].m_numStagesDone / numStages;
+		SDL_UnlockMutex(state.m_pMutex);
+	}
+
+	int progressId = state.m_inputs[ task.m_input ].m_progressId;
+
+	// The load starts the item, after that, every stage checks in first, so
+	// a cancel skips whatever hasn't run yet
+	bool bRun = !pProgress ||
+				((0 == task.m_stage) ? pProgress->Start(progressId)
+									 : !pProgress->IsCanceled(progressId));
+
+	if (bRun)
+	{
+		bSuccess = state.m_workers[ slot ]->Execute(task, pRGBA, pIndexed, output,
+													progressStart,
+													progressStart + 100.0f / numStages);
+
+		if (!bSuccess)
+			error = D16_GetError();
+	}
+	else
+	{
+		error = "Canceled";
+	}
+
+	SDL_LockMutex(state.m_pMutex);
+
+	const ManifestStage& stage = stages[ task.m_stage ];
+	RunInput& input = state.m_inputs[ task.m_input ];
+
+	bool bHasChildren = false;
+
+	++input.m_numStagesDone;
+
+	if ((0 == task.m_stage) && pRGBA)
+		input.m_numPixels = (long long)pRGBA->GetWidth() * pRGBA->GetHeight();
+
+	if (!bSuccess)
+	{
+		FailOutputs(state, input, task.m_stage, error);
+
+		if (!input.m_bFailed)
+		{
+			input.m_bFailed = true;
+			input.m_error = error;
+		}
+	}
+	else if (eStageSave == stage.m_iType)
+	{
+		ManifestResult result;
+		result.m_input = input.m_path;
+		result.m_output = output;
+		result.m_bSuccess = true;
+
+		if (state.m_pOptions->m_pReport)
+			state.m_pOptions->m_pReport(result, state.m_pOptions->m_pUserData);
+	}
+	else
+	{
+		input.m_rgba[ task.m_stage ] = pRGBA;
+		input.m_indexed[ task.m_stage ] = pIndexed;
+
+		long long bytes = 0;
+
+		if (pRGBA)
+			bytes = (long long)pRGBA->GetWidth() * pRGBA->GetHeight() * sizeof(Uint32);
+		if (pIndexed)
+			bytes = (long long)pIndexed->GetWidth() * pIndexed->GetHeight();
+
+		input.m_bytes[ task.m_stage ] = bytes;
+		state.m_liveBytes += bytes;
+
+		bHasChildren = !stage.m_children.empty();
+
+		if (!bHasChildren)
+			FreeResult(state, input, task.m_stage);
+	}
+
+	// The parent is done with, once all its children have run
+	if (stage.m_parent >= 0)
+	{
+		if (0 == --input.m_pendingChildren[ stage.m_parent ])
+			FreeResult(state, input, stage.m_parent);
+	}
+
+	--input.m_numTasks;
+
+	if (!bHasChildren && (0 == input.m_numTasks))
+	{
+		// This input is all the way through
+		--state.m_numLiveInputs;
+		++state.m_numDoneInputs;
+
+		if (pProgress)
+			pProgress->Finish(input.m_progressId, !input.m_bFailed, input.m_numPixels, input.m_error);
+	}
+	else if (pProgress && bSuccess)
+	{
+		pProgress->SetPercent(input.m_progressId, 100.0f * input.m_numStagesDone / numStages);
+	}
+
+	StartInputs(state);
+
+	// Submitted last, and in reverse, so the first child is the next thing
+	// this worker pops
+	if (bHasChildren)
+	{
+		for (int idx = (int)stage.m_children.size() - 1; idx >= 0; --idx)
+		{
+			RunTask child;
+			child.m_input = task.m_input;
+			child.m_stage = stage.m_children[ idx ];
+
+			SubmitTask(state, child);
+		}
+	}
+
+	SDL_UnlockMutex(state.m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
+int RunManifest(const Manifest& manifest, const ManifestRunOptions& options)
+{
+	RunState state;
+	state.m_pManifest = &manifest;
+	state.m_pOptions = &options;
+	state.m_pJobs = options.m_pJobs ? options.m_pJobs : &JobSystem::GetDefault();
+	state.m_nextInput = 0;
+	state.m_numLiveInputs = 0;
+	state.m_numDoneInputs = 0;
+	state.m_liveBytes = 0;
+	state.m_numFailed = 0;
+
+	// Enough inputs in flight to keep every worker busy, while some of them
+	// are stuck in a load, or a save
+	state.m_maxLiveInputs = 2 * state.m_pJobs->GetNumWorkers();
+
+	if (state.m_maxLiveInputs < 1)
+		state.m_maxLiveInputs = 1;
+
+	state.m_workers.assign(state.m_pJobs->GetNumWorkers() + 1, nullptr);
+
+	const std::vector<std::string>& inputs = manifest.GetInputs();
+
+	for (int idx = 0; idx < (int)inputs.size(); ++idx)
+	{
+		std::vector<std::string> files;
+		std::string root;
+
+		if (IsDirectory(inputs[ idx ]))
+		{
+			CollectImageFiles(inputs[ idx ], manifest.IsRecursive(), files);
+			root = inputs[ idx ];
+		}
+		else
+		{
+			files.push_back(inputs[ idx ]);
+		}
+
+		for (int fileIndex = 0; fileIndex < (int)files.size(); ++fileIndex)
+		{
+			RunInput input;
+			input.m_path = files[ fileIndex ];
+			input.m_root = root;
+			input.m_numTasks = 0;
+			input.m_progressId = 0;
+			input.m_numStagesDone = 0;
+			input.m_numPixels = 0;
+			input.m_bFailed = false;
+
+			if (options.m_pProgress)
+				input.m_progressId = options.m_pProgress->Add(input.m_path);
+
+			state.m_inputs.push_back(input);
+		}
+	}
+
+	if (state.m_inputs.empty())
+	{
+		D16_SetError("Manifest, no images found");
+		return -1;
+	}
+
+	state.m_pMutex = SDL_CreateMutex();
+
+	SDL_LockMutex(state.m_pMutex);
+
+	StartInputs(state);
+
+	// A task submits its children before it's done, so once everything
+	// we've been handed is done, and nothing new has come in, we're through.
+	// Waiting also lends this thread to the resizes
+	while (state.m_numDoneInputs < (int)state.m_inputs.size())
+	{
+		std::vector<JobHandle> handles;
+		handles.swap(state.m_handles);
+
+		SDL_UnlockMutex(state.m_pMutex);
+
+		if (options.m_pTick)
+		{
+			for (int idx = 0; idx < (int)handles.size(); ++idx)
+			{
+				while (!state.m_pJobs->Wait(handles[ idx ], 100))
+				{
+					options.m_pTick(options.m_pUserData);
+				}
+			}
+
+			options.m_pTick(options.m_pUserData);
+		}
+		else
+		{
+			state.m_pJobs->Wait(handles);
+		}
+
+		SDL_LockMutex(state.m_pMutex);
+	}
+
+	SDL_UnlockMutex(state.m_pMutex);
+
+	for (int idx = 0; idx < (int)state.m_workers.size(); ++idx)
+	{
+		delete state.m_workers[ idx ];
+	}
+
+	SDL_DestroyMutex(state.m_pMutex);
+
+	return state.m_numFailed;
+}
@@ -0,0 +1,184 @@
+//
+// Engine Manifest - A conversion, written down as stages, run as a DAG
+//
+// A manifest is an INI file, each section is a stage, and "from" says
+// which stage feeds it.  "load" is always there, and is where every
+// input starts.
+//
+//   [inputs]
+//   path      = art/title        ; files, or directories
+//   recursive = 1
+//
+//   [fit]
+//   type    = crop               ; crop, resize, quantize, or save
+//   from    = load
+//   justify = eCenterCenter
+//   size    = 320x200
+//
+//   [quant]
+//   type      = quantize
+//   from      = fit
+//   posterize = 444
+//   dither    = 50
+//   dither-method = bayer4      ; diffusion, floyd, atkinson, sierralite, jjn,
+//                               ; bayer2-8, cluster4-8, or bluenoise
+//   palette   = dawnbringer16.pal
+//
+//   [c1]
+//   type   = save
+//   from   = quant
+//   format = c1
+//   output = out/c1
+//
+//   [png]
+//   type   = save
+//   from   = quant
+//   format = png                 ; c1, pnt (PackBytes $C0), apf, or png
+//   level  = 9                   ; png only, 0 (stored) to 9 (smallest)
+//   output = out/png
+//
+// Each input is decoded once, and fit, and quant run once, to feed both
+// saves.  Stages that do the same thing, to the same parent, get merged.
+// Relative paths are relative to the manifest.
+//
+#ifndef ENGINE_MANIFEST_H_
+#define ENGINE_MANIFEST_H_
+
+#include "pipeline.h"
+
+#include <string>
+#include <vector>
+
+class JobSystem;
+class BatchProgress;
+
+enum StageType
+{
+	eStageLoad,
+	eStageCrop,
+	eStageResize,
+	eStageQuantize,
+	eStageSave
+};
+
+//------------------------------------------------------------------------------
+
+struct ManifestStage
+{
+	ManifestStage()
+		: m_iType(eStageLoad)
+		, m_parent(-1)
+		, m_width(0)
+		, m_height(0)
+		, m_iJustify(eCenterCenter)
+		, m_iFilter(eAVIR)
+		, m_bResizeDither(false)
+		, m_iFormat(eOutputC1)
+		, m_pngLevel(eDeflateDefault)
+	{
+	}
+
+	std::string m_name;
+	int m_iType;             // StageType
+	int m_parent;            // index into the stages, -1 for load
+	std::vector<int> m_children;
+
+	// crop, and resize
+	int  m_width;
+	int  m_height;
+	int  m_iJustify;         // Justify
+	int  m_iFilter;          // ScaleFilter
+	bool m_bResizeDither;
+
+	// quantize
+	QuantizeSettings m_quantize;
+
+	// save
+	int m_iFormat;           // OutputFormat
+	int m_pngLevel;          // 0-9, like zlib
+	std::string m_outputDirectory;
+	std::string m_suffix;    // added to the file name, before the extension
+};
+
+//------------------------------------------------------------------------------
+
+class Manifest
+{
+public:
+	Manifest();
+	~Manifest();
+
+	// Check D16_GetError() on failure
+	bool Load(const std::string& filenamepath);
+	bool Parse(const std::string& text, const std::string& baseDirectory);
+
+	// More inputs, on top of the ones in [inputs]
+	void AddInput(const std::string& path) { m_inputs.push_back(path); }
+	void SetRecursive(bool bRecursive)     { m_bRecursive = bRecursive; }
+
+	const std::vector<ManifestStage>& GetStages() const { return m_stages; }
+	const std::vector<std::string>& GetInputs() const   { return m_inputs; }
+	bool IsRecursive() const { return m_bRecursive; }
+
+	// Number of save stages, which is the number of outputs per input
+	int GetNumOutputs() const;
+
+private:
+	bool Link();
+
+	std::vector<ManifestStage> m_stages;  // load is always [0]
+	std::vector<std::string> m_parentNames;  // "from", only while parsing
+	std::vector<std::string> m_inputs;
+	bool m_bRecursive;
+};
+
+//------------------------------------------------------------------------------
+
+struct ManifestResult
+{
+	std::string m_input;
+	std::string m_output;
+	bool m_bSuccess;
+	std::string m_error;
+};
+
+struct ManifestRunOptions
+{
+	ManifestRunOptions()
+		: m_pJobs(nullptr)
+		, m_maxBytes(1024LL * 1024 * 1024)
+		, m_pCache(nullptr)
+		, m_pReport(nullptr)
+		, m_pUserData(nullptr)
+		, m_pProgress(nullptr)
+		, m_pTick(nullptr)
+	{
+	}
+
+	JobSystem* m_pJobs;  // nullptr, for JobSystem::GetDefault()
+
+	// Decoded, and in between images, new inputs don't get loaded while
+	// we're over this, one input is always allowed
+	long long m_maxBytes;
+
+	ConversionCache* m_pCache;  // optional
+
+	// Called once per output, from the worker threads, but never from two
+	// at the same time
+	void (*m_pReport)(const ManifestResult& result, void* pUserData);
+	void* m_pUserData;
+
+	// Optional, one item per input, added when the run starts.  Cancelling
+	// an item (or all of them) fails the outputs, that haven't been saved
+	BatchProgress* m_pProgress;
+
+	// Optional, called on the calling thread, about every 100ms, while it
+	// waits, with m_pUserData
+	void (*m_pTick)(void* pUserData);
+};
+
+// Returns the number of outputs that failed, or -1 if it couldn't start
+int RunManifest(const Manifest& manifest, const ManifestRunOptions& options);
+
+#endif // ENGINE_MANIFEST_H_
+
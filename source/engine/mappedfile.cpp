@@ -0,0 +1,166 @@
+//
+// Engine MappedFile - A whole file, read only, mapped into memory
+//
+#include "mappedfile.h"
+
+#include "pixels.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//------------------------------------------------------------------------------
+
+MappedFile::MappedFile()
+	: m_pData(nullptr)
+	, m_size(0)
+	, m_bOpen(false)
+#ifdef _WIN32
+	, m_hFile(INVALID_HANDLE_VALUE)
+	, m_hMapping(nullptr)
+#else
+	, m_fd(-1)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+//------------------------------------------------------------------------------
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& filenamepath)
+{
+	Close();
+
+	m_hFile = CreateFileA(filenamepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+						  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (INVALID_HANDLE_VALUE == m_hFile)
+	{
+		D16_SetError("MappedFile: Unable to open %s", filenamepath.c_str());
+		return false;
+	}
+
+	LARGE_INTEGER size;
+
+	if (!GetFileSizeEx(m_hFile, &size))
+	{
+		D16_SetError("MappedFile: Unable to get the size of %s", filenamepath.c_str());
+		Close();
+		return false;
+	}
+
+	m_size = (size_t)size.QuadPart;
+
+	// Windows won't map an empty file
+	if (m_size)
+	{
+		m_hMapping = CreateFileMappingA(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (m_hMapping)
+			m_pData = (const Uint8*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+
+		if (nullptr == m_pData)
+		{
+			D16_SetError("MappedFile: Unable to map %s", filenamepath.c_str());
+			Close();
+			return false;
+		}
+	}
+
+	m_bOpen = true;
+
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (m_pData)
+		UnmapViewOfFile(m_pData);
+
+	if (m_hMapping)
+		CloseHandle(m_hMapping);
+
+	if (INVALID_HANDLE_VALUE != m_hFile)
+		CloseHandle(m_hFile);
+
+	m_pData = nullptr;
+	m_size = 0;
+	m_bOpen = false;
+	m_hFile = INVALID_HANDLE_VALUE;
+	m_hMapping = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& filenamepath)
+{
+	Close();
+
+	m_fd = open(filenamepath.c_str(), O_RDONLY);
+
+	if (m_fd < 0)
+	{
+		D16_SetError("MappedFile: Unable to open %s", filenamepath.c_str());
+		return false;
+	}
+
+	struct stat info;
+
+	if (0 != fstat(m_fd, &info))
+	{
+		D16_SetError("MappedFile: Unable to get the size of %s", filenamepath.c_str());
+		Close();
+		return false;
+	}
+
+	m_size = (size_t)info.st_size;
+
+	if (m_size)
+	{
+		void* pData = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+
+		if (MAP_FAILED == pData)
+		{
+			D16_SetError("MappedFile: Unable to map %s", filenamepath.c_str());
+			Close();
+			return false;
+		}
+
+		m_pData = (const Uint8*)pData;
+	}
+
+	m_bOpen = true;
+
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (m_pData)
+		munmap((void*)m_pData, m_size);
+
+	if (m_fd >= 0)
+		close(m_fd);
+
+	m_pData = nullptr;
+	m_size = 0;
+	m_bOpen = false;
+	m_fd = -1;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,47 @@
+//
+// Engine MappedFile - A whole file, read only, mapped into memory
+//
+// For readers that go through a lot of small files, or look at a few
+// bytes of a big one, the OS pages in what gets touched, and nothing is
+// copied.  Empty files open fine, with a size of 0, and no data.
+//
+#ifndef ENGINE_MAPPEDFILE_H_
+#define ENGINE_MAPPEDFILE_H_
+
+#include <SDL.h>
+
+#include <string>
+
+class MappedFile
+{
+public:
+	MappedFile();
+	~MappedFile();
+
+	// false, and D16_SetError, if it can't be opened, or mapped
+	bool Open(const std::string& filenamepath);
+	void Close();
+
+	bool IsOpen() const { return m_bOpen; }
+
+	const Uint8* GetData() const { return m_pData; }
+	size_t GetSize() const { return m_size; }
+
+private:
+	const Uint8* m_pData;
+	size_t m_size;
+	bool m_bOpen;
+
+#ifdef _WIN32
+	void* m_hFile;
+	void* m_hMapping;
+#else
+	int m_fd;
+#endif
+
+	// Not copyable
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+};
+
+#endif // ENGINE_MAPPEDFILE_H_
@@ -0,0 +1,289 @@
+//
+// Engine PackBytes - Apple IIgs PackBytes, and UnPackBytes
+//
+#include "packbytes.h"
+
+#include "pixels.h"
+
+#include <limits.h>
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define PACKBYTES_SSE2 1
+#include <emmintrin.h>
+#endif
+
+enum PackGroup
+{
+	ePackLiteral = 0x00,
+	ePackRun     = 0x40,
+	ePackRepeat4 = 0x80,
+	ePackRun4    = 0xC0
+};
+
+static const int MAX_COUNT = 64;
+
+//------------------------------------------------------------------------------
+// How many bytes match, between pA, and pB, up to maxLength.  Called with
+// pB = pA + 1 this is a run, with pB = pA + 4, it's a repeating 4 byte group
+static int MatchLength(const Uint8* pA, const Uint8* pB, int maxLength)
+{
+	int length = 0;
+
+	#if PACKBYTES_SSE2
+	for (; length + 16 <= maxLength; length += 16)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i*)(pA + length));
+		__m128i b = _mm_loadu_si128((const __m128i*)(pB + length));
+
+		int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+
+		if (0xFFFF != mask)
+		{
+			// First byte that's different
+			while (mask & 1)
+			{
+				mask >>= 1;
+				++length;
+			}
+
+			return length;
+		}
+	}
+	#endif
+
+	while ((length < maxLength) && (pA[ length ] == pB[ length ]))
+	{
+		++length;
+	}
+
+	return length;
+}
+
+//------------------------------------------------------------------------------
+// For every position, how far the match, at that distance, goes on.  The
+// scanner jumps from mismatch to mismatch, and fills in the span between
+static void ScanMatches(const Uint8* pSrc, int numBytes, int distance, std::vector<int>& lengths)
+{
+	lengths.assign(numBytes + 1, 0);
+
+	int pos = 0;
+
+	while (pos + distance < numBytes)
+	{
+		int length = MatchLength(pSrc + pos, pSrc + pos + distance, numBytes - pos - distance);
+
+		for (int idx = 0; idx <= length; ++idx)
+		{
+			lengths[ pos + idx ] = length - idx;
+		}
+
+		pos += length + 1;
+	}
+}
+
+//------------------------------------------------------------------------------
+
+struct PackChoice
+{
+	Uint8 m_flag;    // PackGroup
+	Uint8 m_count;   // 1-64
+	int m_length;    // source bytes it covers
+};
+
+void PackBytes(const Uint8* pSrc, size_t numBytes, std::vector<Uint8>& packed)
+{
+	int count = (int)numBytes;
+
+	if (count <= 0)
+		return;
+
+	std::vector<int> sameNext;   // bytes after this one, that are the same
+	std::vector<int> sameFour;   // bytes that match the ones 4 further on
+
+	ScanMatches(pSrc, count, 1, sameNext);
+	ScanMatches(pSrc, count, 4, sameFour);
+
+	// cost[ pos ], is the fewest packed bytes for everything from pos on,
+	// worked out from the end back
+	std::vector<int> cost(count + 1, 0);
+	std::vector<PackChoice> choices(count);
+
+	for (int pos = count - 1; pos >= 0; --pos)
+	{
+		int remaining = count - pos;
+		int best = INT_MAX;
+		PackChoice choice = { ePackLiteral, 1, 1 };
+
+		// Ties go to the first one tried, so runs win over literals, and
+		// the output doesn't depend on anything but the input
+		int runLength = sameNext[ pos ] + 1;
+		int maxRun = runLength < MAX_COUNT ? runLength : MAX_COUNT;
+
+		for (int length = 2; length <= maxRun; ++length)
+		{
+			if (2 + cost[ pos + length ] < best)
+			{
+				best = 2 + cost[ pos + length ];
+				choice.m_flag = ePackRun;
+				choice.m_count = (Uint8)length;
+				choice.m_length = length;
+			}
+		}
+
+		int maxRun4 = runLength / 4;
+
+		if (maxRun4 > MAX_COUNT)
+			maxRun4 = MAX_COUNT;
+
+		for (int groups = 1; groups <= maxRun4; ++groups)
+		{
+			if (2 + cost[ pos + (groups * 4) ] < best)
+			{
+				best = 2 + cost[ pos + (groups * 4) ];
+				choice.m_flag = ePackRun4;
+				choice.m_count = (Uint8)groups;
+				choice.m_length = groups * 4;
+			}
+		}
+
+		// 4 bytes, then as many copies as match the 4 before them
+		int maxRepeat = (remaining >= 4) ? 1 + (sameFour[ pos ] / 4) : 0;
+
+		if (maxRepeat > remaining / 4)
+			maxRepeat = remaining / 4;
+		if (maxRepeat > MAX_COUNT)
+			maxRepeat = MAX_COUNT;
+
+		for (int groups = 1; groups <= maxRepeat; ++groups)
+		{
+			if (5 + cost[ pos + (groups * 4) ] < best)
+			{
+				best = 5 + cost[ pos + (groups * 4) ];
+				choice.m_flag = ePackRepeat4;
+				choice.m_count = (Uint8)groups;
+				choice.m_length = groups * 4;
+			}
+		}
+
+		int maxLiteral = remaining < MAX_COUNT ? remaining : MAX_COUNT;
+
+		for (int length = 1; length <= maxLiteral; ++length)
+		{
+			if (1 + length + cost[ pos + length ] < best)
+			{
+				best = 1 + length + cost[ pos + length ];
+				choice.m_flag = ePackLiteral;
+				choice.m_count = (Uint8)length;
+				choice.m_length = length;
+			}
+		}
+
+		cost[ pos ] = best;
+		choices[ pos ] = choice;
+	}
+
+	//--------------------------------------------------------------------------
+	// Walk the cheapest path, from the front
+
+	size_t start = packed.size();
+	packed.resize(start + cost[ 0 ]);
+
+	Uint8* pOut = &packed[ start ];
+
+	for (int pos = 0; pos < count; pos += choices[ pos ].m_length)
+	{
+		const PackChoice& choice = choices[ pos ];
+
+		*pOut++ = (Uint8)(choice.m_flag | (choice.m_count - 1));
+
+		switch (choice.m_flag)
+		{
+		case ePackLiteral:
+			memcpy(pOut, pSrc + pos, choice.m_length);
+			pOut += choice.m_length;
+			break;
+
+		case ePackRepeat4:
+			memcpy(pOut, pSrc + pos, 4);
+			pOut += 4;
+			break;
+
+		default:
+			*pOut++ = pSrc[ pos ];
+			break;
+		}
+	}
+
+	SDL_assert(pOut == &packed[ 0 ] + packed.size());
+}
+
+//------------------------------------------------------------------------------
+
+size_t UnpackBytes(const Uint8* pSrc, size_t srcBytes, Uint8* pDst, size_t dstBytes)
+{
+	size_t in = 0;
+	size_t out = 0;
+
+	while (out < dstBytes)
+	{
+		if (in >= srcBytes)
+		{
+			D16_SetError("UnpackBytes, ran out of data, at %d of %d bytes",
+						 (int)out, (int)dstBytes);
+			return 0;
+		}
+
+		Uint8 flag = pSrc[ in++ ];
+		size_t count = (flag & 0x3F) + 1;
+		size_t length = count;   // bytes out
+		size_t needed = 1;       // bytes in, after the flag
+
+		switch (flag & 0xC0)
+		{
+		case ePackLiteral: needed = count;                 break;
+		case ePackRepeat4: needed = 4;    length = count * 4; break;
+		case ePackRun4:                   length = count * 4; break;
+		}
+
+		if (in + needed > srcBytes)
+		{
+			D16_SetError("UnpackBytes, ran out of data, at %d of %d bytes",
+						 (int)out, (int)dstBytes);
+			return 0;
+		}
+
+		if (out + length > dstBytes)
+		{
+			D16_SetError("UnpackBytes, group at %d runs %d bytes past the end",
+						 (int)(in - 1), (int)(out + length - dstBytes));
+			return 0;
+		}
+
+		switch (flag & 0xC0)
+		{
+		case ePackLiteral:
+			memcpy(pDst + out, pSrc + in, count);
+			break;
+
+		case ePackRepeat4:
+			for (size_t idx = 0; idx < count; ++idx)
+			{
+				memcpy(pDst + out + (idx * 4), pSrc + in, 4);
+			}
+			break;
+
+		default:
+			memset(pDst + out, pSrc[ in ], length);
+			break;
+		}
+
+		in += needed;
+		out += length;
+	}
+
+	return in;
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,31 @@
+//
+// Engine PackBytes - Apple IIgs PackBytes, and UnPackBytes
+//
+// The compression used by $C0/$0001 (PNT), and APF pictures.  Each group
+// starts with a flag byte, the top 2 bits say what follows, the low 6 bits
+// are the count - 1
+//
+//   00  1-64 bytes, as they are
+//   01  1 byte, repeated 1-64 times
+//   10  4 bytes, repeated 1-64 times
+//   11  1 byte, repeated 4-256 times, in steps of 4
+//
+#ifndef ENGINE_PACKBYTES_H_
+#define ENGINE_PACKBYTES_H_
+
+#include <SDL.h>
+
+#include <vector>
+
+// Appends pSrc to packed, in as few bytes as the format allows.  The
+// toolbox PackBytes picks groups greedily, this tries every grouping (it
+// finds the shortest path through the groups that could start at each
+// byte), so it's never bigger, and usually a few percent smaller
+void PackBytes(const Uint8* pSrc, size_t numBytes, std::vector<Uint8>& packed);
+
+// Unpacks until dstBytes have been written, returns how many packed bytes
+// that took, or 0 if the data runs out, or a group runs past the end of
+// pDst (D16_SetError)
+size_t UnpackBytes(const Uint8* pSrc, size_t srcBytes, Uint8* pDst, size_t dstBytes);
+
+#endif // ENGINE_PACKBYTES_H_
@@ -0,0 +1,740 @@
+//
+// Engine Palettes - Reading palette files, and a library of them on disk
+//
+#include "palettes.h"
+
+#include "cache.h"
+#include "fileio.h"
+#include "files.h"
+#include "jobs.h"
+#include "pixels.h"
+
+#include <ctype.h>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// More than any of the formats can hold, except a big image strip
+static const int MAX_LIBRARY_COLORS = 256;
+
+static inline Uint32 MakeColor(int r, int g, int b)
+{
+	return 0xFF000000 | ((b & 0xFF) << 16) | ((g & 0xFF) << 8) | (r & 0xFF);
+}
+
+static std::string GetLowerExtension(const std::string& filenamepath)
+{
+	size_t dot = filenamepath.find_last_of('.');
+
+	if (std::string::npos == dot)
+		return "";
+
+	std::string ext = filenamepath.substr(dot + 1);
+
+	for (size_t idx = 0; idx < ext.size(); ++idx)
+	{
+		ext[ idx ] = (char)tolower(ext[ idx ]);
+	}
+
+	return ext;
+}
+
+//------------------------------------------------------------------------------
+
+bool IsPaletteFile(const std::string& filenamepath)
+{
+	std::string ext = GetLowerExtension(filenamepath);
+
+	return ("pal" == ext) || ("gpl" == ext) || ("act" == ext) || ("png" == ext);
+}
+
+//------------------------------------------------------------------------------
+//
+// Parsers, each one appends to colors, and stops at maxColors
+//
+//------------------------------------------------------------------------------
+
+// One line at a time, without the end of line, false once there are no more
+static bool NextLine(const char*& pText, const char* pEnd, std::string& line)
+{
+	if (pText >= pEnd)
+		return false;
+
+	const char* pStart = pText;
+
+	while ((pText < pEnd) && ('\n' != *pText) && ('\r' != *pText))
+		++pText;
+
+	line.assign(pStart, pText);
+
+	if ((pText < pEnd) && ('\r' == *pText))
+		++pText;
+	if ((pText < pEnd) && ('\n' == *pText))
+		++pText;
+
+	return true;
+}
+
+static bool StartsWith(const Uint8* pData, size_t numBytes, const char* pMagic)
+{
+	size_t length = strlen(pMagic);
+
+	return (numBytes >= length) && (0 == memcmp(pData, pMagic, length));
+}
+
+//------------------------------------------------------------------------------
+// Paint Shop Pro
+//
+//   JASC-PAL
+//   0100
+//   16
+//   0 0 0
+//   ...
+//
+static bool ParseJASC(const Uint8* pData, size_t numBytes, std::vector<Uint32>& colors,
+					  int maxColors)
+{
+	const char* pText = (const char*)pData;
+	const char* pEnd  = pText + numBytes;
+
+	std::string line;
+	int lineNumber = 0;
+	int numColors  = maxColors;
+
+	while (NextLine(pText, pEnd, line) && ((int)colors.size() < numColors))
+	{
+		++lineNumber;
+
+		if (lineNumber <= 2)
+			continue;  // magic, and version
+
+		if (3 == lineNumber)
+		{
+			numColors = SDL_min(atoi(line.c_str()), maxColors);
+			continue;
+		}
+
+		int r, g, b;
+
+		if (3 == sscanf(line.c_str(), "%d %d %d", &r, &g, &b))
+			colors.push_back(MakeColor(r, g, b));
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// GIMP
+//
+//   GIMP Palette
+//   Name: pico-8
+//   Columns: 8
+//   # comment
+//     0   0   0	black
+//
+static bool ParseGIMP(const Uint8* pData, size_t numBytes, std::vector<Uint32>& colors,
+					  int maxColors)
+{
+	const char* pText = (const char*)pData;
+	const char* pEnd  = pText + numBytes;
+
+	std::string line;
+	NextLine(pText, pEnd, line);  // magic
+
+	while (NextLine(pText, pEnd, line) && ((int)colors.size() < maxColors))
+	{
+		int r, g, b;
+
+		// Name:, Columns:, and comments won't start with a number
+		if (3 == sscanf(line.c_str(), "%d %d %d", &r, &g, &b))
+			colors.push_back(MakeColor(r, g, b));
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Microsoft RIFF palette, a "data" chunk of version, count, then R G B flags
+static bool ParseRIFF(const Uint8* pData, size_t numBytes, std::vector<Uint32>& colors,
+					  int maxColors)
+{
+	size_t offset = 12;  // "RIFF", size, "PAL "
+
+	while (offset + 8 <= numBytes)
+	{
+		Uint32 chunkSize = pData[offset+4] | (pData[offset+5] << 8) |
+						   (pData[offset+6] << 16) | ((Uint32)pData[offset+7] << 24);
+
+		if (0 == memcmp(pData + offset, "data", 4))
+		{
+			const Uint8* pChunk = pData + offset + 8;
+			size_t available = SDL_min((size_t)chunkSize, numBytes - offset - 8);
+
+			if (available < 4)
+				break;
+
+			int numColors = pChunk[2] | (pChunk[3] << 8);
+			numColors = SDL_min(numColors, (int)((available - 4) / 4));
+			numColors = SDL_min(numColors, maxColors);
+
+			for (int idx = 0; idx < numColors; ++idx)
+			{
+				const Uint8* pEntry = pChunk + 4 + (idx * 4);
+				colors.push_back(MakeColor(pEntry[0], pEntry[1], pEntry[2]));
+			}
+
+			return true;
+		}
+
+		offset += 8 + chunkSize + (chunkSize & 1);
+	}
+
+	D16_SetError("RIFF palette, no data chunk");
+	return false;
+}
+
+//------------------------------------------------------------------------------
+// Adobe Color Table, 256 RGB, and maybe a big endian count, and transparent
+// index on the end
+static bool ParseACT(const Uint8* pData, size_t numBytes, std::vector<Uint32>& colors,
+					 int maxColors)
+{
+	if (numBytes < 768)
+	{
+		D16_SetError("Adobe color table is %d bytes, should be 768, or 772", (int)numBytes);
+		return false;
+	}
+
+	int numColors = 256;
+
+	if (numBytes >= 772)
+	{
+		int count = (pData[768] << 8) | pData[769];
+
+		if ((count > 0) && (count <= 256))
+			numColors = count;
+	}
+
+	numColors = SDL_min(numColors, maxColors);
+
+	for (int idx = 0; idx < numColors; ++idx)
+	{
+		const Uint8* pRGB = pData + (idx * 3);
+		colors.push_back(MakeColor(pRGB[0], pRGB[1], pRGB[2]));
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Raw .pal, the way Dream16 has always saved them, 3 bytes per color
+static bool ParseRaw(const Uint8* pData, size_t numBytes, std::vector<Uint32>& colors,
+					 int maxColors)
+{
+	for (size_t offset = 0; (offset + 3 <= numBytes) && ((int)colors.size() < maxColors);
+		 offset += 3)
+	{
+		colors.push_back(MakeColor(pData[offset], pData[offset+1], pData[offset+2]));
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// A row, or a column of colors, each color can be scaled up to a square
+static bool ParseStrip(const RGBAImage& image, std::vector<Uint32>& colors, int maxColors)
+{
+	int width  = image.GetWidth();
+	int height = image.GetHeight();
+
+	int cellSize = SDL_min(width, height);
+	int length   = SDL_max(width, height);
+
+	if ((cellSize < 1) || (0 != (length % cellSize)))
+	{
+		D16_SetError("%dx%d isn't a strip of colors", width, height);
+		return false;
+	}
+
+	int numColors = SDL_min(length / cellSize, maxColors);
+	int center = cellSize / 2;
+
+	for (int idx = 0; idx < numColors; ++idx)
+	{
+		int along = (idx * cellSize) + center;
+
+		Uint32 pixel = (width >= height) ? image.GetPixel(along, center)
+										 : image.GetPixel(center, along);
+
+		colors.push_back(pixel | 0xFF000000);
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool LoadPaletteFile(const std::string& filenamepath, std::vector<Uint32>& colors,
+					 int maxColors)
+{
+	colors.clear();
+
+	std::string ext = GetLowerExtension(filenamepath);
+
+	if ("png" == ext)
+	{
+		RGBAImage* pImage = LoadRGBAImage(filenamepath);
+
+		if (nullptr == pImage)
+			return false;
+
+		bool bParsed = ParseStrip(*pImage, colors, maxColors);
+
+		delete pImage;
+
+		if (!bParsed)
+		{
+			std::string error = D16_GetError();
+			D16_SetError("LoadPaletteFile: %s, %s", filenamepath.c_str(), error.c_str());
+			return false;
+		}
+	}
+	else
+	{
+		MappedFile file;
+
+		if (!file.Open(filenamepath))
+		{
+			D16_SetError("LoadPaletteFile: Unable to open %s", filenamepath.c_str());
+			return false;
+		}
+
+		const Uint8* pData = file.GetData();
+		size_t numBytes = file.GetSize();
+
+		bool bParsed;
+
+		// The text formats say what they are, whatever the extension
+		if (StartsWith(pData, numBytes, "JASC-PAL"))
+			bParsed = ParseJASC(pData, numBytes, colors, maxColors);
+		else if (StartsWith(pData, numBytes, "GIMP Palette"))
+			bParsed = ParseGIMP(pData, numBytes, colors, maxColors);
+		else if (StartsWith(pData, numBytes, "RIFF") && (numBytes >= 12) &&
+				 (0 == memcmp(pData + 8, "PAL ", 4)))
+			bParsed = ParseRIFF(pData, numBytes, colors, maxColors);
+		else if ("act" == ext)
+			bParsed = ParseACT(pData, numBytes, colors, maxColors);
+		else
+			bParsed = ParseRaw(pData, numBytes, colors, maxColors);
+
+		if (!bParsed)
+		{
+			std::string error = D16_GetError();
+			D16_SetError("LoadPaletteFile: %s, %s", filenamepath.c_str(), error.c_str());
+			return false;
+		}
+	}
+
+	if (colors.empty())
+	{
+		D16_SetError("LoadPaletteFile: No colors in %s", filenamepath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+//
+// PaletteLibrary
+//
+// The index is one block, that gets used right where it's mapped
+//
+//   IndexHeader
+//   IndexEntry[ m_numEntries ]    sorted by name, files that didn't parse
+//                                 have no colors, so they aren't tried again
+//   Uint32 colors[]               RGBA
+//   char names[]                  each one 0 terminated
+//
+// It's in the byte order of the machine that wrote it, one from another
+// byte order just gets rebuilt.
+//
+//------------------------------------------------------------------------------
+
+static const char   INDEX_MAGIC[ 8 ]  = { 'D','1','6','P','A','L','I','X' };
+static const Uint32 INDEX_VERSION     = 1;
+static const Uint32 INDEX_BYTE_ORDER  = 0x01020304;
+
+struct PaletteLibrary::IndexHeader
+{
+	char   m_magic[ 8 ];
+	Uint32 m_version;
+	Uint32 m_byteOrder;
+	Uint32 m_numEntries;
+	Uint32 m_numBytes;     // the whole index, header included
+};
+
+struct PaletteLibrary::IndexEntry
+{
+	Sint64 m_modifiedTime;
+	Sint64 m_fileSize;
+	Uint32 m_nameOffset;    // from the start of the index
+	Uint32 m_colorsOffset;
+	Uint32 m_numColors;     // 0 if it didn't parse
+	Uint32 m_reserved;
+};
+
+//------------------------------------------------------------------------------
+
+PaletteLibrary::PaletteLibrary()
+	: m_pEntries(nullptr)
+	, m_pData(nullptr)
+	, m_numParsed(0)
+{
+}
+
+PaletteLibrary::~PaletteLibrary()
+{
+	Close();
+}
+
+void PaletteLibrary::Close()
+{
+	m_index.Close();
+	m_indexBytes.clear();
+
+	m_pEntries = nullptr;
+	m_pData = nullptr;
+	m_palettes.clear();
+
+	m_numParsed = 0;
+	m_errors.clear();
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ std::string PaletteLibrary::DefaultIndexPath(const std::string& directory)
+{
+	char* pPrefPath = SDL_GetPrefPath("dwsJason", "d16");
+
+	if (nullptr == pPrefPath)
+		return "";
+
+	char filename[ 64 ];
+	snprintf(filename, sizeof(filename), "%016llx.idx",
+			 (unsigned long long)HashBytes(directory.c_str(), directory.size()));
+
+	std::string path = JoinPath(JoinPath(pPrefPath, "palettes"), filename);
+
+	SDL_free(pPrefPath);
+
+	return path;
+}
+
+//------------------------------------------------------------------------------
+// Check everything we'll point at is inside the index, a stale, or
+// truncated file just gets rebuilt
+bool PaletteLibrary::Attach(const Uint8* pData, size_t numBytes)
+{
+	m_pEntries = nullptr;
+	m_pData = nullptr;
+
+	if (numBytes < sizeof(IndexHeader))
+		return false;
+
+	const IndexHeader* pHeader = (const IndexHeader*)pData;
+
+	if ((0 != memcmp(pHeader->m_magic, INDEX_MAGIC, sizeof(INDEX_MAGIC))) ||
+		(INDEX_VERSION != pHeader->m_version) ||
+		(INDEX_BYTE_ORDER != pHeader->m_byteOrder) ||
+		(numBytes != pHeader->m_numBytes))
+	{
+		return false;
+	}
+
+	size_t numEntries = pHeader->m_numEntries;
+
+	if (numEntries > ((numBytes - sizeof(IndexHeader)) / sizeof(IndexEntry)))
+		return false;
+
+	const IndexEntry* pEntries = (const IndexEntry*)(pData + sizeof(IndexHeader));
+
+	for (size_t idx = 0; idx < numEntries; ++idx)
+	{
+		const IndexEntry& entry = pEntries[ idx ];
+
+		if ((entry.m_nameOffset >= numBytes) ||
+			(nullptr == memchr(pData + entry.m_nameOffset, 0, numBytes - entry.m_nameOffset)))
+		{
+			return false;
+		}
+
+		if ((entry.m_numColors > MAX_LIBRARY_COLORS) || (0 != (entry.m_colorsOffset & 3)) ||
+			((size_t)entry.m_colorsOffset + (entry.m_numColors * sizeof(Uint32)) > numBytes))
+		{
+			return false;
+		}
+	}
+
+	m_pEntries = pEntries;
+	m_pData = pData;
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool PaletteLibrary::Open(const std::string& directory, const std::string& indexPath)
+{
+	Close();
+
+	if (!IsDirectory(directory))
+	{
+		D16_SetError("PaletteLibrary: %s isn't a directory", directory.c_str());
+		return false;
+	}
+
+	m_directory = directory;
+
+	struct Found
+	{
+		std::string m_name;
+		std::string m_path;
+		long long m_modifiedTime;
+		long long m_fileSize;
+		int m_oldEntry;                // in the index we mapped, or -1
+		std::vector<Uint32> m_colors;  // if we had to parse it
+		std::string m_error;
+	};
+
+	std::vector<Found> found;
+
+	{
+		std::vector<std::string> files;
+		CollectFiles(directory, false, files);
+
+		found.reserve(files.size());
+
+		for (size_t idx = 0; idx < files.size(); ++idx)
+		{
+			if (!IsPaletteFile(files[ idx ]))
+				continue;
+
+			Found file;
+			file.m_name = GetFileName(files[ idx ]);
+			file.m_path = files[ idx ];
+			file.m_modifiedTime = GetModifiedTime(files[ idx ]);
+			file.m_fileSize = GetFileSize(files[ idx ]);
+			file.m_oldEntry = -1;
+
+			found.push_back(file);
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// Match them up with the index from last time
+
+	int numOldEntries = 0;
+
+	if (!indexPath.empty() && FileExists(indexPath) && m_index.Open(indexPath))
+	{
+		if (Attach(m_index.GetData(), m_index.GetSize()))
+			numOldEntries = (int)((const IndexHeader*)m_pData)->m_numEntries;
+		else
+			m_index.Close();
+	}
+
+	std::map<std::string, int> oldEntries;
+
+	for (int idx = 0; idx < numOldEntries; ++idx)
+	{
+		oldEntries[ (const char*)(m_pData + m_pEntries[ idx ].m_nameOffset) ] = idx;
+	}
+
+	std::vector<int> toParse;
+
+	for (int idx = 0; idx < (int)found.size(); ++idx)
+	{
+		Found& file = found[ idx ];
+
+		std::map<std::string, int>::const_iterator it = oldEntries.find(file.m_name);
+
+		if ((oldEntries.end() != it) &&
+			(m_pEntries[ it->second ].m_modifiedTime == file.m_modifiedTime) &&
+			(m_pEntries[ it->second ].m_fileSize == file.m_fileSize))
+		{
+			file.m_oldEntry = it->second;
+		}
+		else
+		{
+			toParse.push_back(idx);
+		}
+	}
+
+	// Nothing new, changed, or gone, use the index where it's mapped
+	if (toParse.empty() && (numOldEntries == (int)found.size()) && m_index.IsOpen())
+	{
+		for (size_t idx = 0; idx < found.size(); ++idx)
+		{
+			if (m_pEntries[ found[ idx ].m_oldEntry ].m_numColors > 0)
+				m_palettes.push_back(found[ idx ].m_oldEntry);
+		}
+
+		return true;
+	}
+
+	//--------------------------------------------------------------------------
+	// Parse what we have to, and build a new index
+
+	JobSystem::GetDefault().ParallelFor(0, (int)toParse.size(), 8, [&](int start, int end)
+	{
+		for (int idx = start; idx < end; ++idx)
+		{
+			Found& file = found[ toParse[ idx ] ];
+
+			if (!LoadPaletteFile(file.m_path, file.m_colors, MAX_LIBRARY_COLORS))
+			{
+				file.m_colors.clear();
+				file.m_error = D16_GetError();
+			}
+		}
+	});
+
+	m_numParsed = (int)toParse.size();
+
+	size_t numColors = 0;
+	size_t numNameBytes = 0;
+
+	for (size_t idx = 0; idx < found.size(); ++idx)
+	{
+		const Found& file = found[ idx ];
+
+		if (file.m_oldEntry >= 0)
+			numColors += m_pEntries[ file.m_oldEntry ].m_numColors;
+		else
+			numColors += file.m_colors.size();
+
+		numNameBytes += file.m_name.size() + 1;
+
+		if (!file.m_error.empty())
+			m_errors.push_back(file.m_error);
+	}
+
+	size_t entriesOffset = sizeof(IndexHeader);
+	size_t colorsOffset  = entriesOffset + (found.size() * sizeof(IndexEntry));
+	size_t namesOffset   = colorsOffset + (numColors * sizeof(Uint32));
+	size_t numBytes      = namesOffset + numNameBytes;
+
+	std::vector<Uint8> index(numBytes, 0);
+
+	IndexHeader* pHeader = (IndexHeader*)&index[0];
+	memcpy(pHeader->m_magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+	pHeader->m_version    = INDEX_VERSION;
+	pHeader->m_byteOrder  = INDEX_BYTE_ORDER;
+	pHeader->m_numEntries = (Uint32)found.size();
+	pHeader->m_numBytes   = (Uint32)numBytes;
+
+	IndexEntry* pEntries = (IndexEntry*)&index[ entriesOffset ];
+
+	for (size_t idx = 0; idx < found.size(); ++idx)
+	{
+		const Found& file = found[ idx ];
+		IndexEntry& entry = pEntries[ idx ];
+
+		const Uint32* pColors;
+
+		if (file.m_oldEntry >= 0)
+		{
+			const IndexEntry& oldEntry = m_pEntries[ file.m_oldEntry ];
+			pColors = (const Uint32*)(m_pData + oldEntry.m_colorsOffset);
+			entry.m_numColors = oldEntry.m_numColors;
+		}
+		else
+		{
+			pColors = file.m_colors.empty() ? nullptr : &file.m_colors[0];
+			entry.m_numColors = (Uint32)file.m_colors.size();
+		}
+
+		entry.m_modifiedTime = file.m_modifiedTime;
+		entry.m_fileSize     = file.m_fileSize;
+		entry.m_colorsOffset = (Uint32)colorsOffset;
+		entry.m_nameOffset   = (Uint32)namesOffset;
+
+		if (entry.m_numColors)
+			memcpy(&index[ colorsOffset ], pColors, entry.m_numColors * sizeof(Uint32));
+
+		memcpy(&index[ namesOffset ], file.m_name.c_str(), file.m_name.size() + 1);
+
+		colorsOffset += entry.m_numColors * sizeof(Uint32);
+		namesOffset  += file.m_name.size() + 1;
+	}
+
+	// Done with the old one, which has to be unmapped, before Windows will
+	// let us replace it
+	m_index.Close();
+
+	m_indexBytes.swap(index);
+	Attach(&m_indexBytes[0], m_indexBytes.size());
+
+	for (size_t idx = 0; idx < found.size(); ++idx)
+	{
+		if (m_pEntries[ idx ].m_numColors > 0)
+			m_palettes.push_back((int)idx);
+	}
+
+	//--------------------------------------------------------------------------
+	// Save it for next time, not being able to is only slower
+
+	if (!indexPath.empty() && MakeDirectories(GetDirectory(indexPath)))
+	{
+		std::string tempPath = indexPath + ".tmp";
+
+		FILE* pFile = fopen(tempPath.c_str(), "wb");
+
+		if (pFile)
+		{
+			bool bWritten = (m_indexBytes.size() == fwrite(&m_indexBytes[0], 1,
+														   m_indexBytes.size(), pFile));
+
+			bWritten = (0 == fclose(pFile)) && bWritten;
+
+			if (bWritten)
+			{
+				// Windows won't rename on top of an existing file
+				if (0 != rename(tempPath.c_str(), indexPath.c_str()))
+				{
+					remove(indexPath.c_str());
+					bWritten = (0 == rename(tempPath.c_str(), indexPath.c_str()));
+				}
+			}
+
+			if (!bWritten)
+				remove(tempPath.c_str());
+		}
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+const char* PaletteLibrary::GetName(int index) const
+{
+	return (const char*)(m_pData + m_pEntries[ m_palettes[ index ] ].m_nameOffset);
+}
+
+std::string PaletteLibrary::GetPath(int index) const
+{
+	return JoinPath(m_directory, GetName(index));
+}
+
+int PaletteLibrary::GetNumColors(int index) const
+{
+	return (int)m_pEntries[ m_palettes[ index ] ].m_numColors;
+}
+
+const Uint32* PaletteLibrary::GetColors(int index) const
+{
+	return (const Uint32*)(m_pData + m_pEntries[ m_palettes[ index ] ].m_colorsOffset);
+}
@@ -0,0 +1,84 @@
+//
+// Engine Palettes - Reading palette files, and a library of them on disk
+//
+// A library is one folder of palettes.  Every file in it gets parsed once,
+// and what came out goes in a binary index, that's mapped back in on the
+// next run.  A file is only parsed again when its modified time, or size
+// changes, so a folder with thousands of palettes costs a directory scan,
+// and a page or two of index at startup.
+//
+#ifndef ENGINE_PALETTES_H_
+#define ENGINE_PALETTES_H_
+
+#include "mappedfile.h"
+
+#include <SDL.h>
+
+#include <string>
+#include <vector>
+
+// Does the extension look like a palette we can read?  .pal (raw RGB,
+// JASC, or RIFF), .gpl (GIMP), .act (Adobe), and .png strips
+bool IsPaletteFile(const std::string& filenamepath);
+
+// Colors are RGBA, with alpha forced to 0xFF.  Raw .pal files are 3 bytes
+// per color, .png files are a strip of colors, 1xN or Nx1, or the same
+// with each color scaled up to a square (lospec's "-1x", and "-8x" files)
+bool LoadPaletteFile(const std::string& filenamepath, std::vector<Uint32>& colors,
+					 int maxColors = 16);
+
+//------------------------------------------------------------------------------
+
+class PaletteLibrary
+{
+public:
+	PaletteLibrary();
+	~PaletteLibrary();
+
+	// Every palette in directory (not sub-directories), sorted by file name.
+	// The index lives at indexPath, "" to parse everything, every time.
+	// Only fails (with D16_SetError) if the directory isn't there, files
+	// that won't parse are left out, and listed in GetErrors
+	bool Open(const std::string& directory, const std::string& indexPath);
+	void Close();
+
+	// Where a library for directory keeps its index, in the user's
+	// preferences folder, "" if there isn't one
+	static std::string DefaultIndexPath(const std::string& directory);
+
+	int GetNumPalettes() const { return (int)m_palettes.size(); }
+
+	const char* GetName(int index) const;    // file name, with the extension
+	std::string GetPath(int index) const;
+	int GetNumColors(int index) const;
+	const Uint32* GetColors(int index) const;
+
+	// How many files were parsed by Open, rather than taken from the index
+	int GetNumParsed() const { return m_numParsed; }
+
+	const std::vector<std::string>& GetErrors() const { return m_errors; }
+
+private:
+	struct IndexHeader;
+	struct IndexEntry;
+
+	bool Attach(const Uint8* pData, size_t numBytes);
+
+	std::string m_directory;
+
+	MappedFile m_index;
+	std::vector<Uint8> m_indexBytes;  // when the index couldn't be written
+
+	const IndexEntry* m_pEntries;
+	const Uint8* m_pData;
+	std::vector<int> m_palettes;      // entries that have colors
+
+	int m_numParsed;
+	std::vector<std::string> m_errors;
+
+	// Not copyable
+	PaletteLibrary(const PaletteLibrary&);
+	PaletteLibrary& operator=(const PaletteLibrary&);
+};
+
+#endif // ENGINE_PALETTES_H_
@@ -0,0 +1,257 @@
+//
+// Engine Pipeline - load -> resize/crop -> quantize -> save
+//
+#include "pipeline.h"
+
+#include "cache.h"
+#include "files.h"
+
+//------------------------------------------------------------------------------
+
+IndexedImage* ConvertImage(const RGBAImage& source, const ConvertOptions& options)
+{
+	Converter converter(options);
+
+	return converter.Convert(source);
+}
+
+//------------------------------------------------------------------------------
+
+bool SaveConverted(const IndexedImage& image, const std::string& filenamepath, int iFormat,
+				   int pngLevel)
+{
+	switch (iFormat)
+	{
+	case eOutputC1:
+		return SaveC1(image, filenamepath);
+	case eOutputPNG:
+		return SavePNG(image, filenamepath, pngLevel);
+	case eOutputPNT:
+		return SavePNT(image, filenamepath);
+	case eOutputAPF:
+		return SaveAPF(image, filenamepath);
+	}
+
+	D16_SetError("SaveConverted, unknown format %d", iFormat);
+	return false;
+}
+
+//------------------------------------------------------------------------------
+
+bool EncodeConverted(const IndexedImage& image, int iFormat, std::vector<Uint8>& data,
+					 int pngLevel)
+{
+	switch (iFormat)
+	{
+	case eOutputC1:
+		data.resize(0x8000);
+		BuildC1(image, &data[0]);
+		return true;
+	case eOutputPNG:
+		return EncodePNG(image, data, pngLevel);
+	case eOutputPNT:
+		return EncodePNT(image, data);
+	case eOutputAPF:
+		return EncodeAPF(image, data);
+	}
+
+	D16_SetError("EncodeConverted, unknown format %d", iFormat);
+	return false;
+}
+
+//------------------------------------------------------------------------------
+
+bool ConvertFile(const std::string& inputPath, const std::string& outputPath,
+				 const ConvertOptions& options)
+{
+	Converter converter(options);
+
+	return converter.ConvertFile(inputPath, outputPath);
+}
+
+//------------------------------------------------------------------------------
+
+const char* OutputExtension(int iFormat)
+{
+	switch (iFormat)
+	{
+	case eOutputC1:
+		return ".c1";
+	case eOutputPNG:
+		return ".png";
+	case eOutputPNT:
+		return ".pnt";
+	case eOutputAPF:
+		return ".apf";
+	}
+
+	return "";
+}
+
+//------------------------------------------------------------------------------
+
+std::string MakeOutputPath(const std::string& inputPath, const std::string& root,
+						   const std::string& outputDirectory, int iFormat)
+{
+	std::string output = RemoveExtension(inputPath) + OutputExtension(iFormat);
+
+	if (!outputDirectory.empty())
+	{
+		// Keep the layout under the directory we were given
+		std::string relative = GetFileName(output);
+
+		if (!root.empty() && (0 == output.compare(0, root.size(), root)))
+		{
+			relative = output.substr(root.size());
+
+			while (!relative.empty() && (('/' == relative[0]) || ('\\' == relative[0])))
+				relative = relative.substr(1);
+		}
+
+		output = JoinPath(outputDirectory, relative);
+	}
+
+	// Never write over the source, png -> png
+	if (output == inputPath)
+	{
+		output = RemoveExtension(output) + "_d16" + OutputExtension(iFormat);
+	}
+
+	return output;
+}
+
+//------------------------------------------------------------------------------
+
+Converter::Converter(const ConvertOptions& options, ConversionCache* pCache)
+	: m_options(options)
+	, m_pCache(pCache)
+	, m_pProgress(nullptr)
+	, m_pProgressData(nullptr)
+	, m_quantizer(options.m_quantize)
+{
+}
+
+Converter::~Converter()
+{
+}
+
+//------------------------------------------------------------------------------
+
+// Rough share of the time each stage takes, in percent, where it ends
+static const float PROGRESS_LOADED    = 10.0f;
+static const float PROGRESS_RESIZED   = 25.0f;
+static const float PROGRESS_QUANTIZED = 95.0f;
+
+void Converter::SetProgress(ProgressFunc pFunc, void* pUserData)
+{
+	m_pProgress = pFunc;
+	m_pProgressData = pUserData;
+
+	m_quantizer.SetProgress(pFunc, pUserData, PROGRESS_RESIZED, PROGRESS_QUANTIZED);
+}
+
+// false, and the error is set, if we've been asked to stop
+bool Converter::Report(float percent)
+{
+	if (m_pProgress && !m_pProgress(percent, m_pProgressData))
+	{
+		D16_SetError("Canceled");
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* Converter::Convert(const RGBAImage& source)
+{
+	CacheKey key;
+
+	if (m_pCache)
+	{
+		key = MakeCacheKey(source, m_options);
+
+		IndexedImage* pCached = m_pCache->Load(key);
+
+		if (pCached)
+		{
+			Report(PROGRESS_QUANTIZED);
+			return pCached;
+		}
+	}
+
+	const RGBAImage* pImage = &source;
+	RGBAImage* pResized = nullptr;
+
+	int width  = m_options.m_width  > 0 ? m_options.m_width  : source.GetWidth();
+	int height = m_options.m_height > 0 ? m_options.m_height : source.GetHeight();
+
+	if ((width != source.GetWidth()) || (height != source.GetHeight()))
+	{
+		if (m_options.m_bCrop)
+			pResized = CropImage(source, width, height, m_options.m_iJustify);
+		else
+			pResized = m_resizer.Resize(source, width, height, m_options.m_iFilter, m_options.m_bResizeDither);
+
+		if (nullptr == pResized)
+			return nullptr;
+
+		pImage = pResized;
+	}
+
+	if (!Report(PROGRESS_RESIZED))
+	{
+		delete pResized;
+		return nullptr;
+	}
+
+	IndexedImage* pResult = m_quantizer.Quantize(*pImage);
+
+	delete pResized;
+
+	if (m_pCache && pResult)
+	{
+		// A cache that can't be written, shouldn't stop the conversion
+		m_pCache->Store(key, *pResult);
+	}
+
+	return pResult;
+}
+
+//------------------------------------------------------------------------------
+
+bool Converter::ConvertFile(const std::string& inputPath, const std::string& outputPath,
+							long long* pSourcePixels)
+{
+	RGBAImage* pSource = LoadRGBAImage(inputPath);
+
+	if (nullptr == pSource)
+		return false;
+
+	if (pSourcePixels)
+		*pSourcePixels = (long long)pSource->GetWidth() * pSource->GetHeight();
+
+	if (!Report(PROGRESS_LOADED))
+	{
+		delete pSource;
+		return false;
+	}
+
+	IndexedImage* pResult = Convert(*pSource);
+
+	delete pSource;
+
+	if (nullptr == pResult)
+		return false;
+
+	bool bResult = SaveConverted(*pResult, outputPath, m_options.m_iFormat,
+								 m_options.m_pngLevel);
+
+	delete pResult;
+
+	return bResult;
+}
+
+//------------------------------------------------------------------------------
+
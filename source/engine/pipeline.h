@@ -0,0 +1,122 @@
+//
+// Engine Pipeline - load -> resize/crop -> quantize -> save
+//
+// This is the whole conversion, with no window, and no OpenGL, so it can
+// be driven by the GUI, the command line, or anything else
+//
+#ifndef ENGINE_PIPELINE_H_
+#define ENGINE_PIPELINE_H_
+
+#include "pixels.h"
+#include "resize.h"
+#include "quantize.h"
+#include "fileio.h"
+
+#include <string>
+
+enum OutputFormat
+{
+	eOutputC1,
+	eOutputPNG,
+	eOutputPNT,   // $C0/$0001, PackBytes
+	eOutputAPF    // $C0/$0002, any size
+};
+
+//------------------------------------------------------------------------------
+
+struct ConvertOptions
+{
+	ConvertOptions()
+		: m_width(0)
+		, m_height(0)
+		, m_bCrop(false)
+		, m_iJustify(eCenterCenter)
+		, m_iFilter(eAVIR)
+		, m_bResizeDither(false)
+		, m_iFormat(eOutputC1)
+		, m_pngLevel(eDeflateDefault)
+	{
+	}
+
+	// New size, leave at 0 to keep the source size
+	int  m_width;
+	int  m_height;
+	bool m_bCrop;         // Reposition, instead of scale
+	int  m_iJustify;      // Justify, when cropping
+	int  m_iFilter;       // ScaleFilter, when scaling
+	bool m_bResizeDither; // AVIR only
+
+	QuantizeSettings m_quantize;
+
+	int m_iFormat;        // OutputFormat
+	int m_pngLevel;       // 0-9, like zlib, for eOutputPNG
+};
+
+//------------------------------------------------------------------------------
+
+// Resize (if asked), and Quantize, caller owns the result
+IndexedImage* ConvertImage(const RGBAImage& source, const ConvertOptions& options);
+
+bool SaveConverted(const IndexedImage& image, const std::string& filenamepath, int iFormat,
+				   int pngLevel = eDeflateDefault);
+
+// The bytes SaveConverted would have written, for streaming
+bool EncodeConverted(const IndexedImage& image, int iFormat, std::vector<Uint8>& data,
+					 int pngLevel = eDeflateDefault);
+
+// The whole thing, file to file, check D16_GetError() on failure
+bool ConvertFile(const std::string& inputPath, const std::string& outputPath,
+				 const ConvertOptions& options);
+
+// ".c1", ".png", ".pnt", or ".apf"
+const char* OutputExtension(int iFormat);
+
+// Where the result for inputPath goes, next to it if outputDirectory is
+// empty, otherwise under outputDirectory, keeping the layout below root
+// If the result would land on top of the input, it gets a _d16 suffix
+std::string MakeOutputPath(const std::string& inputPath, const std::string& root,
+						   const std::string& outputDirectory, int iFormat);
+
+class ConversionCache;
+
+//------------------------------------------------------------------------------
+//
+// Warm version of the pipeline, a worker keeps one of these, and converts
+// image after image, without setting up the resizer, or quantizer again
+//
+// One per thread, but they can all share the same pCache
+//
+class Converter
+{
+public:
+	Converter(const ConvertOptions& options, ConversionCache* pCache = nullptr);
+	~Converter();
+
+	IndexedImage* Convert(const RGBAImage& source);
+
+	// pSourcePixels, if not null, gets the decoded width * height
+	bool ConvertFile(const std::string& inputPath, const std::string& outputPath,
+					 long long* pSourcePixels = nullptr);
+
+	const ConvertOptions& GetOptions() const { return m_options; }
+
+	// Reported as each stage finishes, and from inside the quantize.  If
+	// pFunc returns false, the conversion stops, and fails.  nullptr, to
+	// stop reporting
+	void SetProgress(ProgressFunc pFunc, void* pUserData);
+
+private:
+	bool Report(float percent);
+
+	ConvertOptions m_options;
+	ConversionCache* m_pCache;
+
+	ProgressFunc m_pProgress;
+	void* m_pProgressData;
+
+	Resizer   m_resizer;
+	Quantizer m_quantizer;
+};
+
+#endif // ENGINE_PIPELINE_H_
+
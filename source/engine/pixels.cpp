@@ -0,0 +1,314 @@
+//
+// Engine Pixels - Plain memory images, for the conversion engine
+//
+#include "pixels.h"
+
+#include "jobs.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+
+static thread_local char t_errorMessage[ 1024 ] = { 0 };
+
+void D16_SetError(const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	vsnprintf(t_errorMessage, sizeof(t_errorMessage), format, args);
+	va_end(args);
+}
+
+const char* D16_GetError()
+{
+	return t_errorMessage;
+}
+
+//------------------------------------------------------------------------------
+
+RGBAImage::RGBAImage(int width, int height)
+	: m_width(width)
+	, m_height(height)
+{
+	m_pixels.resize((size_t)width * height, 0);
+}
+
+RGBAImage::RGBAImage(const Uint32* pPixels, int width, int height)
+	: m_width(width)
+	, m_height(height)
+{
+	m_pixels.assign(pPixels, pPixels + ((size_t)width * height));
+}
+
+RGBAImage::~RGBAImage()
+{
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ RGBAImage* RGBAImage::FromSurface(SDL_Surface* pSurface)
+{
+	if ((nullptr == pSurface) || (pSurface->w <= 0) || (pSurface->h <= 0))
+	{
+		D16_SetError("RGBAImage::FromSurface, no pixels");
+		return nullptr;
+	}
+
+	RGBAImage* pImage = new RGBAImage(pSurface->w, pSurface->h);
+
+	SDL_Surface* pDest = pImage->WrapSurface();
+
+	if (nullptr == pDest)
+	{
+		D16_SetError("RGBAImage::FromSurface, %s", SDL_GetError());
+		delete pImage;
+		return nullptr;
+	}
+
+	/* Save the alpha blending attributes */
+	SDL_BlendMode saved_mode;
+	SDL_GetSurfaceBlendMode(pSurface, &saved_mode);
+	SDL_SetSurfaceBlendMode(pSurface, SDL_BLENDMODE_NONE);
+
+	SDL_Rect area = { 0, 0, pSurface->w, pSurface->h };
+	SDL_BlitSurface(pSurface, &area, pDest, &area);
+
+	/* Restore the alpha blending attributes */
+	SDL_SetSurfaceBlendMode(pSurface, saved_mode);
+
+	SDL_FreeSurface(pDest);
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+
+SDL_Surface* RGBAImage::CreateSurface() const
+{
+	SDL_Surface* pSurface = SDL_CreateRGBSurfaceWithFormat(0, m_width, m_height,
+														   32, SDL_PIXELFORMAT_RGBA32);
+	if (nullptr == pSurface)
+		return nullptr;
+
+	if( SDL_MUSTLOCK(pSurface) )
+		SDL_LockSurface(pSurface);
+
+	for (int y = 0; y < m_height; ++y)
+	{
+		Uint8* pDest = (Uint8*)pSurface->pixels + (y * pSurface->pitch);
+		memcpy(pDest, &m_pixels[ (size_t)y * m_width ], m_width * sizeof(Uint32));
+	}
+
+	if( SDL_MUSTLOCK(pSurface) )
+		SDL_UnlockSurface(pSurface);
+
+	return pSurface;
+}
+
+SDL_Surface* RGBAImage::WrapSurface()
+{
+	return SDL_CreateRGBSurfaceWithFormatFrom(&m_pixels[0], m_width, m_height,
+											  32, m_width * sizeof(Uint32),
+											  SDL_PIXELFORMAT_RGBA32);
+}
+
+//------------------------------------------------------------------------------
+
+Uint32 RGBAImage::GetPixel(int x, int y) const
+{
+	if (x < 0) x = 0;
+	if (x >= m_width) x = m_width-1;
+	if (y < 0) y = 0;
+	if (y >= m_height) y = m_height-1;
+
+	return m_pixels[ ((size_t)y * m_width) + x ];
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage::IndexedImage(int width, int height, int numColors)
+	: m_width(width)
+	, m_height(height)
+{
+	m_pixels.resize((size_t)width * height, 0);
+	m_palette.resize(numColors, 0xFF000000);
+}
+
+IndexedImage::~IndexedImage()
+{
+}
+
+//------------------------------------------------------------------------------
+
+SDL_Surface* IndexedImage::CreateSurface() const
+{
+	SDL_Surface* pSurface = SDL_CreateRGBSurfaceWithFormat(0, m_width, m_height,
+														   8, SDL_PIXELFORMAT_INDEX8);
+	if (nullptr == pSurface)
+		return nullptr;
+
+	// RGBA32 is byte for byte, the same as an SDL_Color
+	SDL_SetPaletteColors(pSurface->format->palette, (const SDL_Color*)&m_palette[0],
+						 0, (int)m_palette.size());
+
+	if( SDL_MUSTLOCK(pSurface) )
+		SDL_LockSurface(pSurface);
+
+	for (int y = 0; y < m_height; ++y)
+	{
+		Uint8* pDest = (Uint8*)pSurface->pixels + (y * pSurface->pitch);
+		memcpy(pDest, &m_pixels[ (size_t)y * m_width ], m_width);
+	}
+
+	if( SDL_MUSTLOCK(pSurface) )
+		SDL_UnlockSurface(pSurface);
+
+	return pSurface;
+}
+
+//------------------------------------------------------------------------------
+
+Uint8 IndexedImage::GetIndex(int x, int y) const
+{
+	if (x < 0) x = 0;
+	if (x >= m_width) x = m_width-1;
+	if (y < 0) y = 0;
+	if (y >= m_height) y = m_height-1;
+
+	return m_pixels[ ((size_t)y * m_width) + x ];
+}
+
+//------------------------------------------------------------------------------
+
+int ClosestIndex(const Uint32* pPalette, int numColors, Uint32 color)
+{
+	int targetRed   = (color >> 0) & 0xFF;
+	int targetGreen = (color >> 8) & 0xFF;
+	int targetBlue  = (color >>16) & 0xFF;
+
+	int closestIndex = 0;
+	long closestDistance = 0x7FFFFFFF;
+
+	for (int idx = 0; idx < numColors; ++idx)
+	{
+		Uint32 entry = pPalette[ idx ];
+
+		int deltaRed   = (int)((entry >> 0) & 0xFF) - targetRed;
+		int deltaGreen = (int)((entry >> 8) & 0xFF) - targetGreen;
+		int deltaBlue  = (int)((entry >>16) & 0xFF) - targetBlue;
+
+		long distance = (deltaRed * deltaRed) + (deltaGreen * deltaGreen) + (deltaBlue * deltaBlue);
+
+		if (distance < closestDistance)
+		{
+			closestDistance = distance;
+			closestIndex = idx;
+		}
+	}
+
+	return closestIndex;
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* RemapToPalette(const RGBAImage& image, const Uint32* pPalette, int numColors)
+{
+	int width  = image.GetWidth();
+	int height = image.GetHeight();
+
+	IndexedImage* pResult = new IndexedImage(width, height, numColors);
+
+	memcpy(pResult->GetPalette(), pPalette, numColors * sizeof(Uint32));
+
+	const Uint32* pSource = image.GetPixels();
+	Uint8* pDest = pResult->GetPixels();
+
+	// Images have a lot of runs, so don't search again for the same color
+	Uint32 lastColor = 0;
+	int lastIndex = -1;
+
+	for (size_t idx = 0; idx < (size_t)width * height; ++idx)
+	{
+		Uint32 color = pSource[ idx ];
+
+		if ((lastIndex < 0) || (color != lastColor))
+		{
+			lastColor = color;
+			lastIndex = ClosestIndex(pPalette, numColors, color);
+		}
+
+		pDest[ idx ] = (Uint8)lastIndex;
+	}
+
+	return pResult;
+}
+
+//------------------------------------------------------------------------------
+
+int CountUniqueColors(const RGBAImage& image)
+{
+	int width  = image.GetWidth();
+	int height = image.GetHeight();
+
+	JobSystem& jobs = JobSystem::GetDefault();
+
+	// Each band of rows, sorts its own colors
+	int numBands = jobs.GetNumWorkers() + 1;
+
+	if (numBands > height)
+		numBands = height;
+
+	std::vector< std::vector<Uint32> > bands(numBands);
+
+	jobs.ParallelFor(0, numBands, 1, [&](int start, int end)
+	{
+		for (int band = start; band < end; ++band)
+		{
+			int y0 = (int)(((long long)height * band) / numBands);
+			int y1 = (int)(((long long)height * (band + 1)) / numBands);
+
+			const Uint32* pPixels = image.GetPixels() + ((size_t)y0 * width);
+
+			std::vector<Uint32>& colors = bands[ band ];
+			colors.assign(pPixels, pPixels + ((size_t)(y1 - y0) * width));
+
+			std::sort(colors.begin(), colors.end());
+			colors.erase(std::unique(colors.begin(), colors.end()), colors.end());
+		}
+	});
+
+	// Then merge them in pairs, until there is only one left
+	while (bands.size() > 1)
+	{
+		int numPairs = (int)bands.size() / 2;
+
+		std::vector< std::vector<Uint32> > merged((bands.size() + 1) / 2);
+
+		jobs.ParallelFor(0, numPairs, 1, [&](int start, int end)
+		{
+			for (int pair = start; pair < end; ++pair)
+			{
+				const std::vector<Uint32>& a = bands[ pair * 2 ];
+				const std::vector<Uint32>& b = bands[ (pair * 2) + 1 ];
+
+				merged[ pair ].reserve(a.size() + b.size());
+				std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+							   std::back_inserter(merged[ pair ]));
+			}
+		});
+
+		if (bands.size() & 1)
+			merged.back().swap(bands.back());
+
+		bands.swap(merged);
+	}
+
+	return bands.empty() ? 0 : (int)bands[0].size();
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,105 @@
+//
+// Engine Pixels - Plain memory images, for the conversion engine
+//
+// Nothing in here needs a window, or an OpenGL context.  SDL_Surfaces are
+// only used at the edges, to get pixels in and out of SDL_image, and the
+// SDL software blitters, neither of which needs SDL_INIT_VIDEO
+//
+#ifndef ENGINE_PIXELS_H_
+#define ENGINE_PIXELS_H_
+
+#include <SDL.h>
+#include <vector>
+
+// Bump this when a change to the engine would change the output pixels
+#define D16_ENGINE_VERSION 1
+
+//------------------------------------------------------------------------------
+// Errors, work like SDL_GetError, and are kept per thread
+void D16_SetError(const char* format, ...);
+const char* D16_GetError();
+
+//------------------------------------------------------------------------------
+//
+// 32 bit RGBA, R in the low byte, same as SDL_PIXELFORMAT_RGBA32
+//
+class RGBAImage
+{
+public:
+	RGBAImage(int width, int height);
+	RGBAImage(const Uint32* pPixels, int width, int height);
+	~RGBAImage();
+
+	// Makes a copy of the pixels, in any format SDL can blit
+	static RGBAImage* FromSurface(SDL_Surface* pSurface);
+
+	// Copy of the pixels, caller owns the new surface
+	SDL_Surface* CreateSurface() const;
+
+	// Surface that points at our pixels, only valid as long as we are,
+	// free it with SDL_FreeSurface when done
+	SDL_Surface* WrapSurface();
+
+	// Same, for reading only, SDL doesn't do const
+	SDL_Surface* WrapSurface() const { return const_cast<RGBAImage*>(this)->WrapSurface(); }
+
+	int GetWidth() const  { return m_width; }
+	int GetHeight() const { return m_height; }
+
+	Uint32* GetPixels() { return &m_pixels[0]; }
+	const Uint32* GetPixels() const { return &m_pixels[0]; }
+
+	// Clamps x, and y to the edge of the image
+	Uint32 GetPixel(int x, int y) const;
+
+private:
+	int m_width;
+	int m_height;
+	std::vector<Uint32> m_pixels;
+};
+
+//------------------------------------------------------------------------------
+//
+// 8 bit indexes, with an RGBA palette
+//
+class IndexedImage
+{
+public:
+	IndexedImage(int width, int height, int numColors);
+	~IndexedImage();
+
+	// INDEX8 surface, with the palette attached, caller owns it
+	SDL_Surface* CreateSurface() const;
+
+	int GetWidth() const  { return m_width; }
+	int GetHeight() const { return m_height; }
+
+	Uint8* GetPixels() { return &m_pixels[0]; }
+	const Uint8* GetPixels() const { return &m_pixels[0]; }
+
+	// Clamps x, and y to the edge of the image
+	Uint8 GetIndex(int x, int y) const;
+
+	int GetNumColors() const { return (int)m_palette.size(); }
+	Uint32* GetPalette() { return &m_palette[0]; }
+	const Uint32* GetPalette() const { return &m_palette[0]; }
+
+private:
+	int m_width;
+	int m_height;
+	std::vector<Uint8>  m_pixels;
+	std::vector<Uint32> m_palette;
+};
+
+//------------------------------------------------------------------------------
+// Nearest color match (squared RGB distance), into a palette, first one wins
+int ClosestIndex(const Uint32* pPalette, int numColors, Uint32 color);
+
+// Every pixel, gets the closest entry in the palette
+IndexedImage* RemapToPalette(const RGBAImage& image, const Uint32* pPalette, int numColors);
+
+// Number of different RGBA values in the image, alpha counts
+int CountUniqueColors(const RGBAImage& image);
+
+#endif // ENGINE_PIXELS_H_
+
@@ -0,0 +1,319 @@
+//
+// Engine PNG Writer - Indexed PNGs, without going through SDL_image
+//
+#include "pngwriter.h"
+
+#include "jobs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static const int PNG_ROW_BAND  = 32;           // rows per ParallelFor band
+static const size_t IDAT_BYTES = 256 * 1024;   // most bytes per IDAT chunk
+
+enum PNGFilter
+{
+	eFilterNone,
+	eFilterSub,
+	eFilterUp,
+	eFilterAverage,
+	eFilterPaeth,
+
+	eNumFilters
+};
+
+//------------------------------------------------------------------------------
+
+static void PutBE32(std::vector<Uint8>& data, Uint32 value)
+{
+	data.push_back((Uint8)(value >> 24));
+	data.push_back((Uint8)(value >> 16));
+	data.push_back((Uint8)(value >> 8));
+	data.push_back((Uint8)value);
+}
+
+static void WriteChunk(std::vector<Uint8>& data, const char* pType,
+					   const Uint8* pBytes, size_t numBytes)
+{
+	PutBE32(data, (Uint32)numBytes);
+
+	size_t typeOffset = data.size();
+
+	data.insert(data.end(), pType, pType + 4);
+
+	if (numBytes)
+		data.insert(data.end(), pBytes, pBytes + numBytes);
+
+	PutBE32(data, CRC32(0, &data[ typeOffset ], numBytes + 4));
+}
+
+//------------------------------------------------------------------------------
+// Indexes into bitDepth bits each, high bits first
+static void PackRow(const Uint8* pPixels, int width, int bitDepth, Uint8* pRow)
+{
+	if (8 == bitDepth)
+	{
+		memcpy(pRow, pPixels, width);
+		return;
+	}
+
+	int perByte = 8 / bitDepth;
+
+	for (int x = 0; x < width; x += perByte)
+	{
+		Uint8 packed = 0;
+
+		for (int sub = 0; sub < perByte; ++sub)
+		{
+			Uint8 index = (x + sub < width) ? pPixels[ x + sub ] : 0;
+			packed |= (Uint8)(index << (8 - bitDepth * (sub + 1)));
+		}
+
+		*pRow++ = packed;
+	}
+}
+
+static inline Uint8 Paeth(int a, int b, int c)
+{
+	int p  = a + b - c;
+	int pa = abs(p - a);
+	int pb = abs(p - b);
+	int pc = abs(p - c);
+
+	if ((pa <= pb) && (pa <= pc))
+		return (Uint8)a;
+
+	return (Uint8)((pb <= pc) ? b : c);
+}
+
+// Palette indexes aren't brightness, so the usual smallest sum of the
+// bytes heuristic (libpng's) mostly picks filters that make things worse.
+// What deflate likes is runs, and repeats, so count how often a byte
+// differs from the one before it
+static inline int CountChanges(const Uint8* pBytes, int numBytes)
+{
+	int changes = 0;
+
+	for (int x = 1; x < numBytes; ++x)
+		changes += (pBytes[ x ] != pBytes[ x - 1 ]) ? 1 : 0;
+
+	return changes;
+}
+
+// Filtered bytes, with the filter type in front, pPrev is all zeros for
+// the first row.  Packed pixels are always 1 byte per "pixel", as far as
+// the filters are concerned
+static void FilterRow(const Uint8* pRow, const Uint8* pPrev, int rowBytes, bool bChoose,
+					  Uint8* pScratch, Uint8* pOut)
+{
+	if (!bChoose)
+	{
+		pOut[0] = eFilterNone;
+		memcpy(pOut + 1, pRow, rowBytes);
+		return;
+	}
+
+	Uint8* pSub     = pScratch + ((size_t)eFilterSub * rowBytes);
+	Uint8* pUp      = pScratch + ((size_t)eFilterUp * rowBytes);
+	Uint8* pAverage = pScratch + ((size_t)eFilterAverage * rowBytes);
+	Uint8* pPaeth   = pScratch + ((size_t)eFilterPaeth * rowBytes);
+
+	pSub[0]     = pRow[0];
+	pUp[0]      = (Uint8)(pRow[0] - pPrev[0]);
+	pAverage[0] = (Uint8)(pRow[0] - (pPrev[0] >> 1));
+	pPaeth[0]   = (Uint8)(pRow[0] - pPrev[0]);
+
+	for (int x = 1; x < rowBytes; ++x)
+	{
+		int a = pRow[ x - 1 ];
+		int b = pPrev[ x ];
+		int c = pPrev[ x - 1 ];
+
+		pSub[ x ]     = (Uint8)(pRow[ x ] - a);
+		pUp[ x ]      = (Uint8)(pRow[ x ] - b);
+		pAverage[ x ] = (Uint8)(pRow[ x ] - ((a + b) >> 1));
+		pPaeth[ x ]   = (Uint8)(pRow[ x ] - Paeth(a, b, c));
+	}
+
+	const Uint8* pFiltered[ eNumFilters ] = { pRow, pSub, pUp, pAverage, pPaeth };
+
+	// Unfiltered rows repeat the rows around them, which deflate finds, so
+	// a filter has to look a lot better before it gets picked
+	int bestFilter = eFilterNone;
+	int bestChanges = CountChanges(pRow, rowBytes) / 4;
+
+	for (int filter = eFilterSub; filter < eNumFilters; ++filter)
+	{
+		int changes = CountChanges(pFiltered[ filter ], rowBytes);
+
+		if (changes < bestChanges)
+		{
+			bestChanges = changes;
+			bestFilter = filter;
+		}
+	}
+
+	pOut[0] = (Uint8)bestFilter;
+	memcpy(pOut + 1, pFiltered[ bestFilter ], rowBytes);
+}
+
+//------------------------------------------------------------------------------
+
+bool EncodeIndexedPNG(const IndexedImage& image, int level, std::vector<Uint8>& data)
+{
+	data.clear();
+
+	int width = image.GetWidth();
+	int height = image.GetHeight();
+	int numColors = image.GetNumColors();
+
+	if ((width < 1) || (height < 1))
+	{
+		D16_SetError("EncodeIndexedPNG: %dx%d is empty", width, height);
+		return false;
+	}
+
+	if ((numColors < 1) || (numColors > 256))
+	{
+		D16_SetError("EncodeIndexedPNG: %d colors, should be 1 to 256", numColors);
+		return false;
+	}
+
+	const Uint8* pPixels = image.GetPixels();
+
+	// Packed, an index past the palette would turn into some other color,
+	// and at 8 bits, decoders reject it
+	if (numColors < 256)
+	{
+		size_t numPixels = (size_t)width * height;
+
+		for (size_t idx = 0; idx < numPixels; ++idx)
+		{
+			if (pPixels[ idx ] >= numColors)
+			{
+				D16_SetError("EncodeIndexedPNG: pixel %d,%d is index %d, with only %d colors",
+							 (int)(idx % width), (int)(idx / width), pPixels[ idx ], numColors);
+				return false;
+			}
+		}
+	}
+
+	int bitDepth = (numColors <= 2) ? 1 : (numColors <= 4) ? 2 : (numColors <= 16) ? 4 : 8;
+	int rowBytes = ((width * bitDepth) + 7) / 8;
+
+	level = SDL_max(eDeflateStore, SDL_min(level, eDeflateSmallest));
+
+	bool bChoose = (level > 2);
+
+	//--------------------------------------------------------------------------
+	// Pack, and filter, each band packs the row above it too, so it doesn't
+	// have to wait for anybody
+
+	size_t filteredRowBytes = (size_t)rowBytes + 1;
+	std::vector<Uint8> filtered(filteredRowBytes * height);
+
+	JobSystem::GetDefault().ParallelFor(0, height, PNG_ROW_BAND, [&](int start, int end)
+	{
+		std::vector<Uint8> rows(rowBytes * 2, 0);
+		std::vector<Uint8> scratch((size_t)rowBytes * eNumFilters);
+
+		Uint8* pPrev = &rows[0];
+		Uint8* pRow  = &rows[ rowBytes ];
+
+		if (start > 0)
+			PackRow(pPixels + ((size_t)(start - 1) * width), width, bitDepth, pPrev);
+
+		for (int y = start; y < end; ++y)
+		{
+			PackRow(pPixels + ((size_t)y * width), width, bitDepth, pRow);
+
+			FilterRow(pRow, pPrev, rowBytes, bChoose, &scratch[0],
+					  &filtered[ filteredRowBytes * y ]);
+
+			Uint8* pSwap = pPrev;
+			pPrev = pRow;
+			pRow = pSwap;
+		}
+	});
+
+	std::vector<Uint8> compressed;
+	DeflateZlib(&filtered[0], filtered.size(), level, compressed);
+
+	// Trying harder, see if leaving every row alone comes out smaller
+	if (level >= 7)
+	{
+		std::vector<Uint8> unfiltered(filtered.size());
+
+		JobSystem::GetDefault().ParallelFor(0, height, PNG_ROW_BAND, [&](int start, int end)
+		{
+			for (int y = start; y < end; ++y)
+			{
+				Uint8* pOut = &unfiltered[ filteredRowBytes * y ];
+				pOut[0] = eFilterNone;
+				PackRow(pPixels + ((size_t)y * width), width, bitDepth, pOut + 1);
+			}
+		});
+
+		std::vector<Uint8> compressedUnfiltered;
+		DeflateZlib(&unfiltered[0], unfiltered.size(), level, compressedUnfiltered);
+
+		if (compressedUnfiltered.size() < compressed.size())
+			compressed.swap(compressedUnfiltered);
+	}
+
+	//--------------------------------------------------------------------------
+
+	static const Uint8 signature[ 8 ] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+	data.reserve(compressed.size() + (numColors * 4) + 128);
+	data.insert(data.end(), signature, signature + 8);
+
+	Uint8 header[ 13 ] =
+	{
+		(Uint8)(width >> 24), (Uint8)(width >> 16), (Uint8)(width >> 8), (Uint8)width,
+		(Uint8)(height >> 24), (Uint8)(height >> 16), (Uint8)(height >> 8), (Uint8)height,
+		(Uint8)bitDepth,
+		3,   // indexed color
+		0,   // deflate
+		0,   // adaptive filtering
+		0    // not interlaced
+	};
+
+	WriteChunk(data, "IHDR", header, sizeof(header));
+
+	const Uint32* pPalette = image.GetPalette();
+
+	Uint8 palette[ 256 * 3 ];
+	Uint8 alpha[ 256 ];
+	int numAlpha = 0;
+
+	for (int idx = 0; idx < numColors; ++idx)
+	{
+		Uint32 color = pPalette[ idx ];
+
+		palette[ (idx * 3) + 0 ] = (Uint8)(color);
+		palette[ (idx * 3) + 1 ] = (Uint8)(color >> 8);
+		palette[ (idx * 3) + 2 ] = (Uint8)(color >> 16);
+
+		alpha[ idx ] = (Uint8)(color >> 24);
+
+		if (0xFF != alpha[ idx ])
+			numAlpha = idx + 1;
+	}
+
+	WriteChunk(data, "PLTE", palette, numColors * 3);
+
+	// Only up to the last one that isn't opaque
+	if (numAlpha)
+		WriteChunk(data, "tRNS", alpha, numAlpha);
+
+	for (size_t offset = 0; offset < compressed.size(); offset += IDAT_BYTES)
+	{
+		size_t count = SDL_min(IDAT_BYTES, compressed.size() - offset);
+		WriteChunk(data, "IDAT", &compressed[ offset ], count);
+	}
+
+	WriteChunk(data, "IEND", nullptr, 0);
+
+	return true;
+}
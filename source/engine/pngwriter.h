@@ -0,0 +1,22 @@
+//
+// Engine PNG Writer - Indexed PNGs, without going through SDL_image
+//
+// Palettes of 2, 4, or 16 colors are packed into 1, 2, or 4 bits per pixel.
+// Rows are filtered in parallel, each with whichever of the five PNG
+// filters looks like it will compress best, then deflated in parallel
+// chunks (see deflate.h).
+//
+#ifndef ENGINE_PNGWRITER_H_
+#define ENGINE_PNGWRITER_H_
+
+#include "pixels.h"
+#include "deflate.h"
+
+#include <vector>
+
+// level is 0-9, like zlib (see DeflateLevel).  0-2 don't filter the rows,
+// for speed, 7-9 also try the image with no filtering, and keep whichever
+// is smaller.  Fails (see D16_GetError) if a pixel is past the palette
+bool EncodeIndexedPNG(const IndexedImage& image, int level, std::vector<Uint8>& data);
+
+#endif // ENGINE_PNGWRITER_H_
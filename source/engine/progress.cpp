@@ -0,0 +1,492 @@
+//
+// Engine Progress - Per job state, throughput, ETA, and cancelling, for batches
+//
+#include "progress.h"
+
+#include <stdio.h>
+
+//------------------------------------------------------------------------------
+
+const char* ProgressStateName(int iState)
+{
+	switch (iState)
+	{
+	case eProgressQueued:   return "queued";
+	case eProgressRunning:  return "running";
+	case eProgressDone:     return "done";
+	case eProgressFailed:   return "failed";
+	case eProgressCanceled: return "canceled";
+	}
+
+	return "unknown";
+}
+
+static bool IsFinishedState(int iState)
+{
+	return (eProgressDone == iState) || (eProgressFailed == iState) ||
+		   (eProgressCanceled == iState);
+}
+
+static double SecondsBetween(Uint64 start, Uint64 end)
+{
+	return (double)(end - start) / SDL_GetPerformanceFrequency();
+}
+
+//------------------------------------------------------------------------------
+
+BatchProgress::BatchProgress()
+	: m_pMutex(SDL_CreateMutex())
+	, m_nextId(1)
+	, m_bCancelAll(false)
+	, m_bStarted(false)
+	, m_startTime(0)
+	, m_lastFinishTime(0)
+	, m_numRemoved(0)
+	, m_removedPixels(0)
+{
+}
+
+BatchProgress::~BatchProgress()
+{
+	SDL_DestroyMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+// With the lock held, ids go up, so the items are always sorted
+ProgressItem* BatchProgress::Find(int id)
+{
+	int low = 0;
+	int high = (int)m_items.size() - 1;
+
+	while (low <= high)
+	{
+		int mid = (low + high) / 2;
+
+		if (m_items[ mid ].m_id == id)
+			return &m_items[ mid ];
+
+		if (m_items[ mid ].m_id < id)
+			low = mid + 1;
+		else
+			high = mid - 1;
+	}
+
+	return nullptr;
+}
+
+const ProgressItem* BatchProgress::Find(int id) const
+{
+	return const_cast<BatchProgress*>(this)->Find(id);
+}
+
+//------------------------------------------------------------------------------
+
+int BatchProgress::Add(const std::string& name)
+{
+	SDL_LockMutex(m_pMutex);
+
+	ProgressItem item;
+	item.m_id = m_nextId++;
+	item.m_name = name;
+	item.m_bCancel = m_bCancelAll;
+
+	m_items.push_back(item);
+
+	SDL_UnlockMutex(m_pMutex);
+
+	return item.m_id;
+}
+
+//------------------------------------------------------------------------------
+
+bool BatchProgress::Start(int id)
+{
+	bool bRun = false;
+
+	SDL_LockMutex(m_pMutex);
+
+	ProgressItem* pItem = Find(id);
+
+	if (pItem)
+	{
+		Uint64 now = SDL_GetPerformanceCounter();
+
+		if (!m_bStarted)
+		{
+			m_bStarted = true;
+			m_startTime = now;
+		}
+
+		if (pItem->m_bCancel || m_bCancelAll)
+		{
+			// Never got going, so it doesn't count against the time
+			pItem->m_iState = eProgressCanceled;
+		}
+		else
+		{
+			pItem->m_iState = eProgressRunning;
+			pItem->m_startTime = now;
+			bRun = true;
+		}
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+
+	return bRun;
+}
+
+//------------------------------------------------------------------------------
+
+bool BatchProgress::SetPercent(int id, float percent)
+{
+	bool bContinue = false;
+
+	SDL_LockMutex(m_pMutex);
+
+	ProgressItem* pItem = Find(id);
+
+	if (pItem)
+	{
+		if (percent > pItem->m_percent)
+			pItem->m_percent = percent > 100.0f ? 100.0f : percent;
+
+		bContinue = !(pItem->m_bCancel || m_bCancelAll);
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+
+	return bContinue;
+}
+
+//------------------------------------------------------------------------------
+
+void BatchProgress::SetPixels(int id, long long numPixels)
+{
+	SDL_LockMutex(m_pMutex);
+
+	ProgressItem* pItem = Find(id);
+
+	if (pItem)
+		pItem->m_numPixels = numPixels;
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
+void BatchProgress::Finish(int id, bool bSuccess, long long numPixels, const std::string& error)
+{
+	SDL_LockMutex(m_pMutex);
+
+	ProgressItem* pItem = Find(id);
+
+	if (pItem)
+	{
+		Uint64 now = SDL_GetPerformanceCounter();
+
+		if (bSuccess)
+			pItem->m_iState = eProgressDone;
+		else if (pItem->m_bCancel || m_bCancelAll)
+			pItem->m_iState = eProgressCanceled;
+		else
+			pItem->m_iState = eProgressFailed;
+
+		if (bSuccess)
+			pItem->m_percent = 100.0f;
+
+		if (numPixels > 0)
+			pItem->m_numPixels = numPixels;
+
+		pItem->m_error = error;
+
+		if (pItem->m_startTime)
+			pItem->m_milliseconds = SecondsBetween(pItem->m_startTime, now) * 1000.0;
+
+		m_lastFinishTime = now;
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
+void BatchProgress::Cancel(int id)
+{
+	SDL_LockMutex(m_pMutex);
+
+	ProgressItem* pItem = Find(id);
+
+	if (pItem)
+		pItem->m_bCancel = true;
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+void BatchProgress::CancelAll()
+{
+	SDL_LockMutex(m_pMutex);
+
+	m_bCancelAll = true;
+
+	for (int idx = 0; idx < (int)m_items.size(); ++idx)
+	{
+		m_items[ idx ].m_bCancel = true;
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
+bool BatchProgress::IsCanceled(int id) const
+{
+	SDL_LockMutex(m_pMutex);
+
+	const ProgressItem* pItem = Find(id);
+	bool bCanceled = m_bCancelAll || (pItem && pItem->m_bCancel);
+
+	SDL_UnlockMutex(m_pMutex);
+
+	return bCanceled;
+}
+
+bool BatchProgress::IsCanceled() const
+{
+	SDL_LockMutex(m_pMutex);
+
+	bool bCanceled = m_bCancelAll;
+
+	SDL_UnlockMutex(m_pMutex);
+
+	return bCanceled;
+}
+
+//------------------------------------------------------------------------------
+
+bool BatchProgress::IsFinished() const
+{
+	bool bFinished = true;
+
+	SDL_LockMutex(m_pMutex);
+
+	for (int idx = 0; bFinished && (idx < (int)m_items.size()); ++idx)
+	{
+		bFinished = IsFinishedState(m_items[ idx ].m_iState);
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+
+	return bFinished;
+}
+
+//------------------------------------------------------------------------------
+
+void BatchProgress::RemoveFinished()
+{
+	SDL_LockMutex(m_pMutex);
+
+	std::vector<ProgressItem> items;
+
+	for (int idx = 0; idx < (int)m_items.size(); ++idx)
+	{
+		const ProgressItem& item = m_items[ idx ];
+
+		if (!IsFinishedState(item.m_iState))
+		{
+			items.push_back(item);
+		}
+		else if (eProgressDone == item.m_iState)
+		{
+			++m_numRemoved;
+			m_removedPixels += item.m_numPixels;
+		}
+	}
+
+	m_items.swap(items);
+
+	// Nothing left to go on, start the clock again with the next one
+	if (m_items.empty())
+	{
+		m_bStarted = false;
+		m_numRemoved = 0;
+		m_removedPixels = 0;
+		m_bCancelAll = false;
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
+void BatchProgress::GetItems(std::vector<ProgressItem>& items) const
+{
+	SDL_LockMutex(m_pMutex);
+
+	items = m_items;
+
+	// Running items, show the time so far
+	Uint64 now = SDL_GetPerformanceCounter();
+
+	for (int idx = 0; idx < (int)items.size(); ++idx)
+	{
+		if (eProgressRunning == items[ idx ].m_iState)
+			items[ idx ].m_milliseconds = SecondsBetween(items[ idx ].m_startTime, now) * 1000.0;
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
+void BatchProgress::GetSummary(ProgressSummary& summary) const
+{
+	SDL_LockMutex(m_pMutex);
+
+	summary.m_numItems    = (int)m_items.size();
+	summary.m_numQueued   = 0;
+	summary.m_numRunning  = 0;
+	summary.m_numDone     = 0;
+	summary.m_numFailed   = 0;
+	summary.m_numCanceled = 0;
+	summary.m_bCanceled   = m_bCancelAll;
+
+	double percentSum = 0.0;
+	double runningFraction = 0.0;  // how much of the running items is done
+	long long donePixels = m_removedPixels;
+
+	for (int idx = 0; idx < (int)m_items.size(); ++idx)
+	{
+		const ProgressItem& item = m_items[ idx ];
+
+		switch (item.m_iState)
+		{
+		case eProgressQueued:
+			++summary.m_numQueued;
+			break;
+		case eProgressRunning:
+			++summary.m_numRunning;
+			percentSum += item.m_percent;
+			runningFraction += item.m_percent / 100.0;
+			break;
+		case eProgressDone:
+			++summary.m_numDone;
+			percentSum += 100.0;
+			donePixels += item.m_numPixels;
+			break;
+		case eProgressFailed:
+			++summary.m_numFailed;
+			percentSum += 100.0;
+			break;
+		case eProgressCanceled:
+			++summary.m_numCanceled;
+			percentSum += 100.0;
+			break;
+		}
+	}
+
+	summary.m_percent = summary.m_numItems ? (float)(percentSum / summary.m_numItems) : 0.0f;
+
+	// The clock stops, once nothing is left to do
+	bool bBusy = (summary.m_numQueued + summary.m_numRunning) > 0;
+	Uint64 end = bBusy ? SDL_GetPerformanceCounter() : m_lastFinishTime;
+
+	summary.m_elapsedSeconds = (m_bStarted && (end > m_startTime)) ? SecondsBetween(m_startTime, end) : 0.0;
+
+	int numProcessed = m_numRemoved + summary.m_numDone + summary.m_numFailed;
+
+	if (summary.m_elapsedSeconds > 0.0)
+	{
+		summary.m_imagesPerSecond = numProcessed / summary.m_elapsedSeconds;
+		summary.m_megapixelsPerSecond = (donePixels / 1000000.0) / summary.m_elapsedSeconds;
+	}
+	else
+	{
+		summary.m_imagesPerSecond = 0.0;
+		summary.m_megapixelsPerSecond = 0.0;
+	}
+
+	// Cancelled items aren't going to be done, so they aren't left either
+	double remaining = summary.m_numQueued + (summary.m_numRunning - runningFraction);
+
+	if (!bBusy)
+		summary.m_etaSeconds = 0.0;
+	else if (summary.m_imagesPerSecond > 0.0)
+		summary.m_etaSeconds = remaining / summary.m_imagesPerSecond;
+	else
+		summary.m_etaSeconds = -1.0;
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ bool BatchProgress::ReportItem(float percent, void* pBinding)
+{
+	Binding* pBind = (Binding*)pBinding;
+
+	return pBind->m_pProgress->SetPercent(pBind->m_id, percent);
+}
+
+//------------------------------------------------------------------------------
+
+static std::string JsonString(const std::string& text)
+{
+	std::string result = "\"";
+
+	for (int idx = 0; idx < (int)text.size(); ++idx)
+	{
+		unsigned char c = (unsigned char)text[ idx ];
+
+		if (('"' == c) || ('\\' == c))
+		{
+			result += '\\';
+			result += (char)c;
+		}
+		else if (c < 0x20)
+		{
+			char escaped[ 8 ];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+			result += escaped;
+		}
+		else
+		{
+			result += (char)c;
+		}
+	}
+
+	return result + "\"";
+}
+
+std::string FormatProgressLine(const ProgressSummary& summary)
+{
+	char line[ 512 ];
+
+	snprintf(line, sizeof(line),
+			 "progress {\"total\":%d,\"queued\":%d,\"running\":%d,\"done\":%d,"
+			 "\"failed\":%d,\"canceled\":%d,\"percent\":%.1f,\"elapsed_s\":%.2f,"
+			 "\"images_per_s\":%.2f,\"megapixels_per_s\":%.2f,\"eta_s\":%.1f}",
+			 summary.m_numItems, summary.m_numQueued, summary.m_numRunning,
+			 summary.m_numDone, summary.m_numFailed, summary.m_numCanceled,
+			 summary.m_percent, summary.m_elapsedSeconds, summary.m_imagesPerSecond,
+			 summary.m_megapixelsPerSecond, summary.m_etaSeconds);
+
+	return line;
+}
+
+std::string FormatProgressItem(const ProgressItem& item)
+{
+	char numbers[ 256 ];
+
+	snprintf(numbers, sizeof(numbers),
+			 "\"percent\":%.1f,\"ms\":%.1f,\"pixels\":%lld",
+			 item.m_percent, item.m_milliseconds, item.m_numPixels);
+
+	std::string line = "item {\"id\":" + std::to_string(item.m_id) +
+					   ",\"name\":" + JsonString(item.m_name) +
+					   ",\"state\":\"" + ProgressStateName(item.m_iState) + "\"," + numbers;
+
+	if (!item.m_error.empty())
+		line += ",\"error\":" + JsonString(item.m_error);
+
+	return line + "}";
+}
@@ -0,0 +1,156 @@
+//
+// Engine Progress - Per job state, throughput, ETA, and cancelling, for batches
+//
+// A batch is a list of items (usually one per image).  Workers call Start,
+// SetPercent, and Finish as they go, the UI, or the command line takes a
+// snapshot whenever it wants one.  Cancelling is cooperative, Start, and
+// SetPercent return false once an item, or the whole batch has been
+// cancelled, and the worker is expected to stop.
+//
+// Everything here is safe to call from any thread.
+//
+#ifndef ENGINE_PROGRESS_H_
+#define ENGINE_PROGRESS_H_
+
+#include <SDL.h>
+
+#include <string>
+#include <vector>
+
+enum ProgressState
+{
+	eProgressQueued,
+	eProgressRunning,
+	eProgressDone,
+	eProgressFailed,
+	eProgressCanceled
+};
+
+const char* ProgressStateName(int iState);
+
+// For engine work that can take a while, percent is 0-100, return false
+// to ask it to stop
+typedef bool (*ProgressFunc)(float percent, void* pUserData);
+
+//------------------------------------------------------------------------------
+
+struct ProgressItem
+{
+	ProgressItem()
+		: m_id(0)
+		, m_iState(eProgressQueued)
+		, m_percent(0.0f)
+		, m_milliseconds(0.0)
+		, m_numPixels(0)
+		, m_bCancel(false)
+		, m_startTime(0)
+	{
+	}
+
+	int m_id;
+	std::string m_name;
+	int m_iState;            // ProgressState
+	float m_percent;         // 0-100
+	double m_milliseconds;   // so far, or in total, once finished
+	long long m_numPixels;   // source pixels, once known
+	std::string m_error;
+	bool m_bCancel;          // asked to stop, it may still be running
+
+	Uint64 m_startTime;      // performance counter
+};
+
+struct ProgressSummary
+{
+	int m_numItems;
+	int m_numQueued;
+	int m_numRunning;
+	int m_numDone;
+	int m_numFailed;
+	int m_numCanceled;
+
+	float  m_percent;              // the whole batch
+	double m_elapsedSeconds;       // since the first Start
+	double m_imagesPerSecond;
+	double m_megapixelsPerSecond;
+	double m_etaSeconds;           // -1 until there's something to go on
+	bool   m_bCanceled;
+};
+
+//------------------------------------------------------------------------------
+
+class BatchProgress
+{
+public:
+	BatchProgress();
+	~BatchProgress();
+
+	// Returns the item id, ids only go up, and are never reused
+	int Add(const std::string& name);
+
+	// false, if it's been cancelled, and shouldn't run
+	bool Start(int id);
+
+	// false, if it's been cancelled, and should stop
+	bool SetPercent(int id, float percent);
+
+	// numPixels, of the source, for megapixels per second.  An item that
+	// was asked to cancel, and fails, counts as cancelled
+	void Finish(int id, bool bSuccess, long long numPixels, const std::string& error = "");
+
+	void SetPixels(int id, long long numPixels);
+
+	void Cancel(int id);
+	void CancelAll();
+
+	bool IsCanceled(int id) const;
+	bool IsCanceled() const;   // the whole batch
+
+	// Once every item is done, failed, or cancelled
+	bool IsFinished() const;
+
+	// Forget the items that are done, failed, or cancelled
+	void RemoveFinished();
+
+	void GetSummary(ProgressSummary& summary) const;
+	void GetItems(std::vector<ProgressItem>& items) const;
+
+	//--------------------------------------------------------------------------
+	// To hand an item to a ProgressFunc, pUserData is a Binding*
+	struct Binding
+	{
+		BatchProgress* m_pProgress;
+		int m_id;
+	};
+
+	static bool ReportItem(float percent, void* pBinding);
+
+private:
+	ProgressItem* Find(int id);
+	const ProgressItem* Find(int id) const;
+
+	SDL_mutex* m_pMutex;  // everything below
+
+	std::vector<ProgressItem> m_items;  // in id order
+	int m_nextId;
+
+	bool m_bCancelAll;
+	bool m_bStarted;
+	Uint64 m_startTime;
+	Uint64 m_lastFinishTime;
+
+	// Finished items, that were forgotten by RemoveFinished, still count
+	// towards the throughput
+	int m_numRemoved;
+	long long m_removedPixels;
+};
+
+//------------------------------------------------------------------------------
+// One line of JSON each, for scripts, and CI dashboards to scrape
+//
+//   progress {"total":50,"queued":40,"running":4,"done":5,"failed":1,...}
+//   item {"id":7,"name":"art/a.png","state":"done","percent":100,...}
+//
+std::string FormatProgressLine(const ProgressSummary& summary);
+std::string FormatProgressItem(const ProgressItem& item);
+
+#endif // ENGINE_PROGRESS_H_
@@ -0,0 +1,543 @@
+//
+// Engine Quantize - Reduce an image down to a small palette with libimagequant
+//
+#include "quantize.h"
+
+#include "ingest.h"
+#include "jobs.h"
+#include "libimagequant.h"
+
+#include <algorithm>
+#include <string.h>
+
+// libimagequant sizes its color hash from the first batch of colors it's
+// given (squared), so that one is kept small, the rest go in big batches
+static const size_t HISTOGRAM_FIRST_BATCH = 1024;
+static const size_t HISTOGRAM_BATCH = 65536;
+
+//------------------------------------------------------------------------------
+
+int PosterizeFromName(const char* pName)
+{
+	// Allow the enum names too, ePosterize444
+	if (0 == SDL_strncasecmp(pName, "ePosterize", 10))
+		pName += 10;
+
+	if (0 == SDL_strcmp(pName, "444")) return ePosterize444;
+	if (0 == SDL_strcmp(pName, "555")) return ePosterize555;
+	if (0 == SDL_strcmp(pName, "888")) return ePosterize888;
+
+	return -1;
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* QuantizeImage(SDL_Surface* pSurface, const QuantizeSettings& settings,
+							int* pUniqueColors)
+{
+	Quantizer quantizer(settings);
+
+	return quantizer.Quantize(pSurface, pUniqueColors);
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* QuantizeImage(const RGBAImage& image, const QuantizeSettings& settings,
+							int* pUniqueColors)
+{
+	Quantizer quantizer(settings);
+
+	return quantizer.Quantize(image, pUniqueColors);
+}
+
+//------------------------------------------------------------------------------
+
+bool QuantizeFrames(const std::vector<const RGBAImage*>& frames, const QuantizeSettings& settings,
+					std::vector<IndexedImage*>& results, int* pUniqueColors)
+{
+	Quantizer quantizer(settings);
+
+	return quantizer.QuantizeFrames(frames, results, pUniqueColors);
+}
+
+//------------------------------------------------------------------------------
+
+Quantizer::Quantizer(const QuantizeSettings& settings)
+	: m_settings(settings)
+	, m_pAttr(nullptr)
+	, m_pProgress(nullptr)
+	, m_pProgressData(nullptr)
+	, m_progressStart(0.0f)
+	, m_progressEnd(100.0f)
+{
+	if (settings.m_pMalloc && settings.m_pFree)
+		m_pAttr = liq_attr_create_with_allocator(settings.m_pMalloc, settings.m_pFree);
+	else
+		m_pAttr = liq_attr_create();
+
+	if (m_pAttr)
+	{
+		liq_set_max_colors(m_pAttr, settings.m_numColors);
+		liq_set_speed(m_pAttr, settings.m_speed);
+
+		int min_posterize = 4;
+		switch (settings.m_iPosterize)
+		{
+		case ePosterize444:
+			min_posterize = 4;
+			break;
+		case ePosterize555:
+			min_posterize = 3;
+			break;
+		case ePosterize888:
+			min_posterize = 0;
+			break;
+		}
+
+		liq_set_min_posterization(m_pAttr, min_posterize);
+	}
+}
+
+Quantizer::~Quantizer()
+{
+	if (m_pAttr)
+	{
+		liq_attr_destroy(m_pAttr);
+		m_pAttr = nullptr;
+	}
+}
+
+//------------------------------------------------------------------------------
+
+void Quantizer::SetProgress(ProgressFunc pFunc, void* pUserData, float start, float end)
+{
+	m_pProgress = pFunc;
+	m_pProgressData = pUserData;
+	m_progressStart = start;
+	m_progressEnd = end;
+
+	if (m_pAttr)
+		liq_attr_set_progress_callback(m_pAttr, pFunc ? LiqProgress : nullptr, this);
+}
+
+// Quantizing is most of the work, remapping (and dithering) the rest
+static const float QUANTIZE_SHARE = 0.8f;
+
+/*static*/ int Quantizer::LiqProgress(float percent, void* pUserData)
+{
+	Quantizer* pQuantizer = (Quantizer*)pUserData;
+	float range = pQuantizer->m_progressEnd - pQuantizer->m_progressStart;
+
+	float scaled = pQuantizer->m_progressStart + (percent * QUANTIZE_SHARE * range) / 100.0f;
+
+	// libimagequant wants 0 to stop
+	return pQuantizer->m_pProgress(scaled, pQuantizer->m_pProgressData) ? 1 : 0;
+}
+
+/*static*/ int Quantizer::LiqRemapProgress(float percent, void* pUserData)
+{
+	Quantizer* pQuantizer = (Quantizer*)pUserData;
+	float range = pQuantizer->m_progressEnd - pQuantizer->m_progressStart;
+
+	float scaled = pQuantizer->m_progressStart + (range * QUANTIZE_SHARE) +
+				   (percent * (1.0f - QUANTIZE_SHARE) * range) / 100.0f;
+
+	return pQuantizer->m_pProgress(scaled, pQuantizer->m_pProgressData) ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+// Our own dithering reads the rows through the ingest too
+
+static void IngestRow(Uint32* pDest, int row, void* pUserData)
+{
+	ImageIngest* pIngest = (ImageIngest*)pUserData;
+
+	pIngest->ConvertRow(pDest, row);
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* Quantizer::Quantize(SDL_Surface* pSurface, int* pUniqueColors)
+{
+	if (nullptr == pSurface)
+	{
+		D16_SetError("Quantize, no surface");
+		return nullptr;
+	}
+
+	if (nullptr == m_pAttr)
+	{
+		D16_SetError("Quantize, liq_attr_create failed");
+		return nullptr;
+	}
+
+    unsigned int width=(unsigned int)pSurface->w;
+	unsigned int height=(unsigned int)pSurface->h;
+
+	//-----------------------------------------------
+	// The ingest reads pSurface directly, converting to RGBA, and
+	// pre-multiplying Alpha a row at a time, so we don't need a temporary
+	// RGBA copy of the whole image.  It counts the colors on the way, and
+	// libimagequant quantizes from those counts, the rows are only read
+	// again for the remap
+
+	ImageIngest ingest(pSurface);
+
+	std::vector<liq_histogram_entry> histogram;
+	ingest.CountColors(histogram);
+
+	liq_histogram* pHistogram = liq_histogram_create(m_pAttr);
+
+	if (nullptr == pHistogram)
+	{
+		D16_SetError("Quantize, liq_histogram_create failed");
+		return nullptr;
+	}
+
+	size_t batch = HISTOGRAM_FIRST_BATCH;
+
+	for (size_t pos = 0; pos < histogram.size(); pos += batch, batch = HISTOGRAM_BATCH)
+	{
+		size_t numEntries = SDL_min(batch, histogram.size() - pos);
+
+		if (LIQ_OK != liq_histogram_add_colors(pHistogram, m_pAttr, &histogram[ pos ], (int)numEntries, 0.0))
+		{
+			D16_SetError("Quantize, liq_histogram_add_colors failed");
+			liq_histogram_destroy(pHistogram);
+			return nullptr;
+		}
+	}
+
+	// Add the fixed colors
+	for (int idx = 0; idx < (int)m_settings.m_lockedColors.size(); ++idx)
+	{
+		Uint32 locked = m_settings.m_lockedColors[ idx ];
+
+		liq_color color;
+		color.r = (unsigned char) ((locked >>  0) & 0xFF);
+		color.g = (unsigned char) ((locked >>  8) & 0xFF);
+		color.b = (unsigned char) ((locked >> 16) & 0xFF);
+		color.a = (unsigned char) ((locked >> 24) & 0xFF);
+
+		liq_histogram_add_fixed_color(pHistogram, color, 0.0);
+	}
+
+	// You could set more options here, like liq_set_quality
+    liq_result *quantization_result;
+    liq_error error = liq_histogram_quantize(pHistogram, m_pAttr, &quantization_result);
+
+	liq_histogram_destroy(pHistogram);
+
+    if (error != LIQ_OK) {
+		if (LIQ_ABORTED == error)
+			D16_SetError("Quantize, canceled");
+		else
+			D16_SetError("Quantize, quantization failed");
+		return nullptr;
+    }
+
+	if (pUniqueColors)
+	{
+		*pUniqueColors = ingest.GetUniqueColorCount();
+	}
+
+	// Always hand back the number of colors that was asked for, anything
+	// that libimagequant didn't need stays black
+	if (eDitherDiffusion != m_settings.m_iDitherMethod)
+	{
+		// The palette, as quantized, our own dithering doesn't use the remap
+		std::vector<Uint32> palette(m_settings.m_numColors, 0xFF000000);
+
+		const liq_palette* pPalette = liq_get_palette(quantization_result);
+
+		for (int idx = 0; (idx < (int)pPalette->count) && (idx < m_settings.m_numColors); ++idx)
+		{
+			const liq_color& color = pPalette->entries[ idx ];
+
+			palette[ idx ] = color.r | (color.g << 8) | (color.b << 16) | (((Uint32)color.a) << 24);
+		}
+
+		liq_result_destroy(quantization_result);
+
+		// Same rows the histogram was made from, pre-multiplied, and opaque
+		Ditherer ditherer(&palette[0], m_settings.m_numColors, m_settings.m_iDitherMethod,
+						  m_settings.m_iDither, m_settings.m_iPosterize);
+
+		return ditherer.Dither((int)width, (int)height, IngestRow, &ingest);
+	}
+
+	// The remap reads the rows again, through the ingest
+    liq_image *input_image = ingest.CreateLiqImage(m_pAttr);
+
+	if (nullptr == input_image)
+	{
+		D16_SetError("Quantize, liq_image_create_custom failed");
+		liq_result_destroy(quantization_result);
+		return nullptr;
+	}
+
+	if (m_pProgress)
+		liq_result_set_progress_callback(quantization_result, LiqRemapProgress, this);
+
+	liq_set_dithering_level(quantization_result, m_settings.m_iDither / 100.0f);  // 0.0->1.0
+
+	IndexedImage* pResult = new IndexedImage(width, height, m_settings.m_numColors);
+
+    error = liq_write_remapped_image(quantization_result, input_image,
+									 pResult->GetPixels(), (size_t)width * height);
+
+	if (error != LIQ_OK)
+	{
+		if (LIQ_ABORTED == error)
+			D16_SetError("Quantize, canceled");
+		else
+			D16_SetError("Quantize, remap failed");
+		delete pResult;
+		liq_result_destroy(quantization_result);
+		liq_image_destroy(input_image);
+		return nullptr;
+	}
+
+	// liq_get_palette is only valid after the remap
+    const liq_palette *palette = liq_get_palette(quantization_result);
+
+	for (int idx = 0; (idx < (int)palette->count) && (idx < m_settings.m_numColors); ++idx)
+	{
+		const liq_color& color = palette->entries[ idx ];
+
+		pResult->GetPalette()[ idx ] = color.r | (color.g << 8) | (color.b << 16) | (((Uint32)color.a) << 24);
+	}
+
+	// Free up the memory used by libquant -------------------------------------
+    liq_result_destroy(quantization_result); // Must be freed only after you're done using the palette
+    liq_image_destroy(input_image);
+
+	return pResult;
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* Quantizer::Quantize(const RGBAImage& image, int* pUniqueColors)
+{
+	SDL_Surface* pSurface = image.WrapSurface();
+
+	if (nullptr == pSurface)
+	{
+		D16_SetError("Quantize, %s", SDL_GetError());
+		return nullptr;
+	}
+
+	IndexedImage* pResult = Quantize(pSurface, pUniqueColors);
+
+	SDL_FreeSurface(pSurface);
+
+	return pResult;
+}
+
+//------------------------------------------------------------------------------
+
+bool Quantizer::QuantizeFrames(const std::vector<const RGBAImage*>& frames,
+							   std::vector<IndexedImage*>& results, int* pUniqueColors)
+{
+	results.clear();
+
+	int numFrames = (int)frames.size();
+
+	if (0 == numFrames)
+	{
+		D16_SetError("QuantizeFrames, no frames");
+		return false;
+	}
+
+	if (nullptr == m_pAttr)
+	{
+		D16_SetError("QuantizeFrames, liq_attr_create failed");
+		return false;
+	}
+
+	JobSystem& jobs = JobSystem::GetDefault();
+
+	//-----------------------------------------------
+	// Colors counted per frame, through the same ingest as a single image,
+	// pre-multiplied, and opaque, then merged in pairs, until there's one
+
+	std::vector<ColorCounts> counts(numFrames);
+
+	SDL_atomic_t numFailed;
+	SDL_AtomicSet(&numFailed, 0);
+
+	jobs.ParallelFor(0, numFrames, 1, [&](int start, int end)
+	{
+		for (int frame = start; frame < end; ++frame)
+		{
+			SDL_Surface* pSurface = frames[ frame ]->WrapSurface();
+
+			if (nullptr == pSurface)
+			{
+				SDL_AtomicAdd(&numFailed, 1);
+				continue;
+			}
+
+			{
+				ImageIngest ingest(pSurface);
+				ingest.CountColors(counts[ frame ]);
+			}
+
+			SDL_FreeSurface(pSurface);
+		}
+	});
+
+	// SDL's error is on the worker's thread
+	if (SDL_AtomicGet(&numFailed))
+	{
+		D16_SetError("QuantizeFrames, SDL_CreateRGBSurfaceWithFormatFrom failed");
+		return false;
+	}
+
+	while (counts.size() > 1)
+	{
+		int numPairs = (int)counts.size() / 2;
+
+		jobs.ParallelFor(0, numPairs, 1, [&](int start, int end)
+		{
+			for (int pair = start; pair < end; ++pair)
+			{
+				counts[ pair * 2 ].Merge(counts[ (pair * 2) + 1 ]);
+			}
+		});
+
+		// Pairs fold down into the first of each, the odd one out goes up
+		// as it is
+		std::vector<ColorCounts> merged((counts.size() + 1) / 2);
+
+		for (size_t idx = 0; idx < merged.size(); ++idx)
+		{
+			std::swap(merged[ idx ], counts[ idx * 2 ]);
+		}
+
+		counts.swap(merged);
+	}
+
+	if (pUniqueColors)
+		*pUniqueColors = counts[0].GetNumColors();
+
+	std::vector<liq_histogram_entry> histogram;
+	counts[0].GetHistogram(histogram);
+	counts.clear();
+
+	//-----------------------------------------------
+
+	liq_histogram* pHistogram = liq_histogram_create(m_pAttr);
+
+	if (nullptr == pHistogram)
+	{
+		D16_SetError("QuantizeFrames, liq_histogram_create failed");
+		return false;
+	}
+
+	size_t batch = HISTOGRAM_FIRST_BATCH;
+
+	for (size_t pos = 0; pos < histogram.size(); pos += batch, batch = HISTOGRAM_BATCH)
+	{
+		size_t numEntries = SDL_min(batch, histogram.size() - pos);
+
+		if (LIQ_OK != liq_histogram_add_colors(pHistogram, m_pAttr, &histogram[ pos ], (int)numEntries, 0.0))
+		{
+			D16_SetError("QuantizeFrames, liq_histogram_add_colors failed");
+			liq_histogram_destroy(pHistogram);
+			return false;
+		}
+	}
+
+	// Add the fixed colors
+	for (int idx = 0; idx < (int)m_settings.m_lockedColors.size(); ++idx)
+	{
+		Uint32 locked = m_settings.m_lockedColors[ idx ];
+
+		liq_color color;
+		color.r = (unsigned char) ((locked >>  0) & 0xFF);
+		color.g = (unsigned char) ((locked >>  8) & 0xFF);
+		color.b = (unsigned char) ((locked >> 16) & 0xFF);
+		color.a = (unsigned char) ((locked >> 24) & 0xFF);
+
+		liq_histogram_add_fixed_color(pHistogram, color, 0.0);
+	}
+
+	liq_result* pResult = nullptr;
+	liq_error error = liq_histogram_quantize(pHistogram, m_pAttr, &pResult);
+
+	liq_histogram_destroy(pHistogram);
+
+	if (LIQ_OK != error)
+	{
+		if (LIQ_ABORTED == error)
+			D16_SetError("QuantizeFrames, canceled");
+		else
+			D16_SetError("QuantizeFrames, quantization failed");
+		return false;
+	}
+
+	// Always the number of colors that was asked for, anything libimagequant
+	// didn't need stays black
+	std::vector<Uint32> palette(m_settings.m_numColors, 0xFF000000);
+
+	const liq_palette* pPalette = liq_get_palette(pResult);
+
+	for (int idx = 0; (idx < (int)pPalette->count) && (idx < m_settings.m_numColors); ++idx)
+	{
+		const liq_color& color = pPalette->entries[ idx ];
+
+		palette[ idx ] = color.r | (color.g << 8) | (color.b << 16) | (((Uint32)color.a) << 24);
+	}
+
+	liq_result_destroy(pResult);
+
+	//-----------------------------------------------
+	// A liq_result can only remap one image at a time, so the frames go
+	// through our own remap, each on its own worker, libimagequant's error
+	// diffusion becomes our Floyd-Steinberg
+
+	results.assign(numFrames, nullptr);
+
+	Ditherer ditherer(&palette[0], m_settings.m_numColors, m_settings.m_iDitherMethod,
+					  m_settings.m_iDither, m_settings.m_iPosterize);
+
+	jobs.ParallelFor(0, numFrames, 1, [&](int start, int end)
+	{
+		for (int frame = start; frame < end; ++frame)
+		{
+			SDL_Surface* pSurface = frames[ frame ]->WrapSurface();
+
+			if (nullptr == pSurface)
+				continue;
+
+			{
+				ImageIngest ingest(pSurface);
+				results[ frame ] = ditherer.Dither(frames[ frame ]->GetWidth(), frames[ frame ]->GetHeight(),
+												   IngestRow, &ingest);
+			}
+
+			SDL_FreeSurface(pSurface);
+		}
+	});
+
+	for (int frame = 0; frame < numFrames; ++frame)
+	{
+		if (nullptr == results[ frame ])
+		{
+			D16_SetError("QuantizeFrames, SDL_CreateRGBSurfaceWithFormatFrom failed");
+
+			for (int done = 0; done < numFrames; ++done)
+			{
+				delete results[ done ];
+			}
+
+			results.clear();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,126 @@
+//
+// Engine Quantize - Reduce an image down to a small palette with libimagequant
+//
+#ifndef ENGINE_QUANTIZE_H_
+#define ENGINE_QUANTIZE_H_
+
+#include "pixels.h"
+#include "dither.h"
+#include "progress.h"
+#include "libimagequant.h"
+
+#include <stddef.h>
+
+enum PosterizeTargets
+{
+	ePosterize444,
+	ePosterize555,
+	ePosterize888
+};
+
+//------------------------------------------------------------------------------
+
+struct QuantizeSettings
+{
+	QuantizeSettings()
+		: m_numColors(16)
+		, m_speed(1)
+		, m_iPosterize(ePosterize444)
+		, m_iDither(50)
+		, m_iDitherMethod(eDitherDiffusion)
+		, m_pMalloc(nullptr)
+		, m_pFree(nullptr)
+	{
+	}
+
+	int m_numColors;  // 2-256
+	int m_speed;      // 1-10  (1 best quality)
+	int m_iPosterize; // PosterizeTargets
+	int m_iDither;    // 0-100 %
+	int m_iDitherMethod; // DitherMethods
+
+	// RGBA colors that have to be in the result, libimagequant places them
+	// at the end of the palette
+	std::vector<Uint32> m_lockedColors;
+
+	// Optional, allocator for libimagequant to use
+	void* (*m_pMalloc)(size_t);
+	void  (*m_pFree)(void*);
+};
+
+// Get a posterize target from a name like "444", "555", or "888"
+// (or "ePosterize444")
+// returns -1 if the name is not known
+int PosterizeFromName(const char* pName);
+
+//------------------------------------------------------------------------------
+// pSurface can be in any format that ImageIngest understands, the pixels
+// are read directly, without making an RGBA copy first
+//
+// pUniqueColors, if not null, gets the number of unique colors in the source
+//
+IndexedImage* QuantizeImage(SDL_Surface* pSurface, const QuantizeSettings& settings,
+							int* pUniqueColors = nullptr);
+
+IndexedImage* QuantizeImage(const RGBAImage& image, const QuantizeSettings& settings,
+							int* pUniqueColors = nullptr);
+
+//------------------------------------------------------------------------------
+//
+// The frames of an animation, all quantized to one palette, so the colors
+// don't jump around from frame to frame.  Each frame's colors are counted
+// on its own worker, through ImageIngest, like a single image, so a still
+// gets the same palette either way.  The counts are merged, libimagequant
+// picks the palette from all of them at once, then each frame is remapped
+// on its own worker.  results gets an IndexedImage per frame, they all have the same
+// palette, with the locked colors at the end, the same as QuantizeImage.
+//
+// pUniqueColors, if not null, gets the number of unique colors in all the
+// frames together
+//
+bool QuantizeFrames(const std::vector<const RGBAImage*>& frames, const QuantizeSettings& settings,
+					std::vector<IndexedImage*>& results, int* pUniqueColors = nullptr);
+
+//------------------------------------------------------------------------------
+//
+// Keeps the libimagequant attributes around, so a worker can quantize
+// image after image, with the same settings, without setting up again
+//
+// One per thread, libimagequant attributes are not meant to be shared
+//
+class Quantizer
+{
+public:
+	Quantizer(const QuantizeSettings& settings);
+	~Quantizer();
+
+	IndexedImage* Quantize(SDL_Surface* pSurface, int* pUniqueColors = nullptr);
+	IndexedImage* Quantize(const RGBAImage& image, int* pUniqueColors = nullptr);
+
+	// See QuantizeFrames
+	bool QuantizeFrames(const std::vector<const RGBAImage*>& frames,
+						std::vector<IndexedImage*>& results, int* pUniqueColors = nullptr);
+
+	const QuantizeSettings& GetSettings() const { return m_settings; }
+
+	// Reports from libimagequant, scaled to start-end percent, for the next
+	// Quantize calls.  If pFunc returns false, Quantize stops, and fails.
+	// nullptr, to stop reporting
+	void SetProgress(ProgressFunc pFunc, void* pUserData,
+					 float start = 0.0f, float end = 100.0f);
+
+private:
+	static int LiqProgress(float percent, void* pUserData);
+	static int LiqRemapProgress(float percent, void* pUserData);
+
+	QuantizeSettings m_settings;
+	liq_attr* m_pAttr;
+
+	ProgressFunc m_pProgress;
+	void* m_pProgressData;
+	float m_progressStart;
+	float m_progressEnd;
+};
+
+#endif // ENGINE_QUANTIZE_H_
+
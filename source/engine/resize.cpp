@@ -0,0 +1,478 @@
+//
+// Engine Resize - Crop / Reposition, and Resampling of RGBAImages
+//
+#include "resize.h"
+
+#include "jobs.h"
+#include "limage.h"
+#include "avir.h"
+#include "lancir.h"
+
+#include <string.h>
+
+//------------------------------------------------------------------------------
+//  iJustify
+//
+//  0 1 2
+//  3 4 5
+//  6 7 8
+//
+RGBAImage* CropImage(const RGBAImage& source, int iNewWidth, int iNewHeight, int iJustify)
+{
+	if ((iNewWidth < 1) || (iNewHeight < 1))
+	{
+		D16_SetError("CropImage, invalid size %d x %d", iNewWidth, iNewHeight);
+		return nullptr;
+	}
+
+	int width  = source.GetWidth();
+	int height = source.GetHeight();
+
+	int dest_x = 0;
+	int dest_y = 0;
+
+	// Left Right Position
+	switch (iJustify)
+	{
+	case eUpperLeft:
+	case eCenterLeft:
+	case eLowerLeft:
+			dest_x = 0;
+			break;
+	case eUpperCenter:
+	case eCenterCenter:
+	case eLowerCenter:
+			dest_x = (iNewWidth - width)/2;
+			break;
+	case eUpperRight:
+	case eCenterRight:
+	case eLowerRight:
+			dest_x = iNewWidth - width;
+			break;
+	}
+
+	// Vertical Position
+	switch (iJustify)
+	{
+	case eUpperLeft:
+	case eUpperCenter:
+	case eUpperRight:
+			dest_y = 0;
+			break;
+	case eCenterLeft:
+	case eCenterCenter:
+	case eCenterRight:
+			dest_y = (iNewHeight - height)/2;
+			break;
+	case eLowerLeft:
+	case eLowerCenter:
+	case eLowerRight:
+			dest_y = iNewHeight - height;
+			break;
+	}
+
+	RGBAImage* pImage = new RGBAImage(iNewWidth, iNewHeight);
+
+	// Clip the source against the new canvas
+	int x0 = dest_x < 0 ? 0 : dest_x;
+	int y0 = dest_y < 0 ? 0 : dest_y;
+	int x1 = (dest_x + width)  > iNewWidth  ? iNewWidth  : (dest_x + width);
+	int y1 = (dest_y + height) > iNewHeight ? iNewHeight : (dest_y + height);
+
+	if (x1 > x0)
+	{
+		for (int y = y0; y < y1; ++y)
+		{
+			const Uint32* pSource = source.GetPixels() + ((size_t)(y - dest_y) * width) + (x0 - dest_x);
+			Uint32* pDest = pImage->GetPixels() + ((size_t)y * iNewWidth) + x0;
+
+			memcpy(pDest, pSource, (x1 - x0) * sizeof(Uint32));
+		}
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+// Same stepping as SDL_SoftStretch, which is what SDL_BlitScaled used to do
+// for us, so the results match what the GUI has always produced
+static RGBAImage* PointSampleResize(const RGBAImage& source, int iNewWidth, int iNewHeight)
+{
+	RGBAImage* pImage = new RGBAImage(iNewWidth, iNewHeight);
+
+	Uint32 incX = ((Uint32)source.GetWidth()  << 16) / iNewWidth;
+	Uint32 incY = ((Uint32)source.GetHeight() << 16) / iNewHeight;
+
+	for (int y = 0; y < iNewHeight; ++y)
+	{
+		int sourceY = (int)(((Uint64)y * incY) >> 16);
+
+		const Uint32* pSource = source.GetPixels() + ((size_t)sourceY * source.GetWidth());
+		Uint32* pDest = pImage->GetPixels() + ((size_t)y * iNewWidth);
+
+		for (int x = 0; x < iNewWidth; ++x)
+		{
+			pDest[ x ] = pSource[ ((Uint64)x * incX) >> 16 ];
+		}
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+static RGBAImage* LinearSampleResize(const RGBAImage& source, int iNewWidth, int iNewHeight)
+{
+	// Shuttle us over to the linear image class
+	LinearImage sourceImage((unsigned int*)source.GetPixels(), source.GetWidth(), source.GetHeight());
+
+	LinearImage* pDestImage = sourceImage.Scale( iNewWidth, iNewHeight );
+
+	RGBAImage* pImage = new RGBAImage(iNewWidth, iNewHeight);
+
+	Uint32* pPixels = pImage->GetPixels();
+
+	for (int y = 0; y < iNewHeight; ++y)
+	{
+		for (int x = 0; x < iNewWidth; ++x)
+		{
+			FloatPixel p = pDestImage->GetPixel(x, y);
+
+			Uint32 pixel = ((Uint32)p.a)&0xFF;
+			pixel<<=8;
+			pixel |= ((Uint32)p.b)&0xFF;
+			pixel<<=8;
+			pixel |= ((Uint32)p.g)&0xFF;
+			pixel<<=8;
+			pixel |= ((Uint32)p.r)&0xFF;
+
+			*pPixels++ = pixel;
+		}
+	}
+
+	delete pDestImage;
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+
+typedef avir::fpclass_def< float, float,
+	avir::CImageResizerDithererErrdINL< float > > fpclass_dith;
+
+//------------------------------------------------------------------------------
+// AVIR splits the image into workloads, and hands them to a thread pool,
+// so give it ours.  They go in as interactive jobs, so the thread that
+// asked for the resize, helps out while it waits
+class AvirJobPool : public avir::CImageResizerThreadPool
+{
+public:
+	AvirJobPool(JobSystem& jobs)
+		: m_jobs(jobs)
+	{
+	}
+
+	int getSuggestedWorkloadCount() const override
+	{
+		return m_jobs.GetNumWorkers() + 1;
+	}
+
+	void addWorkload(CWorkload* const pWorkload) override
+	{
+		m_workloads.push_back(pWorkload);
+	}
+
+	void startAllWorkloads() override
+	{
+		for (int idx = 0; idx < (int)m_workloads.size(); ++idx)
+		{
+			CWorkload* pWorkload = m_workloads[ idx ];
+
+			m_handles.push_back(m_jobs.Submit([pWorkload]() { pWorkload->process(); },
+											  eJobInteractive));
+		}
+	}
+
+	void waitAllWorkloadsToFinish() override
+	{
+		m_jobs.Wait(m_handles);
+		m_handles.clear();
+	}
+
+	void removeAllWorkloads() override
+	{
+		m_workloads.clear();
+	}
+
+private:
+	JobSystem& m_jobs;
+	std::vector<CWorkload*> m_workloads;
+	std::vector<JobHandle> m_handles;
+};
+
+struct ResizerState
+{
+	ResizerState()
+		: m_pAvir(nullptr)
+		, m_pAvirDither(nullptr)
+	{
+	}
+
+	~ResizerState()
+	{
+		delete m_pAvir;
+		delete m_pAvirDither;
+	}
+
+	avir::CLancIR m_lanczos;
+
+	// Building the filter bank is the expensive part, so these are only
+	// made the first time they are needed
+	avir::CImageResizer<>* m_pAvir;
+	avir::CImageResizer< fpclass_dith >* m_pAvirDither;
+};
+
+//------------------------------------------------------------------------------
+
+Resizer::Resizer()
+	: m_pState(nullptr)
+{
+}
+
+Resizer::~Resizer()
+{
+	delete m_pState;
+}
+
+//------------------------------------------------------------------------------
+
+RGBAImage* Resizer::Resize(const RGBAImage& source, int iNewWidth, int iNewHeight,
+						   int iFilter, bool bDither)
+{
+	if ((iNewWidth < 1) || (iNewHeight < 1))
+	{
+		D16_SetError("ResizeImage, invalid size %d x %d", iNewWidth, iNewHeight);
+		return nullptr;
+	}
+
+	switch (iFilter)
+	{
+	case ePointSample:
+		return PointSampleResize(source, iNewWidth, iNewHeight);
+	case eBilinearSample:
+		return LinearSampleResize(source, iNewWidth, iNewHeight);
+	case eLanczos:
+	case eAVIR:
+		break;
+	default:
+		D16_SetError("ResizeImage, unknown filter %d", iFilter);
+		return nullptr;
+	}
+
+	if (nullptr == m_pState)
+	{
+		m_pState = new ResizerState;
+	}
+
+	RGBAImage* pImage = new RGBAImage(iNewWidth, iNewHeight);
+
+	AvirJobPool pool(JobSystem::GetDefault());
+
+	avir::CImageResizerVars vars;
+	vars.ThreadPool = &pool;
+
+	if (eLanczos == iFilter)
+	{
+		m_pState->m_lanczos.resizeImage<unsigned char>((unsigned char*)source.GetPixels(),
+										   source.GetWidth(), source.GetHeight(),
+										   sizeof(Uint32)*source.GetWidth(),
+											(unsigned char*)pImage->GetPixels(),
+												  iNewWidth, iNewHeight,
+												  sizeof(Uint32));  //RGBA 8888
+	}
+	else if (bDither)
+	{
+		if (nullptr == m_pState->m_pAvirDither)
+			m_pState->m_pAvirDither = new avir::CImageResizer< fpclass_dith >( 8 );
+
+		m_pState->m_pAvirDither->resizeImage<Uint8,Uint8>((const Uint8*)source.GetPixels(),
+											 source.GetWidth(), source.GetHeight(),
+											 source.GetWidth()*sizeof(Uint32),
+											 (Uint8*)pImage->GetPixels(),
+											 iNewWidth, iNewHeight,
+											 sizeof(Uint32),  // RGBA 8888
+											 0, &vars);
+	}
+	else
+	{
+		if (nullptr == m_pState->m_pAvir)
+			m_pState->m_pAvir = new avir::CImageResizer<>( 8 );
+
+		m_pState->m_pAvir->resizeImage<Uint8,Uint8>((const Uint8*)source.GetPixels(),
+											 source.GetWidth(), source.GetHeight(),
+											 source.GetWidth()*sizeof(Uint32),
+											 (Uint8*)pImage->GetPixels(),
+											 iNewWidth, iNewHeight,
+											 sizeof(Uint32),  // RGBA 8888
+											 0, &vars);
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+
+RGBAImage* ResizeImage(const RGBAImage& source, int iNewWidth, int iNewHeight,
+					   int iFilter, bool bDither)
+{
+	Resizer resizer;
+
+	return resizer.Resize(source, iNewWidth, iNewHeight, iFilter, bDither);
+}
+
+//------------------------------------------------------------------------------
+
+RGBAImage* ShrinkImage(const RGBAImage& source, int iNewWidth, int iNewHeight)
+{
+	int width  = source.GetWidth();
+	int height = source.GetHeight();
+
+	if ((iNewWidth < 1) || (iNewHeight < 1) || (iNewWidth > width) || (iNewHeight > height))
+	{
+		D16_SetError("ShrinkImage, can't shrink %d x %d to %d x %d", width, height,
+					 iNewWidth, iNewHeight);
+		return nullptr;
+	}
+
+	RGBAImage* pDest = new RGBAImage(iNewWidth, iNewHeight);
+
+	const Uint32* pSource = source.GetPixels();
+	Uint32* pPixels = pDest->GetPixels();
+
+	// Column spans, the same for every row
+	std::vector<int> columns(iNewWidth + 1);
+
+	for (int x = 0; x <= iNewWidth; ++x)
+		columns[ x ] = (int)(((long long)x * width) / iNewWidth);
+
+	// Sums per new column, for the source rows of one new row
+	std::vector<Uint64> sums((size_t)iNewWidth * 4);
+
+	for (int y = 0; y < iNewHeight; ++y)
+	{
+		int y0 = (int)(((long long)y * height) / iNewHeight);
+		int y1 = (int)(((long long)(y + 1) * height) / iNewHeight);
+
+		memset(&sums[0], 0, sums.size() * sizeof(Uint64));
+
+		for (int sy = y0; sy < y1; ++sy)
+		{
+			const Uint32* pRow = pSource + ((size_t)sy * width);
+
+			for (int x = 0; x < iNewWidth; ++x)
+			{
+				Uint64* pSum = &sums[ x * 4 ];
+
+				for (int sx = columns[ x ]; sx < columns[ x + 1 ]; ++sx)
+				{
+					Uint32 pixel = pRow[ sx ];
+					Uint32 alpha = pixel >> 24;
+
+					pSum[0] += (pixel & 0xFF) * alpha;
+					pSum[1] += ((pixel >> 8) & 0xFF) * alpha;
+					pSum[2] += ((pixel >> 16) & 0xFF) * alpha;
+					pSum[3] += alpha;
+				}
+			}
+		}
+
+		for (int x = 0; x < iNewWidth; ++x)
+		{
+			const Uint64* pSum = &sums[ x * 4 ];
+			Uint64 count = (Uint64)(columns[ x + 1 ] - columns[ x ]) * (y1 - y0);
+
+			Uint32 pixel = 0;
+
+			if (pSum[3])
+			{
+				Uint64 half = pSum[3] / 2;
+
+				pixel  = (Uint32)((pSum[0] + half) / pSum[3]);
+				pixel |= (Uint32)((pSum[1] + half) / pSum[3]) << 8;
+				pixel |= (Uint32)((pSum[2] + half) / pSum[3]) << 16;
+				pixel |= (Uint32)((pSum[3] + (count / 2)) / count) << 24;
+			}
+
+			pPixels[ ((size_t)y * iNewWidth) + x ] = pixel;
+		}
+	}
+
+	return pDest;
+}
+
+//------------------------------------------------------------------------------
+
+int ScaleFilterFromName(const char* pName)
+{
+	static const struct
+	{
+		const char* pName;
+		int filter;
+	} filters[] =
+	{
+		{ "point",   ePointSample },
+		{ "linear",  eBilinearSample },
+		{ "lanczos", eLanczos },
+		{ "avir",    eAVIR },
+
+		{ "ePointSample",    ePointSample },
+		{ "eBilinearSample", eBilinearSample },
+		{ "eLanczos",        eLanczos },
+		{ "eAVIR",           eAVIR },
+	};
+
+	for (int idx = 0; idx < (int)(sizeof(filters)/sizeof(filters[0])); ++idx)
+	{
+		if (0 == SDL_strcasecmp(pName, filters[ idx ].pName))
+			return filters[ idx ].filter;
+	}
+
+	return -1;
+}
+
+//------------------------------------------------------------------------------
+
+int JustifyFromName(const char* pName)
+{
+	static const struct
+	{
+		const char* pName;
+		int justify;
+	} justifies[] =
+	{
+		{ "upperleft",    eUpperLeft },
+		{ "uppercenter",  eUpperCenter },
+		{ "upperright",   eUpperRight },
+		{ "centerleft",   eCenterLeft },
+		{ "center",       eCenterCenter },
+		{ "centercenter", eCenterCenter },
+		{ "centerright",  eCenterRight },
+		{ "lowerleft",    eLowerLeft },
+		{ "lowercenter",  eLowerCenter },
+		{ "lowerright",   eLowerRight },
+	};
+
+	// Allow the enum names too, eCenterCenter
+	if (('e' == pName[0]) && (pName[1] >= 'A') && (pName[1] <= 'Z'))
+		++pName;
+
+	for (int idx = 0; idx < (int)(sizeof(justifies)/sizeof(justifies[0])); ++idx)
+	{
+		if (0 == SDL_strcasecmp(pName, justifies[ idx ].pName))
+			return justifies[ idx ].justify;
+	}
+
+	return -1;
+}
+
+//------------------------------------------------------------------------------
+
@@ -0,0 +1,84 @@
+//
+// Engine Resize - Crop / Reposition, and Resampling of RGBAImages
+//
+#ifndef ENGINE_RESIZE_H_
+#define ENGINE_RESIZE_H_
+
+#include "pixels.h"
+
+//-------------------------------
+//  0 1 2
+//  3 4 5
+//  6 7 8
+//-------------------------------
+enum Justify
+{
+	eUpperLeft,
+	eUpperCenter,
+	eUpperRight,
+
+	eCenterLeft,
+	eCenterCenter,
+	eCenterRight,
+
+	eLowerLeft,
+	eLowerCenter,
+	eLowerRight
+};
+//-------------------------------
+enum ScaleFilter
+{
+	ePointSample,
+	eBilinearSample,
+	eLanczos,
+	eAVIR
+};
+//-------------------------------
+
+// Resize the canvas, the pixels are not scaled, just positioned by iJustify
+// anything uncovered is left transparent black
+RGBAImage* CropImage(const RGBAImage& source, int iNewWidth, int iNewHeight, int iJustify);
+
+// Resample, iFilter is a ScaleFilter, bDither is only used by eAVIR
+RGBAImage* ResizeImage(const RGBAImage& source, int iNewWidth, int iNewHeight,
+					   int iFilter, bool bDither = false);
+
+// Box filter, each new pixel is the average of the source pixels under it,
+// weighted by alpha, so clear pixels don't darken the edges.  Only for
+// making things smaller, quick, and good enough for thumbnails
+RGBAImage* ShrinkImage(const RGBAImage& source, int iNewWidth, int iNewHeight);
+
+//------------------------------------------------------------------------------
+//
+// Keeps the AVIR filter banks, and the Lanczos buffers around, so a worker
+// can resize image after image without building them again
+//
+// One per thread
+//
+struct ResizerState;
+
+class Resizer
+{
+public:
+	Resizer();
+	~Resizer();
+
+	RGBAImage* Resize(const RGBAImage& source, int iNewWidth, int iNewHeight,
+					  int iFilter, bool bDither = false);
+
+private:
+	ResizerState* m_pState;  // created on first use
+};
+
+//------------------------------------------------------------------------------
+
+// Get a filter from a name like "point", "linear", "lanczos", or "avir"
+// (the enum names, like "eAVIR", work too), returns -1 if the name is not known
+int ScaleFilterFromName(const char* pName);
+
+// Get a justify from a name like "center", "upperleft", or "eCenterCenter"
+// returns -1 if the name is not known
+int JustifyFromName(const char* pName);
+
+#endif // ENGINE_RESIZE_H_
+
@@ -0,0 +1,724 @@
+//
+// Engine SHR - Apple IIgs Super Hi-Res screens, as they are on the IIgs
+//
+#include "shr.h"
+
+#include "fileio.h"
+#include "jobs.h"
+#include "mappedfile.h"
+#include "packbytes.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+// $C1 memory layout
+static const int C1_SIZE           = 0x8000;
+static const int C1_SCB_OFFSET     = 0x7D00;
+static const int C1_PALETTE_OFFSET = 0x7E00;
+static const int C1_WIDTH          = 320;
+static const int C1_HEIGHT         = 200;
+static const int C1_BYTES_PER_LINE = 160;
+
+// APF sizes are 16 bit, but nothing real comes close, these keep a damaged
+// header from asking for gigabytes
+static const int APF_MAX_SIZE = 16384;
+static const long long APF_MAX_PIXELS = 1LL << 26;
+
+// In 640 mode, each of the 4 pixels in a byte, has its own 4 colors
+static const Uint8 s_640Base[ 4 ] = { 8, 12, 0, 4 };
+
+//------------------------------------------------------------------------------
+
+static Uint16 ReadWord(const Uint8* pData)
+{
+	return (Uint16)(pData[0] | (pData[1] << 8));
+}
+
+static Uint32 ReadLong(const Uint8* pData)
+{
+	return (Uint32)pData[0] | ((Uint32)pData[1] << 8) |
+		   ((Uint32)pData[2] << 16) | ((Uint32)pData[3] << 24);
+}
+
+static void WriteWord(std::vector<Uint8>& data, Uint16 value)
+{
+	data.push_back((Uint8)(value & 0xFF));
+	data.push_back((Uint8)(value >> 8));
+}
+
+static void WriteLong(Uint8* pData, Uint32 value)
+{
+	pData[0] = (Uint8)(value >> 0);
+	pData[1] = (Uint8)(value >> 8);
+	pData[2] = (Uint8)(value >> 16);
+	pData[3] = (Uint8)(value >> 24);
+}
+
+//------------------------------------------------------------------------------
+
+Uint32 IIgsColorToRGBA(Uint16 color)
+{
+	Uint32 r = (color >> 8) & 0xF;
+	Uint32 g = (color >> 4) & 0xF;
+	Uint32 b = (color >> 0) & 0xF;
+
+	return 0xFF000000 | ((b * 0x11) << 16) | ((g * 0x11) << 8) | (r * 0x11);
+}
+
+//------------------------------------------------------------------------------
+
+SHRImage::SHRImage(int width, int height)
+	: m_width(width)
+	, m_height(height)
+	, m_pixels((size_t)width * height, 0)
+	, m_scbs(height, 0)
+	, m_palettes(NUM_PALETTES * 16, 0)
+{
+}
+
+SHRImage::~SHRImage()
+{
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ SHRImage* SHRImage::FromIndexed(const IndexedImage& image)
+{
+	int width = image.GetWidth();
+	int height = image.GetHeight();
+	int numColors = image.GetNumColors();
+
+	if ((width > 0xFFFF) || (height > 0xFFFF))
+	{
+		D16_SetError("SHRImage: %dx%d is too big, 65535 is the most", width, height);
+		return nullptr;
+	}
+
+	SHRImage* pImage = new SHRImage(width, height);
+
+	for (int idx = 0; (idx < numColors) && (idx < NUM_PALETTES * 16); ++idx)
+	{
+		pImage->m_palettes[ idx ] = RGBAToIIgsColor(image.GetPalette()[ idx ]);
+	}
+
+	for (int y = 0; y < height; ++y)
+	{
+		const Uint8* pLine = image.GetPixels() + (y * width);
+		Uint8* pOut = pImage->GetPixels() + (y * width);
+
+		int palette = width ? (pLine[ 0 ] >> 4) : 0;
+
+		for (int x = 0; x < width; ++x)
+		{
+			if ((pLine[ x ] >> 4) != palette)
+			{
+				D16_SetError("SHRImage: line %d uses colors from more than one palette", y);
+				delete pImage;
+				return nullptr;
+			}
+
+			pOut[ x ] = pLine[ x ] & 0xF;
+		}
+
+		pImage->m_scbs[ y ] = (Uint8)palette;
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+
+bool SHRImage::UsesOnePalette(int* pPalette) const
+{
+	int palette = m_height ? (m_scbs[ 0 ] & SHR_SCB_PALETTE) : 0;
+
+	for (int y = 1; y < m_height; ++y)
+	{
+		if ((m_scbs[ y ] & SHR_SCB_PALETTE) != palette)
+			return false;
+	}
+
+	if (pPalette)
+		*pPalette = palette;
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+void SHRImage::GetLineEntries(int y, Uint8* pEntries) const
+{
+	const Uint8* pLine = &m_pixels[ y * m_width ];
+	Uint8 scb = m_scbs[ y ];
+
+	if ((scb & SHR_SCB_FILL) && !(scb & SHR_SCB_640))
+	{
+		Uint8 previous = 0;
+
+		for (int x = 0; x < m_width; ++x)
+		{
+			if (pLine[ x ])
+				previous = pLine[ x ];
+
+			pEntries[ x ] = previous;
+		}
+	}
+	else
+	{
+		memcpy(pEntries, pLine, m_width);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+RGBAImage* SHRImage::CreateRGBA() const
+{
+	RGBAImage* pImage = new RGBAImage(m_width, m_height);
+	std::vector<Uint8> entries(m_width);
+
+	for (int y = 0; y < m_height; ++y)
+	{
+		const Uint16* pPalette = GetPalette(m_scbs[ y ] & SHR_SCB_PALETTE);
+		Uint32* pOut = pImage->GetPixels() + (y * m_width);
+
+		Uint32 colors[ 16 ];
+
+		for (int idx = 0; idx < 16; ++idx)
+		{
+			colors[ idx ] = IIgsColorToRGBA(pPalette[ idx ]);
+		}
+
+		GetLineEntries(y, &entries[0]);
+
+		for (int x = 0; x < m_width; ++x)
+		{
+			pOut[ x ] = colors[ entries[ x ] ];
+		}
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+
+IndexedImage* SHRImage::CreateIndexed() const
+{
+	int onePalette = 0;
+	bool bOnePalette = UsesOnePalette(&onePalette);
+
+	IndexedImage* pImage = new IndexedImage(m_width, m_height, bOnePalette ? 16 : 256);
+	Uint32* pClut = pImage->GetPalette();
+
+	for (int idx = 0; idx < pImage->GetNumColors(); ++idx)
+	{
+		int palette = bOnePalette ? onePalette : (idx >> 4);
+
+		pClut[ idx ] = IIgsColorToRGBA(GetPalette(palette)[ idx & 0xF ]);
+	}
+
+	for (int y = 0; y < m_height; ++y)
+	{
+		Uint8* pOut = pImage->GetPixels() + (y * m_width);
+
+		GetLineEntries(y, pOut);
+
+		if (!bOnePalette)
+		{
+			Uint8 base = (Uint8)((m_scbs[ y ] & SHR_SCB_PALETTE) << 4);
+
+			for (int x = 0; x < m_width; ++x)
+			{
+				pOut[ x ] |= base;
+			}
+		}
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+// numBytes of packed pixels, in the mode the SCB says, out to numPixels
+// entries, each one scale times
+static void DecodeLine(const Uint8* pBytes, Uint8 scb, Uint8* pOut, int numPixels, int scale)
+{
+	if (scb & SHR_SCB_640)
+	{
+		for (int x = 0; x < numPixels; ++x)
+		{
+			int shift = 6 - ((x & 3) * 2);
+
+			pOut[ x ] = (Uint8)(s_640Base[ x & 3 ] + ((pBytes[ x >> 2 ] >> shift) & 3));
+		}
+	}
+	else
+	{
+		for (int x = 0; x < numPixels / scale; ++x)
+		{
+			Uint8 entry = (x & 1) ? (pBytes[ x >> 1 ] & 0xF) : (pBytes[ x >> 1 ] >> 4);
+
+			for (int idx = 0; idx < scale; ++idx)
+			{
+				pOut[ (x * scale) + idx ] = entry;
+			}
+		}
+	}
+}
+
+static int BytesPerLine(int numPixels, Uint8 scb)
+{
+	return (scb & SHR_SCB_640) ? (numPixels + 3) / 4 : (numPixels + 1) / 2;
+}
+
+// The other way, a 640 mode pixel keeps the 2 bits it can, if the entry
+// isn't one its column can show
+static void EncodeLine(const Uint8* pEntries, Uint8 scb, Uint8* pBytes, int numPixels)
+{
+	memset(pBytes, 0, BytesPerLine(numPixels, scb));
+
+	if (scb & SHR_SCB_640)
+	{
+		for (int x = 0; x < numPixels; ++x)
+		{
+			int shift = 6 - ((x & 3) * 2);
+
+			pBytes[ x >> 2 ] |= (Uint8)((pEntries[ x ] & 3) << shift);
+		}
+	}
+	else
+	{
+		for (int x = 0; x < numPixels; ++x)
+		{
+			pBytes[ x >> 1 ] |= (Uint8)((x & 1) ? (pEntries[ x ] & 0xF) : (pEntries[ x ] << 4));
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// 32K of screen memory, raw, or unpacked
+static SHRImage* DecodeC1(const Uint8* pData)
+{
+	const Uint8* pSCBs = pData + C1_SCB_OFFSET;
+
+	// Any 640 line, makes the whole thing 640 wide, 320 lines get doubled
+	bool b640 = false;
+
+	for (int y = 0; y < C1_HEIGHT; ++y)
+	{
+		if (pSCBs[ y ] & SHR_SCB_640)
+			b640 = true;
+	}
+
+	int width = b640 ? C1_WIDTH * 2 : C1_WIDTH;
+
+	SHRImage* pImage = new SHRImage(width, C1_HEIGHT);
+
+	for (int y = 0; y < C1_HEIGHT; ++y)
+	{
+		Uint8 scb = pSCBs[ y ];
+		int scale = (b640 && !(scb & SHR_SCB_640)) ? 2 : 1;
+
+		pImage->SetSCB(y, scb);
+
+		DecodeLine(pData + (y * C1_BYTES_PER_LINE), scb,
+				   pImage->GetPixels() + (y * width), width, scale);
+	}
+
+	for (int palette = 0; palette < SHRImage::NUM_PALETTES; ++palette)
+	{
+		for (int idx = 0; idx < 16; ++idx)
+		{
+			pImage->GetPalette(palette)[ idx ] =
+				ReadWord(pData + C1_PALETTE_OFFSET + (palette * 32) + (idx * 2));
+		}
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+// MAIN block, pData is just past the name
+static SHRImage* DecodeAPFMain(const Uint8* pData, size_t numBytes)
+{
+	size_t pos = 0;
+
+	if (numBytes < 6)
+	{
+		D16_SetError("LoadSHRImage: APF MAIN block is too short");
+		return nullptr;
+	}
+
+	Uint16 masterMode  = ReadWord(pData + 0);
+	int numPixels      = ReadWord(pData + 2);
+	int numColorTables = ReadWord(pData + 4);
+	pos = 6;
+
+	(void)masterMode;  // every line has its own mode
+
+	if (numColorTables > SHRImage::NUM_PALETTES)
+	{
+		D16_SetError("LoadSHRImage: APF has %d color tables, 16 is the most", numColorTables);
+		return nullptr;
+	}
+
+	const Uint8* pColorTables = pData + pos;
+	pos += numColorTables * 32;
+
+	if (pos + 2 > numBytes)
+	{
+		D16_SetError("LoadSHRImage: APF MAIN block is too short");
+		return nullptr;
+	}
+
+	int numLines = ReadWord(pData + pos);
+	pos += 2;
+
+	const Uint8* pDirectory = pData + pos;
+	pos += numLines * 4;
+
+	if ((pos > numBytes) || (0 == numPixels) || (0 == numLines))
+	{
+		D16_SetError("LoadSHRImage: APF MAIN block is too short, or empty");
+		return nullptr;
+	}
+
+	if ((numPixels > APF_MAX_SIZE) || (numLines > APF_MAX_SIZE) ||
+		((long long)numPixels * numLines > APF_MAX_PIXELS))
+	{
+		D16_SetError("LoadSHRImage: APF is %dx%d, that's too big", numPixels, numLines);
+		return nullptr;
+	}
+
+	// Every line has to have something packed, and it all has to be there,
+	// before anything gets allocated
+	size_t totalLength = 0;
+
+	for (int y = 0; y < numLines; ++y)
+	{
+		size_t packedLength = ReadWord(pDirectory + (y * 4));
+
+		if (0 == packedLength)
+		{
+			D16_SetError("LoadSHRImage: APF line %d is empty", y);
+			return nullptr;
+		}
+
+		totalLength += packedLength;
+	}
+
+	if (totalLength > numBytes - pos)
+	{
+		D16_SetError("LoadSHRImage: APF lines run past the end of the file");
+		return nullptr;
+	}
+
+	SHRImage* pImage = new SHRImage(numPixels, numLines);
+
+	for (int palette = 0; palette < numColorTables; ++palette)
+	{
+		for (int idx = 0; idx < 16; ++idx)
+		{
+			pImage->GetPalette(palette)[ idx ] = ReadWord(pColorTables + (palette * 32) + (idx * 2));
+		}
+	}
+
+	std::vector<Uint8> line;
+
+	for (int y = 0; y < numLines; ++y)
+	{
+		size_t packedLength = ReadWord(pDirectory + (y * 4));
+		Uint8 scb = (Uint8)(ReadWord(pDirectory + (y * 4) + 2) & 0xFF);
+
+		if (pos + packedLength > numBytes)
+		{
+			D16_SetError("LoadSHRImage: APF line %d runs past the end of the file", y);
+			delete pImage;
+			return nullptr;
+		}
+
+		line.resize(BytesPerLine(numPixels, scb));
+
+		if (0 == UnpackBytes(pData + pos, packedLength, &line[0], line.size()))
+		{
+			std::string error = D16_GetError();
+
+			D16_SetError("LoadSHRImage: APF line %d, %s", y, error.c_str());
+			delete pImage;
+			return nullptr;
+		}
+
+		pImage->SetSCB(y, scb);
+
+		DecodeLine(&line[0], scb, pImage->GetPixels() + (y * numPixels), numPixels, 1);
+
+		pos += packedLength;
+	}
+
+	return pImage;
+}
+
+//------------------------------------------------------------------------------
+// Blocks are a 4 byte length (counting itself), a pascal string name, then
+// the data.  Returns nullptr, without setting an error, if it isn't APF
+static SHRImage* DecodeAPF(const Uint8* pData, size_t numBytes, bool* pbIsAPF)
+{
+	size_t pos = 0;
+
+	*pbIsAPF = false;
+
+	while (pos + 5 <= numBytes)
+	{
+		size_t length = ReadLong(pData + pos);
+		size_t nameLength = pData[ pos + 4 ];
+
+		if ((length < 5 + nameLength) || (pos + length > numBytes))
+			return nullptr;
+
+		const Uint8* pName = pData + pos + 5;
+
+		if ((4 == nameLength) && (0 == memcmp(pName, "MAIN", 4)))
+		{
+			*pbIsAPF = true;
+
+			return DecodeAPFMain(pName + nameLength, length - 5 - nameLength);
+		}
+
+		// MULTIPAL, PATS, SCIB, NOTE, and the rest, aren't needed to show it
+		pos += length;
+	}
+
+	return nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+SHRImage* LoadSHRImage(const Uint8* pData, size_t numBytes, int* pFormat)
+{
+	SHRImage* pImage = nullptr;
+	int iFormat = eSHRUnknown;
+
+	bool bIsAPF = false;
+
+	if (numBytes == (size_t)C1_SIZE)
+	{
+		iFormat = eSHRRawC1;
+		pImage = DecodeC1(pData);
+	}
+	else if ((pImage = DecodeAPF(pData, numBytes, &bIsAPF)) != nullptr)
+	{
+		iFormat = eSHRAPF;
+	}
+	else if (bIsAPF)
+	{
+		// Had a MAIN block, that was broken, the error says how
+		return nullptr;
+	}
+	else
+	{
+		// PNT is the only one left, that unpacks to the 32K, or it's not ours
+		std::vector<Uint8> unpacked(C1_SIZE);
+
+		if (0 == UnpackBytes(pData, numBytes, &unpacked[0], unpacked.size()))
+		{
+			std::string error = D16_GetError();
+
+			D16_SetError("LoadSHRImage: not $C1, PNT, or APF (%s)", error.c_str());
+			return nullptr;
+		}
+
+		iFormat = eSHRPacked;
+		pImage = DecodeC1(&unpacked[0]);
+	}
+
+	if (pFormat)
+		*pFormat = iFormat;
+
+	return pImage;
+}
+
+SHRImage* LoadSHRImage(const std::string& filenamepath, int* pFormat)
+{
+	MappedFile file;
+
+	if (!file.Open(filenamepath))
+		return nullptr;
+
+	if (0 == file.GetSize())
+	{
+		D16_SetError("LoadSHRImage: %s is empty", filenamepath.c_str());
+		return nullptr;
+	}
+
+	return LoadSHRImage(file.GetData(), file.GetSize(), pFormat);
+}
+
+//------------------------------------------------------------------------------
+
+bool EncodeAPF(const SHRImage& image, std::vector<Uint8>& data)
+{
+	int width = image.GetWidth();
+	int height = image.GetHeight();
+
+	if ((width < 1) || (height < 1) || (width > 0xFFFF) || (height > 0xFFFF))
+	{
+		D16_SetError("EncodeAPF: %dx%d won't fit, 1 to 65535 each way", width, height);
+		return false;
+	}
+
+	// Every line is packed on its own, so they can all go at once
+	std::vector< std::vector<Uint8> > packedLines(height);
+	SDL_atomic_t numBad;
+	SDL_AtomicSet(&numBad, 0);
+
+	JobSystem::GetDefault().ParallelFor(0, height, 16, [&](int start, int end)
+	{
+		std::vector<Uint8> line;
+		std::vector<Uint8> unpacked;
+
+		for (int y = start; y < end; ++y)
+		{
+			Uint8 scb = image.GetSCB(y);
+
+			line.resize(BytesPerLine(width, scb));
+			unpacked.resize(line.size());
+
+			EncodeLine(image.GetPixels() + (y * width), scb, &line[0], width);
+
+			PackBytes(&line[0], line.size(), packedLines[ y ]);
+
+			const std::vector<Uint8>& packed = packedLines[ y ];
+
+			// The directory only has a word for the length
+			if ((packed.size() > 0xFFFF) ||
+				(UnpackBytes(&packed[0], packed.size(), &unpacked[0], unpacked.size()) != packed.size()) ||
+				(0 != memcmp(&unpacked[0], &line[0], line.size())))
+			{
+				SDL_AtomicAdd(&numBad, 1);
+			}
+		}
+	});
+
+	if (SDL_AtomicGet(&numBad))
+	{
+		D16_SetError("EncodeAPF: %d lines didn't pack", SDL_AtomicGet(&numBad));
+		return false;
+	}
+
+	// Only as many color tables, as the SCBs use
+	int numColorTables = 1;
+
+	for (int y = 0; y < height; ++y)
+	{
+		int palette = image.GetSCB(y) & SHR_SCB_PALETTE;
+
+		if (palette >= numColorTables)
+			numColorTables = palette + 1;
+	}
+
+	//--------------------------------------------------------------------------
+	// MAIN block
+
+	data.clear();
+	data.resize(4);   // length, once we know it
+	data.push_back(4);
+	data.insert(data.end(), "MAIN", "MAIN" + 4);
+
+	WriteWord(data, image.GetSCB(0) & SHR_SCB_640);   // MasterMode
+	WriteWord(data, (Uint16)width);                   // PixelsPerScanLine
+	WriteWord(data, (Uint16)numColorTables);
+
+	for (int palette = 0; palette < numColorTables; ++palette)
+	{
+		for (int idx = 0; idx < 16; ++idx)
+		{
+			WriteWord(data, image.GetPalette(palette)[ idx ]);
+		}
+	}
+
+	WriteWord(data, (Uint16)height);                  // NumScanLines
+
+	for (int y = 0; y < height; ++y)
+	{
+		WriteWord(data, (Uint16)packedLines[ y ].size());
+		WriteWord(data, image.GetSCB(y));             // Mode
+	}
+
+	for (int y = 0; y < height; ++y)
+	{
+		data.insert(data.end(), packedLines[ y ].begin(), packedLines[ y ].end());
+	}
+
+	WriteLong(&data[0], (Uint32)data.size());
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool SaveAPF(const SHRImage& image, const std::string& filenamepath)
+{
+	std::vector<Uint8> data;
+
+	if (!EncodeAPF(image, data))
+		return false;
+
+	FILE* file = fopen(filenamepath.c_str(), "wb");
+
+	if (nullptr == file)
+	{
+		D16_SetError("SaveAPF: Unable to open %s", filenamepath.c_str());
+		return false;
+	}
+
+	size_t written = fwrite(&data[0], 1, data.size(), file);
+
+	fclose(file);
+
+	if (written != data.size())
+	{
+		D16_SetError("SaveAPF: Unable to write %s", filenamepath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool IsSHRFile(const std::string& filenamepath)
+{
+	static const char* extensions[] = { "c1", "shr", "pnt", "apf" };
+
+	std::string name = filenamepath;
+
+	for (size_t idx = 0; idx < name.size(); ++idx)
+	{
+		name[ idx ] = (char)tolower(name[ idx ]);
+	}
+
+	// ProDOS file type, and aux type, on the end
+	if ((name.find("#c10000") != std::string::npos) ||
+		(name.find("#c00001") != std::string::npos) ||
+		(name.find("#c00002") != std::string::npos))
+	{
+		return true;
+	}
+
+	size_t dot = name.find_last_of('.');
+
+	if (std::string::npos == dot)
+		return false;
+
+	std::string ext = name.substr(dot + 1);
+
+	for (int idx = 0; idx < (int)(sizeof(extensions)/sizeof(extensions[0])); ++idx)
+	{
+		if (ext == extensions[ idx ])
+			return true;
+	}
+
+	return false;
+}
+
+//------------------------------------------------------------------------------
+
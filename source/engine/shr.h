@@ -0,0 +1,111 @@
+//
+// Engine SHR - Apple IIgs Super Hi-Res screens, as they are on the IIgs
+//
+// Unlike IndexedImage, this keeps what the hardware sees, a palette entry
+// (0-15) per pixel, a Scanline Control Byte per line, that picks one of 16
+// palettes (and 320, or 640 mode), and the palettes as $0RGB words.  So
+// a screen can be opened, re-touched, or re-palettized, and written back,
+// without losing any of that.
+//
+// Readers for
+//   $C1/$0000  raw 32K screen memory
+//   $C0/$0001  the same 32K, PackBytes compressed (PNT)
+//   $C0/$0002  Apple Preferred Format (APF), MAIN block, any size
+//
+// and a writer for APF
+//
+#ifndef ENGINE_SHR_H_
+#define ENGINE_SHR_H_
+
+#include "pixels.h"
+
+#include <string>
+
+// Scanline Control Byte
+#define SHR_SCB_640        0x80
+#define SHR_SCB_INTERRUPT  0x40
+#define SHR_SCB_FILL       0x20   // 320 mode, a 0 pixel repeats the one before
+#define SHR_SCB_PALETTE    0x0F
+
+enum SHRFormat
+{
+	eSHRUnknown,
+	eSHRRawC1,     // $C1/$0000
+	eSHRPacked,    // $C0/$0001
+	eSHRAPF        // $C0/$0002
+};
+
+//------------------------------------------------------------------------------
+
+class SHRImage
+{
+public:
+	static const int NUM_PALETTES = 16;
+
+	// All pixels, SCBs, and colors 0
+	SHRImage(int width, int height);
+	~SHRImage();
+
+	// Up to 16 colors, is one palette.  Up to 256, is palette (index / 16),
+	// and entry (index % 16), and each line has to stay in one palette.
+	// 320 mode, caller owns the result, nullptr, and D16_SetError if it
+	// doesn't fit
+	static SHRImage* FromIndexed(const IndexedImage& image);
+
+	int GetWidth() const  { return m_width; }
+	int GetHeight() const { return m_height; }
+
+	// Palette entry, 0-15, per pixel.  640 mode pixels are stored as the
+	// entry they show, which depends on the column, as well as the value
+	Uint8* GetPixels() { return &m_pixels[0]; }
+	const Uint8* GetPixels() const { return &m_pixels[0]; }
+
+	Uint8 GetSCB(int y) const { return m_scbs[ y ]; }
+	void SetSCB(int y, Uint8 scb) { m_scbs[ y ] = scb; }
+
+	// 16 colors, $0RGB
+	Uint16* GetPalette(int index) { return &m_palettes[ index * 16 ]; }
+	const Uint16* GetPalette(int index) const { return &m_palettes[ index * 16 ]; }
+
+	// True, and which one, if every line uses the same palette
+	bool UsesOnePalette(int* pPalette = nullptr) const;
+
+	// The entries a line shows, with fill mode worked out
+	void GetLineEntries(int y, Uint8* pEntries) const;
+
+	// What it looks like, caller owns the result
+	RGBAImage* CreateRGBA() const;
+
+	// 16 colors, if one palette is used, otherwise all 256 (palette * 16
+	// + entry), caller owns the result
+	IndexedImage* CreateIndexed() const;
+
+private:
+	int m_width;
+	int m_height;
+	std::vector<Uint8>  m_pixels;
+	std::vector<Uint8>  m_scbs;
+	std::vector<Uint16> m_palettes;   // NUM_PALETTES * 16
+};
+
+//------------------------------------------------------------------------------
+
+// $0RGB -> opaque RGBA, each nibble repeated, so $F is $FF
+Uint32 IIgsColorToRGBA(Uint16 color);
+
+// Does the name look like a Super Hi-Res file, .c1, .shr, .pnt, .apf, or
+// a ProDOS type suffix, like #c10000 (how CiderPress exports them)
+bool IsSHRFile(const std::string& filenamepath);
+
+// Works out the format from the data, not the name.  The file is memory
+// mapped, caller owns the result, nullptr, and D16_SetError on failure
+SHRImage* LoadSHRImage(const std::string& filenamepath, int* pFormat = nullptr);
+SHRImage* LoadSHRImage(const Uint8* pData, size_t numBytes, int* pFormat = nullptr);
+
+// APF, with just a MAIN block, the size, SCBs, and palettes as they are.
+// Lines are packed in parallel, and each one is unpacked, and checked,
+// before it goes in
+bool EncodeAPF(const SHRImage& image, std::vector<Uint8>& data);
+bool SaveAPF(const SHRImage& image, const std::string& filenamepath);
+
+#endif // ENGINE_SHR_H_
@@ -0,0 +1,458 @@
+//
+// Engine ThumbnailCache - Small previews of image files, made in the background
+//
+#include "thumbcache.h"
+
+#include "cache.h"
+#include "fileio.h"
+#include "files.h"
+#include "resize.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// A job that starts on a file that's been off screen this many frames,
+// drops it
+static const int THUMB_STALE_FRAMES = 2;
+
+static const char* THUMB_EXTENSION = ".png";
+
+struct ThumbnailCache::Entry
+{
+	Entry(const std::string& filenamepath)
+		: m_filenamepath(filenamepath)
+		, m_state(eThumbNone)
+		, m_pImage(nullptr)
+	{
+		SDL_AtomicSet(&m_requestFrame, 0);
+	}
+
+	~Entry()
+	{
+		delete m_pImage;
+	}
+
+	std::string m_filenamepath;
+	SDL_atomic_t m_requestFrame;
+
+	int m_state;             // m_pMutex
+	RGBAImage* m_pImage;     // m_pMutex, set once it's eThumbReady
+
+	JobHandle m_job;         // UI thread
+};
+
+//------------------------------------------------------------------------------
+
+ThumbnailCache::ThumbnailCache(const std::string& directory, int thumbSize, long long maxDiskBytes)
+	: m_directory(directory)
+	, m_thumbSize(SDL_max(thumbSize, 1))
+	, m_pMutex(SDL_CreateMutex())
+	, m_maxDiskBytes(maxDiskBytes)
+	, m_diskBytes(-1)
+	, m_bTrimming(false)
+{
+	SDL_AtomicSet(&m_frame, 0);
+	SDL_AtomicSet(&m_tempCounter, 0);
+
+	// Count what's there, and clear out what earlier runs left over the cap
+	if (!m_directory.empty())
+		SubmitTrimDisk();
+}
+
+ThumbnailCache::~ThumbnailCache()
+{
+	// Anything still queued drops itself, it won't look requested
+	SDL_AtomicAdd(&m_frame, THUMB_STALE_FRAMES + 1);
+
+	for (std::map<std::string, Entry*>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		if (it->second->m_job.IsValid())
+			JobSystem::GetDefault().Wait(it->second->m_job);
+
+		delete it->second;
+	}
+
+	m_entries.clear();
+
+	// Nothing is saving anymore, so nothing can start another
+	if (m_trimJob.IsValid())
+		JobSystem::GetDefault().Wait(m_trimJob);
+
+	if (m_pMutex)
+	{
+		SDL_DestroyMutex(m_pMutex);
+		m_pMutex = nullptr;
+	}
+}
+
+//------------------------------------------------------------------------------
+
+/*static*/ std::string ThumbnailCache::DefaultDirectory()
+{
+	char* pPrefPath = SDL_GetPrefPath("dwsJason", "d16");
+
+	if (nullptr == pPrefPath)
+		return "";
+
+	std::string directory = JoinPath(pPrefPath, "thumbs");
+
+	SDL_free(pPrefPath);
+
+	return directory;
+}
+
+//------------------------------------------------------------------------------
+
+void ThumbnailCache::NextFrame()
+{
+	SDL_AtomicAdd(&m_frame, 1);
+}
+
+int ThumbnailCache::Request(const std::string& filenamepath, const RGBAImage** ppImage)
+{
+	*ppImage = nullptr;
+
+	Entry* pEntry = nullptr;
+
+	std::map<std::string, Entry*>::iterator it = m_entries.find(filenamepath);
+
+	if (it == m_entries.end())
+	{
+		pEntry = new Entry(filenamepath);
+		m_entries[ filenamepath ] = pEntry;
+	}
+	else
+	{
+		pEntry = it->second;
+	}
+
+	SDL_AtomicSet(&pEntry->m_requestFrame, SDL_AtomicGet(&m_frame));
+
+	SDL_LockMutex(m_pMutex);
+
+	int state = pEntry->m_state;
+
+	if (eThumbReady == state)
+		*ppImage = pEntry->m_pImage;
+	else if (eThumbNone == state)
+		pEntry->m_state = eThumbPending;
+
+	SDL_UnlockMutex(m_pMutex);
+
+	if (eThumbNone == state)
+	{
+		pEntry->m_job = JobSystem::GetDefault().Submit([this, pEntry]()
+		{
+			Make(pEntry);
+
+		}, eJobBatch);
+
+		state = eThumbPending;
+	}
+
+	return state;
+}
+
+//------------------------------------------------------------------------------
+
+int ThumbnailCache::GetNumPending() const
+{
+	int numPending = 0;
+
+	SDL_LockMutex(m_pMutex);
+
+	for (std::map<std::string, Entry*>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		if (eThumbPending == it->second->m_state)
+			++numPending;
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+
+	return numPending;
+}
+
+//------------------------------------------------------------------------------
+// Oldest requests go first, pending ones stay, a job is pointing at them
+
+void ThumbnailCache::Trim(int maxEntries)
+{
+	if ((int)m_entries.size() <= maxEntries)
+		return;
+
+	std::vector<std::pair<int, Entry*>> candidates;
+
+	SDL_LockMutex(m_pMutex);
+
+	for (std::map<std::string, Entry*>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		if (eThumbPending != it->second->m_state)
+		{
+			candidates.push_back(std::make_pair(SDL_AtomicGet(&it->second->m_requestFrame),
+												it->second));
+		}
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+
+	std::sort(candidates.begin(), candidates.end(),
+			  [](const std::pair<int, Entry*>& a, const std::pair<int, Entry*>& b)
+			  {
+				  return a.first < b.first;
+			  });
+
+	int numRemove = SDL_min((int)m_entries.size() - maxEntries, (int)candidates.size());
+
+	for (int idx = 0; idx < numRemove; ++idx)
+	{
+		Entry* pEntry = candidates[ idx ].second;
+
+		m_entries.erase(pEntry->m_filenamepath);
+		delete pEntry;
+	}
+}
+
+//------------------------------------------------------------------------------
+// On a worker
+
+void ThumbnailCache::Make(Entry* pEntry)
+{
+	int age = SDL_AtomicGet(&m_frame) - SDL_AtomicGet(&pEntry->m_requestFrame);
+
+	if (age > THUMB_STALE_FRAMES)
+	{
+		SDL_LockMutex(m_pMutex);
+		pEntry->m_state = eThumbNone;
+		SDL_UnlockMutex(m_pMutex);
+		return;
+	}
+
+	RGBAImage* pImage = Build(pEntry->m_filenamepath);
+
+	SDL_LockMutex(m_pMutex);
+
+	pEntry->m_pImage = pImage;
+	pEntry->m_state = pImage ? eThumbReady : eThumbFailed;
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+
+RGBAImage* ThumbnailCache::Build(const std::string& filenamepath)
+{
+	long long modifiedTime = GetModifiedTime(filenamepath);
+	long long fileSize = GetFileSize(filenamepath);
+
+	if (fileSize < 0)
+	{
+		D16_SetError("ThumbnailCache, %s is gone", filenamepath.c_str());
+		return nullptr;
+	}
+
+	std::string path;
+
+	if (!m_directory.empty())
+	{
+		Uint64 stamp[ 3 ] = { (Uint64)modifiedTime, (Uint64)fileSize, (Uint64)m_thumbSize };
+
+		Uint64 hash = HashBytes(filenamepath.c_str(), filenamepath.size(),
+								HashBytes(stamp, sizeof(stamp)));
+
+		// 256 sub directories, like the conversion cache
+		char name[ 64 ];
+		snprintf(name, sizeof(name), "%02x/%016llx.png", (unsigned int)(hash >> 56),
+				 (unsigned long long)hash);
+
+		path = JoinPath(m_directory, name);
+
+		if (FileExists(path))
+		{
+			RGBAImage* pCached = LoadRGBAImage(path);
+
+			if (pCached)
+			{
+				// Recently used, for TrimDisk
+				TouchFile(path);
+				return pCached;
+			}
+
+			// Damaged, make it again
+			remove(path.c_str());
+		}
+	}
+
+	RGBAImage* pSource = LoadRGBAImage(filenamepath);
+
+	if (nullptr == pSource)
+		return nullptr;
+
+	int width = pSource->GetWidth();
+	int height = pSource->GetHeight();
+
+	RGBAImage* pThumb = nullptr;
+
+	if ((width <= m_thumbSize) && (height <= m_thumbSize))
+	{
+		pThumb = pSource;
+		pSource = nullptr;
+	}
+	else
+	{
+		int thumbWidth = m_thumbSize;
+		int thumbHeight = m_thumbSize;
+
+		if (width > height)
+			thumbHeight = SDL_max(1, (int)(((long long)height * m_thumbSize) / width));
+		else
+			thumbWidth = SDL_max(1, (int)(((long long)width * m_thumbSize) / height));
+
+		pThumb = ShrinkImage(*pSource, thumbWidth, thumbHeight);
+	}
+
+	delete pSource;
+
+	// Not being able to save it is only slower next time
+	if (pThumb && !path.empty() && MakeDirectories(GetDirectory(path)))
+	{
+		char suffix[ 64 ];
+		snprintf(suffix, sizeof(suffix), ".tmp%lu_%d", (unsigned long)SDL_ThreadID(),
+				 SDL_AtomicAdd(&m_tempCounter, 1));
+
+		std::string tempPath = path + suffix;
+
+		bool bWritten = SavePNG(*pThumb, tempPath);
+
+		if (bWritten)
+		{
+			// Windows won't rename on top of an existing file
+			if (0 != rename(tempPath.c_str(), path.c_str()))
+			{
+				remove(path.c_str());
+				bWritten = (0 == rename(tempPath.c_str(), path.c_str()));
+			}
+		}
+
+		if (!bWritten)
+			remove(tempPath.c_str());
+
+		long long savedBytes = bWritten ? GetFileSize(path) : -1;
+
+		if (savedBytes > 0)
+		{
+			bool bTrim = false;
+
+			SDL_LockMutex(m_pMutex);
+
+			if (m_diskBytes >= 0)
+			{
+				m_diskBytes += savedBytes;
+				bTrim = m_diskBytes > m_maxDiskBytes;
+			}
+
+			SDL_UnlockMutex(m_pMutex);
+
+			if (bTrim)
+				SubmitTrimDisk();
+		}
+	}
+
+	return pThumb;
+}
+
+//------------------------------------------------------------------------------
+
+void ThumbnailCache::SubmitTrimDisk()
+{
+	SDL_LockMutex(m_pMutex);
+
+	if (!m_bTrimming)
+	{
+		m_bTrimming = true;
+
+		m_trimJob = JobSystem::GetDefault().Submit([this]()
+		{
+			TrimDisk();
+
+		}, eJobBatch);
+	}
+
+	SDL_UnlockMutex(m_pMutex);
+}
+
+//------------------------------------------------------------------------------
+// On a worker, least recently used first, the same as ConversionCache::Trim
+
+struct ThumbFile
+{
+	std::string m_path;
+	long long m_modifiedTime;
+	long long m_size;
+
+	bool operator<(const ThumbFile& other) const
+	{
+		return m_modifiedTime < other.m_modifiedTime;
+	}
+};
+
+void ThumbnailCache::TrimDisk()
+{
+	std::vector<std::string> files;
+	CollectFiles(m_directory, true, files);
+
+	std::vector<ThumbFile> thumbs;
+	long long totalBytes = 0;
+	long long now = (long long)time(nullptr);
+	size_t extLength = strlen(THUMB_EXTENSION);
+
+	for (int idx = 0; idx < (int)files.size(); ++idx)
+	{
+		ThumbFile thumb;
+		thumb.m_path = files[ idx ];
+		thumb.m_modifiedTime = GetModifiedTime(thumb.m_path);
+		thumb.m_size = GetFileSize(thumb.m_path);
+
+		if (thumb.m_size < 0)
+			continue;
+
+		const std::string& path = thumb.m_path;
+
+		bool bThumb = (path.size() > extLength) &&
+					  (0 == path.compare(path.size() - extLength, extLength, THUMB_EXTENSION));
+
+		if (!bThumb)
+		{
+			// A save that didn't finish, an hour ago
+			if ((std::string::npos != path.find(".tmp")) && ((now - thumb.m_modifiedTime) > 3600))
+				remove(path.c_str());
+
+			continue;
+		}
+
+		totalBytes += thumb.m_size;
+		thumbs.push_back(thumb);
+	}
+
+	if (totalBytes > m_maxDiskBytes)
+	{
+		// Go a bit under, so the next few saves don't start another
+		std::sort(thumbs.begin(), thumbs.end());
+
+		long long targetBytes = m_maxDiskBytes - (m_maxDiskBytes / 10);
+
+		for (int idx = 0; (idx < (int)thumbs.size()) && (totalBytes > targetBytes); ++idx)
+		{
+			if (0 == remove(thumbs[ idx ].m_path.c_str()))
+				totalBytes -= thumbs[ idx ].m_size;
+		}
+	}
+
+	SDL_LockMutex(m_pMutex);
+
+	m_diskBytes = totalBytes;
+	m_bTrimming = false;
+
+	SDL_UnlockMutex(m_pMutex);
+}
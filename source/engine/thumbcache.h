@@ -0,0 +1,98 @@
+//
+// Engine ThumbnailCache - Small previews of image files, made in the background
+//
+// Request is called from the UI thread, for the files that are on screen
+// right now.  Anything not already in memory is queued on the job system,
+// where it's loaded from the disk cache, or decoded, shrunk (box filter),
+// and saved there for next time.  Disk entries are keyed by the path, the
+// modified time, and the size, so an edited file gets a new thumbnail.
+//
+// The disk cache is capped, like the conversion cache, a thumbnail that's
+// used gets its modified time touched, and once the folder goes over the
+// cap, the least recently used ones are removed, on a worker.  It's counted
+// once, when the cache is made, after that, saves add up.
+//
+// Scrolling fast through a big folder queues a lot of files that are gone
+// again before a worker gets to them, so a job that starts on a file that
+// hasn't been requested in the last couple of frames just drops it.
+//
+#ifndef ENGINE_THUMBCACHE_H_
+#define ENGINE_THUMBCACHE_H_
+
+#include "pixels.h"
+#include "jobs.h"
+
+#include <map>
+#include <string>
+
+enum ThumbnailState
+{
+	eThumbNone,      // not requested, or dropped before it was made
+	eThumbPending,   // queued, or being made
+	eThumbReady,
+	eThumbFailed     // couldn't be decoded, won't be tried again
+};
+
+class ThumbnailCache
+{
+public:
+	// Thumbnails fit in thumbSize x thumbSize, keeping their aspect, a
+	// directory of "" keeps them in memory only.  maxDiskBytes is a soft cap
+	// on the directory
+	ThumbnailCache(const std::string& directory, int thumbSize = DEFAULT_SIZE,
+				   long long maxDiskBytes = DEFAULT_MAX_DISK_BYTES);
+
+	// Waits for the jobs still going
+	~ThumbnailCache();
+
+	// Once a frame, before the Requests
+	void NextFrame();
+
+	// Queues the thumbnail, if it isn't already, and returns its state,
+	// *ppImage is set once it's eThumbReady, the cache owns the image, it's
+	// good until Trim removes it
+	int Request(const std::string& filenamepath, const RGBAImage** ppImage);
+
+	// Remove thumbnails that haven't been requested in a while, until there
+	// are no more than maxEntries
+	void Trim(int maxEntries);
+
+	int GetNumPending() const;
+	int GetThumbSize() const { return m_thumbSize; }
+
+	// Per user thumbnail location, "" if SDL can't find one
+	static std::string DefaultDirectory();
+
+	static const int DEFAULT_SIZE = 96;
+	static const long long DEFAULT_MAX_DISK_BYTES = 64LL * 1024 * 1024;
+
+private:
+	struct Entry;
+
+	void Make(Entry* pEntry);
+	RGBAImage* Build(const std::string& filenamepath);
+
+	// Starts a TrimDisk on a worker, if there isn't one going
+	void SubmitTrimDisk();
+	void TrimDisk();
+
+	std::string m_directory;
+	int m_thumbSize;
+
+	SDL_atomic_t m_frame;
+
+	SDL_mutex* m_pMutex;     // Entry state, and image, and the disk counts
+	std::map<std::string, Entry*> m_entries;  // only changed on the UI thread
+	SDL_atomic_t m_tempCounter;
+
+	long long m_maxDiskBytes;
+	long long m_diskBytes;   // -1 until TrimDisk has counted
+	bool m_bTrimming;
+	JobHandle m_trimJob;
+
+	// Not copyable
+	ThumbnailCache(const ThumbnailCache&);
+	ThumbnailCache& operator=(const ThumbnailCache&);
+};
+
+#endif // ENGINE_THUMBCACHE_H_
@@ -0,0 +1,215 @@
+//
+// Engine Watcher - Tell us when images in a set of directories change
+//
+#include "watcher.h"
+
+#include "files.h"
+#include "pixels.h"
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+//------------------------------------------------------------------------------
+
+FolderWatcher::FolderWatcher()
+{
+#ifdef __linux__
+	m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+}
+
+FolderWatcher::~FolderWatcher()
+{
+#ifdef __linux__
+	if (m_inotify >= 0)
+	{
+		close(m_inotify);
+		m_inotify = -1;
+	}
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+bool FolderWatcher::AddDirectory(const std::string& directory, bool bRecursive)
+{
+	if (!IsDirectory(directory))
+	{
+		D16_SetError("FolderWatcher: %s is not a directory", directory.c_str());
+		return false;
+	}
+
+	WatchedDirectory watched;
+	watched.m_path = directory;
+	watched.m_bRecursive = bRecursive;
+
+	m_directories.push_back(watched);
+
+#ifdef __linux__
+	if (m_inotify < 0)
+	{
+		D16_SetError("FolderWatcher: inotify_init1 failed");
+		return false;
+	}
+
+	if (!AddWatch(directory, bRecursive))
+		return false;
+
+	if (bRecursive)
+	{
+		std::vector<std::string> directories;
+		CollectDirectories(directory, directories);
+
+		for (int idx = 0; idx < (int)directories.size(); ++idx)
+		{
+			AddWatch(directories[ idx ], bRecursive);
+		}
+	}
+#else
+	// Take a snapshot, so the first Poll only reports real changes
+	std::map<std::string, long long> files;
+	Scan(files);
+	m_modifiedTimes.swap(files);
+#endif
+
+	return true;
+}
+
+#ifdef __linux__
+//------------------------------------------------------------------------------
+
+bool FolderWatcher::AddWatch(const std::string& directory, bool bRecursive)
+{
+	// IN_CLOSE_WRITE, so we don't see half written files
+	// IN_MOVED_TO, for the editors that save to a temp, then rename
+	// IN_CREATE, for new sub-directories
+	int wd = inotify_add_watch(m_inotify, directory.c_str(),
+							   IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+	if (wd < 0)
+	{
+		D16_SetError("FolderWatcher: unable to watch %s", directory.c_str());
+		return false;
+	}
+
+	WatchedDirectory& watched = m_watches[ wd ];
+	watched.m_path = directory;
+	watched.m_bRecursive = bRecursive;
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+void FolderWatcher::Poll(int timeoutMS, std::vector<std::string>& changed)
+{
+	if (m_inotify < 0)
+		return;
+
+	struct pollfd fds;
+	fds.fd = m_inotify;
+	fds.events = POLLIN;
+	fds.revents = 0;
+
+	if (poll(&fds, 1, timeoutMS) <= 0)
+		return;
+
+	// Events are variable length, the buffer needs to be aligned for them
+	char buffer[ 16 * 1024 ] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+
+	for (;;)
+	{
+		ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+
+		if (length <= 0)
+			break;
+
+		for (char* pEvent = buffer; pEvent < buffer + length; )
+		{
+			const struct inotify_event* pInfo = (const struct inotify_event*)pEvent;
+
+			pEvent += sizeof(struct inotify_event) + pInfo->len;
+
+			std::map<int, WatchedDirectory>::iterator it = m_watches.find(pInfo->wd);
+
+			if ((it == m_watches.end()) || (0 == pInfo->len))
+				continue;
+
+			std::string path = JoinPath(it->second.m_path, pInfo->name);
+
+			if (pInfo->mask & IN_ISDIR)
+			{
+				if (it->second.m_bRecursive && (pInfo->mask & (IN_CREATE | IN_MOVED_TO)))
+				{
+					bool bRecursive = it->second.m_bRecursive;
+
+					// it is invalid after this
+					AddWatch(path, bRecursive);
+
+					// Anything that landed in there before the watch was
+					// set up, would be missed otherwise
+					CollectImageFiles(path, bRecursive, changed);
+
+					std::vector<std::string> directories;
+					CollectDirectories(path, directories);
+
+					for (int idx = 0; idx < (int)directories.size(); ++idx)
+					{
+						AddWatch(directories[ idx ], bRecursive);
+					}
+				}
+			}
+			else if ((pInfo->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) && IsImageFile(path))
+			{
+				changed.push_back(path);
+			}
+		}
+	}
+}
+
+#else
+//------------------------------------------------------------------------------
+
+void FolderWatcher::Scan(std::map<std::string, long long>& files)
+{
+	for (int idx = 0; idx < (int)m_directories.size(); ++idx)
+	{
+		std::vector<std::string> images;
+		CollectImageFiles(m_directories[ idx ].m_path, m_directories[ idx ].m_bRecursive, images);
+
+		for (int imageIndex = 0; imageIndex < (int)images.size(); ++imageIndex)
+		{
+			files[ images[ imageIndex ] ] = GetModifiedTime(images[ imageIndex ]);
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+
+void FolderWatcher::Poll(int timeoutMS, std::vector<std::string>& changed)
+{
+	SDL_Delay(timeoutMS);
+
+	std::map<std::string, long long> files;
+	Scan(files);
+
+	std::map<std::string, long long>::iterator it;
+
+	for (it = files.begin(); it != files.end(); ++it)
+	{
+		std::map<std::string, long long>::iterator previous = m_modifiedTimes.find(it->first);
+
+		if ((previous == m_modifiedTimes.end()) || (previous->second != it->second))
+		{
+			changed.push_back(it->first);
+		}
+	}
+
+	m_modifiedTimes.swap(files);
+}
+#endif
+
+//------------------------------------------------------------------------------
+
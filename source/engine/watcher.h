@@ -0,0 +1,49 @@
+//
+// Engine Watcher - Tell us when images in a set of directories change
+//
+// Uses inotify on Linux, everywhere else it falls back to scanning the
+// directories, and comparing modified times
+//
+#ifndef ENGINE_WATCHER_H_
+#define ENGINE_WATCHER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+class FolderWatcher
+{
+public:
+	FolderWatcher();
+	~FolderWatcher();
+
+	bool AddDirectory(const std::string& directory, bool bRecursive);
+
+	// Wait up to timeoutMS for something to happen, image files that were
+	// written, or moved into a watched directory, get added to changed
+	void Poll(int timeoutMS, std::vector<std::string>& changed);
+
+private:
+
+	struct WatchedDirectory
+	{
+		std::string m_path;
+		bool m_bRecursive;
+	};
+
+	std::vector<WatchedDirectory> m_directories;
+
+#ifdef __linux__
+	bool AddWatch(const std::string& directory, bool bRecursive);
+
+	int m_inotify;
+	std::map<int, WatchedDirectory> m_watches;  // watch descriptor -> directory
+#else
+	void Scan(std::map<std::string, long long>& files);
+
+	std::map<std::string, long long> m_modifiedTimes;  // path -> mtime
+#endif
+};
+
+#endif // ENGINE_WATCHER_H_
+
@@ -11,18 +11,25 @@
 #include "ImGuiFileDialog.h"
 
 #include <stdio.h>
+#include <math.h>
 #include <SDL.h>
 #include <SDL_image.h>
 #include "log.h"
-#include "libimagequant.h"
-#include "limage.h"
-#include "avir.h"
-#include "lancir.h"
+#include "texture.h"
+#include "resources.h"
+#include "pipeline.h"
+#include "cache.h"
+#include "jobswindow.h"
+#include "shr.h"
+#include "ilbm.h"
+#include "frames.h"
+#include "files.h"
+#include "paldoc.h"
 
 #include "toolbar.h"
 #include "cursor.h"
 
-#include <map>
+#include <algorithm>
 #include <vector>
 
 // About Desktop OpenGL function loaders:
@@ -41,44 +48,162 @@
 
 // Statics
 int ImageDocument::s_uniqueId = 0;
+int ImageDocument::s_uploadFrame = -1;
+int ImageDocument::s_numUploads = 0;
 
 static SDL_Cursor* pEyeDropperCursor = nullptr;
 
-// Prototype for helper function, that should live in a some sort of helper
-// module, but so far does not
-GLuint
-SDL_GL_LoadTexture(SDL_Surface * surface, GLfloat * texcoord);
+// Texture uploads have to happen on the main thread, this many loaded
+// images get their textures per frame, so 50 landing together don't hitch
+static const int MAX_UPLOADS_PER_FRAME = 4;
+
+//------------------------------------------------------------------------------
+// How long a frame is shown, like browsers, GIFs that say 0, or 1 get 1/10th
+// of a second, and so do sequences, that don't say
+
+static int FrameDelayMS(const std::vector<int>& delays, int frame)
+{
+	int delay = (frame < (int)delays.size()) ? delays[ frame ] : 0;
+
+	if (delay < 2)
+		delay = 10;
+
+	return delay * 10;
+}
 
 //------------------------------------------------------------------------------
 
 ImageDocument::ImageDocument(std::string filename, std::string pathname, SDL_Surface *pImage)
 	: m_filename(filename)
 	, m_pathname(pathname)
-	, m_pSurface( pImage )
+	, m_pSurface(nullptr)
+	, m_frame(0)
+	, m_bPlaying(false)
+	, m_frameTicks(0)
+	, m_textureWidth(0)
+	, m_textureHeight(0)
+	, m_numSourceColors(0)
+	, m_width(0)
+	, m_height(0)
 	, m_zoom(1)
 	, m_targetImage(0)
 	, m_pTargetSurface(nullptr)
 	, m_numTargetColors(16)
 	, m_iDither(50)
+	, m_iDitherMethod(eDitherDiffusion)
 	, m_iPosterize(ePosterize444)
+	, m_pngLevel(eDeflateSmallest)
+	, m_loadProgressId(0)
+	, m_bLoading(false)
+	, m_bSizeWindow(false)
+	, m_quantProgressId(0)
+	, m_bQuantizing(false)
 	, m_bOpen(true)
 	, m_bPanActive(false)
 	, m_bShowResizeUI(false)
 	, m_bEyeDropDrag(false)
 {
+	InitDocument();
+
 	// Make sure the surface is in a supported format for eyedropper
 	//if (SDL_PIXELFORMAT_RGBA8888 != pImage->format->format)
 	if (4 != pImage->format->BytesPerPixel)
 	{
-		m_pSurface = SDL_SurfaceToRGBA( pImage );
+		SDL_Surface* pRGBA = SDL_SurfaceToRGBA( pImage );
 		SDL_FreeSurface( pImage );
-		pImage = m_pSurface;
+		pImage = pRGBA;
+	}
+
+	SetLoadedFrames(std::vector<SDL_Surface*>(1, pImage));
+
+	m_numSourceColors = CountUniqueColors(m_pSurface);
+	m_frameColors[0] = m_numSourceColors;
+}
+
+ImageDocument::ImageDocument(std::string filename, std::string pathname, bool bSequence)
+	: m_filename(filename)
+	, m_pathname(pathname)
+	, m_pSurface(nullptr)
+	, m_frame(0)
+	, m_bPlaying(false)
+	, m_frameTicks(0)
+	, m_textureWidth(0)
+	, m_textureHeight(0)
+	, m_numSourceColors(0)
+	, m_width(0)
+	, m_height(0)
+	, m_zoom(1)
+	, m_targetImage(0)
+	, m_pTargetSurface(nullptr)
+	, m_numTargetColors(16)
+	, m_iDither(50)
+	, m_iDitherMethod(eDitherDiffusion)
+	, m_iPosterize(ePosterize444)
+	, m_pngLevel(eDeflateSmallest)
+	, m_loadProgressId(0)
+	, m_bLoading(true)
+	, m_bSizeWindow(false)
+	, m_quantProgressId(0)
+	, m_bQuantizing(false)
+	, m_bOpen(true)
+	, m_bPanActive(false)
+	, m_bShowResizeUI(false)
+	, m_bEyeDropDrag(false)
+{
+	InitDocument();
+
+	// A batch job, so the ParallelFor inside CountUniqueColors only ever
+	// helps with its own row bands, and never starts a second decode
+	int progressId = JobsWindow::GetProgress().Add("Load " + filename);
+	m_loadProgressId = progressId;
+
+	m_load = JobSystem::GetDefault().Async<LoadedImage>(
+				[pathname, progressId, bSequence]() { return DecodeImageFile(pathname, progressId, bSequence); },
+				eJobBatch);
+}
+
+//------------------------------------------------------------------------------
+// The parts that don't need the pixels
+void ImageDocument::InitDocument()
+{
+	// Assign a unique Window Name
+	m_windowName = m_filename + "##" + std::to_string(s_uniqueId++);
+
+	m_image = 0;
+
+	// Initialize Target Colors
+	for (int idx = 0; idx < 16; ++idx)
+	{
+		m_targetColors.push_back(ImVec4(idx/15.0f,idx/15.0f,idx/15.0f, 1.0f));
+		m_bLocks.push_back(0);
+	}
+
+	if (nullptr == pEyeDropperCursor)
+	{
+		pEyeDropperCursor = SDL_CreateEyeDropperCursor();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Takes the 32bpp surfaces, all the same size, gets the first one on the
+// GPU, main thread only
+void ImageDocument::SetLoadedFrames(const std::vector<SDL_Surface*>& frames)
+{
+	m_frames = frames;
+	m_frameColors.assign(m_frames.size(), -1);
+	m_frame = 0;
+
+	for (int idx = 0; idx < (int)m_frames.size(); ++idx)
+	{
+		ResourceTracker::AddSurface(m_windowName, m_frames[ idx ]);
 	}
 
-	m_image = SDL_GL_LoadTexture(pImage, m_image_uv);
+	m_pSurface = m_frames[0];
 
-	m_width  = pImage->w;
-	m_height = pImage->h;
+	m_width  = m_pSurface->w;
+	m_height = m_pSurface->h;
+
+	LoadSourceTexture();
 
 	// If the image is small, automatically make it a little bigger
 	if (m_width < 640)
@@ -90,39 +215,296 @@ ImageDocument::ImageDocument(std::string filename, std::string pathname, SDL_Sur
 			m_zoom = 4;
 		}
 	}
+}
 
-	// Assign a unique Window Name
-	m_windowName = filename + "##" + std::to_string(s_uniqueId++);
+//------------------------------------------------------------------------------
+// Runs on a worker, everything but the GL upload
+/*static*/ ImageDocument::LoadedImage ImageDocument::DecodeImageFile(const std::string& pathname,
+																	  int progressId, bool bSequence)
+{
+	LoadedImage loaded;
+	BatchProgress& progress = JobsWindow::GetProgress();
 
-	m_numSourceColors = CountUniqueColors();
+	if (!progress.Start(progressId))
+	{
+		loaded.m_error = "Canceled";
+		progress.Finish(progressId, false, 0, loaded.m_error);
+		return loaded;
+	}
 
-	// Initialize Target Colors
-	for (int idx = 0; idx < 16; ++idx)
+	SDL_Surface* pImage = nullptr;
+
+	// Animations, and sequences, every frame the same size
+	std::vector<RGBAImage*> frames;
+
+	if (bSequence)
 	{
-		m_targetColors.push_back(ImVec4(idx/15.0f,idx/15.0f,idx/15.0f, 1.0f));
-		m_bLocks.push_back(0);
+		std::vector<std::string> files;
+		FindFrameSequence(pathname, files);
+
+		if (!LoadFrameSequence(files, frames))
+			IMG_SetError("%s", D16_GetError());
+	}
+	else if (IsGIFFile(pathname) && LoadGIFFrames(pathname, frames, &loaded.m_delays))
+	{
+		// SDL_image would only have given us the first frame
 	}
+	else if (IsSHRFile(pathname))
+	{
+		SHRImage* pSHR = LoadSHRImage(pathname);
+		IndexedImage* pIndexed = pSHR ? pSHR->CreateIndexed() : nullptr;
 
-	if (nullptr == pEyeDropperCursor)
+		if (pIndexed)
+		{
+			pImage = pIndexed->CreateSurface();
+
+			if (16 == pIndexed->GetNumColors())
+			{
+				loaded.m_palette.assign(pIndexed->GetPalette(), pIndexed->GetPalette() + 16);
+			}
+		}
+		else
+		{
+			IMG_SetError("%s", D16_GetError());
+		}
+
+		delete pIndexed;
+		delete pSHR;
+	}
+	else if (IsILBMFile(pathname))
 	{
-		pEyeDropperCursor = SDL_CreateEyeDropperCursor();
+		int numCMAPColors = 0;
+		IndexedImage* pIndexed = LoadILBMImage(pathname, &numCMAPColors);
+
+		if (pIndexed)
+		{
+			pImage = pIndexed->CreateSurface();
+
+			int numColors = numCMAPColors < 16 ? numCMAPColors : 16;
+
+			loaded.m_palette.assign(pIndexed->GetPalette(), pIndexed->GetPalette() + numColors);
+			loaded.m_bLockPalette = true;
+
+			delete pIndexed;
+		}
+		else
+		{
+			// HAM, 24 bit, and the rest, SDL_image might still manage
+			pImage = IMG_Load(pathname.c_str());
+		}
+	}
+	else
+	{
+		pImage = IMG_Load(pathname.c_str());
+	}
+
+	if (pImage && (4 != pImage->format->BytesPerPixel))
+	{
+		SDL_Surface* pRGBA = SDL_SurfaceToRGBA( pImage );
+		SDL_FreeSurface( pImage );
+		pImage = pRGBA;
+	}
+
+	if (pImage)
+		loaded.m_frames.push_back(pImage);
+
+	size_t numFrames = frames.empty() ? 1 : frames.size();
+
+	for (int idx = 0; idx < (int)frames.size(); ++idx)
+	{
+		SDL_Surface* pFrame = frames[ idx ]->CreateSurface();
+
+		delete frames[ idx ];
+
+		if (pFrame)
+			loaded.m_frames.push_back(pFrame);
+	}
+
+	// All, or nothing
+	if (loaded.m_frames.size() != numFrames)
+	{
+		for (int idx = 0; idx < (int)loaded.m_frames.size(); ++idx)
+		{
+			SDL_FreeSurface(loaded.m_frames[ idx ]);
+		}
+
+		loaded.m_frames.clear();
+		loaded.m_error = IMG_GetError();
+		progress.Finish(progressId, false, 0, loaded.m_error);
+		return loaded;
+	}
+
+	long long numPixels = (long long)loaded.m_frames[0]->w * loaded.m_frames[0]->h *
+						  (long long)loaded.m_frames.size();
+
+	// Decoded, the count is the rest
+	if (!progress.SetPercent(progressId, 70.0f))
+	{
+		for (int idx = 0; idx < (int)loaded.m_frames.size(); ++idx)
+		{
+			SDL_FreeSurface(loaded.m_frames[ idx ]);
+		}
+
+		loaded.m_frames.clear();
+		loaded.m_error = "Canceled";
+		progress.Finish(progressId, false, numPixels, loaded.m_error);
+		return loaded;
+	}
+
+	loaded.m_numColors = CountUniqueColors(loaded.m_frames[0]);
+
+	progress.Finish(progressId, true, numPixels);
+
+	return loaded;
+}
+
+//------------------------------------------------------------------------------
+// Returns true once the document is done loading, or failed, and closed
+bool ImageDocument::FinishLoading()
+{
+	if (!m_load.IsDone())
+		return false;
+
+	int frame = ImGui::GetFrameCount();
+
+	if (frame != s_uploadFrame)
+	{
+		s_uploadFrame = frame;
+		s_numUploads = 0;
 	}
+
+	if (s_numUploads >= MAX_UPLOADS_PER_FRAME)
+		return false;
+
+	++s_numUploads;
+
+	LoadedImage& loaded = m_load.Get();
+
+	m_bLoading = false;
+
+	if (loaded.m_frames.empty())
+	{
+		LOG("Failed %s: %s\n", m_pathname.c_str(), loaded.m_error.c_str());
+		m_bOpen = false;
+		return true;
+	}
+
+	if (loaded.m_frames.size() > 1)
+		LOG("Loaded %s, %d frames\n", m_pathname.c_str(), (int)loaded.m_frames.size());
+	else
+		LOG("Loaded %s\n", m_pathname.c_str());
+
+	SetLoadedFrames(loaded.m_frames);
+	m_frameDelays = loaded.m_delays;
+	m_numSourceColors = loaded.m_numColors;
+	m_frameColors[0] = m_numSourceColors;
+	loaded.m_frames.clear();
+
+	// Start from the colors it already has
+	for (int idx = 0; idx < (int)loaded.m_palette.size() && idx < (int)m_targetColors.size(); ++idx)
+	{
+		Uint32 color = loaded.m_palette[ idx ];
+
+		m_targetColors[ idx ] = ImVec4((color & 0xFF) / 255.0f, ((color >> 8) & 0xFF) / 255.0f,
+									   ((color >> 16) & 0xFF) / 255.0f, 1.0f);
+
+		if (loaded.m_bLockPalette)
+			m_bLocks[ idx ] = 1;
+	}
+
+	// The CMAP, where it can be dragged onto other documents
+	if (loaded.m_bLockPalette && !loaded.m_palette.empty())
+	{
+		std::vector<unsigned int> colors(loaded.m_palette.begin(), loaded.m_palette.end());
+
+		PaletteDocument::GDocuments.push_back(new PaletteDocument(m_filename + " CMAP", colors));
+	}
+
+	// The placeholder set the window size, put it back to fit the image
+	m_bSizeWindow = true;
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageDocument::RenderLoading()
+{
+	ImGui::SetNextWindowSize(ImVec2(240.0f, 120.0f), ImGuiCond_FirstUseEver);
+
+	ImGui::Begin(m_windowName.c_str(),&m_bOpen, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoScrollWithMouse);
+
+	ImGui::TextColored(ImVec4(0.7f,0.7f,0.7f,1.0f),"Loading %s", m_filename.c_str());
+
+	// Spinner, a ring of dots, the bright one goes around
+	const int   NUM_DOTS = 8;
+	const float RADIUS = 16.0f;
+	const float DOT_RADIUS = 3.0f;
+
+	ImVec2 pos = ImGui::GetCursorScreenPos();
+	ImVec2 center(pos.x + RADIUS + DOT_RADIUS, pos.y + RADIUS + DOT_RADIUS);
+
+	ImDrawList* pDrawList = ImGui::GetWindowDrawList();
+	int bright = (int)(ImGui::GetTime() * NUM_DOTS) % NUM_DOTS;
+
+	for (int idx = 0; idx < NUM_DOTS; ++idx)
+	{
+		float angle = (idx * 2.0f * 3.14159265f) / NUM_DOTS;
+		int age = (bright - idx + NUM_DOTS) % NUM_DOTS;
+
+		ImVec2 dot(center.x + cosf(angle) * RADIUS, center.y + sinf(angle) * RADIUS);
+
+		pDrawList->AddCircleFilled(dot, DOT_RADIUS,
+								   ImGui::GetColorU32(ImGuiCol_Text, 1.0f - (age / (float)NUM_DOTS)));
+	}
+
+	ImGui::Dummy(ImVec2((RADIUS + DOT_RADIUS) * 2.0f, (RADIUS + DOT_RADIUS) * 2.0f));
+
+	ImGui::End();
 }
 
 ImageDocument::~ImageDocument()
 {
+	if (m_bLoading)
+	{
+		// Closed before it finished, nobody is going to pick it up, so it
+		// gets freed whenever it lands (or doesn't get decoded, if it
+		// hasn't started yet)
+		JobsWindow::GetProgress().Cancel(m_loadProgressId);
+
+		JobSystem::GetDefault().Then<LoadedImage, int>(m_load,
+			[](LoadedImage& loaded)
+			{
+				for (int idx = 0; idx < (int)loaded.m_frames.size(); ++idx)
+				{
+					SDL_FreeSurface(loaded.m_frames[ idx ]);
+				}
+				return 0;
+			});
+	}
+
+	DiscardQuantize();
+
+	FreeTargetSurface();
+
 	// unregister / free the m_image
 	if (m_image)
 	{
+		ResourceTracker::RemoveTexture(m_image);
 		glDeleteTextures(1, &m_image);
 		m_image = 0;
 	}
-	// unregister / free the m_pSurface
-	if (m_pSurface)
+	// unregister / free the frames, m_pSurface is one of them
+	for (int idx = 0; idx < (int)m_frames.size(); ++idx)
 	{
-		SDL_FreeSurface(m_pSurface);
-		m_pSurface = nullptr;
+		ResourceTracker::RemoveSurface(m_frames[ idx ]);
+		SDL_FreeSurface(m_frames[ idx ]);
 	}
+
+	m_frames.clear();
+	m_pSurface = nullptr;
+
+	ResourceTracker::Remove(eResPixelBuffer, (uintptr_t)&m_staging);
 }
 #if 0
 void PutPixel32_nolock(SDL_Surface * surface, int x, int y, Uint32 color)
@@ -200,67 +582,22 @@ void PutPixel8(SDL_Surface * surface, int x, int y, Uint32 color)
 
 //------------------------------------------------------------------------------
 
-int ImageDocument::CountUniqueColors()
+/*static*/ int ImageDocument::CountUniqueColors(SDL_Surface* pSurface)
 {
-    SDL_Surface *pImage = SDL_CreateRGBSurface(SDL_SWSURFACE, m_width, m_height,
-											   32,
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN     /* OpenGL RGBA masks */
-                                 0x000000FF,
-                                 0x0000FF00, 0x00FF0000, 0xFF000000
-#else
-                                 0xFF000000,
-                                 0x00FF0000, 0x0000FF00, 0x000000FF
-#endif
-											   );
+	// Copy the source image into 32bpp format, then the engine sorts it out
+	// in row bands, on the job system
+	RGBAImage* pImage = RGBAImage::FromSurface(pSurface);
 
 	if (nullptr == pImage)
 	{
 		return 0;
 	}
 
-	// Copy the source image into 32bpp format
-	{
-		/* Save the alpha blending attributes */
-		SDL_Rect area;
-		SDL_BlendMode saved_mode;
-		SDL_GetSurfaceBlendMode(m_pSurface, &saved_mode);
-		SDL_SetSurfaceBlendMode(m_pSurface, SDL_BLENDMODE_NONE);
-
-		/* Copy the surface into the GL texture image */
-		area.x = 0;
-		area.y = 0;
-		area.w = m_pSurface->w;
-		area.h = m_pSurface->h;
-		SDL_BlitSurface(m_pSurface, &area, pImage, &area);
-
-		/* Restore the alpha blending attributes */
-		SDL_SetSurfaceBlendMode(m_pSurface, saved_mode);
-	}
-
-    if( SDL_MUSTLOCK(pImage) )
-        SDL_LockSurface(pImage);
-
-	std::map<Uint32,Uint32> histogram;
-
-	for (int y = 0; y < pImage->h; ++y)
-	{
-		for (int x = 0; x < pImage->w; ++x)
-		{
-			Uint8 * pixel = (Uint8*)pImage->pixels;
-			pixel += (y * pImage->pitch) + (x * sizeof(Uint32));
-
-			Uint32 color = *((Uint32*)pixel);
-
-			histogram[ color ] = 1;
-		}
-	}
-
-    if( SDL_MUSTLOCK(pImage) )
-        SDL_UnlockSurface(pImage);
+	int numColors = ::CountUniqueColors(*pImage);
 
-    SDL_FreeSurface(pImage);     /* No longer needed */
+	delete pImage;
 
-	return (int)histogram.size();
+	return numColors;
 }
 
 //------------------------------------------------------------------------------
@@ -276,6 +613,40 @@ void ImageDocument::Render()
 	// Posterize
 	// Force Target Palette
 	const float TOOLBAR_HEIGHT = 72.0f;
+	const float FRAMEBAR_HEIGHT = 24.0f;   // animations get a third line
+
+	if (m_bLoading)
+	{
+		if (!FinishLoading())
+		{
+			RenderLoading();
+			return;
+		}
+
+		if (!m_bOpen)
+			return;
+	}
+
+	// Animations, step along when the frame's time is up
+	if (m_bPlaying && (m_frames.size() > 1))
+	{
+		Uint32 ticks = SDL_GetTicks();
+
+		if ((ticks - m_frameTicks) >= (Uint32)FrameDelayMS(m_frameDelays, m_frame))
+		{
+			m_frameTicks = ticks;
+			SetFrame((m_frame + 1) % (int)m_frames.size());
+		}
+	}
+
+	// Swap in a quantize, once it has landed
+	if (m_bQuantizing && m_quant.IsDone())
+	{
+		FinishQuantize();
+	}
+
+	// Get any changed pixels up on the GPU, before we draw
+	UpdateTextures();
 
 	ImTextureID tex_id = (ImTextureID)((size_t) m_image ); 
 	ImVec2 uv0 = ImVec2(m_image_uv[0],m_image_uv[1]);
@@ -287,7 +658,12 @@ void ImageDocument::Render()
 	float padding_h = (style.WindowPadding.y + style.FrameBorderSize + style.ChildBorderSize) * 2.0f;
 	padding_h += TOOLBAR_HEIGHT;
 
-	ImGui::SetNextWindowSize(ImVec2((m_width*m_zoom)+padding_w, (m_height*m_zoom)+padding_h), ImGuiCond_FirstUseEver);
+	if (m_frames.size() > 1)
+		padding_h += FRAMEBAR_HEIGHT;
+
+	ImGui::SetNextWindowSize(ImVec2((m_width*m_zoom)+padding_w, (m_height*m_zoom)+padding_h),
+							 m_bSizeWindow ? ImGuiCond_Always : ImGuiCond_FirstUseEver);
+	m_bSizeWindow = false;
 
 	ImGui::Begin(m_windowName.c_str(),&m_bOpen, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoScrollWithMouse);
 
@@ -403,7 +779,26 @@ void ImageDocument::Render()
 
 	ImGui::SameLine();
 
-	if (ImGui::Button("Quantize Image"))
+	// Short names, so the palette still starts at 320
+	ImGui::SetNextItemWidth(64);
+	ImGui::Combo("##DitherMethod", &m_iDitherMethod,
+				 "Diffuse\0" "Bayer2\0" "Bayer4\0" "Bayer8\0" "Clust4\0" "Clust8\0" "Blue\0"
+				 "Floyd\0" "Atkin\0" "Sierra\0" "JJN\0\0");
+
+	if (ImGui::IsItemHovered())
+	{
+		ImGui::BeginTooltip();
+		ImGui::Text("Dither Method");
+		ImGui::Text("Diffuse is libimagequant's error diffusion");
+		ImGui::Text("Bayer, Clustered Dot, and Blue Noise are ordered");
+		ImGui::Text("Floyd-Steinberg, Atkinson, Sierra Lite, and JJN");
+		ImGui::Text("are error diffusion, on every core");
+		ImGui::EndTooltip();
+	}
+
+	ImGui::SameLine();
+
+	if (ImGui::Button("Quantize"))
 	{
 		// Make it 16 colors
 		Quant();
@@ -513,6 +908,11 @@ void ImageDocument::Render()
 	}
 	//ImGui::NewLine();
 
+	// Third Line of Toolbar, for animations
+	//--------------------------------------------------------------------------
+	if (m_frames.size() > 1)
+		RenderFrameBar();
+
 	//--------------------------------------------------------------------------
 
 	// Width and Height here needs to be based on the parent Window
@@ -588,7 +988,29 @@ void ImageDocument::Render()
 			{
 				if (ImGui::MenuItem("Keep Image"))
 				{
-					SetDocumentSurface( SDL_SurfaceToRGBA(m_pTargetSurface) );
+					std::vector<SDL_Surface*> frames;
+
+					for (int idx = 0; idx < (int)m_targetFrames.size(); ++idx)
+					{
+						SDL_Surface* pFrame = SDL_SurfaceToRGBA(m_targetFrames[ idx ]);
+
+						if (pFrame)
+							frames.push_back(pFrame);
+					}
+
+					if (frames.size() == m_targetFrames.size())
+					{
+						SetDocumentFrames(frames);
+					}
+					else
+					{
+						LOG("%s\n", SDL_GetError());
+
+						for (int idx = 0; idx < (int)frames.size(); ++idx)
+						{
+							SDL_FreeSurface(frames[ idx ]);
+						}
+					}
 				}
 				if (ImGui::MenuItem("Save as $C1"))
 				{
@@ -604,10 +1026,7 @@ void ImageDocument::Render()
 															defaultFilename);
 
 				}
-				//if (ImGui::MenuItem("Save as (32Bpp)PNG+PAL"))
-				//{
-				//}
-				if (ImGui::MenuItem("Save as PNG"))
+				if (ImGui::MenuItem("Save as $C0/0001 (PackBytes)"))
 				{
 					std::string defaultFilename = m_filename;
 
@@ -616,15 +1035,62 @@ void ImageDocument::Render()
 						defaultFilename  = defaultFilename.substr(0, defaultFilename.size()-4);
 					}
 
-					ImGuiFileDialog::Instance()->OpenModal("SavePNGKey", "Save as PNG", ".png\0\0",
+					ImGuiFileDialog::Instance()->OpenModal("SavePNTKey", "Save as $C0/0001", "#C00001\0.pnt\0\0",
 														   ".",
 															defaultFilename);
 
 				}
-				ImGui::EndPopup();
-			}
-		}
-
+				if (ImGui::MenuItem("Save as APF"))
+				{
+					std::string defaultFilename = m_filename;
+
+					if (defaultFilename.size() > 4)
+					{
+						defaultFilename  = defaultFilename.substr(0, defaultFilename.size()-4);
+					}
+
+					ImGuiFileDialog::Instance()->OpenModal("SaveAPFKey", "Save as APF ($C0/0002)", "#C00002\0.apf\0\0",
+														   ".",
+															defaultFilename);
+
+				}
+				//if (ImGui::MenuItem("Save as (32Bpp)PNG+PAL"))
+				//{
+				//}
+				if (ImGui::MenuItem("Save as PNG"))
+				{
+					std::string defaultFilename = m_filename;
+
+					if (defaultFilename.size() > 4)
+					{
+						defaultFilename  = defaultFilename.substr(0, defaultFilename.size()-4);
+					}
+
+					ImGuiFileDialog::Instance()->OpenModal("SavePNGKey", "Save as PNG", ".png\0\0",
+														   ".",
+															defaultFilename,
+															RenderPNGOptions, 160, 1, this);
+
+				}
+				if ((m_targetFrames.size() > 1) && ImGui::MenuItem("Save Frames as PNG"))
+				{
+					std::string defaultFilename = m_filename;
+
+					if (defaultFilename.size() > 4)
+					{
+						defaultFilename  = defaultFilename.substr(0, defaultFilename.size()-4);
+					}
+
+					ImGuiFileDialog::Instance()->OpenModal("SaveFramesPNGKey", "Save Frames as PNG", ".png\0\0",
+														   ".",
+															defaultFilename,
+															RenderPNGOptions, 160, 1, this);
+
+				}
+				ImGui::EndPopup();
+			}
+		}
+
 
 		// Glue for the Toolbar button
 		if (ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows))
@@ -686,6 +1152,26 @@ void ImageDocument::Render()
 		ImGuiFileDialog::Instance()->CloseDialog("SaveC1Key");
 	}
 
+	if (ImGuiFileDialog::Instance()->FileDialog("SavePNTKey"))
+	{
+		if (ImGuiFileDialog::Instance()->IsOk == true)
+		{
+			SavePNT( ImGuiFileDialog::Instance()->GetFilepathName() );
+		}
+
+		ImGuiFileDialog::Instance()->CloseDialog("SavePNTKey");
+	}
+
+	if (ImGuiFileDialog::Instance()->FileDialog("SaveAPFKey"))
+	{
+		if (ImGuiFileDialog::Instance()->IsOk == true)
+		{
+			SaveAPF( ImGuiFileDialog::Instance()->GetFilepathName() );
+		}
+
+		ImGuiFileDialog::Instance()->CloseDialog("SaveAPFKey");
+	}
+
 	if (ImGuiFileDialog::Instance()->FileDialog("SavePNGKey"))
 	{
 		if (ImGuiFileDialog::Instance()->IsOk == true)
@@ -696,6 +1182,82 @@ void ImageDocument::Render()
 		ImGuiFileDialog::Instance()->CloseDialog("SavePNGKey");
 	}
 
+	if (ImGuiFileDialog::Instance()->FileDialog("SaveFramesPNGKey"))
+	{
+		if (ImGuiFileDialog::Instance()->IsOk == true)
+		{
+			SaveFramesPNG( ImGuiFileDialog::Instance()->GetFilepathName() );
+		}
+
+		ImGuiFileDialog::Instance()->CloseDialog("SaveFramesPNGKey");
+	}
+
+}
+
+//------------------------------------------------------------------------------
+// The frames are all the same size, so the textures only need new pixels
+
+void ImageDocument::SetFrame(int frame)
+{
+	if ((frame < 0) || (frame >= (int)m_frames.size()) || (frame == m_frame))
+		return;
+
+	m_frame = frame;
+	m_pSurface = m_frames[ m_frame ];
+
+	MarkDirty(0, 0, m_width, m_height);
+
+	if (m_frameColors[ m_frame ] < 0)
+		m_frameColors[ m_frame ] = CountUniqueColors(m_pSurface);
+
+	m_numSourceColors = m_frameColors[ m_frame ];
+
+	if (m_frame < (int)m_targetFrames.size())
+	{
+		m_pTargetSurface = m_targetFrames[ m_frame ];
+
+		SDL_Rect area = { 0, 0, m_width, m_height };
+		SDL_GL_UpdateTexture(m_targetImage, m_pTargetSurface, area, m_staging);
+	}
+}
+
+//------------------------------------------------------------------------------
+
+void ImageDocument::RenderFrameBar()
+{
+	int numFrames = (int)m_frames.size();
+
+	ImGui::Text("Frame:");
+	ImGui::SameLine();
+
+	if (ImGui::Button(m_bPlaying ? "Stop" : "Play"))
+	{
+		m_bPlaying = !m_bPlaying;
+		m_frameTicks = SDL_GetTicks();
+	}
+
+	ImGui::SameLine();
+
+	int frame = m_frame + 1;
+
+	ImGui::SetNextItemWidth(160);
+	if (ImGui::SliderInt("##Frame", &frame, 1, numFrames, "%d"))
+	{
+		m_bPlaying = false;
+		SetFrame(frame - 1);
+	}
+
+	if (ImGui::IsItemHovered())
+	{
+		ImGui::BeginTooltip();
+		ImGui::Text("Quantize uses one");
+		ImGui::Text("palette for every frame");
+		ImGui::EndTooltip();
+	}
+
+	ImGui::SameLine();
+	ImGui::TextColored(ImVec4(0.7f,0.7f,0.7f,1.0f),"of %d, %d ms", numFrames,
+					   FrameDelayMS(m_frameDelays, m_frame));
 }
 
 //------------------------------------------------------------------------------
@@ -878,199 +1440,339 @@ void ImageDocument::RenderPanAndZoom(int iButtonIndex)
 	}
 
 }
+//------------------------------------------------------------------------------
+// Shared by every document, results from the command line show up here too
+static ConversionCache* GetConversionCache()
+{
+	static ConversionCache* pCache = nullptr;
+	static bool bTried = false;
+
+	if (!bTried)
+	{
+		bTried = true;
+
+		std::string directory = ConversionCache::DefaultDirectory();
+
+		if (!directory.empty())
+			pCache = new ConversionCache(directory, ConversionCache::DEFAULT_MAX_BYTES);
+	}
+
+	return pCache;
+}
+
 //------------------------------------------------------------------------------
 
 void ImageDocument::Quant()
 {
-	// Do an actual color reduction on the source Image
-	// then generate an OGL Texture
+	// Do an actual color reduction on the source Image, on the job system,
+	// FinishQuantize generates an OGL Texture when it lands
 	LOG("Color Reduce - Go!\n");
 
-    unsigned int width=(unsigned int)m_width;
-	unsigned int height=(unsigned int)m_height;
-    unsigned char *raw_rgba_pixels = nullptr;
+	QuantizeSettings settings;
 
-	//-----------------------------------------------
+	settings.m_numColors  = 16;
+	settings.m_speed      = 1;   // 1-10  (1 best quality)
+	settings.m_iPosterize = m_iPosterize;
+	settings.m_iDither    = m_iDither;
+	settings.m_iDitherMethod = m_iDitherMethod;
 
-	SDL_Surface *pImage = SDL_SurfaceToRGBA(m_pSurface);
+	// Charge everything libimagequant allocates to this document
+	settings.m_pMalloc = ResourceTracker::LiqMalloc;
+	settings.m_pFree   = ResourceTracker::LiqFree;
 
-	if (nullptr == pImage)
+	// Add the fixed colors
+	for (int idx = 0; idx < m_bLocks.size(); ++idx)
 	{
-		return;
+		if (m_bLocks[idx])
+		{
+			settings.m_lockedColors.push_back(ImVec4ToRGBA(m_targetColors[idx]));
+		}
 	}
 
-    if( SDL_MUSTLOCK(pImage) )
-        SDL_LockSurface(pImage);
-
-	raw_rgba_pixels = (unsigned char*) pImage->pixels;
+	// Pressed again, before the last one landed, this one replaces it
+	DiscardQuantize();
 
-	//-----------------------------------------------
-	// Since I'm not supporting Alpha, now is the time
-	// to pre-multiply Alpha, and set the alpha to 1
+	// The job gets its own copy of the source, so the document can crop,
+	// scale, or close while it runs
+	std::vector<SDL_Surface*> sources;
 
+	for (int idx = 0; idx < (int)m_frames.size(); ++idx)
 	{
-		for (int y = 0; y < pImage->h; ++y)
+		SDL_Surface* pSource = SDL_DuplicateSurface(m_frames[ idx ]);
+
+		if (nullptr == pSource)
 		{
-			unsigned char *pPixel = raw_rgba_pixels + (y * pImage->pitch);
+			LOG("%s\n", SDL_GetError());
 
-			for (int x = 0; x < pImage->w; ++x)
+			for (int copy = 0; copy < (int)sources.size(); ++copy)
 			{
-				unsigned int a = pPixel[3];
+				SDL_FreeSurface(sources[ copy ]);
+			}
+			return;
+		}
+
+		sources.push_back(pSource);
+	}
 
-				if (a != 0xFF)
+	// Made here, the first time, not on a worker
+	ConversionCache* pCache = GetConversionCache();
+	std::string owner = m_windowName;
+	std::vector<int> bLocks = m_bLocks;
+
+	int progressId = JobsWindow::GetProgress().Add("Quantize " + m_filename);
+	m_quantProgressId = progressId;
+	m_bQuantizing = true;
+
+	// A batch job, like the loads, the UI thread helps with interactive jobs
+	// while it waits in a ParallelFor, and it mustn't pick up a whole quantize
+	m_quant = JobSystem::GetDefault().Async<QuantizedImage>(
+				[sources, settings, pCache, owner, progressId, bLocks]()
 				{
-					unsigned int r = pPixel[0];
-					unsigned int g = pPixel[1];
-					unsigned int b = pPixel[2];
+					QuantizedImage quantized = QuantizeSources(sources, settings, pCache, owner, progressId);
+					quantized.m_bLocks = bLocks;
 
-					r *= a; r>>=8;
-					g *= a; g>>=8;
-					b *= a; b>>=8;
+					for (int idx = 0; idx < (int)sources.size(); ++idx)
+					{
+						SDL_FreeSurface(sources[ idx ]);
+					}
+					return quantized;
+				},
+				eJobBatch);
+}
 
-					a = 255;
+//------------------------------------------------------------------------------
+// Runs on a worker, everything but the GL upload
 
-					pPixel[0] = (unsigned char)r;
-					pPixel[1] = (unsigned char)g;
-					pPixel[2] = (unsigned char)b;
-					pPixel[3] = (unsigned char)a;
-				}
+/*static*/ ImageDocument::QuantizedImage ImageDocument::QuantizeSources(const std::vector<SDL_Surface*>& sources,
+																		 const QuantizeSettings& settings,
+																		 ConversionCache* pCache,
+																		 const std::string& owner, int progressId)
+{
+	QuantizedImage quantized;
+	BatchProgress& progress = JobsWindow::GetProgress();
 
-				pPixel+=4;
-			}
-		}
+	if (!progress.Start(progressId))
+	{
+		quantized.m_error = "Canceled";
+		progress.Finish(progressId, false, 0, quantized.m_error);
+		return quantized;
 	}
 
-	//-----------------------------------------------
-
-    liq_attr *handle = liq_attr_create();
+	// libimagequant's allocations, on this thread, go to the document
+	ResourceScope scope(owner);
 
-	liq_set_max_colors(handle, 16);
-	liq_set_speed(handle, 1);   // 1-10  (1 best quality)
+	long long numPixels = 0;
 
-	int min_posterize = 4;
-	switch (m_iPosterize)
+	for (int idx = 0; idx < (int)sources.size(); ++idx)
 	{
-	case ePosterize444:
-		min_posterize = 4;
-		break;
-	case ePosterize555:
-		min_posterize = 3;
-		break;
-	case ePosterize888:
-		min_posterize = 0;
-		break;
+		numPixels += (long long)sources[ idx ]->w * sources[ idx ]->h;
 	}
 
-	liq_set_min_posterization(handle, min_posterize);
+	// Animations, every frame gets the same palette
+	if (sources.size() > 1)
+	{
+		std::vector<RGBAImage*> frames;
 
-	//$$JGA Fixed Colors can be added to the input_image
-	//$$JGA which is going to be sweet
-    liq_image *input_image = liq_image_create_rgba(handle, raw_rgba_pixels, width, height, 0);
+		for (int idx = 0; idx < (int)sources.size(); ++idx)
+		{
+			RGBAImage* pFrame = RGBAImage::FromSurface(sources[ idx ]);
 
-	// Add the fixed colors
-	for (int idx = 0; idx < m_bLocks.size(); ++idx)
+			if (pFrame)
+				frames.push_back(pFrame);
+		}
+
+		bool bQuantized = (frames.size() == sources.size()) &&
+						  QuantizeFrames(std::vector<const RGBAImage*>(frames.begin(), frames.end()),
+										 settings, quantized.m_results, &quantized.m_uniqueColors);
+
+		for (int idx = 0; idx < (int)frames.size(); ++idx)
+		{
+			delete frames[ idx ];
+		}
+
+		if (!bQuantized)
+			quantized.m_error = D16_GetError();
+	}
+	else
 	{
-		if (m_bLocks[idx])
+		IndexedImage* pResult = nullptr;
+
+		ConvertOptions options;
+		options.m_quantize = settings;
+
+		CacheKey key;
+
+		if (pCache)
+		{
+			key = MakeCacheKey(sources[0], options);
+			pResult = pCache->Load(key, &quantized.m_uniqueColors);
+			quantized.m_bFromCache = (nullptr != pResult);
+		}
+
+		if (nullptr == pResult)
 		{
-			liq_color color;
-			color.r = (unsigned char) (m_targetColors[idx].x * 255.0f);
-			color.g = (unsigned char) (m_targetColors[idx].y * 255.0f); 
-			color.b = (unsigned char) (m_targetColors[idx].z * 255.0f); 
-			color.a = (unsigned char) (m_targetColors[idx].w * 255.0f);
-			
-			// Add a Color
-			liq_image_add_fixed_color(input_image, color);
+			pResult = QuantizeImage(sources[0], settings, &quantized.m_uniqueColors);
+
+			if (nullptr == pResult)
+			{
+				quantized.m_error = D16_GetError();
+			}
+			else if (pCache && !pCache->Store(key, *pResult, quantized.m_uniqueColors))
+			{
+				// Not worth failing over, it just won't be quicker next time
+				quantized.m_error = D16_GetError();
+			}
 		}
+
+		if (pResult)
+			quantized.m_results.push_back(pResult);
 	}
 
-	// You could set more options here, like liq_set_quality
-    liq_result *quantization_result;
-    if (liq_image_quantize(input_image, handle, &quantization_result) != LIQ_OK) {
-        LOG("Quantization failed, memory leaked\n");
+	bool bQuantized = !quantized.m_results.empty();
+
+	progress.Finish(progressId, bQuantized, bQuantized ? numPixels : 0,
+					bQuantized ? "" : quantized.m_error);
+
+	return quantized;
+}
+
+//------------------------------------------------------------------------------
+// Closed, or quantized again, before the last one landed, nobody is going
+// to pick it up, so the results are freed whenever it's done
+
+void ImageDocument::DiscardQuantize()
+{
+	if (!m_bQuantizing)
 		return;
-    }
 
-    // Use libimagequant to make new image pixels from the palette
+	m_bQuantizing = false;
+
+	JobsWindow::GetProgress().Cancel(m_quantProgressId);
 
-    size_t pixels_size = width * height;
-    unsigned char *raw_8bit_pixels = (unsigned char*)malloc(pixels_size);
-	liq_set_dithering_level(quantization_result, m_iDither / 100.0f);  // 0.0->1.0
-//	liq_set_output_gamma(quantization_result, 1.0);
+	JobSystem::GetDefault().Then<QuantizedImage, int>(m_quant,
+		[](QuantizedImage& quantized)
+		{
+			for (int idx = 0; idx < (int)quantized.m_results.size(); ++idx)
+			{
+				delete quantized.m_results[ idx ];
+			}
+			return 0;
+		});
+
+	m_quant = JobFuture<QuantizedImage>();
+}
 
-    liq_write_remapped_image(quantization_result, input_image, raw_8bit_pixels, pixels_size);
-    const liq_palette *palette = liq_get_palette(quantization_result);
+//------------------------------------------------------------------------------
+// Main thread, once m_quant is done, the palette goes up in the tray, and
+// the results go on the GPU
 
-	// Convert Results into a Surface ------------------------------------------
+void ImageDocument::FinishQuantize()
+{
+	m_bQuantizing = false;
 
-	SDL_Surface *pTargetSurface = SDL_CreateRGBSurfaceWithFormatFrom(
-									raw_8bit_pixels, width, height,
-									8, width, SDL_PIXELFORMAT_INDEX8);
-	SDL_Palette *pPalette = SDL_AllocPalette( 16 );
+	QuantizedImage& quantized = m_quant.Get();
 
-	SDL_SetPaletteColors(pPalette, (const SDL_Color*)palette->entries, 0, 16);
+	std::vector<IndexedImage*> results;
+	results.swap(quantized.m_results);
 
-	SDL_SetSurfacePalette(pTargetSurface, pPalette);
+	if (!quantized.m_error.empty())
+		LOG("%s\n", quantized.m_error.c_str());
+
+	if (results.empty())
+		return;
+
+	if (quantized.m_bFromCache)
+		LOG("Found in the cache\n");
+
+	int uniqueColors = quantized.m_uniqueColors;
+
+	// The frame on screen, if the frames are still the ones that went in
+	IndexedImage* pResult = results[ (m_frame < (int)results.size()) ? m_frame : 0 ];
+
+	LOG("Ingest found %d unique colors\n", uniqueColors);
+
+	const Uint32* pPalette = pResult->GetPalette();
 
 	// Put the result colors back up in the tray, so we can see them
 	{
+		// The locks it was quantized with, they may have changed since
+		const std::vector<int>& bLocks = quantized.m_bLocks;
+
 		// take advantage, I know the locked colors all get grouped on the end of the result
 				// count the number of locked colors
 		int numLocked = 0;
-		for (int idx = 0; idx < m_bLocks.size(); ++idx)
+		for (int idx = 0; idx < bLocks.size(); ++idx)
 		{
-			if (m_bLocks[idx]) numLocked++;
+			if (bLocks[idx]) numLocked++;
 		}
 
 		// locked colors start at this index
-		int lockedBaseIndex = (int)m_bLocks.size() - numLocked;
+		int lockedBaseIndex = (int)bLocks.size() - numLocked;
 
 		int lockedIndex = 0;
 		int palIndex = 0;
 
 		for (int idx = 0; idx < m_targetColors.size(); ++idx)
 		{
-			liq_color color;
+			Uint32 color;
 
-			if (m_bLocks[idx])
+			if (bLocks[idx])
 			{
-				color = palette->entries[lockedBaseIndex + lockedIndex];
+				color = pPalette[lockedBaseIndex + lockedIndex];
 				lockedIndex++;
 			}
 			else
-				color = palette->entries[ palIndex++ ];
+				color = pPalette[ palIndex++ ];
 
-			m_targetColors[ idx ].x = color.r / 255.0f;
-			m_targetColors[ idx ].y = color.g / 255.0f;
-			m_targetColors[ idx ].z = color.b / 255.0f;
-			m_targetColors[ idx ].w = color.a / 255.0f;
+			m_targetColors[ idx ].x = ((color >>  0) & 0xFF) / 255.0f;
+			m_targetColors[ idx ].y = ((color >>  8) & 0xFF) / 255.0f;
+			m_targetColors[ idx ].z = ((color >> 16) & 0xFF) / 255.0f;
+			m_targetColors[ idx ].w = ((color >> 24) & 0xFF) / 255.0f;
 		}
 	}
 
-	GLfloat about_image_uv[4];
-	m_targetImage = SDL_GL_LoadTexture(pTargetSurface, about_image_uv);
+	// Convert Results into Surfaces ------------------------------------------
+
+	std::vector<SDL_Surface*> targetFrames;
+
+	for (int idx = 0; idx < (int)results.size(); ++idx)
+	{
+		SDL_Surface* pTargetSurface = results[ idx ]->CreateSurface();
 
-    m_pTargetSurface = pTargetSurface;
+		delete results[ idx ];
 
-	// Free up the memory used by libquant -------------------------------------
-    liq_result_destroy(quantization_result); // Must be freed only after you're done using the palette
-    liq_image_destroy(input_image);
-    liq_attr_destroy(handle);
+		if (pTargetSurface)
+			targetFrames.push_back(pTargetSurface);
+	}
+
+	if (targetFrames.size() != results.size())
+	{
+		LOG("%s\n", SDL_GetError());
 
-	// SDL_CreateRGBSurfaceWithFormatFrom, makes you manage the raw pixels buffer
-	// instead of make a copy of it, so I'm supposed to free it manually, after
-	// the surface is free!
-    //free(raw_8bit_pixels);  // The surface owns these now
+		for (int idx = 0; idx < (int)targetFrames.size(); ++idx)
+		{
+			SDL_FreeSurface(targetFrames[ idx ]);
+		}
+		return;
+	}
 
-	// Tell SDL to free it for me
-	//pTargetSurface->flags &= ~SDL_PREALLOC;
+	// Release the previous result, before we replace it
+	FreeTargetSurface();
 
-	//-----------------------------------------------
+	m_targetFrames = targetFrames;
 
-    if( SDL_MUSTLOCK(pImage) )
-        SDL_UnlockSurface(pImage);
+	for (int idx = 0; idx < (int)m_targetFrames.size(); ++idx)
+	{
+		ResourceTracker::AddSurface(m_windowName, m_targetFrames[ idx ]);
+	}
 
-    SDL_FreeSurface(pImage);     /* No longer needed */
+	m_pTargetSurface = m_targetFrames[ (m_frame < (int)m_targetFrames.size()) ? m_frame : 0 ];
 
+	GLfloat about_image_uv[4];
+	m_targetImage = SDL_GL_LoadTexture(m_pTargetSurface, about_image_uv);
+	ResourceTracker::AddTexture(m_windowName, m_targetImage,
+								SDL_GL_TextureSize(m_pTargetSurface->w),
+								SDL_GL_TextureSize(m_pTargetSurface->h));
 }
 
 //------------------------------------------------------------------------------
@@ -1236,21 +1938,7 @@ void ImageDocument::RenderResizeDialog()
 		{
 			// Scale
 			// Resize and Resample
-			switch (item_current)
-			{
-			case ePointSample:
-				PointSampleResize(iNewWidth,iNewHeight);
-				break;
-			case eBilinearSample:
-				LinearSampleResize(iNewWidth,iNewHeight);
-				break;
-			case eLanczos:
-				LanczosResize(iNewWidth, iNewHeight);
-				break;
-			case eAVIR:
-				AvirSampleResize(iNewWidth,iNewHeight,bDither);
-				break;
-			}
+			ScaleImage(iNewWidth, iNewHeight, item_current, bDither);
 		}
 
 		// Put some code here to dispatch the crop/resize
@@ -1275,304 +1963,108 @@ void ImageDocument::RenderResizeDialog()
 //
 void ImageDocument::CropImage(int iNewWidth, int iNewHeight, int iJustify)
 {
-    SDL_Surface *pImage = SDL_CreateRGBSurface(SDL_SWSURFACE, iNewWidth, iNewHeight,
-											   32,
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN     /* OpenGL RGBA masks */
-                                 0x000000FF,
-                                 0x0000FF00, 0x00FF0000, 0xFF000000
-#else
-                                 0xFF000000,
-                                 0x00FF0000, 0x0000FF00, 0x000000FF
-#endif
-											   );
-	if (nullptr == pImage)
-		return;
-
-	/* Save the alpha blending attributes */
-	SDL_Rect source_area;
-	SDL_Rect dest_area;
-	SDL_BlendMode saved_mode;
-	SDL_GetSurfaceBlendMode(m_pSurface, &saved_mode);
-	SDL_SetSurfaceBlendMode(m_pSurface, SDL_BLENDMODE_NONE);
-
-	/* Copy the surface into the GL texture image */
-	source_area.x = 0;
-	source_area.y = 0;
-	source_area.w = m_pSurface->w;
-	source_area.h = m_pSurface->h;
-	dest_area.w = iNewWidth;
-	dest_area.h = iNewHeight;
-
-	// Left Right Position
-
-	switch (iJustify)
-	{
-	case eUpperLeft:
-	case eCenterLeft:
-	case eLowerLeft:
-			dest_area.x = 0;
-			break;
-	case eUpperCenter:
-	case eCenterCenter:
-	case eLowerCenter:
-			dest_area.x = (iNewWidth - m_width)/2;
-			break;
-	case eUpperRight:
-	case eCenterRight:
-	case eLowerRight:
-			dest_area.x = iNewWidth - m_width;
-			break;	
-	}
+	// Every frame, so they stay the same size
+	std::vector<SDL_Surface*> frames;
 
-	// Vertical Position
-	switch (iJustify)
+	for (int idx = 0; idx < (int)m_frames.size(); ++idx)
 	{
-	case eUpperLeft:
-	case eUpperCenter:
-	case eUpperRight:
-			dest_area.y = 0;
-			break;
-	case eCenterLeft:
-	case eCenterCenter:
-	case eCenterRight:
-			dest_area.y = (iNewHeight - m_height)/2;
-			break;
-	case eLowerLeft:
-	case eLowerCenter:
-	case eLowerRight:
-			dest_area.y = iNewHeight - m_height;
-			break;	
-	}
+		RGBAImage* pSource = RGBAImage::FromSurface(m_frames[ idx ]);
+		SDL_Surface* pFrame = nullptr;
 
-	SDL_BlitSurface(m_pSurface, &source_area,
-					pImage, &dest_area);
-
-	/* Restore the alpha blending attributes */
-	SDL_SetSurfaceBlendMode(m_pSurface, saved_mode);
+		if (pSource)
+		{
+			pFrame = ImageToSurface(::CropImage(*pSource, iNewWidth, iNewHeight, iJustify));
 
+			delete pSource;
+		}
+		else
+		{
+			LOG("%s\n", D16_GetError());
+		}
 
-	// Free up the source image, and opengl texture
-	SetDocumentSurface( pImage );
-}
+		if (nullptr == pFrame)
+			break;
 
-//------------------------------------------------------------------------------
+		frames.push_back(pFrame);
+	}
 
-//------------------------------------------------------------------------------
-void ImageDocument::PointSampleResize(int iNewWidth, int iNewHeight)
-{
-    SDL_Surface *pImage = SDL_CreateRGBSurface(SDL_SWSURFACE, iNewWidth, iNewHeight,
-											   32,
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN     /* OpenGL RGBA masks */
-                                 0x000000FF,
-                                 0x0000FF00, 0x00FF0000, 0xFF000000
-#else
-                                 0xFF000000,
-                                 0x00FF0000, 0x0000FF00, 0x000000FF
-#endif
-											   );
-	if (nullptr == pImage)
+	if (frames.size() == m_frames.size())
+	{
+		SetDocumentFrames(frames);
 		return;
+	}
 
-	/* Save the alpha blending attributes */
-	SDL_Rect source_area;
-	SDL_Rect dest_area;
-	SDL_BlendMode saved_mode;
-	SDL_GetSurfaceBlendMode(m_pSurface, &saved_mode);
-	SDL_SetSurfaceBlendMode(m_pSurface, SDL_BLENDMODE_NONE);
-
-	/* Copy the surface into the GL texture image */
-	source_area.x = 0;
-	source_area.y = 0;
-	source_area.w = m_pSurface->w;
-	source_area.h = m_pSurface->h;
-	dest_area.x = 0;
-	dest_area.y = 0;
-	dest_area.w = iNewWidth;
-	dest_area.h = iNewHeight;
-
-	SDL_Surface *pSource = SDL_SurfaceToRGBA(m_pSurface);
-
-	SDL_BlitScaled(pSource, &source_area,
-					pImage, &dest_area);
-
-	/* Restore the alpha blending attributes */
-	SDL_SetSurfaceBlendMode(m_pSurface, saved_mode);
-
-	// Free up the source image, and opengl texture
-
-	if (pSource)
+	for (int idx = 0; idx < (int)frames.size(); ++idx)
 	{
-		SDL_FreeSurface(pSource);
+		SDL_FreeSurface(frames[ idx ]);
 	}
-
-	//--------------------------
-	SetDocumentSurface( pImage );
 }
+
 //------------------------------------------------------------------------------
-void ImageDocument::LinearSampleResize(int iNewWidth, int iNewHeight)
+//  iFilter is a ScaleFilter
+//
+void ImageDocument::ScaleImage(int iNewWidth, int iNewHeight, int iFilter, bool bDither)
 {
-	SDL_Surface *pSource = SDL_SurfaceToRGBA(m_pSurface);
+	// Every frame, so they stay the same size
+	std::vector<SDL_Surface*> frames;
 
-	if (pSource)
+	for (int idx = 0; idx < (int)m_frames.size(); ++idx)
 	{
-		if( SDL_MUSTLOCK(pSource) )
-			SDL_LockSurface(pSource);
-
-		Uint32* pPixels = (Uint32*) malloc(pSource->w * pSource->h * sizeof(Uint32));
+		RGBAImage* pSource = RGBAImage::FromSurface(m_frames[ idx ]);
+		SDL_Surface* pFrame = nullptr;
 
-		// So do some work here
-		for (int y = 0; y < pSource->h; ++y)
+		if (pSource)
 		{
-			for (int x = 0; x < pSource->w; ++x)
-			{
-				Uint8 * pixel = (Uint8*)pSource->pixels;
-				pixel += (y * pSource->pitch) + (x * sizeof(Uint32));
-
-				Uint32 color = *((Uint32*)pixel);
+			pFrame = ImageToSurface(::ResizeImage(*pSource, iNewWidth, iNewHeight, iFilter, bDither));
 
-				// Dump the Colors out into an array
-				pPixels[ (y * pSource->w) + x ] = color;
-			}
+			delete pSource;
 		}
-
-		if( SDL_MUSTLOCK(pSource) )
-			SDL_UnlockSurface(pSource);
-
-		// Shuttle us over to the linear image class
-		LinearImage sourceImage(pPixels, pSource->w, pSource->h);
-
-		LinearImage* pDestImage = sourceImage.Scale( iNewWidth, iNewHeight );
-
-		SDL_FreeSurface(pSource);
-		free(pPixels);
-//------------------------------------------
-		SDL_Surface *pImage = SDL_CreateRGBSurface(SDL_SWSURFACE, iNewWidth, iNewHeight,
-												   32,
-	#if SDL_BYTEORDER == SDL_LIL_ENDIAN     /* OpenGL RGBA masks */
-									 0x000000FF,
-									 0x0000FF00, 0x00FF0000, 0xFF000000
-	#else
-									 0xFF000000,
-									 0x00FF0000, 0x0000FF00, 0x000000FF
-	#endif
-												   );
-
-		if (nullptr == pImage)
-			return;
-
-		if( SDL_MUSTLOCK(pImage) )
-			SDL_LockSurface(pImage);
-
-
-		for (int y = 0; y < iNewHeight; ++y)
+		else
 		{
-			for (int x = 0; x < iNewWidth; ++x)
-			{
-				FloatPixel p = pDestImage->GetPixel(x, y);
-
-				Uint32 pixel = ((Uint32)p.a)&0xFF;
-				pixel<<=8;
-				pixel |= ((Uint32)p.b)&0xFF;
-				pixel<<=8;
-				pixel |= ((Uint32)p.g)&0xFF;
-				pixel<<=8;
-				pixel |= ((Uint32)p.r)&0xFF;
-
-				Uint8* pPixel = (Uint8*)pImage->pixels;
-				pPixel += (y*pImage->pitch) + (x * sizeof(Uint32));
-
-				*((Uint32*)pPixel) = pixel;
-			}
+			LOG("%s\n", D16_GetError());
 		}
 
-		if( SDL_MUSTLOCK(pImage) )
-			SDL_UnlockSurface(pImage);
-
-		delete pDestImage;
-		pDestImage = nullptr;
-//------------------------------------------
-
-		SetDocumentSurface( pImage );
+		if (nullptr == pFrame)
+			break;
 
+		frames.push_back(pFrame);
 	}
-}
-//------------------------------------------------------------------------------
-void ImageDocument::LanczosResize(int iNewWidth, int iNewHeight)
-{
-	Uint32* pPixels = SDL_SurfaceToUint32Array(m_pSurface);
 
-	if (pPixels)
+	if (frames.size() == m_frames.size())
 	{
-		avir::CLancIR LanczosResizer;
-
-		Uint32* pNewPixels = new Uint32[ iNewWidth * iNewHeight ];
-
-		LanczosResizer.resizeImage<unsigned char>((unsigned char*)pPixels,
-										   m_width, m_height,
-										   sizeof(Uint32)*m_width,  		// $$JGA Since this takes a stride, we might be able to pass SDL Surface directly in
-											(unsigned char*)pNewPixels,
-												  iNewWidth, iNewHeight,
-												  sizeof(Uint32));  //RGBA 8888
-
-
-		SDL_Surface* pSurface = SDL_SurfaceFromRawRGBA(pNewPixels, iNewWidth, iNewHeight);
-
-		delete[] pNewPixels;
-		delete[] pPixels;
+		SetDocumentFrames(frames);
+		return;
+	}
 
-		if (pSurface)
-		{
-			SetDocumentSurface( pSurface );
-		}
+	for (int idx = 0; idx < (int)frames.size(); ++idx)
+	{
+		SDL_FreeSurface(frames[ idx ]);
 	}
 }
 
 //------------------------------------------------------------------------------
-void ImageDocument::AvirSampleResize(int iNewWidth, int iNewHeight, bool bDither)
+//  Takes ownership of pImage, nullptr (and logs why) if there's no surface
+//
+/*static*/ SDL_Surface* ImageDocument::ImageToSurface(RGBAImage* pImage)
 {
-	Uint32* pPixels = SDL_SurfaceToUint32Array(m_pSurface);
-
-	if (pPixels)
+	if (nullptr == pImage)
 	{
-		Uint32* pNewPixels = new Uint32[ iNewWidth * iNewHeight ];
-
-		if (bDither)
-		{
-			typedef avir::fpclass_def< float, float,
-				avir::CImageResizerDithererErrdINL< float > > fpclass_dith;
-
-			avir::CImageResizer< fpclass_dith > DitherResizer( 8 );
-
-			DitherResizer.resizeImage<Uint8,Uint8>((Uint8*)pPixels, m_width, m_height,
-												 m_width*sizeof(Uint32),
-												 (Uint8*)pNewPixels,
-												 iNewWidth, iNewHeight,
-												 sizeof(Uint32),  // RGBA 8888
-												 0);
-		}
-		else
-		{
-			avir::CImageResizer<> AvirResizer(8);
-
-			AvirResizer.resizeImage<Uint8,Uint8>((Uint8*)pPixels, m_width, m_height,
-												 m_width*sizeof(Uint32),
-												 (Uint8*)pNewPixels,
-												 iNewWidth, iNewHeight,
-												 sizeof(Uint32),  // RGBA 8888
-												 0);
-		}
+		LOG("%s\n", D16_GetError());
+		return nullptr;
+	}
 
-		SDL_Surface* pSurface = SDL_SurfaceFromRawRGBA(pNewPixels, iNewWidth, iNewHeight);
+	SDL_Surface* pSurface = pImage->CreateSurface();
 
-		delete[] pNewPixels;
-		delete[] pPixels;
+	delete pImage;
 
-		if (pSurface)
-		{
-			SetDocumentSurface( pSurface );
-		}
+	if (nullptr == pSurface)
+	{
+		LOG("%s\n", SDL_GetError());
 	}
+
+	return pSurface;
 }
+
 //------------------------------------------------------------------------------
 SDL_Surface* ImageDocument::SDL_SurfaceToRGBA(SDL_Surface* pSurface)
 {
@@ -1610,137 +2102,162 @@ SDL_Surface* ImageDocument::SDL_SurfaceToRGBA(SDL_Surface* pSurface)
 	return pImage;
 }
 //------------------------------------------------------------------------------
-
-Uint32* ImageDocument::SDL_SurfaceToUint32Array(SDL_Surface* pSurface)
+//  Takes ownership of the frames, which are all the same size
+//
+void ImageDocument::SetDocumentFrames(const std::vector<SDL_Surface*>& frames)
 {
-	Uint32* pPixels = nullptr;
-
-	SDL_Surface *pSource = SDL_SurfaceToRGBA(pSurface);
+	// Free up the target, because it won't work right after a resize
+		for (int idx = 0; idx < (int)m_targetFrames.size(); ++idx)
+		{
+			if (frames.end() != std::find(frames.begin(), frames.end(), m_targetFrames[ idx ]))
+			{
+				// I want to accept the target here, so don't free it
+				ResourceTracker::RemoveSurface(m_targetFrames[ idx ]);
+				m_targetFrames[ idx ] = nullptr;
+			}
+		}
 
-	if (pSource)
-	{
-		if( SDL_MUSTLOCK(pSource) )
-			SDL_LockSurface(pSource);
+		FreeTargetSurface();
 
-		pPixels = new Uint32[ pSource->w * pSource->h ];
+	// Free up the source frames
 
-		// So do some work here
-		for (int y = 0; y < pSource->h; ++y)
+		// unregister / free the m_frames, m_pSurface is one of them
+		for (int idx = 0; idx < (int)m_frames.size(); ++idx)
 		{
-			for (int x = 0; x < pSource->w; ++x)
-			{
-				Uint8 * pixel = (Uint8*)pSource->pixels;
-				pixel += (y * pSource->pitch) + (x * sizeof(Uint32));
+			ResourceTracker::RemoveSurface(m_frames[ idx ]);
+			SDL_FreeSurface(m_frames[ idx ]);
+		}
 
-				Uint32 color = *((Uint32*)pixel);
+		// Set, and Register the new frames
+		m_frames = frames;
+		m_frameColors.assign(m_frames.size(), -1);
 
-				// Dump the Colors out into an array
-				pPixels[ (y * pSource->w) + x ] = color;
-			}
+		for (int idx = 0; idx < (int)m_frames.size(); ++idx)
+		{
+			ResourceTracker::AddSurface(m_windowName, m_frames[ idx ]);
 		}
 
-		if( SDL_MUSTLOCK(pSource) )
-			SDL_UnlockSurface(pSource);
+		if (m_frame >= (int)m_frames.size())
+			m_frame = 0;
+
+		m_pSurface = m_frames[ m_frame ];
+
+		m_width  = m_pSurface->w;
+		m_height = m_pSurface->h;
 
-		SDL_FreeSurface(pSource);
+		m_dirtyRects.Clear();
 
+		if (m_image &&
+			(SDL_GL_TextureSize(m_width)  == m_textureWidth) &&
+			(SDL_GL_TextureSize(m_height) == m_textureHeight))
+		{
+			// The texture we have is big enough, so just stage the new
+			// pixels into it, instead of allocating a new one
+			m_image_uv[2] = (GLfloat) m_width / m_textureWidth;
+			m_image_uv[3] = (GLfloat) m_height / m_textureHeight;
+
+			MarkDirty(0, 0, m_width, m_height);
+		}
+		else
+		{
+			// Full re-upload
+			LoadSourceTexture();
+		}
+
+		// Update colors
+		m_numSourceColors = CountUniqueColors(m_pSurface);
+		m_frameColors[ m_frame ] = m_numSourceColors;
+}
+//------------------------------------------------------------------------------
+
+void ImageDocument::LoadSourceTexture()
+{
+	// unregister / free the m_image
+	if (m_image)
+	{
+		ResourceTracker::RemoveTexture(m_image);
+		glDeleteTextures(1, &m_image);
+		m_image = 0;
 	}
 
-	return pPixels;
+	m_image = SDL_GL_LoadTexture(m_pSurface, m_image_uv);
+
+	m_textureWidth  = SDL_GL_TextureSize(m_pSurface->w);
+	m_textureHeight = SDL_GL_TextureSize(m_pSurface->h);
+
+	ResourceTracker::AddTexture(m_windowName, m_image, m_textureWidth, m_textureHeight);
+
+	// Everything just went up
+	m_dirtyRects.Clear();
 }
 
 //------------------------------------------------------------------------------
 
-SDL_Surface* ImageDocument::SDL_SurfaceFromRawRGBA(Uint32* pPixels, int iWidth, int iHeight)
+void ImageDocument::MarkDirty(int x, int y, int w, int h)
 {
-	SDL_Surface *pImage = SDL_CreateRGBSurface(SDL_SWSURFACE, iWidth, iHeight,
-											   32,
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN     /* OpenGL RGBA masks */
-								 0x000000FF,
-								 0x0000FF00, 0x00FF0000, 0xFF000000
-#else
-								 0xFF000000,
-								 0x00FF0000, 0x0000FF00, 0x000000FF
-#endif
-								 );
+	SDL_Rect area = { x, y, w, h };
+	SDL_Rect bounds = { 0, 0, m_width, m_height };
+	SDL_Rect clipped;
 
-	if (nullptr == pImage)
-		return nullptr;
+	if (SDL_IntersectRect(&area, &bounds, &clipped))
+	{
+		m_dirtyRects.Add(clipped);
+	}
+}
 
-	if( SDL_MUSTLOCK(pImage) )
-		SDL_LockSurface(pImage);
+//------------------------------------------------------------------------------
+//
+// Cost of this is O(changed pixels), unless we don't have a texture yet
+//
+void ImageDocument::UpdateTextures()
+{
+	if (m_dirtyRects.IsEmpty())
+		return;
 
+	if (!m_image)
+	{
+		LoadSourceTexture();
+		return;
+	}
 
-	Uint32 *pRGBA = pPixels;  // Start with the first pixel
+	const std::vector<SDL_Rect>& rects = m_dirtyRects.GetRects();
 
-	for (int y = 0; y < iHeight; ++y)
+	for (int idx = 0; idx < (int)rects.size(); ++idx)
 	{
-		for (int x = 0; x < iWidth; ++x)
-		{
-			Uint8* pPixel = (Uint8*)pImage->pixels;
-			pPixel += (y*pImage->pitch) + (x * sizeof(Uint32));
-
-			*((Uint32*)pPixel) = *pRGBA++;
-		}
+		SDL_GL_UpdateTexture(m_image, m_pSurface, rects[ idx ], m_staging);
 	}
 
-	if( SDL_MUSTLOCK(pImage) )
-		SDL_UnlockSurface(pImage);
+	m_dirtyRects.Clear();
 
-	return pImage;
+	ResourceTracker::Add(m_windowName, eResPixelBuffer, (uintptr_t)&m_staging,
+						 m_staging.capacity() * sizeof(Uint32));
 }
 
 //------------------------------------------------------------------------------
 
-void ImageDocument::SetDocumentSurface(SDL_Surface* pSurface)
+void ImageDocument::FreeTargetSurface()
 {
-	// Free up the target, because it won't work right after a resize
-		if (m_targetImage)
-		{
-			glDeleteTextures(1, &m_targetImage);
-			m_targetImage = 0;
-		}
-
-		if (m_pTargetSurface)
-		{
-			// I want to accept the target here
-			if (pSurface != m_pTargetSurface)
-			{
-				// Free the pixels, because I allocated them?
-				if (pSurface->flags & SDL_PREALLOC)
-					free(pSurface->pixels);
-
-				SDL_FreeSurface(m_pTargetSurface);
-			}
-
-			m_pTargetSurface = nullptr;
-		}
-
-	// Free up the source image, and opengl texture
+	if (m_targetImage)
+	{
+		ResourceTracker::RemoveTexture(m_targetImage);
+		glDeleteTextures(1, &m_targetImage);
+		m_targetImage = 0;
+	}
 
-		// unregister / free the m_image
-		if (m_image)
-		{
-			glDeleteTextures(1, &m_image);
-			m_image = 0;
-		}
-		// unregister / free the m_pSurface
-		if (m_pSurface)
+	// m_pTargetSurface is one of the frames
+	for (int idx = 0; idx < (int)m_targetFrames.size(); ++idx)
+	{
+		if (m_targetFrames[ idx ])
 		{
-			SDL_FreeSurface(m_pSurface);
-			m_pSurface = nullptr;
+			ResourceTracker::RemoveSurface(m_targetFrames[ idx ]);
+			SDL_FreeSurface(m_targetFrames[ idx ]);
 		}
+	}
 
-		// Set, and Register the new image
-		m_pSurface = pSurface;
-		m_image = SDL_GL_LoadTexture(pSurface, m_image_uv);
-
-		m_width  = pSurface->w;
-		m_height = pSurface->h;
-
-		// Update colors
-		m_numSourceColors = CountUniqueColors();
+	m_targetFrames.clear();
+	m_pTargetSurface = nullptr;
 }
+
 //------------------------------------------------------------------------------
 
 Uint32 ImageDocument::SDL_GetPixel(SDL_Surface* pSurface, int x, int y)
@@ -1755,10 +2272,9 @@ Uint32 ImageDocument::SDL_GetPixel(SDL_Surface* pSurface, int x, int y)
 		if (y < 0) y = 0;
 		if (y >= pSurface->h) y = pSurface->h-1;
 
-		if (pSurface->flags & SDL_PREALLOC)
+		if (1 == pSurface->format->BytesPerPixel)
 		{
-			// This is only true if I allocated the pixels
-			// which means this has to be 8 bit indexed
+			// Only the quantize results are 8 bit indexed
 			Uint8* pPixel = (Uint8*)pSurface->pixels;
 			pPixel += (y * pSurface->pitch) + x;
 
@@ -1788,132 +2304,194 @@ Uint32 ImageDocument::SDL_GetPixel(SDL_Surface* pSurface, int x, int y)
 }
 
 //------------------------------------------------------------------------------
-// Just return the index, that has the closest match to the passed in color
-static Uint32 ClosestIndex(Uint32* pClut, Uint32 uColor)
+
+Uint32 ImageDocument::ImVec4ToRGBA(const ImVec4& floatColor)
 {
-	int closestIndex = 0;
-	long closestDistance;
-	Uint32 color = pClut[0];
-	int red,green,blue;
-	int targetRed, targetGreen, targetBlue;
-	int deltaRed, deltaGreen, deltaBlue;
+	float red   = floatColor.x * 255.0f;
+	float green = floatColor.y * 255.0f;
+	float blue  = floatColor.z * 255.0f;
+	float alpha = floatColor.w * 255.0f;
 
-	targetRed   = (uColor >> 0) & 0xFF;
-	targetGreen = (uColor >> 8) & 0xFF;
-	targetBlue  = (uColor >>16) & 0xFF;
+	Uint32 color = (((Uint32)alpha)&0xFF) << 24;
+	color       |= (((Uint32)blue)&0xFF)  << 16;
+	color       |= (((Uint32)green)&0xFF) << 8;
+	color       |= (((Uint32)red)&0xFF)   << 0;
 
-	red   = (color >> 0) & 0xFF;
-	green = (color >> 8) & 0xFF;
-	blue  = (color >>16) & 0xFF;
+	return color;
+}
 
-	deltaRed   = red - targetRed;
-	deltaGreen = green - targetGreen;
-	deltaBlue  = blue - targetBlue;
+//------------------------------------------------------------------------------
 
-	closestDistance = (deltaRed * deltaRed) + (deltaGreen * deltaGreen) + (deltaBlue * deltaBlue);
+// The target, as 16 color indexes, for the IIgs formats, caller owns it
+IndexedImage* ImageDocument::CreateTargetIndexed(int frame)
+{
+// Get a copy of the clut
+	Uint32 pClut[ 16 ];
 
-	for (int idx = 1; idx < 16; ++idx)
+	for (int idx = 0; idx < m_targetColors.size(); ++idx)
 	{
-		color = pClut[ idx ];
+		pClut[idx] = ImVec4ToRGBA(m_targetColors[ idx ]) | 0xFF000000;  // A = 1.0
+	}
 
-		red   = (color >> 0) & 0xFF;
-		green = (color >> 8) & 0xFF;
-		blue  = (color >>16) & 0xFF;
+// Choose a surface to save
+	if ((frame < 0) || (frame >= (int)m_frames.size()))
+		frame = m_frame;
 
-		deltaRed   = red - targetRed;
-		deltaGreen = green - targetGreen;
-		deltaBlue  = blue - targetBlue;
+	SDL_Surface* pImage = m_pTargetSurface ? m_targetFrames[ frame ] : m_frames[ frame ];
 
-		long distance = (deltaRed * deltaRed) + (deltaGreen * deltaGreen) + (deltaBlue * deltaBlue);
+	RGBAImage* pSource = RGBAImage::FromSurface(pImage);
+	IndexedImage* pIndexed = pSource ? RemapToPalette(*pSource, pClut, 16) : nullptr;
 
-		if (distance < closestDistance)
-		{
-			closestDistance = distance;
-			closestIndex = idx;
-		}
-	}
+	delete pSource;
 
-	return closestIndex;
+	return pIndexed;
 }
 
+//------------------------------------------------------------------------------
+
 void ImageDocument::SaveC1(std::string filenamepath)
 {
-// Copy of the C1 memory
-	unsigned char c1data[ 0x8000 ];
-	memset(c1data, 0, 0x8000 );
+	IndexedImage* pIndexed = CreateTargetIndexed();
 
-// Get a copy of the clut
-	Uint32 pClut[ 16 ];
+	if (!pIndexed || !::SaveC1(*pIndexed, filenamepath))
+	{
+		LOG("%s\n", D16_GetError());
+	}
 
-	for (int idx = 0; idx < m_targetColors.size(); ++idx)
+	delete pIndexed;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageDocument::SavePNT(std::string filenamepath)
+{
+	IndexedImage* pIndexed = CreateTargetIndexed();
+
+	if (!pIndexed || !::SavePNT(*pIndexed, filenamepath))
 	{
-		const ImVec4& floatColor = m_targetColors[ idx ];
+		LOG("%s\n", D16_GetError());
+	}
+
+	delete pIndexed;
+}
+
+//------------------------------------------------------------------------------
+// Any size, unlike $C1, which gets clamped to 320x200
 
-		float red   = floatColor.x * 255.0f;
-		float green = floatColor.y * 255.0f;
-		float blue  = floatColor.z * 255.0f;
+void ImageDocument::SaveAPF(std::string filenamepath)
+{
+	IndexedImage* pIndexed = CreateTargetIndexed();
 
-		Uint32 color = 0xFF000000;   					// A = 1.0
-		color       |= (((Uint32)blue)&0xFF)  << 16;
-		color       |= (((Uint32)green)&0xFF) << 8;
-		color       |= (((Uint32)red)&0xFF)   << 0;
-		
-		pClut[idx] = color;
+	if (!pIndexed || !::SaveAPF(*pIndexed, filenamepath))
+	{
+		LOG("%s\n", D16_GetError());
 	}
 
-// Choose a surface to save
-	SDL_Surface* pImage = m_pTargetSurface ? m_pTargetSurface : m_pSurface;
+	delete pIndexed;
+}
+//------------------------------------------------------------------------------
+
+// The target is 16 colors, so it goes out as a 4 bit indexed PNG, which
+// for a big atlas can take a while to compress, so that happens on the
+// pool, and shows up in the Jobs window
 
-	// Nibblized pixel data
-	for (int y = 0; y < 200; ++y)
+void ImageDocument::SavePNG(std::string filenamepath)
+{
+	if (nullptr == m_pTargetSurface)
 	{
-		for (int x = 0; x < 320; x+=2)
+		// Nothing converted yet, the source as it is, using what SDL gave me
+		if (IMG_SavePNG(m_pSurface, filenamepath.c_str()) < 0)
 		{
-			Uint32 pixel0 = SDL_GetPixel(pImage, x, y);
-			Uint32 index0 = ClosestIndex(pClut, pixel0);
-			Uint32 pixel1 = SDL_GetPixel(pImage, x+1, y);
-			Uint32 index1 = ClosestIndex(pClut, pixel1);
-
-			c1data[ (y * 160) + (x>>1) ] = (unsigned char) (index1 | (index0<<4));
+			LOG("ERR IMG_SavePNG: %s\n", IMG_GetError());
 		}
+		return;
 	}
 
-	// Color Data, just doing a floor conversion
+	IndexedImage* pIndexed = CreateTargetIndexed();
 
-	Uint16* pPal = (Uint16*)(&c1data[ 0x7E00 ]);
-	for (int idx = 0; idx < 16; ++idx)
+	if (nullptr == pIndexed)
 	{
-		Uint32 sourceColor = pClut[ idx ];
-		Uint16 targetColor = (Uint16)(((sourceColor>>4) & 0xF) << 8); // Red
+		LOG("%s\n", D16_GetError());
+		return;
+	}
 
-		targetColor |= (Uint16) (((sourceColor>>12) & 0xF) << 4); // Green
-		targetColor |= (Uint16) (((sourceColor>>20) & 0xF) << 0); // Blue
+	SubmitSavePNG(pIndexed, filenamepath, m_pngLevel);
+}
 
-		pPal[ idx ] = targetColor;
-	}
+//------------------------------------------------------------------------------
+// "name.png" -> "name_0001.png", "name_0002.png", ... one job each
 
+void ImageDocument::SaveFramesPNG(std::string filenamepath)
+{
+	std::string base = RemoveExtension(filenamepath);
 
-	// Serialize to disk
+	for (int idx = 0; idx < (int)m_targetFrames.size(); ++idx)
 	{
-		FILE* file = fopen(filenamepath.c_str(), "wb");
+		IndexedImage* pIndexed = CreateTargetIndexed(idx);
+
+		if (nullptr == pIndexed)
+		{
+			LOG("%s\n", D16_GetError());
+			return;
+		}
 
-		fwrite(c1data, 1, 0x8000, file);
+		char suffix[ 32 ];
+		snprintf(suffix, sizeof(suffix), "_%04d.png", idx + 1);
 
-		fclose(file);
+		SubmitSavePNG(pIndexed, base + suffix, m_pngLevel);
 	}
-
 }
+
 //------------------------------------------------------------------------------
+// Takes ownership of pIndexed
 
-// For now, I'm just making this easy
-// and using what SDL gave me
+/*static*/ void ImageDocument::SubmitSavePNG(IndexedImage* pIndexed, const std::string& filenamepath, int level)
+{
+	int progressId = JobsWindow::GetProgress().Add("Save " + filenamepath);
 
-void ImageDocument::SavePNG(std::string filenamepath)
+	JobSystem::GetDefault().Submit([pIndexed, filenamepath, level, progressId]()
+	{
+		BatchProgress& progress = JobsWindow::GetProgress();
+
+		if (progress.Start(progressId))
+		{
+			long long numPixels = (long long)pIndexed->GetWidth() * pIndexed->GetHeight();
+
+			bool bSaved = ::SavePNG(*pIndexed, filenamepath, level);
+
+			progress.Finish(progressId, bSaved, numPixels, bSaved ? "" : D16_GetError());
+		}
+		else
+		{
+			progress.Finish(progressId, false, 0, "Canceled");
+		}
+
+		delete pIndexed;
+
+	}, eJobBatch);
+}
+
+//------------------------------------------------------------------------------
+// The options pane in the Save as PNG dialogs, pUserDatas is the document
+
+/*static*/ void ImageDocument::RenderPNGOptions(std::string filter, void* pUserDatas, bool* pbCanContinue)
 {
-// Choose a surface to save
-	SDL_Surface* pImage = m_pTargetSurface ? m_pTargetSurface : m_pSurface;
+	ImageDocument* pDoc = (ImageDocument*)pUserDatas;
 
-	IMG_SavePNG(pImage, filenamepath.c_str());
+	(void)filter;
+	(void)pbCanContinue;
+
+	ImGui::Text("Compression");
+	ImGui::SetNextItemWidth(-1);
+	ImGui::SliderInt("##PNGLevel", &pDoc->m_pngLevel, eDeflateStore, eDeflateSmallest);
+
+	if (ImGui::IsItemHovered())
+	{
+		ImGui::BeginTooltip();
+		ImGui::Text("0 stores, 9 is smallest, and slowest");
+		ImGui::Text("Below 3 the rows aren't filtered");
+		ImGui::EndTooltip();
+	}
 }
 
 //------------------------------------------------------------------------------
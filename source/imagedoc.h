@@ -7,82 +7,112 @@
 
 #include "imgui.h"
 #include "SDL_Surface.h"
-
-#ifndef GLuint
-typedef unsigned int	GLuint;		/* 4-byte unsigned */
-typedef float		GLfloat;	/* single precision float */
-#endif
-
-enum PosterizeTargets
-{
-	ePosterize444,
-	ePosterize555,
-	ePosterize888
-};
-
-//-------------------------------
-//  0 1 2
-//  3 4 5
-//  6 7 8
-//-------------------------------
-enum Justify
-{
-	eUpperLeft,
-	eUpperCenter,
-	eUpperRight,
-
-	eCenterLeft,
-	eCenterCenter,
-	eCenterRight,
-
-	eLowerLeft,
-	eLowerCenter,
-	eLowerRight
-};
-//-------------------------------
-enum ScaleFilter
-{
-	ePointSample,
-	eBilinearSample,
-	eLanczos,
-	eAVIR
-};
-//-------------------------------
+#include "texture.h"
+#include "pipeline.h"
+#include "jobs.h"
 
 class ImageDocument
 {
 public:
 	ImageDocument(std::string filename, std::string pathname, SDL_Surface* pImage);
+
+	// Decodes pathname on the job system, the window shows a spinner until
+	// the pixels land.  Animated GIFs come in with all their frames, and
+	// bSequence brings in the rest of a numbered sequence, as frames
+	ImageDocument(std::string filename, std::string pathname, bool bSequence = false);
 	~ImageDocument();
 
 	bool IsClosed() { return !m_bOpen; }
 
 	void Render();
 
+	// Let the document know some source pixels changed, only these areas
+	// get sent to the GPU on the next Render
+	void MarkDirty(int x, int y, int w, int h);
+
 private:
 
-	int CountUniqueColors();
+	// What a load job hands back, decoded, and counted, off the main thread
+	struct LoadedImage
+	{
+		LoadedImage()
+			: m_numColors(0)
+			, m_bLockPalette(false)
+		{
+		}
+
+		std::vector<SDL_Surface*> m_frames;  // 32bpp, just one for a still image
+		std::vector<int> m_delays;           // GIFs, 1/100ths of a second
+		int m_numColors;                     // in the first frame
+		std::string m_error;
+
+		// Super Hi-Res files, that use one palette, bring it along, for
+		// the target colors, ILBMs bring their CMAP, and lock it
+		std::vector<Uint32> m_palette;
+		bool m_bLockPalette;
+	};
+
+	// What a quantize job hands back, swapped in on the main thread
+	struct QuantizedImage
+	{
+		QuantizedImage()
+			: m_uniqueColors(0)
+			, m_bFromCache(false)
+		{
+		}
+
+		std::vector<IndexedImage*> m_results;  // a frame each, one palette
+		std::vector<int> m_bLocks;             // as they were, when it went in
+		int m_uniqueColors;
+		bool m_bFromCache;
+		std::string m_error;
+	};
+
+	// progressId is its item in the Jobs window
+	static LoadedImage DecodeImageFile(const std::string& pathname, int progressId, bool bSequence);
+	static int CountUniqueColors(SDL_Surface* pSurface);
+
+	void InitDocument();
+	void SetLoadedFrames(const std::vector<SDL_Surface*>& frames);
+	bool FinishLoading();
+	void RenderLoading();
+
 	void CropImage(int iNewWidth, int iNewHeight, int iJustify);
 	void Quant();
+	static QuantizedImage QuantizeSources(const std::vector<SDL_Surface*>& sources,
+										  const QuantizeSettings& settings, ConversionCache* pCache,
+										  const std::string& owner, int progressId);
+	void FinishQuantize();
+	void DiscardQuantize();
 
-	void PointSampleResize(int iNewWidth, int iNewHeight);
-	void LinearSampleResize(int iNewWidth, int iNewHeight);
-	void LanczosResize(int iNewWidth, int iNewHeight);
-	void AvirSampleResize(int iNewWidth, int iNewHeight, bool bDither);
+	void ScaleImage(int iNewWidth, int iNewHeight, int iFilter, bool bDither);
 
 	void RenderEyeDropper();
 	void RenderPanAndZoom(int iButtonIndex=0);
 	void RenderResizeDialog();
 
+	// frame -1, is the one on screen
+	IndexedImage* CreateTargetIndexed(int frame = -1);
 	void SaveC1(std::string filenamepath);
+	void SavePNT(std::string filenamepath);
+	void SaveAPF(std::string filenamepath);
 	void SavePNG(std::string filenamepath);
+	void SaveFramesPNG(std::string filenamepath);
+	static void SubmitSavePNG(IndexedImage* pIndexed, const std::string& filenamepath, int level);
+	static void RenderPNGOptions(std::string filter, void* pUserDatas, bool* pbCanContinue);
+
+	void SetFrame(int frame);
+	void RenderFrameBar();
 
-	void SetDocumentSurface(SDL_Surface* pSurface);
+	void SetDocumentFrames(const std::vector<SDL_Surface*>& frames);
+	static SDL_Surface* ImageToSurface(RGBAImage* pImage);
+	void LoadSourceTexture();
+	void UpdateTextures();
+	void FreeTargetSurface();
 
-	SDL_Surface* SDL_SurfaceToRGBA(SDL_Surface* pSurface);
-	SDL_Surface* SDL_SurfaceFromRawRGBA(Uint32* pPixels, int iWidth, int iHeight);
-	Uint32* SDL_SurfaceToUint32Array(SDL_Surface* pSurface);
+	static SDL_Surface* SDL_SurfaceToRGBA(SDL_Surface* pSurface);
 	Uint32 SDL_GetPixel(SDL_Surface* pSurface, int x, int y);
+	static Uint32 ImVec4ToRGBA(const ImVec4& color);
 
 	std::string m_windowName;
 	std::string m_filename;
@@ -93,6 +123,20 @@ private:
 	GLfloat m_image_uv[4];    // uv coordinates
 	SDL_Surface* m_pSurface;
 
+	// Every frame, m_pSurface is m_frames[ m_frame ], a still image is a
+	// single frame
+	std::vector<SDL_Surface*> m_frames;
+	std::vector<int> m_frameDelays;   // 1/100ths of a second, empty if unknown
+	std::vector<int> m_frameColors;   // unique colors, counted when first shown
+	int m_frame;
+	bool m_bPlaying;
+	Uint32 m_frameTicks;              // when m_frame went up
+
+	int m_textureWidth;       // power of 2 size of m_image
+	int m_textureHeight;
+	DirtyRects m_dirtyRects;  // source pixels that need to go to m_image
+	std::vector<Uint32> m_staging;
+
 	int m_numSourceColors;
 
 	int m_width;
@@ -102,14 +146,28 @@ private:
 	// Destination Image Things
 	GLuint m_targetImage; // GL Image Number
 	SDL_Surface* m_pTargetSurface;
+	std::vector<SDL_Surface*> m_targetFrames;  // m_pTargetSurface is m_targetFrames[ m_frame ]
 	int m_numTargetColors;
 
 	int m_iDither;
+	int m_iDitherMethod;
 	int m_iPosterize;
+	int m_pngLevel;       // deflate level, 0-9, for Save as PNG
 
 	std::vector<int>   m_bLocks;
 	std::vector<ImVec4> m_targetColors;
 
+	// Loading
+	JobFuture<LoadedImage> m_load;
+	int m_loadProgressId;
+	bool m_bLoading;
+	bool m_bSizeWindow;   // the image landed after the window was made, fit it
+
+	// Quantizing
+	JobFuture<QuantizedImage> m_quant;
+	int m_quantProgressId;
+	bool m_bQuantizing;
+
 //-- UI State
 	bool m_bOpen;
 	bool m_bPanActive;
@@ -117,6 +175,8 @@ private:
 	bool m_bEyeDropDrag;
 
 static int s_uniqueId;
+static int s_uploadFrame;  // so only a few loads finish per frame
+static int s_numUploads;
 
 };
 
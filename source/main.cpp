@@ -13,8 +13,17 @@
 #include "ImGuiFileDialog.h"
 #include "imagedoc.h"
 #include "paldoc.h"
-#include "dirent.h"
 #include "toolbar.h"
+#include "texture.h"
+#include "resources.h"
+#include "jobswindow.h"
+#include "cli.h"
+#include "palettes.h"
+#include "jobs.h"
+#include "assets.h"
+#include "fontcache.h"
+#include "thumbnailpane.h"
+#include "files.h"
 
 #include "d16.h"
 
@@ -39,94 +48,111 @@ void ToolBarUI();
 void MainMenuBarUI();
 
 //------------------------------------------------------------------------------
-/* Quick utility function for texture creation */
-static int
-power_of_two(int input)
+std::vector<ImageDocument*>   imageDocuments;
+
+Toolbar* pToolbar = nullptr; // need to create after stuff intialize
+
+bool bAppDone = false; // Set true to quit App
+
+	bool show_log_window = true;
+	bool show_palette_window = true;
+	bool show_resources_window = false;
+	bool show_jobs_window = false;
+
+//------------------------------------------------------------------------------
+// The preset palettes, read on a worker, while the first frame draws, they
+// go in the Palettes window back on the UI thread, once it's done
+
+struct PresetPalettes
 {
-    int value = 1;
+	PresetPalettes()
+		: m_bOpened(false)
+		, m_numParsed(0)
+		, m_milliseconds(0.0)
+	{
+	}
 
-    while (value < input) {
-        value <<= 1;
-    }
-    return value;
-}
+	bool m_bOpened;
+	std::string m_error;
+
+	std::vector<std::string> m_names;
+	std::vector<std::string> m_paths;
+	std::vector<std::vector<unsigned int>> m_colors;
+	std::vector<std::string> m_errors;
 
-GLuint
-SDL_GL_LoadTexture(SDL_Surface * surface, GLfloat * texcoord)
+	int m_numParsed;
+	double m_milliseconds;
+};
+
+static PresetPalettes LoadPresetPalettes(const std::string& directory)
 {
-    GLuint texture;
-    int w, h;
-    SDL_Surface *image;
-    SDL_Rect area;
-    SDL_BlendMode saved_mode;
-
-    /* Use the surface width and height expanded to powers of 2 */
-    w = power_of_two(surface->w);
-    h = power_of_two(surface->h);
-    texcoord[0] = 0.0f;         /* Min X */
-    texcoord[1] = 0.0f;         /* Min Y */
-    texcoord[2] = (GLfloat) surface->w / w;     /* Max X */
-    texcoord[3] = (GLfloat) surface->h / h;     /* Max Y */
-
-    image = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32,
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN     /* OpenGL RGBA masks */
-                                 0x000000FF,
-                                 0x0000FF00, 0x00FF0000, 0xFF000000
-#else
-                                 0xFF000000,
-                                 0x00FF0000, 0x0000FF00, 0x000000FF
-#endif
-        );
-    if (image == NULL) {
-        return 0;
-    }
+	PresetPalettes presets;
+
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	PaletteLibrary library;
+
+	presets.m_bOpened = library.Open(directory, PaletteLibrary::DefaultIndexPath(directory));
+
+	if (!presets.m_bOpened)
+	{
+		presets.m_error = D16_GetError();
+		return presets;
+	}
+
+	for (int idx = 0; idx < library.GetNumPalettes(); ++idx)
+	{
+		const Uint32* pColors = library.GetColors(idx);
+
+		presets.m_names.push_back(library.GetName(idx));
+		presets.m_paths.push_back(library.GetPath(idx));
+		presets.m_colors.push_back(std::vector<unsigned int>(pColors, pColors + library.GetNumColors(idx)));
+	}
+
+	presets.m_errors = library.GetErrors();
+	presets.m_numParsed = library.GetNumParsed();
+	presets.m_milliseconds = (double)(SDL_GetPerformanceCounter() - startTime) * 1000.0 /
+							 (double)SDL_GetPerformanceFrequency();
 
-    /* Save the alpha blending attributes */
-    SDL_GetSurfaceBlendMode(surface, &saved_mode);
-    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
-
-    /* Copy the surface into the GL texture image */
-    area.x = 0;
-    area.y = 0;
-    area.w = surface->w;
-    area.h = surface->h;
-    SDL_BlitSurface(surface, &area, image, &area);
-
-    /* Restore the alpha blending attributes */
-    SDL_SetSurfaceBlendMode(surface, saved_mode);
-
-    /* Create an OpenGL texture for the image */
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexImage2D(GL_TEXTURE_2D,
-                 0,
-                 GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, image->pixels);
-    SDL_FreeSurface(image);     /* No longer needed */
-
-    return texture;
+	return presets;
 }
-//------------------------------------------------------------------------------
-static int alphaSort(const struct dirent **a, const struct dirent **b)
+
+static void AddPresetPalettes(const PresetPalettes& presets)
 {
-	return strcoll((*a)->d_name, (*b)->d_name);
-}
-//------------------------------------------------------------------------------
-std::vector<ImageDocument*>   imageDocuments;
+	if (!presets.m_bOpened)
+	{
+		LOG("%s\n", presets.m_error.c_str());
+		return;
+	}
 
-Toolbar* pToolbar = nullptr; // need to create after stuff intialize
+	for (size_t idx = 0; idx < presets.m_names.size(); ++idx)
+	{
+		PaletteDocument::GAddPreset(presets.m_names[ idx ], presets.m_colors[ idx ], presets.m_paths[ idx ]);
+	}
 
-bool bAppDone = false; // Set true to quit App
+	for (size_t idx = 0; idx < presets.m_errors.size(); ++idx)
+	{
+		LOG("%s\n", presets.m_errors[ idx ].c_str());
+	}
 
-	bool show_log_window = true;
-	bool show_palette_window = true;
+	LOG("%d palettes, %d parsed, %.1f ms\n", (int)presets.m_names.size(),
+		presets.m_numParsed, presets.m_milliseconds);
+}
 
 //------------------------------------------------------------------------------
 
 // Main code
-int main(int, char**)
+int main(int argc, char* argv[])
 {
+	// Command line tools, don't want a window
+	if ((argc > 1) && CLI_IsCommand(argv[1]))
+	{
+		return CLI_Main(argc, argv);
+	}
+
+	// Time to first frame, logged once it's up
+	Uint64 startupTime = SDL_GetPerformanceCounter();
+
     // Setup SDL
     // (Some versions of SDL before <2.0.10 appears to have performance/stalling issues on a minority of Windows systems,
     // depending on whether SDL_INIT_GAMECONTROLLER is enabled or disabled.. updating to latest version of SDL is recommended!)
@@ -136,16 +162,6 @@ int main(int, char**)
         return -1;
     }
 
-	// load support for the JPG and PNG image formats
-	int flags=IMG_INIT_JPG|IMG_INIT_PNG|IMG_INIT_TIF|IMG_INIT_WEBP;
-	int initted=IMG_Init(flags);
-	if((initted&flags) != flags)
-	{
-		SYSERROR("IMG_Init: Failed to init required jpg and png support!\n"
-		         "IMG_Init: %s\n", IMG_GetError());
-		// handle error
-	}
-
     // Decide GL+GLSL versions
 #if __APPLE__
     // GL 3.2 Core + GLSL 150
@@ -220,7 +236,19 @@ int main(int, char**)
     //io.Fonts->AddFontDefault();
 
 	//io.Fonts->AddFontFromFileTTF("./data/Inconsolata.otf", 15.0f);
-	io.Fonts->AddFontFromFileTTF("./data/ShastonHi640.ttf", 16.0f);
+
+	// Embedded, and the built atlas is cached, so no stb_truetype on
+	// most starts
+	bool bFontFromCache = false;
+	{
+		const Asset* pFont = FindAsset("ShastonHi640.ttf");
+
+		if (pFont)
+		{
+			AddCachedFont(io.Fonts, pFont->m_pData, pFont->m_size, 16.0f,
+						  pFont->m_pName, &bFontFromCache);
+		}
+	}
 
 	//io.Fonts->AddFontFromFileTTF("../../misc/fonts/Roboto-Medium.ttf", 16.0f);
     //io.Fonts->AddFontFromFileTTF("../../misc/fonts/Cousine-Regular.ttf", 15.0f);
@@ -255,6 +283,8 @@ int main(int, char**)
 	ImGuiFileDialog::Instance()->SetFilterColor(".bmp", ImVec4(0,1,0,1));
 	ImGuiFileDialog::Instance()->SetFilterColor(".webp", ImVec4(0,1,0,1));
 	ImGuiFileDialog::Instance()->SetFilterColor(".pal", ImVec4(0,1,0,1));
+	ImGuiFileDialog::Instance()->SetFilterColor(".gpl", ImVec4(0,1,0,1));
+	ImGuiFileDialog::Instance()->SetFilterColor(".act", ImVec4(0,1,0,1));
 	// keep the uppercase around, until we aren't using a stupid file dialog 
 	ImGuiFileDialog::Instance()->SetFilterColor(".PNG", ImVec4(0,1,0,1));
 	ImGuiFileDialog::Instance()->SetFilterColor(".TIF", ImVec4(0,1,0,1));
@@ -267,47 +297,17 @@ int main(int, char**)
 	ImGuiFileDialog::Instance()->SetFilterColor(".WEBP", ImVec4(0,1,0,1));
 	ImGuiFileDialog::Instance()->SetFilterColor(".PAL", ImVec4(0,1,0,1));
 
-	{
-		// Scan preset palette directory
-		LOG("Load Preset Palettes\n");
-
-		std::string vPath = ".\\data\\palettes";
-		struct dirent **files = nullptr;
-		int fileCount = scandir(vPath.c_str(), &files, nullptr, alphaSort);
+	// Preset palettes, parsed once, then out of the library's index, on a
+	// worker, so the first frame doesn't wait on the directory
+	LOG("Load Preset Palettes\n");
 
-		for (int idx = 0; idx < fileCount; ++idx)
-		{
-			struct dirent *ent = files[idx];
+	JobFuture<PresetPalettes> presetPalettes = JobSystem::GetDefault().Async<PresetPalettes>([]()
+	{
+		return LoadPresetPalettes(".\\data\\palettes");
+	});
 
-			if (DT_REG == ent->d_type)
-			{
-				std::string filename = ent->d_name;
-
-				int len = (int)filename.size();
-
-				if (len > 4)
-				{
-					int extensionOffset = len - 4;
-
-					if ('.' == filename[extensionOffset++])
-					{
-						if ('p' == tolower(filename[extensionOffset++]))
-						{
-							if ('a' == tolower(filename[extensionOffset++]))
-							{
-								if ('l' == tolower(filename[extensionOffset++]))
-								{
-									LOG("%s\n", filename.c_str());
-
-									PaletteDocument::GDocuments.push_back(new PaletteDocument(filename, vPath+"\\"+filename ));
-								}
-							}
-						}
-					}
-				}
-			}
-		}
-	}
+	bool bPresetsAdded = false;
+	bool bFirstFrame = true;
 
 	// Get that toolbar created
 
@@ -317,6 +317,12 @@ int main(int, char**)
     bAppDone = false;
     while (!bAppDone)
     {
+		if (!bPresetsAdded && presetPalettes.IsDone())
+		{
+			AddPresetPalettes(presetPalettes.Get());
+			bPresetsAdded = true;
+		}
+
         // Poll and handle events (inputs, window resize, etc.)
         // You can read the io.WantCaptureMouse, io.WantCaptureKeyboard flags to tell if dear imgui wants to use your inputs.
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
@@ -373,6 +379,16 @@ int main(int, char**)
 			ShowLog();
 		}
 
+		if (show_resources_window)
+		{
+			ResourceTracker::Draw("Resources", &show_resources_window);
+		}
+
+		if (show_jobs_window)
+		{
+			JobsWindow::Draw("Jobs", &show_jobs_window);
+		}
+
 #ifdef _DEBUG
         // 1. Show the big demo window (Most of the sample code is in ImGui::ShowDemoWindow()! You can browse its code to learn more about Dear ImGui!).
         if (show_demo_window)
@@ -432,8 +448,33 @@ int main(int, char**)
         }
 
         SDL_GL_SwapWindow(window);
+
+		if (bFirstFrame)
+		{
+			bFirstFrame = false;
+
+			double milliseconds = (double)(SDL_GetPerformanceCounter() - startupTime) * 1000.0 /
+								  (double)SDL_GetPerformanceFrequency();
+
+			LOG("First frame %.1f ms, font atlas %s\n", milliseconds,
+				bFontFromCache ? "from the cache" : "rasterized");
+
+			// SDL_image loads its codecs as they're needed anyway, this is
+			// just to find out early if one is missing
+			int flags=IMG_INIT_JPG|IMG_INIT_PNG|IMG_INIT_TIF|IMG_INIT_WEBP;
+			int initted=IMG_Init(flags);
+			if((initted&flags) != flags)
+			{
+				SYSERROR("IMG_Init: Failed to init required jpg and png support!\n"
+				         "IMG_Init: %s\n", IMG_GetError());
+				// handle error
+			}
+		}
     }
 
+	// Don't leave the worker writing into a future nobody's holding
+	presetPalettes.Get();
+
     // Cleanup
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplSDL2_Shutdown();
@@ -539,7 +580,15 @@ void MainMenuBarUI()
 			if (ImGui::MenuItem("Open Image"))
 			{
 				// Open File
-				ImGuiFileDialog::Instance()->OpenDialog("OpenImageDlgKey", "Open Image", "\0", ".", "", 0);
+				ImGuiFileDialog::Instance()->OpenDialog("OpenImageDlgKey", "Open Image", "\0", ".", "",
+														ThumbnailPane::Draw,
+														(size_t)ThumbnailPane::GetWidth(), 0);
+			}
+
+			if (ImGui::MenuItem("Open Sequence"))
+			{
+				// Any frame, the rest are found by the number in the name
+				ImGuiFileDialog::Instance()->OpenDialog("OpenSequenceDlgKey", "Open Sequence", "\0", ".", "", 1);
 			}
 
 			if (ImGui::MenuItem("Open Palette"))
@@ -589,6 +638,16 @@ void MainMenuBarUI()
 				show_log_window = !show_log_window;
 			}
 
+			if (ImGui::MenuItem("Resources", nullptr, show_resources_window))
+			{
+				show_resources_window = !show_resources_window;
+			}
+
+			if (ImGui::MenuItem("Jobs", nullptr, show_jobs_window))
+			{
+				show_jobs_window = !show_jobs_window;
+			}
+
 			ImGui::EndMenu();
 		}
 
@@ -615,27 +674,52 @@ void MainMenuBarUI()
 		  {
 			  //LOG("%s - %s\n", it->first.c_str(), it->second.c_str());
 
-			  SDL_Surface *image;
-			  image=IMG_Load(it->second.c_str());
+			  // Decoded on the job system, the window fills in when it lands
+			  LOG("Loading %s\n", it->second.c_str());
 
-			  if (image)
-			  {
-				  LOG("Loaded %s\n", it->second.c_str());
-
-				  imageDocuments.push_back(new ImageDocument(it->first, it->second, image));
-			  }
-			  else
-			  {
-				  LOG("Failed %s\n", it->second.c_str());
-			  }
+			  imageDocuments.push_back(new ImageDocument(it->first, it->second));
 
 		  }
 	  }
 	  // close
 	  ImGuiFileDialog::Instance()->CloseDialog("OpenImageDlgKey");
+	  ThumbnailPane::Release();
+	}
+
+	// Double clicked a thumbnail, that's the same as picking it, and OK
+	{
+		std::string picked = ThumbnailPane::TakePicked();
+
+		if (!picked.empty())
+		{
+			LOG("Loading %s\n", picked.c_str());
+
+			imageDocuments.push_back(new ImageDocument(GetFileName(picked), picked));
+
+			ImGuiFileDialog::Instance()->CloseDialog("OpenImageDlgKey");
+			ThumbnailPane::Release();
+		}
 	}
 
 
+	// One frame of a numbered sequence, opens them all, as an animation
+	if (ImGuiFileDialog::Instance()->FileDialog("OpenSequenceDlgKey"))
+	{
+		if (ImGuiFileDialog::Instance()->IsOk == true)
+		{
+			std::map<std::string, std::string> selection = ImGuiFileDialog::Instance()->GetSelection();
+
+			for (std::map<std::string, std::string>::iterator it = selection.begin(); it != selection.end(); it++)
+			{
+				LOG("Loading sequence %s\n", it->second.c_str());
+
+				imageDocuments.push_back(new ImageDocument(it->first, it->second, true));
+			}
+		}
+
+		ImGuiFileDialog::Instance()->CloseDialog("OpenSequenceDlgKey");
+	}
+
 	// display open file dialog
 	if (ImGuiFileDialog::Instance()->FileDialog("OpenPaletteDlgKey")) 
 	{
@@ -655,32 +739,20 @@ void MainMenuBarUI()
 			  LOG("Open PAL: %s, %s\n", it->first.c_str(), it->second.c_str());
 
 			  // Eventually, support opening any type of image, and extracting
-			  // the palette, for now, lets just open the file, if it has a
-			  // .pal extension
+			  // the palette, for now, anything the palette library can read
 			  std::string filename = it->first;
 			  std::string& fullpath = it->second;
 
-			  std::string extension = ".pal";
+			  std::vector<Uint32> colors;
 
-			  if (fullpath.length() > extension.length())
+			  if (LoadPaletteFile(fullpath, colors, 16))
 			  {
-				  size_t fullpath_offset = fullpath.length() - extension.length();
-
-				  for (int idx = 0; idx < extension.length(); ++idx)
-				  {
-					  if (tolower(fullpath[ fullpath_offset + idx ]) != extension[ idx])
-					  {
-						  LOG("FAILED %s\n", filename.c_str());
-					  }
-				  }
-
-				  PaletteDocument::GDocuments.push_back(new PaletteDocument(filename, fullpath));
+				  PaletteDocument::GDocuments.push_back(new PaletteDocument(filename, colors, fullpath));
 			  }
 			  else
 			  {
-				  LOG("FAILED %s\n", filename.c_str());
+				  LOG("FAILED %s\n", D16_GetError());
 			  }
-
 		  }
 	  }
 	  // close
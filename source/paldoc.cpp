@@ -10,6 +10,8 @@
 #include <SDL_image.h>
 #include "log.h"
 #include "libimagequant.h"
+#include "palettes.h"
+#include "pixels.h"
 
 #include <map>
 
@@ -30,34 +32,58 @@
 //------------------------------------------------------------------------------
 // Statics
 std::vector<PaletteDocument*> PaletteDocument::GDocuments;
+std::vector<PaletteDocument::Preset> PaletteDocument::GPresets;
 // Private Statics
 PaletteDocument* PaletteDocument::g_pDoc;  // Document to do a command upon
 int PaletteDocument::g_iCommand;		     // enum, which command
+
+// Every palette is a child window this tall, so the presets can be clipped
+static const float PALETTE_HEIGHT = 56.0f;
 //------------------------------------------------------------------------------
 
 PaletteDocument::PaletteDocument(std::string filename, std::string pathname)
 	: m_filename(filename)
 	, m_pathname(pathname)
 {
-	FILE* pFile = fopen(pathname.c_str(), "rb");
+	std::vector<Uint32> colors;
+
+	if (!LoadPaletteFile(pathname, colors, 16))
+	{
+		LOG("%s\n", D16_GetError());
+	}
 
-	unsigned int colors[16] = {0};
+	unsigned int padded[16] = {0};
 
-	for (int idx = 0; idx < 16; ++idx)
+	for (int idx = 0; idx < (int)colors.size(); ++idx)
 	{
-		fread(&colors[idx], 3, 1, pFile);
+		padded[ idx ] = colors[ idx ];
 	}
 
-	//size_t numread = fread(colors, sizeof(unsigned int), 16, pFile);
-	size_t numread = 16;
+	SetColors(padded, 16);
+}
 
-	fclose(pFile);
+PaletteDocument::PaletteDocument(std::string filename, const std::vector<unsigned int>& colors,
+								 std::string pathname)
+	: m_filename(filename)
+	, m_pathname(pathname)
+{
+	unsigned int padded[16] = {0};
 
-	//LOG("Read in %d Colors\n", (int)numread);
+	for (int idx = 0; (idx < 16) && (idx < (int)colors.size()); ++idx)
+	{
+		padded[ idx ] = colors[ idx ];
+	}
 
-	for (int idx = 0; idx < numread; ++idx)
+	SetColors(padded, 16);
+}
+
+//------------------------------------------------------------------------------
+
+void PaletteDocument::SetColors(const unsigned int* pColors, int numColors)
+{
+	for (int idx = 0; idx < numColors; ++idx)
 	{
-		m_colors.push_back( colors[ idx ] | 0xFF000000 );
+		m_colors.push_back( pColors[ idx ] | 0xFF000000 );
 
 		unsigned int icolor = m_colors[idx];
 		ImVec4 temp_color;
@@ -78,7 +104,7 @@ PaletteDocument::~PaletteDocument()
 
 void PaletteDocument::Render()
 {
-	ImGui::BeginChild(m_filename.c_str(), ImVec2(340, 56), true, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoSavedSettings);
+	ImGui::BeginChild(m_filename.c_str(), ImVec2(340, PALETTE_HEIGHT), true, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoSavedSettings);
 
 
 		if (ImGui::BeginPopupContextWindow(nullptr))
@@ -222,6 +248,28 @@ void PaletteDocument::Render()
 	for (int idx = 0; idx < PaletteDocument::GDocuments.size(); ++idx)
 		GDocuments[ idx ]->Render();
 
+	// A library can have thousands, only the ones on screen are drawn
+	if (!GPresets.empty())
+	{
+		ImGuiListClipper clipper((int)GPresets.size(), PALETTE_HEIGHT + ImGui::GetStyle().ItemSpacing.y);
+
+		while (clipper.Step())
+		{
+			for (int idx = clipper.DisplayStart; idx < clipper.DisplayEnd; ++idx)
+			{
+				Preset& preset = GPresets[ idx ];
+
+				if (nullptr == preset.m_pDoc)
+				{
+					preset.m_pDoc = new PaletteDocument(preset.m_name, preset.m_colors, preset.m_pathname);
+					std::vector<unsigned int>().swap(preset.m_colors);
+				}
+
+				preset.m_pDoc->Render();
+			}
+		}
+	}
+
 	// Support for the Context menu commands
 	if (g_pDoc)
 	{
@@ -230,6 +278,21 @@ void PaletteDocument::Render()
 
 		int docIndex = IndexOf( pDoc );
 
+		// Presets stay in library order, they can only be closed
+		if ((docIndex < 0) && (CMD_CLOSE == g_iCommand))
+		{
+			for (int idx = 0; idx < (int)GPresets.size(); ++idx)
+			{
+				if (GPresets[ idx ].m_pDoc == pDoc)
+				{
+					GPresets.erase(GPresets.begin() + idx);
+					delete pDoc;
+					pDoc = nullptr;
+					break;
+				}
+			}
+		}
+
 		// Basically, do we have a valid document
 		if (docIndex >= 0)
 		{
@@ -290,6 +353,20 @@ void PaletteDocument::Render()
 
 //------------------------------------------------------------------------------
 
+/*static*/ void PaletteDocument::GAddPreset(const std::string& name, const std::vector<unsigned int>& colors,
+											const std::string& pathname)
+{
+	Preset preset;
+	preset.m_name = name;
+	preset.m_pathname = pathname;
+	preset.m_colors = colors;
+	preset.m_pDoc = nullptr;
+
+	GPresets.push_back(preset);
+}
+
+//------------------------------------------------------------------------------
+
 /*static*/ int PaletteDocument::IndexOf(PaletteDocument* pDoc)
 {
 	for (int idx = 0; idx < GDocuments.size(); ++idx)
@@ -12,15 +12,37 @@ class PaletteDocument
 {
 public:
 	PaletteDocument(std::string filename, std::string pathname);
+
+	// From colors that came with something else (an image's CMAP), or out
+	// of the palette library, RGBA, up to 16, the rest are black
+	PaletteDocument(std::string filename, const std::vector<unsigned int>& colors,
+					std::string pathname = "");
 	~PaletteDocument();
 
 static void GRender();  // Render the Palette Documents windows
 
+// A palette out of the library, they're listed after the documents, only
+// the ones on screen are drawn, and each gets its PaletteDocument the first
+// time it's shown
+static void GAddPreset(const std::string& name, const std::vector<unsigned int>& colors,
+					   const std::string& pathname);
+
 static std::vector<PaletteDocument*> GDocuments;
 
 private:
 
+	struct Preset
+	{
+		std::string m_name;
+		std::string m_pathname;
+		std::vector<unsigned int> m_colors;  // until m_pDoc is made
+		PaletteDocument* m_pDoc;
+	};
+
+static std::vector<Preset> GPresets;
+
 	void Render();
+	void SetColors(const unsigned int* pColors, int numColors);
 
 	std::string m_filename;
 	std::string m_pathname;
@@ -10,6 +10,9 @@
 #include <SDL.h>
 #include <SDL_image.h>
 #include "log.h"
+#include "texture.h"
+#include "resources.h"
+#include "assets.h"
 
 
 // This bit here is also dumb
@@ -27,10 +30,6 @@
 #include IMGUI_IMPL_OPENGL_LOADER_CUSTOM
 #endif
 
-// Again, this should be in some sort of helper, or util header
-extern GLuint
-SDL_GL_LoadTexture(SDL_Surface * surface, GLfloat * texcoord);
-
 //------------------------------------------------------------------------------
 Toolbar* Toolbar::GToolbar = nullptr;
 //------------------------------------------------------------------------------
@@ -41,15 +40,17 @@ Toolbar::Toolbar()
 	, m_currentMode(ePanZoom)
 	, m_previousMode(ePanZoom)
 {
-	// So I think this should not be in a file, it should be linked in, maybe
-	// an XPM image like the eye dropper?
-
-	// Get Icons loaded into an OpenGL Texture
-	SDL_Surface* pImage = IMG_Load(".\\data\\buttons.png");
+	// Get Icons loaded into an OpenGL Texture, they're linked in (assets.h),
+	// so there's no file to go missing
+	SDL_RWops* pAsset = OpenAsset("buttons.png");
+	SDL_Surface* pImage = pAsset ? IMG_Load_RW(pAsset, 1) : nullptr;
 
 	if (pImage)
 	{
 		m_GLImage = SDL_GL_LoadTexture(pImage, m_UV);
+		ResourceTracker::AddTexture("Toolbar", m_GLImage,
+									SDL_GL_TextureSize(pImage->w),
+									SDL_GL_TextureSize(pImage->h));
 		SDL_FreeSurface(pImage);
 	}
 	else
@@ -71,6 +72,7 @@ Toolbar::~Toolbar()
 {
 	if (m_GLImage)
 	{
+		ResourceTracker::RemoveTexture(m_GLImage);
 		glDeleteTextures(1, &m_GLImage);
 		m_GLImage = 0;
 	}
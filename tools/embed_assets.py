@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+#
+# embed_assets - Writes source/assets_data.h, the data/ files that are
+# linked into the executable, as byte arrays, and the table FindAsset
+# looks them up in
+#
+# The vcxproj runs this as a custom build step, whenever one of the files
+# (or this script) is newer than assets_data.h.  To add an asset, add it
+# to ASSETS here, and to the step's inputs in d16.vcxproj.
+#
+# usage: embed_assets.py [output]
+#
+import os
+import sys
+
+ASSETS = [
+	"ShastonHi640.ttf",
+	"buttons.png",
+]
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+
+#------------------------------------------------------------------------------
+
+def ArrayName(name):
+	return "".join(ch if ch.isalnum() else "_" for ch in name)
+
+def WriteArray(out, name, data):
+	out.append("// data/%s, %d bytes" % (name, len(data)))
+	out.append("static const unsigned char %s[] = {" % ArrayName(name))
+	for offset in range(0, len(data), 16):
+		out.append("  " + " ".join("0x%02x," % byte for byte in data[offset:offset + 16]))
+	out.append("};")
+	out.append("")
+
+#------------------------------------------------------------------------------
+
+def main(argv):
+	output = argv[1] if len(argv) > 1 else os.path.join(ROOT, "source", "assets_data.h")
+
+	out = [
+		"//",
+		"// Assets Data - generated by tools/embed_assets.py from the files in",
+		"// data/, don't edit it, run the script",
+		"//",
+		"",
+	]
+
+	for name in ASSETS:
+		with open(os.path.join(ROOT, "data", name), "rb") as file:
+			WriteArray(out, name, file.read())
+
+	out.append("//------------------------------------------------------------------------------")
+	out.append("")
+	out.append("static const Asset s_assets[] =")
+	out.append("{")
+	for name in ASSETS:
+		out.append("\t{ \"%s\", %s, sizeof(%s) }," % (name, ArrayName(name), ArrayName(name)))
+	out.append("};")
+	out.append("")
+
+	text = "\n".join(out)
+
+	# Leave the file alone if nothing changed, so it doesn't rebuild assets.cpp
+	try:
+		with open(output, "r", newline="") as file:
+			if file.read() == text:
+				return 0
+	except OSError:
+		pass
+
+	with open(output, "w", newline="") as file:
+		file.write(text)
+
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main(sys.argv))